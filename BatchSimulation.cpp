@@ -0,0 +1,918 @@
+/**
+*  File:  BatchSimulation.cpp
+*
+*  Description:  This file contains the method implementations for the BatchSimulation
+*                class.  Most steps work on four lanes at a time and loop over the
+*                BATCH_LANES/4 groups.  Where LevelSimulation has an if-statement,
+*                this version computes a lane mask and only changes the lanes whose
+*                mask is set, so every lane follows its own path through the rules.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "BatchSimulation.h"
+#include <string.h>  // For memset().
+
+const int FIELD_COUNT = 22;  // Number of per-slot int arrays allocated in one block (the four 16-bit arrays take two).
+
+/**
+*  Function: BatchSimulation(int bubbles, const SimConfig & simConfig)
+*
+*  Purpose: This is the constructor for the BatchSimulation class.  It allocates
+*           one aligned block of memory for all of the per-slot arrays.  Every
+*           lane must be given a layout with generate() before calling tick().
+*
+*  Inputs: bubbles - The number of normal bubbles in each lane's level.
+*          simConfig - The arena and bubble sizes used by every lane.
+*/
+
+BatchSimulation::BatchSimulation(int bubbles, const SimConfig & simConfig)
+{
+	config = simConfig;
+	bubbleCount = bubbles;
+	slotCount = bubbles + 1;
+	tickCount = 0;
+
+	size_t fieldSize = (size_t)slotCount * BATCH_LANES * sizeof(int);
+
+	block = alignedAlloc( fieldSize * FIELD_COUNT, SIMD_ALIGNMENT );
+	memset( block, 0, fieldSize * FIELD_COUNT );
+
+	char * p = (char *)block;
+
+	x = (float *)p;            p += fieldSize;
+	y = (float *)p;            p += fieldSize;
+	stepX = (float *)p;        p += fieldSize;
+	stepY = (float *)p;        p += fieldSize;
+	centerX = (int *)p;        p += fieldSize;
+	centerY = (int *)p;        p += fieldSize;
+	radius = (int *)p;         p += fieldSize;
+	maxRadius = (int *)p;      p += fieldSize;
+	degrees = (int *)p;        p += fieldSize;
+	holdCounter = (int *)p;    p += fieldSize;
+	paused = (int *)p;         p += fieldSize;
+	popping = (int *)p;        p += fieldSize;
+	expanding = (int *)p;      p += fieldSize;
+	holding = (int *)p;        p += fieldSize;
+	contracting = (int *)p;    p += fieldSize;
+
+	// The per-lane values only need BATCH_LANES ints each, but taking them
+	// from the same block keeps them aligned for vLoad().
+	active = (int *)p;                p += fieldSize;
+	userBubbleCreated = (int *)p;     p += fieldSize;
+	chainReactionStarted = (int *)p;  p += fieldSize;
+	currentPopping = (int *)p;        p += fieldSize;
+	levelPoints = (int *)p;           p += fieldSize;
+
+	targetX = (short *)p;       p += fieldSize / 2;
+	targetY = (short *)p;       p += fieldSize / 2;
+	targetRadius = (short *)p;  p += fieldSize / 2;
+	targetOpen = (short *)p;
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		laneTick[lane] = 0;
+		clickTick[lane] = -1;
+		clickX[lane] = 0;
+		clickY[lane] = 0;
+		doneTick[lane] = -1;
+		active[lane] = 0;
+		checksums[lane] = NULL;
+	}
+}
+
+/**
+*  Function: ~BatchSimulation()
+*
+*  Purpose: This is the destructor for the BatchSimulation class.  It frees the
+*           block of memory allocated by the constructor.
+*/
+
+BatchSimulation::~BatchSimulation()
+{
+	alignedFree( block );
+}
+
+/**
+*  Function: generate(int lane, uint32 seed)
+*
+*  Purpose: This function lays out one lane's level.  It uses LevelSimulation to
+*           build the layout, so a lane always starts exactly like a LevelSimulation
+*           given the same seed.  It may be called for a finished lane at any time
+*           without disturbing the other lanes.
+*
+*  Inputs: lane - The lane to fill (0 to BATCH_LANES-1).
+*          seed - The seed for the layout.
+*/
+
+void BatchSimulation::generate(int lane, uint32 seed)
+{
+	LevelSimulation level;
+	level.setConfig( config );
+	level.generate( seed, bubbleCount );
+
+	for ( int slot = 0; slot < slotCount; ++slot )
+	{
+		int k = slot*BATCH_LANES + lane;
+
+		if ( slot < bubbleCount )
+		{
+			const SimBubble & b = level.getBubble( slot );
+
+			x[k] = b.x;
+			y[k] = b.y;
+			stepX[k] = b.stepX;
+			stepY[k] = b.stepY;
+			centerX[k] = b.centerX;
+			centerY[k] = b.centerY;
+			radius[k] = b.radius;
+			maxRadius[k] = b.maxRadius;
+			degrees[k] = b.degrees;
+			holdCounter[k] = b.holdCounter;
+			paused[k] = b.paused ? -1 : 0;
+			popping[k] = b.popping ? -1 : 0;
+			expanding[k] = b.expanding ? -1 : 0;
+			holding[k] = b.holding ? -1 : 0;
+			contracting[k] = b.contracting ? -1 : 0;
+		}
+		else  // The user bubble's slot stays empty (radius 0, paused) until the click.
+		{
+			x[k] = 0.0f;
+			y[k] = 0.0f;
+			stepX[k] = 0.0f;
+			stepY[k] = 0.0f;
+			centerX[k] = 0;
+			centerY[k] = 0;
+			radius[k] = 0;
+			maxRadius[k] = 0;
+			degrees[k] = 0;
+			holdCounter[k] = 0;
+			paused[k] = -1;
+			popping[k] = 0;
+			expanding[k] = 0;
+			holding[k] = 0;
+			contracting[k] = 0;
+		}
+	}
+
+	active[lane] = -1;
+	userBubbleCreated[lane] = 0;
+	chainReactionStarted[lane] = 0;
+	currentPopping[lane] = 0;
+	levelPoints[lane] = 0;
+	laneTick[lane] = 0;
+	clickTick[lane] = -1;
+	doneTick[lane] = -1;
+}
+
+/**
+*  Function: setClick(int lane, int tick, int cX, int cY)
+*
+*  Purpose: This function schedules the user's click for a lane.  The click is
+*           handled at the start of the given tick, counted from when the lane was
+*           generated, just like calling LevelSimulation::click() right before
+*           that tick.
+*
+*  Inputs: lane - The lane that clicks.
+*          tick - The frame number of the click.
+*          cX, cY - Where the user clicks.
+*/
+
+void BatchSimulation::setClick(int lane, int tick, int cX, int cY)
+{
+	clickTick[lane] = tick;
+	clickX[lane] = cX;
+	clickY[lane] = cY;
+}
+
+/**
+*  Function: retire(int lane)
+*
+*  Purpose: This function masks out a lane that has no more games to play, or
+*           whose game has run too long.  The lane keeps its state and stops
+*           changing until generate() is called for it again.
+*
+*  Inputs: lane - The lane to retire.
+*/
+
+void BatchSimulation::retire(int lane)
+{
+	active[lane] = 0;
+}
+
+/**
+*  Function: setChecksumStream(int lane, ChecksumStream * stream)
+*
+*  Purpose: This function starts or stops recording a checksum of one lane's
+*           state after each of its frames, the same as
+*           LevelSimulation::setChecksumStream().  A finished lane adds nothing.
+*
+*  Inputs: lane - The lane.
+*          stream - The stream to add to, or NULL to stop recording.
+*/
+
+void BatchSimulation::setChecksumStream(int lane, ChecksumStream * stream)
+{
+	checksums[lane] = stream;
+}
+
+/**
+*  Function: tick()
+*
+*  Purpose: This function advances every lane by one frame, in the same order
+*           as LevelSimulation::tick().
+*/
+
+void BatchSimulation::tick()
+{
+	int ticking[BATCH_LANES];
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		ticking[lane] = active[lane];
+	}
+
+	detectUserClicks();
+	detectBoundaryCollisions();
+	popUserBubbles();
+	popBubbles();
+	moveBubbles();
+	detectBubbleCollisions();
+	checkChainReactions();
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		if ( ticking[lane] && checksums[lane] != NULL )
+		{
+			uint64 * bubbleHashes = NULL;
+
+			if ( checksums[lane]->getBubbleHashes() )
+			{
+				bubbleChecksums.resize( slotCount );
+				bubbleHashes = & bubbleChecksums[0];
+			}
+
+			int bubbles = userBubbleCreated[lane] ? slotCount : bubbleCount;
+
+			checksums[lane]->addTick( hashLane( lane, bubbleHashes ), bubbleHashes, bubbles );
+		}
+
+		if ( active[lane] )
+		{
+			laneTick[lane]++;
+		}
+	}
+
+	tickCount++;
+}
+
+/**
+*  Function: resolve(int maxTicks)
+*
+*  Purpose: This function keeps ticking until every lane's chain reaction is
+*           over, or until maxTicks frames have been simulated.
+*
+*  Inputs: maxTicks - The most frames to simulate.
+*
+*  Returns: The number of frames simulated by this call.
+*/
+
+int BatchSimulation::resolve(int maxTicks)
+{
+	int ticks = 0;
+
+	while ( allLanesDone() == false && ticks < maxTicks )
+	{
+		tick();
+		ticks++;
+	}
+
+	return ticks;
+}
+
+/**
+*  Function: popQuad(int slot, int q, vint mask)
+*
+*  Purpose: This is simPop() for one slot in the four lanes starting
+*           at lane q.  Each if-statement of simPop(), simExpand(), simHold() and simContract()
+*           becomes a mask, and a value is only changed where its mask is set.
+*
+*  Inputs: slot - The bubble slot to pop.
+*          q - The first of the four lanes.
+*          mask - Which of the four lanes to pop.
+*/
+
+void BatchSimulation::popQuad(int slot, int q, vint mask)
+{
+	const vint zero = vSet( 0 );
+	const vint holdTicks = vSet( POP_HOLD_TICKS );
+
+	int k = slot*BATCH_LANES + q;
+
+	vint pop = vAnd( mask, vLoad( popping + k ) );
+
+	if ( !vAny( pop ) )
+	{
+		return;
+	}
+
+	vint r = vLoad( radius + k );
+	vint maxR = vLoad( maxRadius + k );
+	vint e = vLoad( expanding + k );
+	vint h = vLoad( holding + k );
+	vint c = vLoad( contracting + k );
+	vint counter = vLoad( holdCounter + k );
+
+	vint atMax = vAnd( pop, vCmpEq( r, maxR ) );           // if ( getRadius() == maxRadius )
+	e = vAndNot( atMax, e );                                //     expanding = false;
+	h = vOr( h, atMax );                                    //     holding = true;
+
+	vint grow = vAnd( vAnd( pop, e ), vCmpLt( r, maxR ) );  // if ( expanding && getRadius() < maxRadius )
+	r = vSub( r, grow );                                    //     expand();
+
+	vint hold = vAnd( pop, h );                             // if ( holding )
+	vint below = vCmpLt( counter, holdTicks );              //     if ( holdCounter < 90 )
+	counter = vSub( counter, vAnd( hold, below ) );         //         holdCounter++;
+	vint release = vAndNot( below, hold );                  //     else
+	h = vAndNot( release, h );                              //         holding = false;
+	c = vOr( c, release );                                  //         contracting = true;
+
+	vint shrink = vAnd( vAnd( pop, c ), vCmpGt( r, zero ) );  // if ( contracting && getRadius() > 0 )
+	r = vAdd( r, shrink );                                    //     contract();
+
+	vint done = vAnd( shrink, vCmpEq( r, zero ) );  // if ( getRadius() == 0 && popping )
+
+	vStore( radius + k, r );
+	vStore( expanding + k, e );
+	vStore( holding + k, h );
+	vStore( contracting + k, c );
+	vStore( holdCounter + k, counter );
+	vStore( popping + k, vAndNot( done, vLoad( popping + k ) ) );
+	vStore( currentPopping + q, vAdd( vLoad( currentPopping + q ), done ) );
+}
+
+/**
+*  Function: popSlot(int slot, const int * laneMask)
+*
+*  Purpose: This is simPop() for one slot in every lane whose mask is set.
+*
+*  Inputs: slot - The bubble slot to pop.
+*          laneMask - BATCH_LANES masks saying which lanes to pop.
+*/
+
+void BatchSimulation::popSlot(int slot, const int * laneMask)
+{
+	for ( int q = 0; q < BATCH_LANES; q += 4 )
+	{
+		popQuad( slot, q, vLoadU( laneMask + q ) );
+	}
+}
+
+/**
+*  Function: detectUserClicks()
+*
+*  Purpose: This is detectUserClick() for every lane.  Clicks are rare, so each
+*           lane is checked on its own.
+*/
+
+void BatchSimulation::detectUserClicks()
+{
+	int clicked[BATCH_LANES];
+	bool anyClicked = false;
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		clicked[lane] = 0;
+
+		if ( active[lane] && userBubbleCreated[lane] == 0 && clickTick[lane] == laneTick[lane] )
+		{
+			int k = bubbleCount*BATCH_LANES + lane;
+
+			float sX, sY;
+			simHeadingStep( 0, sX, sY );
+
+			x[k] = (float)clickX[lane];
+			y[k] = (float)clickY[lane];
+			stepX[k] = sX;
+			stepY[k] = sY;
+			centerX[k] = clickX[lane];
+			centerY[k] = clickY[lane];
+			radius[k] = config.bubbleRadius;
+			maxRadius[k] = config.bubbleRadius + config.popExpansion;
+			degrees[k] = 0;
+			holdCounter[k] = 0;
+			paused[k] = -1;
+			popping[k] = -1;
+			expanding[k] = -1;
+			holding[k] = 0;
+			contracting[k] = 0;
+
+			userBubbleCreated[lane] = -1;
+			chainReactionStarted[lane] = -1;
+			clicked[lane] = -1;
+			anyClicked = true;
+		}
+	}
+
+	if ( anyClicked )
+	{
+		popSlot( bubbleCount, clicked );
+
+		for ( int lane = 0; lane < BATCH_LANES; lane++ )
+		{
+			if ( clicked[lane] )
+			{
+				currentPopping[lane]++;
+			}
+		}
+	}
+}
+
+/**
+*  Function: detectBoundaryCollisions()
+*
+*  Purpose: This is detectBoundaryCollisions() and boundaryCollisionCheck() for every
+*           lane.  A bounce off the left or right wall flips the sign of stepX, and
+*           a bounce off the top or bottom wall flips the sign of stepY.
+*/
+
+void BatchSimulation::detectBoundaryCollisions()
+{
+	const vint zero = vSet( 0 );
+	const vint width = vSet( config.arenaWidth );
+	const vint height = vSet( config.arenaHeight );
+	const vint deg360 = vSet( 360 );
+	const vint deg180 = vSet( 180 );
+
+	for ( int slot = 0; slot < bubbleCount; slot++ )  // The user bubble is never tested.
+	{
+		for ( int q = 0; q < BATCH_LANES; q += 4 )
+		{
+			int k = slot*BATCH_LANES + q;
+
+			vint m = vAndNot( vLoad( popping + k ), vLoad( active + q ) );
+
+			if ( !vAny( m ) )
+			{
+				continue;
+			}
+
+			vint cX = vLoad( centerX + k );
+			vint cY = vLoad( centerY + k );
+			vint r = vLoad( radius + k );
+			vint d = vLoad( degrees + k );
+			vfloat sX = vLoadF( stepX + k );
+			vfloat sY = vLoadF( stepY + k );
+
+			vint right = vAndNot( vCmpLt( vAdd( cX, r ), width ), m );   // centerX + radius >= arenaWidth
+			d = vSelect( right, vSub( deg360, d ), d );
+			sX = vFlipSignF( right, sX );
+
+			vint left = vAndNot( vCmpGt( vSub( cX, r ), zero ), m );     // centerX - radius <= 0
+			d = vSelect( left, vSub( deg360, d ), d );
+			sX = vFlipSignF( left, sX );
+
+			vint top = vAndNot( vCmpGt( vSub( cY, r ), zero ), m );      // centerY - radius <= 0
+			d = vSelect( top, vSub( deg180, d ), d );
+			sY = vFlipSignF( top, sY );
+
+			vint bottom = vAndNot( vCmpLt( vAdd( cY, r ), height ), m ); // centerY + radius >= arenaHeight
+			d = vSelect( bottom, vSub( deg180, d ), d );
+			sY = vFlipSignF( bottom, sY );
+
+			vStore( degrees + k, d );
+			vStoreF( stepX + k, sX );
+			vStoreF( stepY + k, sY );
+		}
+	}
+}
+
+/**
+*  Function: popUserBubbles()
+*
+*  Purpose: This is popUserBubble() for every lane that has clicked.
+*/
+
+void BatchSimulation::popUserBubbles()
+{
+	int laneMask[BATCH_LANES];
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		laneMask[lane] = active[lane] & userBubbleCreated[lane];
+	}
+
+	popSlot( bubbleCount, laneMask );
+}
+
+/**
+*  Function: popBubbles()
+*
+*  Purpose: This is popBubbles() for every lane.
+*/
+
+void BatchSimulation::popBubbles()
+{
+	for ( int slot = 0; slot < slotCount; slot++ )
+	{
+		popSlot( slot, active );
+	}
+}
+
+/**
+*  Function: moveBubbles()
+*
+*  Purpose: This is moveBubbles() for every lane.  Lanes that should not move
+*           add zero, which leaves their position exactly as it was.
+*/
+
+void BatchSimulation::moveBubbles()
+{
+	for ( int slot = 0; slot < slotCount; slot++ )
+	{
+		for ( int q = 0; q < BATCH_LANES; q += 4 )
+		{
+			int k = slot*BATCH_LANES + q;
+
+			vint m = vAndNot( vLoad( paused + k ), vLoad( active + q ) );
+
+			if ( !vAny( m ) )
+			{
+				continue;
+			}
+
+			vfloat newX = vAddF( vLoadF( x + k ), vMaskF( m, vLoadF( stepX + k ) ) );
+			vfloat newY = vAddF( vLoadF( y + k ), vMaskF( m, vLoadF( stepY + k ) ) );
+
+			vStoreF( x + k, newX );
+			vStoreF( y + k, newY );
+			vStore( centerX + k, vTruncate( newX ) );
+			vStore( centerY + k, vTruncate( newY ) );
+		}
+	}
+}
+
+/**
+*  Function: nextPopper(int lane, int slot)
+*
+*  Purpose: This function finds the next popping bubble in a lane, the same way
+*           the outer loop of LevelSimulation::detectBubbleCollisions() moves on to
+*           the next bubble whose popping flag is set.
+*
+*  Inputs: lane - The lane to search.
+*          slot - The slot to search after (-1 to start from the beginning).
+*
+*  Returns: The slot of the next popping bubble, or -1 if there are no more.
+*/
+
+int BatchSimulation::nextPopper(int lane, int slot) const
+{
+	for ( int s = slot+1; s < slotCount; s++ )
+	{
+		if ( popping[s*BATCH_LANES + lane] )
+		{
+			return s;
+		}
+	}
+
+	return -1;
+}
+
+/**
+*  Function: packTargets()
+*
+*  Purpose: This function fills in the 16-bit copies of the bubble centers and radii
+*           used by the quick test in detectBubbleCollisions(), eight lanes to a
+*           register.  targetOpen is -1 where a slot can still be hit (it is not
+*           popping and its radius is not 0).
+*/
+
+void BatchSimulation::packTargets()
+{
+	const vint zero = vSet( 0 );
+
+	for ( int slot = 0; slot < slotCount; slot++ )
+	{
+		for ( int g = 0; g < BATCH_LANES; g += 8 )
+		{
+			int k = slot*BATCH_LANES + g;
+
+			vint openLow = vAndNot( vOr( vLoad( popping + k ), vCmpEq( vLoad( radius + k ), zero ) ), vSet( -1 ) );
+			vint openHigh = vAndNot( vOr( vLoad( popping + k + 4 ), vCmpEq( vLoad( radius + k + 4 ), zero ) ), vSet( -1 ) );
+
+			vStore16( targetOpen + k, vPack16( openLow, openHigh ) );
+			vStore16( targetX + k, vPack16( vLoad( centerX + k ), vLoad( centerX + k + 4 ) ) );
+			vStore16( targetY + k, vPack16( vLoad( centerY + k ), vLoad( centerY + k + 4 ) ) );
+			vStore16( targetRadius + k, vPack16( vLoad( radius + k ), vLoad( radius + k + 4 ) ) );
+		}
+	}
+}
+
+/**
+*  Function: detectBubbleCollisions()
+*
+*  Purpose: This is detectBubbleCollisions() and bubbleCollisionCheck() for every
+*           lane.  In each lane the popping bubbles are visited in the same order
+*           as the bubbles vector, so a bubble that is hit can go on to hit others
+*           in the same frame, exactly as it does in the game.
+*
+*           The lanes do not wait for each other: on each step every lane takes
+*           its own next popping bubble (usually a different slot in each lane),
+*           and it is tested against all of the slots of that lane at once.  That
+*           keeps the lanes busy even though different games have different
+*           bubbles popping.
+*
+*           Most slots are nowhere near the popper, so each slot is first given a
+*           quick 16-bit bounding box test in eight lanes at once.  Only the lanes
+*           that pass it get the real test, where the squared distance is worked
+*           out in floats (exact for any distance on the screen).
+*/
+
+void BatchSimulation::detectBubbleCollisions()
+{
+	bool anyClicked = false;
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		if ( active[lane] && userBubbleCreated[lane] )
+		{
+			anyClicked = true;
+		}
+	}
+
+	if ( anyClicked == false )  // Nothing can be popping yet.
+	{
+		return;
+	}
+
+	packTargets();
+
+	const vshort zero16 = vSet16( 0 );
+
+	for ( int g = 0; g < BATCH_LANES; g += 8 )
+	{
+		int popper[8];
+		bool anyPopper = false;
+
+		for ( int l = 0; l < 8; l++ )
+		{
+			popper[l] = -1;
+
+			if ( active[g+l] && userBubbleCreated[g+l] )
+			{
+				popper[l] = nextPopper( g+l, -1 );
+				anyPopper = anyPopper || popper[l] >= 0;
+			}
+		}
+
+		while ( anyPopper )
+		{
+			// Gather each lane's current popper.  A popper can never be hit, so these
+			// values stay the same while the slots are tested against it.
+			int pX[8], pY[8], pR[8], pMask[8];
+			short pX16[8], pY16[8], pR16[8], pMask16[8];
+
+			for ( int l = 0; l < 8; l++ )
+			{
+				int k = popper[l]*BATCH_LANES + g + l;
+
+				pMask[l] = popper[l] >= 0 ? -1 : 0;
+				pX[l] = popper[l] >= 0 ? centerX[k] : 0;
+				pY[l] = popper[l] >= 0 ? centerY[k] : 0;
+				pR[l] = popper[l] >= 0 ? radius[k] : 0;
+
+				pMask16[l] = (short)pMask[l];
+				pX16[l] = (short)pX[l];
+				pY16[l] = (short)pY[l];
+				pR16[l] = (short)pR[l];
+			}
+
+			vshort lanes16 = vLoadU16( pMask16 );
+			vshort xI16 = vLoadU16( pX16 );
+			vshort yI16 = vLoadU16( pY16 );
+			vshort rI16 = vLoadU16( pR16 );
+
+			for ( int j = 0; j < slotCount; j++ )
+			{
+				int kj = j*BATCH_LANES + g;
+
+				vshort open = vAnd16( lanes16, vLoad16( targetOpen + kj ) );
+
+				if ( !vAny16( open ) )
+				{
+					continue;
+				}
+
+				vshort dX = vSub16( xI16, vLoad16( targetX + kj ) );
+				vshort dY = vSub16( yI16, vLoad16( targetY + kj ) );
+				vshort totalRadius = vAdd16( rI16, vLoad16( targetRadius + kj ) );
+
+				vshort far = vOr16( vCmpGt16( vMax16( dX, vSub16( zero16, dX ) ), totalRadius ),
+				                    vCmpGt16( vMax16( dY, vSub16( zero16, dY ) ), totalRadius ) );
+				vshort near = vAndNot16( far, open );
+
+				if ( !vAny16( near ) )
+				{
+					continue;
+				}
+
+				for ( int half = 0; half < 2; half++ )
+				{
+					int q = g + half*4;
+					int k = j*BATCH_LANES + q;
+
+					vint m = half == 0 ? vWidenLow16( near ) : vWidenHigh16( near );
+
+					if ( !vAny( m ) )
+					{
+						continue;
+					}
+
+					vfloat dXF = vSubF( vToFloat( vLoadU( pX + half*4 ) ), vToFloat( vLoad( centerX + k ) ) );
+					vfloat dYF = vSubF( vToFloat( vLoadU( pY + half*4 ) ), vToFloat( vLoad( centerY + k ) ) );
+					vfloat totalRadiusF = vToFloat( vAdd( vLoadU( pR + half*4 ), vLoad( radius + k ) ) );
+
+					vfloat distance2 = vAddF( vMulF( dXF, dXF ), vMulF( dYF, dYF ) );
+					vint touching = vAnd( m, vCmpLeF( distance2, vMulF( totalRadiusF, totalRadiusF ) ) );
+
+					if ( !vAny( touching ) )
+					{
+						continue;
+					}
+
+					vStore( currentPopping + q, vSub( vLoad( currentPopping + q ), touching ) );
+					vStore( levelPoints + q, vSub( vLoad( levelPoints + q ), touching ) );
+					vStore( paused + k, vOr( vLoad( paused + k ), touching ) );
+					vStore( popping + k, vOr( vLoad( popping + k ), touching ) );
+
+					popQuad( j, q, touching );
+				}
+
+				// The slots that were hit are popping now, so they can't be hit again.
+				vStore16( targetOpen + kj, vAndNot16( vPack16( vLoad( popping + kj ), vLoad( popping + kj + 4 ) ), vLoad16( targetOpen + kj ) ) );
+			}
+
+			anyPopper = false;
+
+			for ( int l = 0; l < 8; l++ )
+			{
+				if ( popper[l] >= 0 )
+				{
+					popper[l] = nextPopper( g+l, popper[l] );
+					anyPopper = anyPopper || popper[l] >= 0;
+				}
+			}
+		}
+	}
+}
+
+/**
+*  Function: checkChainReactions()
+*
+*  Purpose: This function ends each lane whose chain reaction is over.  The lane's
+*           mask is cleared, so it keeps its final state while the others go on.
+*/
+
+void BatchSimulation::checkChainReactions()
+{
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		if ( active[lane] && chainReactionStarted[lane] && currentPopping[lane] == 0 )
+		{
+			active[lane] = 0;
+			doneTick[lane] = laneTick[lane];
+
+			for ( int slot = 0; slot < slotCount; slot++ )  // Every bubble stops moving.
+			{
+				paused[slot*BATCH_LANES + lane] = -1;
+			}
+		}
+	}
+}
+
+/**
+*  Function: allLanesDone()
+*
+*  Returns: True when every lane's chain reaction is over.
+*/
+
+bool BatchSimulation::allLanesDone() const
+{
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		if ( active[lane] )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+*  Function: getLaneDone(int lane)
+*
+*  Returns: True when the lane's chain reaction is over.
+*/
+
+bool BatchSimulation::getLaneDone(int lane) const
+{
+	return active[lane] == 0;
+}
+
+/**
+*  Function: getDoneTick(int lane)
+*
+*  Returns: The frame on which the lane's chain reaction ended, or -1 if it has not.
+*/
+
+int BatchSimulation::getDoneTick(int lane) const
+{
+	return doneTick[lane];
+}
+
+/**
+*  Function: getLevelPoints(int lane)
+*
+*  Returns: The number of bubbles popped in the lane so far.
+*/
+
+int BatchSimulation::getLevelPoints(int lane) const
+{
+	return levelPoints[lane];
+}
+
+/**
+*  Function: getLaneTick(int lane)
+*
+*  Returns: The number of frames the lane has simulated since it was generated.
+*/
+
+int BatchSimulation::getLaneTick(int lane) const
+{
+	return laneTick[lane];
+}
+
+/**
+*  Function: getTickCount()
+*
+*  Returns: The number of times tick() has been called.
+*/
+
+int BatchSimulation::getTickCount() const
+{
+	return tickCount;
+}
+
+/**
+*  Function: checksum(int lane)
+*
+*  Returns: A 64-bit hash of the lane's state.  It is the same as
+*           LevelSimulation::checksum() for the same game at the same frame.
+*/
+
+uint64 BatchSimulation::checksum(int lane) const
+{
+	return hashLane( lane, NULL );
+}
+
+/**
+*  Function: hashLane(int lane, uint64 * bubbleHashes)
+*
+*  Purpose: This function hashes each bubble of a lane and the lane's totals,
+*           the same way as LevelSimulation::hashState().  The user bubble's
+*           slot only counts once it has been created.
+*
+*  Inputs: lane - The lane.
+*          bubbleHashes - If not NULL, each bubble's hash is stored here.
+*
+*  Returns: The level hash.
+*/
+
+uint64 BatchSimulation::hashLane(int lane, uint64 * bubbleHashes) const
+{
+	int bubbles = userBubbleCreated[lane] ? slotCount : bubbleCount;
+	uint64 sum = 0;
+
+	for ( int slot = 0; slot < bubbles; slot++ )
+	{
+		int k = slot*BATCH_LANES + lane;
+
+		int flags = ( paused[k] & CHECKSUM_PAUSED ) | ( popping[k] & CHECKSUM_POPPING ) |
+			        ( expanding[k] & CHECKSUM_EXPANDING ) | ( holding[k] & CHECKSUM_HOLDING ) |
+			        ( contracting[k] & CHECKSUM_CONTRACTING );
+
+		uint64 hash = checksumBubble( slot, x[k], y[k], stepX[k], stepY[k], radius[k], degrees[k], holdCounter[k], flags );
+
+		if ( bubbleHashes != NULL )
+		{
+			bubbleHashes[slot] = hash;
+		}
+
+		sum += hash;
+	}
+
+	return checksumFinish( sum, levelPoints[lane], currentPopping[lane] );
+}
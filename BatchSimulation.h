@@ -0,0 +1,113 @@
+/**
+*  File:  BatchSimulation.h
+*
+*  Description:  This header file contains the class definition for BatchSimulation,
+*                which plays out BATCH_LANES separate copies of the same level at
+*                once.  Each SIMD lane holds a different game (its own seed and its
+*                own click), and every step of the main game loop is done for all
+*                of the lanes together with SSE2 instructions.
+*
+*                The bubble fields are stored slot by slot, with the BATCH_LANES
+*                copies of a field next to each other, so one load picks up the
+*                same bubble from four games.  Lanes whose chain reaction is over
+*                are masked out and stop changing, and a finished lane can be given
+*                a new game with generate() while the others carry on, so no lane
+*                sits idle waiting for the slowest game in the batch.
+*
+*                The results are exactly the same as running each lane through
+*                LevelSimulation one at a time.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef BATCH_SIMULATION_H_
+#define BATCH_SIMULATION_H_
+
+#include "Simulation.h"
+#include "Simd.h"
+
+const int BATCH_LANES = 8;  // Must be a multiple of 8 (the width of an SSE register in 16-bit lanes).
+
+class BatchSimulation
+{
+private:
+	SimConfig config;
+	int bubbleCount;   // Normal bubbles in each lane.  The user bubble goes in the slot after them.
+	int slotCount;
+	int tickCount;
+
+	float * x;
+	float * y;
+	float * stepX;
+	float * stepY;
+	int * centerX;
+	int * centerY;
+	int * radius;
+	int * maxRadius;
+	int * degrees;
+	int * holdCounter;
+	int * paused;       // The flags are lane masks: -1 for true and 0 for false.
+	int * popping;
+	int * expanding;
+	int * holding;
+	int * contracting;
+
+	int * active;       // -1 while the lane's chain reaction is still going.
+	int * userBubbleCreated;
+	int * chainReactionStarted;
+	int * currentPopping;
+	int * levelPoints;
+
+	short * targetX;    // 16-bit copies for the quick collision test.  See packTargets().
+	short * targetY;
+	short * targetRadius;
+	short * targetOpen;
+
+	int laneTick[BATCH_LANES];
+	int clickTick[BATCH_LANES];
+	int clickX[BATCH_LANES];
+	int clickY[BATCH_LANES];
+	int doneTick[BATCH_LANES];
+
+	ChecksumStream * checksums[BATCH_LANES];  // NULL for lanes whose checksums aren't being recorded.
+	vector <uint64> bubbleChecksums;
+
+	void * block;
+
+	BatchSimulation(const BatchSimulation &);
+	BatchSimulation & operator=(const BatchSimulation &);
+
+	void popQuad(int slot, int q, vint mask);
+	void popSlot(int slot, const int * laneMask);
+	int nextPopper(int lane, int slot) const;
+	void packTargets();
+	uint64 hashLane(int lane, uint64 * bubbleHashes) const;
+
+public:
+	BatchSimulation(int bubbles, const SimConfig & simConfig = SimConfig());
+	~BatchSimulation();
+	void generate(int lane, uint32 seed);
+	void setClick(int lane, int tick, int cX, int cY);
+	void retire(int lane);
+	void setChecksumStream(int lane, ChecksumStream * stream);
+	void tick();
+	int resolve(int maxTicks);
+	void detectUserClicks();
+	void detectBoundaryCollisions();
+	void popUserBubbles();
+	void popBubbles();
+	void moveBubbles();
+	void detectBubbleCollisions();
+	void checkChainReactions();
+	bool allLanesDone() const;
+	bool getLaneDone(int lane) const;
+	int getDoneTick(int lane) const;
+	int getLevelPoints(int lane) const;
+	int getLaneTick(int lane) const;
+	int getTickCount() const;
+	uint64 checksum(int lane) const;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**
+*  File:  BubbleCircles.cpp
+*
+*  Description:  This file contains the circle styles of the bubbles' color
+*                families and shadeCircle(), which the circles are drawn with
+*                (BubbleCircles.h).
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "BubbleCircles.h"
+#include "Simd.h"
+
+/**
+*  The families' fills are the colors of their images; the rims are those
+*  colors halfway to white.  They are in the order of the families in
+*  BUBBLE_IMAGES (FrontEnd.h), then the user bubble's.
+*/
+
+const CircleStyle BUBBLE_CIRCLE_STYLES[BUBBLE_CIRCLES] =
+{
+	{ 0xd20000, 0xe67373, 255 },  // Red
+	{ 0x802298, 0xb985c6, 255 },  // Purple
+	{ 0x538cdd, 0xa0c0ec, 255 },  // Blue
+	{ 0x4ccb79, 0x9de2b5, 255 },  // Green
+	{ 0xe09450, 0xeec49f, 255 },  // Brown
+	{ 0xff8a00, 0xffbf73, 255 },  // Orange
+	{ 0xfed800, 0xfeea73, 255 },  // Yellow
+	{ 0xc5b5a6, 0xdfd6ce, 255 },  // Tan
+	{ 0x778899, 0xb4bec7, 255 },  // Gray
+	{ 0xfb48ad, 0xfd9ad2, 255 },  // Pink
+	{ 0xffffff, 0xc8dcff, 255 }   // The user bubble.
+};
+
+// Where each family's images start in BUBBLE_IMAGES, and where they end.
+static const int FAMILY_FIRST_IMAGES[BUBBLE_FAMILIES+1] = { 0, 7, 11, 21, 30, 34, 42, 49, 53, 54, 60 };
+
+/**
+*  Function: getBubbleFamily(int imageIndex)
+*
+*  Purpose: This function finds the color family of one of the bubble images.
+*
+*  Inputs: imageIndex - Where the image is in BUBBLE_IMAGES (FrontEnd.h).
+*
+*  Returns: The family, from 0 to BUBBLE_FAMILIES-1, or -1 if imageIndex is
+*           out of range.
+*/
+
+int getBubbleFamily(int imageIndex)
+{
+	for ( int family = 0; family < BUBBLE_FAMILIES; family++ )
+	{
+		if ( imageIndex >= FAMILY_FIRST_IMAGES[family] && imageIndex < FAMILY_FIRST_IMAGES[family+1] )
+		{
+			return family;
+		}
+	}
+
+	return -1;
+}
+
+/**
+*  Function: shadeCircle(const CircleStyle & style, float radius, float x, float y, uint32 colors[4])
+*
+*  Purpose: This function works out the colors of 4 pixels in a row of a
+*           circle, all at once.  From each pixel center's distance to the edge
+*           d (negative inside), the pixel is covered by 0.5 - d of the circle,
+*           clamped to 0-1, which is its alpha; and it goes from the fill to
+*           the rim over the outer eighth or so of the radius, or the outer
+*           pixel of a small circle.
+*
+*  Inputs: style - The circle's colors.
+*          radius - Its radius, in pixels.
+*          x, y - The first pixel's center, relative to the circle's center.
+*                 The other 3 are to its right.
+*          colors - Where the 4 pixels go, 0xAARRGGBB.
+*/
+
+void shadeCircle(const CircleStyle & style, float radius, float x, float y, uint32 colors[4])
+{
+	const vfloat zero = vSetF( 0.0f );
+	const vfloat one = vSetF( 1.0f );
+	const vfloat half = vSetF( 0.5f );
+	float rimWidth = radius * 0.12f > 1.0f ? radius * 0.12f : 1.0f;
+
+	vfloat across = vSetF4( x, x+1.0f, x+2.0f, x+3.0f );
+	vfloat distance = vSubF( vSqrtF( vAddF( vMulF( across, across ), vSetF( y*y ) ) ), vSetF( radius ) );
+	vfloat coverage = vMinF( vMaxF( vSubF( half, distance ), zero ), one );
+	vfloat rim = vMinF( vMaxF( vMulF( vAddF( distance, vSetF( rimWidth ) ), vSetF( 1.0f / rimWidth ) ), zero ), one );
+
+	vint result = vTruncate( vAddF( vMulF( coverage, vSetF( (float)style.alpha ) ), half ) );
+	result = vShiftLeft( result, 8 );
+
+	for ( int shift = 16; shift >= 0; shift -= 8 )
+	{
+		float fill = (float)( ( style.fill >> shift ) & 0xff );
+		float edge = (float)( ( style.rim >> shift ) & 0xff );
+		vint channel = vTruncate( vAddF( vAddF( vSetF( fill ), vMulF( rim, vSetF( edge - fill ) ) ), half ) );
+
+		result = vOr( result, channel );
+
+		if ( shift > 0 )
+		{
+			result = vShiftLeft( result, 8 );
+		}
+	}
+
+	int packed[4];
+
+	vStoreU( packed, result );
+
+	for ( int i = 0; i < 4; i++ )
+	{
+		colors[i] = (uint32)packed[i];
+	}
+}
+
+/**
+*  Function: drawCircleImage(const CircleStyle & style, uint32 * pixels, int size)
+*
+*  Purpose: This function draws a circle filling a square image, for the
+*           renderers that draw images instead of circles.
+*
+*  Inputs: style - The circle's colors.
+*          pixels - The image, size*size pixels, top row first.
+*          size - Its width and height.
+*/
+
+void drawCircleImage(const CircleStyle & style, uint32 * pixels, int size)
+{
+	float radius = size * 0.5f;
+
+	for ( int y = 0; y < size; y++ )
+	{
+		for ( int x = 0; x < size; x += 4 )
+		{
+			uint32 colors[4];
+
+			shadeCircle( style, radius, x + 0.5f - radius, y + 0.5f - radius, colors );
+
+			for ( int i = 0; i < 4 && x+i < size; i++ )
+			{
+				pixels[y*size + x+i] = colors[i];
+			}
+		}
+	}
+}
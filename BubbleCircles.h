@@ -0,0 +1,148 @@
+/**
+*  File:  BubbleCircles.h
+*
+*  Description:  This header file contains the BubbleCircles class, which lets
+*                bubbles be drawn as circles instead of from their images.  A
+*                circle is worked out from each pixel's distance to its edge:
+*                the fill color of the bubble's color family (red, purple,
+*                blue, green, brown, orange, yellow, tan, gray or pink, as in
+*                MediaFilePaths.h), a lighter rim just inside the edge, and an
+*                edge that fades out over a pixel, so it is smooth at any
+*                radius (see shadeCircle()).
+*
+*                There is one circle image for each family, and one for the
+*                user bubble, made with the renderer's makeCircleImage().  The
+*                software renderer draws such an image's circle at whatever
+*                size the sprite is, a row span at a time, so nothing is kept
+*                for each bubble or each radius and the cost is the pixels the
+*                bubbles cover.  The other renderers get the circle drawn into
+*                an image CIRCLE_IMAGE_SIZE across, which they scale down.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef BUBBLE_CIRCLES_H_
+#define BUBBLE_CIRCLES_H_
+
+#include "Constants.h"
+
+/**
+*  A CircleStyle is how a circle is colored: its fill and its rim, 0xRRGGBB,
+*  and how opaque it is.
+*/
+
+struct CircleStyle
+{
+	uint32 fill;
+	uint32 rim;
+	int alpha;
+};
+
+const int BUBBLE_FAMILIES = 10;
+const int USER_BUBBLE_CIRCLE = BUBBLE_FAMILIES;  // After the families.
+const int BUBBLE_CIRCLES = BUBBLE_FAMILIES + 1;
+const int CIRCLE_IMAGE_SIZE = MAX_FRAME_RADIUS * 2;
+
+extern const CircleStyle BUBBLE_CIRCLE_STYLES[BUBBLE_CIRCLES];
+
+int getBubbleFamily(int imageIndex);
+void shadeCircle(const CircleStyle & style, float radius, float x, float y, uint32 colors[4]);
+void drawCircleImage(const CircleStyle & style, uint32 * pixels, int size);
+
+template <class Platform>
+class BubbleCircles
+{
+private:
+	Platform & platform;
+	bool made[BUBBLE_CIRCLES];
+
+public:
+	BubbleCircles(Platform & p);
+	~BubbleCircles();
+	int make(int circle);
+	void clear();
+};
+
+/**
+*  Function: BubbleCircles(Platform & p)
+*
+*  Purpose: This is the constructor for the BubbleCircles class.  No circle
+*           images are made until they are needed.
+*
+*  Inputs: p - The backend the images are made in.
+*/
+
+template <class Platform>
+BubbleCircles<Platform>::BubbleCircles(Platform & p)
+                       : platform(p)
+{
+	for ( int i = 0; i < BUBBLE_CIRCLES; i++ )
+	{
+		made[i] = false;
+	}
+}
+
+/**
+*  Function: ~BubbleCircles()
+*
+*  Purpose: This is the destructor for the BubbleCircles class.  It deletes
+*           the circle images.
+*/
+
+template <class Platform>
+BubbleCircles<Platform>::~BubbleCircles()
+{
+	clear();
+}
+
+/**
+*  Function: make(int circle)
+*
+*  Purpose: This function makes a family's circle image, unless it has been
+*           made already.
+*
+*  Inputs: circle - The family (see getBubbleFamily()), or USER_BUBBLE_CIRCLE.
+*
+*  Returns: The image's ID, or -1 if it couldn't be made.
+*/
+
+template <class Platform>
+int BubbleCircles<Platform>::make(int circle)
+{
+	if ( circle < 0 || circle >= BUBBLE_CIRCLES )
+	{
+		return -1;
+	}
+
+	int imageID = FIRST_BUBBLE_CIRCLE_IMAGE_ID + circle;
+
+	if ( made[circle] == false )
+	{
+		made[circle] = platform.renderer.makeCircleImage( imageID, BUBBLE_CIRCLE_STYLES[circle], CIRCLE_IMAGE_SIZE );
+	}
+
+	return made[circle] ? imageID : -1;
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function deletes every circle image.
+*/
+
+template <class Platform>
+void BubbleCircles<Platform>::clear()
+{
+	for ( int circle = 0; circle < BUBBLE_CIRCLES; circle++ )
+	{
+		if ( made[circle] )
+		{
+			platform.renderer.deleteImage( FIRST_BUBBLE_CIRCLE_IMAGE_ID + circle );
+			made[circle] = false;
+		}
+	}
+}
+
+#endif
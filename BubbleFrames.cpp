@@ -0,0 +1,171 @@
+/**
+*  File:  BubbleFrames.cpp
+*
+*  Description:  This file contains scaleImage(), which the bubbles' radius
+*                frames (BubbleFrames.h) are made with.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "BubbleFrames.h"
+#include <math.h>  // For ceil() and floor().
+
+/**
+*  ScaleFilter holds, for each pixel along one side of the scaled image, the
+*  pixels of the source it is made from and how much of each.
+*/
+
+struct ScaleFilter
+{
+	vector <int> first;     // Each scaled pixel's first tap.
+	vector <int> count;     // And how many it has.
+	vector <int> source;    // Each tap's source pixel.
+	vector <float> weight;  // And its weight.  A pixel's weights add up to 1.
+};
+
+/**
+*  Function: makeScaleFilter(int sourceSize, int scaledSize, ScaleFilter & filter)
+*
+*  Purpose: This function works out a tent filter from one side of the source
+*           to one side of the scaled image.  Enlarging, it is 2 pixels wide, so
+*           each scaled pixel is a blend of its nearest source pixels instead of
+*           a copy of one (which looks blocky).  Shrinking, it widens with the
+*           scale, so every source pixel counts towards the result instead of
+*           some being skipped (which looks jagged).
+*/
+
+static void makeScaleFilter(int sourceSize, int scaledSize, ScaleFilter & filter)
+{
+	double ratio = (double)sourceSize / scaledSize;
+	double support = ratio > 1.0 ? ratio : 1.0;
+
+	filter.first.resize( scaledSize );
+	filter.count.resize( scaledSize );
+	filter.source.clear();
+	filter.weight.clear();
+
+	for ( int i = 0; i < scaledSize; i++ )
+	{
+		double center = ( i + 0.5 ) * ratio - 0.5;  // In source pixels.
+		int low = (int)ceil( center - support );
+		int high = (int)floor( center + support );
+		double total = 0.0;
+
+		filter.first[i] = (int)filter.source.size();
+
+		for ( int j = low; j <= high; j++ )
+		{
+			double distance = j > center ? j - center : center - j;
+			double w = 1.0 - distance / support;
+
+			if ( w <= 0.0 )
+			{
+				continue;
+			}
+
+			filter.source.push_back( j < 0 ? 0 : ( j >= sourceSize ? sourceSize-1 : j ) );
+			filter.weight.push_back( (float)w );
+			total += w;
+		}
+
+		filter.count[i] = (int)filter.source.size() - filter.first[i];
+
+		for ( int k = filter.first[i]; k < (int)filter.source.size(); k++ )
+		{
+			filter.weight[k] = (float)( filter.weight[k] / total );
+		}
+	}
+}
+
+/**
+*  Function: scaleImage(const uint32 * source, int sourceWidth, int sourceHeight, uint32 * scaled, int scaledWidth, int scaledHeight)
+*
+*  Purpose: This function scales an image, across and then down, with the
+*           filter above.  The colors are weighted by their alpha, so the
+*           transparent pixels around a bubble don't darken its edge.
+*
+*  Inputs: source - The image, 0xAARRGGBB, top row first.
+*          sourceWidth, sourceHeight - Its size.
+*          scaled - Filled with the scaled image.
+*          scaledWidth, scaledHeight - The size to scale it to.
+*/
+
+void scaleImage(const uint32 * source, int sourceWidth, int sourceHeight, uint32 * scaled, int scaledWidth, int scaledHeight)
+{
+	ScaleFilter across;
+	ScaleFilter down;
+
+	makeScaleFilter( sourceWidth, scaledWidth, across );
+	makeScaleFilter( sourceHeight, scaledHeight, down );
+
+	// Each source pixel's channels, alpha first, with the colors times alpha.
+	vector <float> premultiplied( sourceWidth * sourceHeight * 4 );
+
+	for ( int i = 0; i < sourceWidth * sourceHeight; i++ )
+	{
+		float a = ( source[i] >> 24 ) / 255.0f;
+
+		premultiplied[i*4] = a;
+		premultiplied[i*4 + 1] = ( ( source[i] >> 16 ) & 0xff ) * a;
+		premultiplied[i*4 + 2] = ( ( source[i] >> 8 ) & 0xff ) * a;
+		premultiplied[i*4 + 3] = ( source[i] & 0xff ) * a;
+	}
+
+	// Scaled across: sourceHeight rows of scaledWidth pixels.
+	vector <float> rows( sourceHeight * scaledWidth * 4, 0.0f );
+
+	for ( int y = 0; y < sourceHeight; y++ )
+	{
+		for ( int x = 0; x < scaledWidth; x++ )
+		{
+			float * out = & rows[( y*scaledWidth + x ) * 4];
+
+			for ( int k = across.first[x]; k < across.first[x] + across.count[x]; k++ )
+			{
+				const float * in = & premultiplied[( y*sourceWidth + across.source[k] ) * 4];
+				float w = across.weight[k];
+
+				out[0] += in[0] * w;
+				out[1] += in[1] * w;
+				out[2] += in[2] * w;
+				out[3] += in[3] * w;
+			}
+		}
+	}
+
+	for ( int y = 0; y < scaledHeight; y++ )
+	{
+		for ( int x = 0; x < scaledWidth; x++ )
+		{
+			float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+			for ( int k = down.first[y]; k < down.first[y] + down.count[y]; k++ )
+			{
+				const float * in = & rows[( down.source[k]*scaledWidth + x ) * 4];
+				float w = down.weight[k];
+
+				sum[0] += in[0] * w;
+				sum[1] += in[1] * w;
+				sum[2] += in[2] * w;
+				sum[3] += in[3] * w;
+			}
+
+			uint32 pixel = 0;
+
+			if ( sum[0] > 0.0f )
+			{
+				int alpha = (int)( sum[0] * 255.0f + 0.5f );
+				int red = (int)( sum[1] / sum[0] + 0.5f );
+				int green = (int)( sum[2] / sum[0] + 0.5f );
+				int blue = (int)( sum[3] / sum[0] + 0.5f );
+
+				pixel = (uint32)( alpha > 255 ? 255 : alpha ) << 24 | (uint32)( red > 255 ? 255 : red ) << 16 |
+					    (uint32)( green > 255 ? 255 : green ) << 8 | (uint32)( blue > 255 ? 255 : blue );
+			}
+
+			scaled[y*scaledWidth + x] = pixel;
+		}
+	}
+}
@@ -0,0 +1,209 @@
+/**
+*  File:  BubbleFrames.h
+*
+*  Description:  This header file contains the BubbleFrames class.  A popping
+*                bubble grows from a radius of 12 to 52 and shrinks back to
+*                nothing, and each frame its 24x24 image would have to be drawn
+*                at a new size, scaled by the engine with no filtering.
+*                Instead, the first time a bubble image is used, it is scaled
+*                once to every radius from 1 to MAX_FRAME_RADIUS, filtered (see
+*                scaleImage()), and each becomes an image of its own: the
+*                image's radius frames.  A bubble then shows the frame for its
+*                radius, at its own size (see BubbleSprite::update()).
+*
+*                There are frames for each of the 60 bubble images, for the
+*                user bubble's and for the one the tinted bubbles share, in the
+*                image IDs from FIRST_BUBBLE_FRAME_IMAGE_ID up.  The frames of images the level doesn't use are deleted
+*                once its bubbles have all been made (see trim()).
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef BUBBLE_FRAMES_H_
+#define BUBBLE_FRAMES_H_
+
+#include "Constants.h"
+#include "Simulation.h"  // For BUBBLE_IMAGE_COUNT.
+#include <vector>
+
+using namespace std;
+
+const int USER_BUBBLE_FRAME_SLOT = BUBBLE_IMAGE_COUNT;      // After the bubble images.
+const int TINT_BUBBLE_FRAME_SLOT = BUBBLE_IMAGE_COUNT + 1;  // The tinted bubbles' one image.
+const int BUBBLE_FRAME_SLOTS = BUBBLE_IMAGE_COUNT + 2;
+
+void scaleImage(const uint32 * source, int sourceWidth, int sourceHeight, uint32 * scaled, int scaledWidth, int scaledHeight);
+
+template <class Platform>
+class BubbleFrames
+{
+private:
+	Platform & platform;
+	bool made[BUBBLE_FRAME_SLOTS];  // Whether each image's frames have been made.
+
+public:
+	BubbleFrames(Platform & p);
+	~BubbleFrames();
+	bool make(int slot, int sourceImageID);
+	int getImageID(int slot, int radius) const;
+	int getFrame(int slot, int radius) const;
+	void trim(const bool used[BUBBLE_FRAME_SLOTS]);
+	void clear();
+};
+
+/**
+*  Function: BubbleFrames(Platform & p)
+*
+*  Purpose: This is the constructor for the BubbleFrames class.  No frames are
+*           made until they are needed.
+*
+*  Inputs: p - The backend the frames are made in.
+*/
+
+template <class Platform>
+BubbleFrames<Platform>::BubbleFrames(Platform & p)
+                      : platform(p)
+{
+	for ( int i = 0; i < BUBBLE_FRAME_SLOTS; i++ )
+	{
+		made[i] = false;
+	}
+}
+
+/**
+*  Function: ~BubbleFrames()
+*
+*  Purpose: This is the destructor for the BubbleFrames class.  It deletes
+*           every frame.
+*/
+
+template <class Platform>
+BubbleFrames<Platform>::~BubbleFrames()
+{
+	clear();
+}
+
+/**
+*  Function: make(int slot, int sourceImageID)
+*
+*  Purpose: This function makes a bubble image's radius frames, from the image
+*           already loaded for a bubble, unless they have been made already.
+*
+*  Inputs: slot - Which bubble image it is: its index in BUBBLE_IMAGES,
+*                 USER_BUBBLE_FRAME_SLOT or TINT_BUBBLE_FRAME_SLOT.
+*          sourceImageID - The image.
+*
+*  Returns: True if the frames are there.
+*/
+
+template <class Platform>
+bool BubbleFrames<Platform>::make(int slot, int sourceImageID)
+{
+	if ( slot < 0 || slot >= BUBBLE_FRAME_SLOTS )
+	{
+		return false;
+	}
+
+	if ( made[slot] )
+	{
+		return true;
+	}
+
+	vector <uint32> source;
+	int width = 0;
+	int height = 0;
+
+	if ( platform.renderer.readImage( sourceImageID, source, width, height ) == false || width <= 0 || height <= 0 )
+	{
+		return false;
+	}
+
+	vector <uint32> scaled( MAX_FRAME_RADIUS*2 * MAX_FRAME_RADIUS*2 );
+
+	for ( int radius = 1; radius <= MAX_FRAME_RADIUS; radius++ )
+	{
+		scaleImage( & source[0], width, height, & scaled[0], radius*2, radius*2 );
+		platform.renderer.makeImage( getImageID( slot, radius ), & scaled[0], radius*2, radius*2 );
+	}
+
+	made[slot] = true;
+
+	return true;
+}
+
+/**
+*  Function: getImageID(int slot, int radius)
+*
+*  Returns: The image ID of a bubble image's frame for a radius, or -1 if there
+*           is no such frame.
+*/
+
+template <class Platform>
+int BubbleFrames<Platform>::getImageID(int slot, int radius) const
+{
+	if ( slot < 0 || slot >= BUBBLE_FRAME_SLOTS || radius < 1 || radius > MAX_FRAME_RADIUS )
+	{
+		return -1;
+	}
+
+	return FIRST_BUBBLE_FRAME_IMAGE_ID + slot*MAX_FRAME_RADIUS + radius-1;
+}
+
+/**
+*  Function: getFrame(int slot, int radius)
+*
+*  Returns: The image ID of a bubble image's frame for a radius, or -1 if its
+*           frames haven't been made or the radius is out of their range.
+*/
+
+template <class Platform>
+int BubbleFrames<Platform>::getFrame(int slot, int radius) const
+{
+	int imageID = getImageID( slot, radius );
+
+	return imageID >= 0 && made[slot] ? imageID : -1;
+}
+
+/**
+*  Function: trim(const bool used[BUBBLE_FRAME_SLOTS])
+*
+*  Purpose: This function deletes the frames of the bubble images that aren't
+*           used, so that only the level's are kept.
+*
+*  Inputs: used - Whether each bubble image is used.
+*/
+
+template <class Platform>
+void BubbleFrames<Platform>::trim(const bool used[BUBBLE_FRAME_SLOTS])
+{
+	for ( int slot = 0; slot < BUBBLE_FRAME_SLOTS; slot++ )
+	{
+		if ( made[slot] && used[slot] == false )
+		{
+			for ( int radius = 1; radius <= MAX_FRAME_RADIUS; radius++ )
+			{
+				platform.renderer.deleteImage( getImageID( slot, radius ) );
+			}
+
+			made[slot] = false;
+		}
+	}
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function deletes every frame.
+*/
+
+template <class Platform>
+void BubbleFrames<Platform>::clear()
+{
+	bool used[BUBBLE_FRAME_SLOTS] = { false };
+
+	trim( used );
+}
+
+#endif
@@ -3,58 +3,318 @@
 *                                                                                            
 *  Description:	 This header file is the class definition for the BubbleSprite class,         
 *                which extends the Sprite class.  BubbleSprite is the base class of
-*                both UserBubble and NormalBubble.
+*                both UserBubble and NormalBubble.  A BubbleSprite only draws a
+*                bubble and plays its pop sound.  The bubble itself is a SimBubble
+*                in the GameSession's level, and update() makes the sprite match it.
+*                Given its image's radius frames (see BubbleFrames.h), a bubble
+*                shows the one for its radius instead of having its image scaled.
+*                Given a circle image instead (see BubbleCircles.h), it shows
+*                that, sized to its radius.
 *                                                                                            
 *  Author:  jjobes                                                                
 *																							  
-*  Last Update:  6/20/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef BUBBLE_SPRITE_H_
 #define BUBBLE_SPRITE_H_
 
 #include "CircleSprite.h"
+#include "Simulation.h"  // For SimBubble.
+#include "BubbleFrames.h"
 
-class BubbleSprite : public CircleSprite
+template <class Platform>
+class BubbleSprite : public CircleSprite<Platform>
 {
 private:
-	bool paused;
-	bool popping;
-	bool expanding;
-	bool holding;
-	bool contracting;
-	bool isUserBubble;
-	int maxRadius;
-	int holdCounter;
+	bool popping;  // Whether the bubble was popping the last time it was drawn.
+	int alpha;
 	int popSoundID;
-	char * popFileName;
+	MediaAsset popSound;
+	const BubbleFrames<Platform> * frames;  // NULL if it has none.
+	int frameSlot;
+	int circleImageID;                     // The circle image, or -1 if it has none.
+	int frameImageID;                      // The frame or circle shown, or -1 for the sprite's own image.
 	char lineBuffer[MAX_ERROR_BUFFER];
 	time_t currentTime;
 
 public:
-	static int currentPopping;  // Total number of bubbles currently popping.  Shared by all BubbleSprite objects.
-	BubbleSprite(int cX, int cY, int r, char * bubbleFileName, int imgID, int sprtID);
+	BubbleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID);
 	~BubbleSprite();
-	void loadPopSound(char * fileName, int soundID);
+	void loadPopSound(MediaAsset sound, int soundID);
 	void playPopSound();
-	void move();
-	void pop();
-	void expand();
-	void hold();
-	void contract();
-	void setPaused(bool p);
-	void setPopping(bool p);
-	bool getPopping() const;
-	void setExpanding(bool e);
-	void setContracting(bool c);
-	void setIsUserBubble(bool u);
-	void setMaxRadius(int m);
-	void setHoldCounter(int h);
+	void update(const SimBubble & b, bool sounds);
+	void useFrames(const BubbleFrames<Platform> * f, int slot);
+	void useCircle(int imageID);
+	int getFrameSlot() const;
 	void setPopSoundID(int id);
 	int getPopSoundID() const;
-	void setPopFileName(char * name);
-	char * getPopFileName() const;
-	bool getIsUserBubble() const;
+	void setPopSound(MediaAsset sound);
+	MediaAsset getPopSound() const;
 };
 
+/**
+*  Function: BubbleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID)
+*
+*  Purpose: This is the constructor for the BubbleSprite class.  It is called by
+*           the UserBubble and NormalBubble constructors when creating their objects.
+*           Its primary purpose is to create the initial sprite.
+*
+*  Inputs: p, imgID, sprtID, bubbleImage, cX, cY, r - passed up to the CircleSprite constructor.
+*/
+
+template <class Platform>
+BubbleSprite<Platform>::BubbleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID)
+            : CircleSprite<Platform>(p, cX, cY, r, bubbleImage, imgID, sprtID)
+{
+	// Pass all incoming values up to the CircleSprite constructor.
+
+	popping = false;
+	alpha = 255;
+	frames = NULL;
+	frameSlot = -1;
+	circleImageID = -1;
+	frameImageID = -1;
+}
+
+/**
+*  Function: ~BubbleSprite()
+*
+*  Purpose: This is the destructor for the BubbleSprite class.  It makes sure
+*           the pop sound exists, and then deletes it from memory.  It writes
+*           an error to the log file otherwise.
+*/
+
+template <class Platform>
+BubbleSprite<Platform>::~BubbleSprite()
+{
+	if ( this->getPlatform().audio.soundExists( popSoundID ) )
+	{
+		this->getPlatform().audio.deleteSound( popSoundID );
+	}
+	else
+	{
+		sprintf( lineBuffer, "~BubbleSprite(): popSoundID %d does not exist.", popSoundID );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: loadPopSound()
+*
+*  Purpose: This function loads the pop sound into memory.  It is called by the
+*           UserBubble and NormalBubble constructors.  The reason each object has 
+*           its own pop sound is that this enables each bubble to have a different 
+*           note.  The sound is made from the media pack if it is in it.  It writes
+*           an error to the log file if the sound file is not found.
+*
+*  Inputs: sound - The pop sound to be loaded.
+*          soundID - The ID to be associated with this sound.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::loadPopSound(MediaAsset sound, int soundID)
+{
+	if ( this->getPlatform().audio.loadSound( sound, soundID ) == false )
+	{
+		sprintf( lineBuffer, "BubbleSprite::loadPopSound(): File %s does not exist.", getMediaPath( sound ) );
+		logFile << lineBuffer << endl << endl;
+	}	
+}
+
+/**
+*  Function: playPopSound()
+*
+*  Purpose: This function makes sure the pop sound exists, and then
+*           plays the sound.  If the sound hasn't been loaded into
+*           memory, it writes an error to the log file.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::playPopSound()
+{
+	if ( this->getPlatform().audio.soundExists( popSoundID ) )
+	{
+		this->getPlatform().audio.playSound( popSoundID );
+	}
+	else
+	{
+		sprintf( lineBuffer, "BubbleSprite::playPopSound(): popSoundID %d does not exist.", popSoundID );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: update(const SimBubble & b, bool sounds)
+*
+*  Purpose: This function is called each frame to make the sprite match its
+*           bubble in the level.  The sprite is only rotated, resized or made
+*           see-through when that has changed.  A bubble that is popping, or
+*           has popped, is semi-transparent, and its pop sound is played when
+*           it starts popping.
+*
+*  Inputs: b - The bubble, from GameSession::getSimulation().
+*          sounds - False to stay quiet, as when the game is rewinding.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::update(const SimBubble & b, bool sounds)
+{
+	this->setCenterX( b.centerX );
+	this->setCenterY( b.centerY );
+
+	if ( b.degrees != this->getDegrees() )
+	{
+		this->rotate( b.degrees );
+	}
+
+	if ( b.radius != this->getRadius() || this->getWidth() != b.radius*2 )  // Changed, or not sized yet.
+	{
+		this->setRadius( b.radius );
+		this->resize( this->getRadius()*2, this->getRadius()*2 );  // The frame's own size, so it isn't scaled.
+		this->setOffsetToCenter();
+
+		frameImageID = frames != NULL ? frames->getFrame( frameSlot, this->getRadius() ) : circleImageID;
+	}
+
+	if ( frameImageID >= 0 )
+	{
+		this->display( this->getCenterX(), this->getCenterY(), frameImageID );
+	}
+	else
+	{
+		this->display( this->getCenterX(), this->getCenterY() );
+	}
+
+	int popAlpha = ( b.popping || b.holding || b.contracting ) ? POP_ALPHA : 255;
+
+	if ( popAlpha != alpha )
+	{
+		alpha = popAlpha;
+		this->setAlpha( alpha );
+	}
+
+	if ( b.popping && popping == false && sounds )
+	{
+		playPopSound();
+	}
+
+	popping = b.popping;
+}
+
+/**
+*  Function: useFrames(const BubbleFrames<Platform> * f, int slot)
+*
+*  Purpose: This function gives the bubble its image's radius frames.  It is
+*           called from createBubbleSprite() in FrontEnd.h once they have been
+*           made.
+*
+*  Inputs: f - The frames, which have to outlive the bubble.
+*          slot - Which image's frames are the bubble's.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::useFrames(const BubbleFrames<Platform> * f, int slot)
+{
+	frames = f;
+	frameSlot = slot;
+	frameImageID = frames->getFrame( frameSlot, this->getRadius() );
+}
+
+/**
+*  Function: useCircle(int imageID)
+*
+*  Purpose: This function has the bubble shown as a circle image instead of
+*           its own image.  It is called from createBubbleSprite() in FrontEnd.h
+*           when the bubbles are drawn as circles.
+*
+*  Inputs: imageID - The circle image (see BubbleCircles.h).
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::useCircle(int imageID)
+{
+	circleImageID = imageID;
+
+	if ( frames == NULL )
+	{
+		frameImageID = circleImageID;
+	}
+}
+
+/**
+*  Function: getFrameSlot()
+*
+*  Returns: Which image's radius frames the bubble uses, or -1 if none.
+*/
+
+template <class Platform>
+int BubbleSprite<Platform>::getFrameSlot() const
+{
+	return frameSlot;
+}
+
+/**
+*  Function: setPopSoundID(bool id)
+*
+*  Purpose: This function sets popSoundID to the passed in value.  It is
+*           called from the NormalBubble and UserBubble constructors.
+*          
+*  Inputs: id - The boolean value that popSoundID gets set to.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::setPopSoundID(int id)
+{
+	popSoundID = id;
+}
+
+/**
+*  Function: getPopSoundID()
+*
+*  Purpose: This function returns the popSoundID.  It is called from
+*           the NormalBubble and UserBubble constructors.
+*
+*  Returns: The popSoundID of the current BubbleSprite.
+*/
+
+template <class Platform>
+int BubbleSprite<Platform>::getPopSoundID() const
+{
+	return popSoundID;
+}
+
+/**
+*  Function: setPopSound(MediaAsset sound)
+*
+*  Purpose: This function sets popSound to the passed in value.  The 
+*           popSound is the sound asset that is used to create the pop
+*           sound.  It is called from the NormalBubble and UserBubble
+*           constructors.
+*          
+*  Inputs: sound - The MediaAsset that popSound gets set to.
+*/
+
+template <class Platform>
+void BubbleSprite<Platform>::setPopSound(MediaAsset sound)
+{
+	popSound = sound;
+}
+
+/**
+*  Function: getPopSound()
+*
+*  Purpose: This function returns the popSound.  The popSound is the
+*           sound asset that is used to create the pop sound.  It is
+*           called from the NormalBubble and UserBubble constructors.
+*
+*  Returns: The popSound of the current BubbleSprite.
+*/
+
+template <class Platform>
+MediaAsset BubbleSprite<Platform>::getPopSound() const
+{
+	return popSound;
+}
+
 #endif
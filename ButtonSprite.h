@@ -6,26 +6,152 @@
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/2/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef BUTTON_SPRITE_H_
 #define BUTTON_SPRITE_H_
 
 #include "Sprite.h"
+#include "InputEvents.h"
 
-class ButtonSprite : public Sprite
+template <class Platform>
+class ButtonSprite : public Sprite<Platform>
 {
 private:
 	int centerX;
 	int centerY;
 
 public:
-	ButtonSprite(int imgID, int sprtID, char fileName[], int cX, int cY);
+	ButtonSprite(Platform & p, int imgID, int sprtID, MediaAsset image, int cX, int cY);
 	~ButtonSprite();
 	void reposition(int cX, int cY);
 	bool mouseOver(int mouseX, int mouseY);
-	bool clicked(int mouseX, int mouseY);
+	bool clicked(const InputEvent & event);
 };
 
-#endif
\ No newline at end of file
+/**
+*  Function: ButtonSprite(Platform & p, int imgID, int sprtID, MediaAsset image, int cX, int cY)
+*
+*  Purpose: This is the constructor for the ButtonSprite class.  It sets the x- and
+*           y-coordinates of the center point, creates the initial sprite at that 
+*           point, then sets the offset to its center point.  Subsequent calls to 
+*           reposition the button will treat the arguments passed in as the button's
+*           new center point.
+*
+*  Inputs: p, imgID, sprtID, image - passed up to the Sprite constructor.
+*          cX - The x-coordinate of the ButtonSprite's center point.
+*		   cY - The y-coordinate of the ButtonSprite's center point.
+*/
+
+template <class Platform>
+ButtonSprite<Platform>::ButtonSprite(Platform & p, int imgID, int sprtID, MediaAsset image, int cX, int cY)
+            : Sprite<Platform>(p, imgID, sprtID, image)
+{
+	centerX = cX;
+	centerY = cY;
+
+	this->display( centerX, centerY );  // Create initial sprite and display it.
+
+	this->setOffsetToCenter();
+
+	this->setWidth( p.renderer.spriteWidth( this->getSpriteID() ) );
+	this->setHeight( p.renderer.spriteHeight( this->getSpriteID() ) );
+}
+
+/**
+*  Function: ~ButtonSprite()
+*
+*  Purpose: This is the destructor for the ButtonSprite class.  It is currently
+*           empty, but is here in case any new additions to the class require
+*           objects to be deleted, or memory to be freed.
+*/
+
+template <class Platform>
+ButtonSprite<Platform>::~ButtonSprite()
+{
+	// Destructor of base class (Sprite) is automatically called.
+}
+
+/**
+*  Function: reposition(int cX, int cY)
+*
+*  Purpose: This function is used to reposition the button in a new location.
+*           This is useful because in the cut-screen functions in FrontEnd.h,
+*           the same button might be in a different location in two different
+*           screens.
+*
+*  Inputs: cX - The x-coordinate of the button's new center point.
+*          cY - The y-coordinate of the button's new center point.
+*/
+
+template <class Platform>
+void ButtonSprite<Platform>::reposition(int cX, int cY)
+{
+	centerX = cX;
+	centerY = cY;
+
+	this->display( centerX, centerY ); 
+	this->hide();
+
+	this->setOffsetToCenter();                 
+}
+
+/**
+*  Function: mouseOver(int mouseX, int mouseY)
+*
+*  Purpose: This function is called from the cut-screen functions in FrontEnd.h.
+*           It is used to determine whether or not the user's mouse is currently
+*           hovering over the button.
+*
+*  Inputs: mouseX - The current x-coordinate of the user's mouse pointer.
+*          mouseY - The current y-coordinate of the user's mouse pointer.
+*
+*  Returns: True if the mouse pointer is currently over the button.
+*           False if the mouse pointer is not currently over the button.
+*/
+
+template <class Platform>
+bool ButtonSprite<Platform>::mouseOver(int mouseX, int mouseY)
+{
+	int halfWidth = this->getWidth() / 2;
+	int halfHeight = this->getHeight() / 2;
+
+	if ( mouseX >= centerX-halfWidth && mouseX <= centerX+halfWidth &&
+		 mouseY >= centerY-halfHeight && mouseY <= centerY+halfHeight )
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/**
+*  Function: clicked(const InputEvent & event)
+*
+*  Purpose: This function is used to determine whether or not the button
+*           has been clicked by the user.  Only the button going down is a
+*           click, so holding it down doesn't click again.
+*
+*  Inputs: event - An event from the front end's InputEvents.
+*
+*  Returns: True if the event is the mouse button going down within the area
+*           of the button.  False otherwise.
+*/
+
+template <class Platform>
+bool ButtonSprite<Platform>::clicked(const InputEvent & event)
+{
+	if ( event.type == MOUSE_PRESSED && mouseOver( event.x, event.y ) )
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+#endif
@@ -0,0 +1,300 @@
+/**
+*  File:  ByteStream.cpp
+*
+*  Description:  This file contains the implementations for ByteWriter and ByteReader.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "ByteStream.h"
+#include <string.h>  // For memcpy().
+
+/**
+*  Function: ByteWriter(vector <uint8> & output)
+*
+*  Purpose: This is the constructor for the ByteWriter class.
+*
+*  Inputs: output - The vector to append to.  It must outlive the writer.
+*/
+
+ByteWriter::ByteWriter(vector <uint8> & output) : bytes( output )
+{
+}
+
+/**
+*  Function: writeByte(uint8 value)
+*
+*  Purpose: This function appends a single byte.
+*
+*  Inputs: value - The byte.
+*/
+
+void ByteWriter::writeByte(uint8 value)
+{
+	bytes.push_back( value );
+}
+
+/**
+*  Function: writeVarint(uint32 value)
+*
+*  Purpose: This function appends a whole number as a varint (1 to 5 bytes).
+*
+*  Inputs: value - The number.
+*/
+
+void ByteWriter::writeVarint(uint32 value)
+{
+	while ( value >= 0x80 )
+	{
+		bytes.push_back( (uint8)( value | 0x80 ) );
+		value >>= 7;
+	}
+
+	bytes.push_back( (uint8)value );
+}
+
+/**
+*  Function: writeSigned(int32 value)
+*
+*  Purpose: This function appends a signed number, zigzag encoded and then
+*           written as a varint.
+*
+*  Inputs: value - The number.
+*/
+
+void ByteWriter::writeSigned(int32 value)
+{
+	writeVarint( ( (uint32)value << 1 ) ^ (uint32)( value >> 31 ) );
+}
+
+/**
+*  Function: writeFloat(float value)
+*
+*  Purpose: This function appends the 4 bytes of a float, lowest byte first.
+*
+*  Inputs: value - The number.
+*/
+
+void ByteWriter::writeFloat(float value)
+{
+	uint32 bits;
+	memcpy( & bits, & value, sizeof(bits) );
+
+	for ( int i = 0; i < 4; i++ )
+	{
+		bytes.push_back( (uint8)( bits >> ( i*8 ) ) );
+	}
+}
+
+/**
+*  Function: writeBytes(const uint8 * data, int count)
+*
+*  Purpose: This function appends a block of bytes as they are.
+*
+*  Inputs: data - The bytes.
+*          count - How many there are.
+*/
+
+void ByteWriter::writeBytes(const uint8 * data, int count)
+{
+	bytes.insert( bytes.end(), data, data + count );
+}
+
+/**
+*  Function: getSize()
+*
+*  Returns: The size of the output vector, in bytes.
+*/
+
+int ByteWriter::getSize() const
+{
+	return (int)bytes.size();
+}
+
+/**
+*  Function: ByteReader(const uint8 * bytes, int count)
+*
+*  Purpose: This is the constructor for the ByteReader class.
+*
+*  Inputs: bytes - The bytes to read.  They must outlive the reader.
+*          count - How many there are.
+*/
+
+ByteReader::ByteReader(const uint8 * bytes, int count)
+{
+	data = bytes;
+	size = count;
+	position = 0;
+	failed = false;
+}
+
+/**
+*  Function: readByte()
+*
+*  Returns: The next byte, or 0 if there are none left.
+*/
+
+uint8 ByteReader::readByte()
+{
+	if ( failed || position >= size )
+	{
+		failed = true;
+		return 0;
+	}
+
+	return data[position++];
+}
+
+/**
+*  Function: readVarint()
+*
+*  Returns: The next varint, or 0 if it is cut off or too long.
+*/
+
+uint32 ByteReader::readVarint()
+{
+	uint32 value = 0;
+
+	for ( int shift = 0; shift < 35; shift += 7 )
+	{
+		uint8 byte = readByte();
+
+		value |= (uint32)( byte & 0x7f ) << shift;
+
+		if ( ( byte & 0x80 ) == 0 )
+		{
+			return failed ? 0 : value;
+		}
+	}
+
+	failed = true;
+	return 0;
+}
+
+/**
+*  Function: readSigned()
+*
+*  Returns: The next zigzag encoded number, or 0 on failure.
+*/
+
+int32 ByteReader::readSigned()
+{
+	uint32 value = readVarint();
+
+	return (int32)( value >> 1 ) ^ -(int32)( value & 1 );
+}
+
+/**
+*  Function: readFloat()
+*
+*  Returns: The next float, or 0 on failure.
+*/
+
+float ByteReader::readFloat()
+{
+	uint32 bits = 0;
+
+	for ( int i = 0; i < 4; i++ )
+	{
+		bits |= (uint32)readByte() << ( i*8 );
+	}
+
+	float value;
+	memcpy( & value, & bits, sizeof(value) );
+
+	return failed ? 0.0f : value;
+}
+
+/**
+*  Function: readBytes(uint8 * output, int count)
+*
+*  Purpose: This function copies the next count bytes.
+*
+*  Inputs: output - Where to copy them.
+*          count - How many to copy.
+*
+*  Returns: True if there were enough bytes left.
+*/
+
+bool ByteReader::readBytes(uint8 * output, int count)
+{
+	const uint8 * start = getCurrent();
+
+	if ( skip( count ) == false )
+	{
+		return false;
+	}
+
+	memcpy( output, start, count );
+
+	return true;
+}
+
+/**
+*  Function: skip(int count)
+*
+*  Purpose: This function moves past the next count bytes without reading them.
+*
+*  Inputs: count - How many bytes to skip.
+*
+*  Returns: True if there were enough bytes left.
+*/
+
+bool ByteReader::skip(int count)
+{
+	if ( failed || count < 0 || count > size - position )
+	{
+		failed = true;
+		return false;
+	}
+
+	position += count;
+
+	return true;
+}
+
+/**
+*  Function: getCurrent()
+*
+*  Returns: A pointer to the next byte to be read.
+*/
+
+const uint8 * ByteReader::getCurrent() const
+{
+	return data + position;
+}
+
+/**
+*  Function: getPosition()
+*
+*  Returns: The number of bytes read so far.
+*/
+
+int ByteReader::getPosition() const
+{
+	return position;
+}
+
+/**
+*  Function: getRemaining()
+*
+*  Returns: The number of bytes left to read.
+*/
+
+int ByteReader::getRemaining() const
+{
+	return size - position;
+}
+
+/**
+*  Function: getFailed()
+*
+*  Returns: True if a read has gone past the end or found a bad varint.
+*/
+
+bool ByteReader::getFailed() const
+{
+	return failed;
+}
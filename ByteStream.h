@@ -0,0 +1,77 @@
+/**
+*  File:  ByteStream.h
+*
+*  Description:  This header file contains ByteWriter and ByteReader, which turn
+*                numbers into a compact, byte-order independent stream of bytes
+*                and back again.  They are used for replay files and saved level
+*                states.
+*
+*                Whole numbers are written as varints: 7 bits to a byte, lowest
+*                bits first, with the top bit set on every byte but the last, so
+*                numbers under 128 take a single byte.  Signed numbers are zigzag
+*                encoded first (0, -1, 1, -2, ... become 0, 1, 2, 3, ...) so small
+*                negative numbers stay small too.  Floats are written as their 4
+*                raw bytes, so they come back exactly.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef BYTE_STREAM_H_
+#define BYTE_STREAM_H_
+
+#include "Portable.h"
+#include <vector>
+
+using namespace std;
+
+/**
+*  ByteWriter appends to a vector of bytes.
+*/
+
+class ByteWriter
+{
+private:
+	vector <uint8> & bytes;
+
+public:
+	ByteWriter(vector <uint8> & output);
+	void writeByte(uint8 value);
+	void writeVarint(uint32 value);
+	void writeSigned(int32 value);
+	void writeFloat(float value);
+	void writeBytes(const uint8 * data, int count);
+	int getSize() const;
+};
+
+/**
+*  ByteReader reads from a block of bytes that it doesn't own.  Reading past
+*  the end, or a varint longer than 5 bytes, makes getFailed() true, and from
+*  then on every read returns 0, so a run of reads can be checked once at the
+*  end instead of after each one.
+*/
+
+class ByteReader
+{
+private:
+	const uint8 * data;
+	int size;
+	int position;
+	bool failed;
+
+public:
+	ByteReader(const uint8 * bytes, int count);
+	uint8 readByte();
+	uint32 readVarint();
+	int32 readSigned();
+	float readFloat();
+	bool readBytes(uint8 * output, int count);
+	bool skip(int count);
+	const uint8 * getCurrent() const;
+	int getPosition() const;
+	int getRemaining() const;
+	bool getFailed() const;
+};
+
+#endif
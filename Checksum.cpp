@@ -0,0 +1,447 @@
+/**
+*  File:  Checksum.cpp
+*
+*  Description:  This file contains the implementations for ChecksumStream and
+*                checksumFirstDifference().
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Checksum.h"
+
+const uint8 CHECKSUM_MAGIC[4] = { 'P', 'R', 'C', 'S' };
+
+/**
+*  Function: ChecksumStream(bool withBubbles)
+*
+*  Purpose: This is the constructor for the ChecksumStream class.  The stream
+*           starts out empty, keeping its records in memory.
+*
+*  Inputs: withBubbles - True to keep a hash of every bubble in every frame, so
+*                        the first bubble that differs can be found.
+*/
+
+ChecksumStream::ChecksumStream(bool withBubbles)
+{
+	bubbleHashes = withBubbles;
+	file = NULL;
+	firstBubble.push_back( 0 );
+}
+
+/**
+*  Function: ~ChecksumStream()
+*
+*  Purpose: This is the destructor for the ChecksumStream class.  It closes the
+*           file, if there is one.
+*/
+
+ChecksumStream::~ChecksumStream()
+{
+	close();
+}
+
+/**
+*  Function: open(const char * fileName)
+*
+*  Purpose: This function sends the records that are added from now on straight
+*           to a file, instead of keeping them in memory.
+*
+*  Inputs: fileName - The file to write.
+*
+*  Returns: True if the file was created.
+*/
+
+bool ChecksumStream::open(const char * fileName)
+{
+	close();
+
+	file = fopen( fileName, "wb" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	buffer.clear();
+	writeHeader( buffer );
+
+	return fwrite( & buffer[0], 1, buffer.size(), file ) == buffer.size();
+}
+
+/**
+*  Function: close()
+*
+*  Purpose: This function closes the file opened by open().  Records go back to
+*           being kept in memory.
+*
+*  Returns: True if there was no file, or everything was written to it.
+*/
+
+bool ChecksumStream::close()
+{
+	if ( file == NULL )
+	{
+		return true;
+	}
+
+	bool closed = ferror( file ) == 0;
+	closed = fclose( file ) == 0 && closed;
+	file = NULL;
+
+	return closed;
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function throws away the records kept in memory.
+*/
+
+void ChecksumStream::clear()
+{
+	tickHashes.clear();
+	firstBubble.assign( 1, 0 );
+	bubbleHashList.clear();
+}
+
+/**
+*  Function: getBubbleHashes()
+*
+*  Returns: True if the stream keeps a hash for each bubble.
+*/
+
+bool ChecksumStream::getBubbleHashes() const
+{
+	return bubbleHashes;
+}
+
+/**
+*  Function: writeHeader(vector <uint8> & bytes)
+*
+*  Purpose: This function writes the start of a checksum file.
+*
+*  Inputs: bytes - The header is added to the end.
+*/
+
+void ChecksumStream::writeHeader(vector <uint8> & bytes) const
+{
+	ByteWriter writer( bytes );
+
+	writer.writeBytes( CHECKSUM_MAGIC, 4 );
+	writer.writeVarint( CHECKSUM_VERSION );
+	writer.writeByte( bubbleHashes ? 1 : 0 );
+}
+
+/**
+*  Function: addTick(uint64 tickHash, const uint64 * bubbles, int bubbleCount)
+*
+*  Purpose: This function adds the record for the next frame.
+*
+*  Inputs: tickHash - The level hash, from checksumFinish().
+*          bubbles - Each bubble's hash, from checksumBubble().  Only read if
+*                    the stream keeps bubble hashes.
+*          bubbleCount - How many bubbles there are.
+*/
+
+void ChecksumStream::addTick(uint64 tickHash, const uint64 * bubbles, int bubbleCount)
+{
+	if ( file == NULL )
+	{
+		tickHashes.push_back( tickHash );
+
+		if ( bubbleHashes )
+		{
+			for ( int i = 0; i < bubbleCount; i++ )
+			{
+				bubbleHashList.push_back( (uint32)( bubbles[i] >> 32 ) );
+			}
+
+			firstBubble.push_back( (int)bubbleHashList.size() );
+		}
+
+		return;
+	}
+
+	buffer.clear();
+
+	ByteWriter writer( buffer );
+
+	for ( int i = 0; i < 8; i++ )
+	{
+		writer.writeByte( (uint8)( tickHash >> ( i*8 ) ) );
+	}
+
+	if ( bubbleHashes )
+	{
+		writer.writeVarint( (uint32)bubbleCount );
+
+		for ( int i = 0; i < bubbleCount; i++ )
+		{
+			uint32 hash = (uint32)( bubbles[i] >> 32 );
+
+			for ( int j = 0; j < 4; j++ )
+			{
+				writer.writeByte( (uint8)( hash >> ( j*8 ) ) );
+			}
+		}
+	}
+
+	fwrite( & buffer[0], 1, buffer.size(), file );
+}
+
+/**
+*  Function: getTickCount()
+*
+*  Returns: The number of frames kept in memory.
+*/
+
+int ChecksumStream::getTickCount() const
+{
+	return (int)tickHashes.size();
+}
+
+/**
+*  Function: getTickHash(int tick)
+*
+*  Returns: The level hash after frame tick (counting from 0).
+*/
+
+uint64 ChecksumStream::getTickHash(int tick) const
+{
+	return tickHashes[tick];
+}
+
+/**
+*  Function: getBubbleCount(int tick)
+*
+*  Returns: The number of bubbles hashed in frame tick, or 0 if the stream
+*           doesn't keep bubble hashes.
+*/
+
+int ChecksumStream::getBubbleCount(int tick) const
+{
+	return bubbleHashes ? firstBubble[tick+1] - firstBubble[tick] : 0;
+}
+
+/**
+*  Function: getBubbleHash(int tick, int bubble)
+*
+*  Returns: The hash of a bubble after frame tick.
+*/
+
+uint32 ChecksumStream::getBubbleHash(int tick, int bubble) const
+{
+	return bubbleHashList[firstBubble[tick] + bubble];
+}
+
+/**
+*  Function: load(const char * fileName)
+*
+*  Purpose: This function reads a checksum file into memory.
+*
+*  Inputs: fileName - The file to read.
+*
+*  Returns: True if the file was read.  If not, the stream is left empty.
+*/
+
+bool ChecksumStream::load(const char * fileName)
+{
+	close();
+	clear();
+
+	FILE * input = fopen( fileName, "rb" );
+
+	if ( input == NULL )
+	{
+		return false;
+	}
+
+	vector <uint8> bytes;
+	uint8 chunk[65536];
+	size_t count;
+
+	while ( ( count = fread( chunk, 1, sizeof(chunk), input ) ) > 0 )
+	{
+		bytes.insert( bytes.end(), chunk, chunk + count );
+	}
+
+	fclose( input );
+
+	if ( bytes.empty() )
+	{
+		return false;
+	}
+
+	ByteReader reader( & bytes[0], (int)bytes.size() );
+
+	uint8 magic[4];
+
+	if ( reader.readBytes( magic, 4 ) == false ||
+		 magic[0] != CHECKSUM_MAGIC[0] || magic[1] != CHECKSUM_MAGIC[1] ||
+		 magic[2] != CHECKSUM_MAGIC[2] || magic[3] != CHECKSUM_MAGIC[3] ||
+		 reader.readVarint() != CHECKSUM_VERSION )
+	{
+		return false;
+	}
+
+	bubbleHashes = reader.readByte() != 0;
+
+	while ( reader.getFailed() == false && reader.getRemaining() > 0 )
+	{
+		uint64 tickHash = 0;
+
+		for ( int i = 0; i < 8; i++ )
+		{
+			tickHash |= (uint64)reader.readByte() << ( i*8 );
+		}
+
+		if ( bubbleHashes )
+		{
+			uint32 bubbleCount = reader.readVarint();
+
+			if ( bubbleCount > (uint32)reader.getRemaining() / 4 )
+			{
+				break;
+			}
+
+			for ( uint32 b = 0; b < bubbleCount; b++ )
+			{
+				uint32 hash = 0;
+
+				for ( int j = 0; j < 4; j++ )
+				{
+					hash |= (uint32)reader.readByte() << ( j*8 );
+				}
+
+				bubbleHashList.push_back( hash );
+			}
+
+			firstBubble.push_back( (int)bubbleHashList.size() );
+		}
+
+		tickHashes.push_back( tickHash );
+	}
+
+	if ( reader.getFailed() || reader.getRemaining() > 0 )
+	{
+		clear();
+		return false;
+	}
+
+	return true;
+}
+
+/**
+*  Function: save(const char * fileName)
+*
+*  Purpose: This function writes the records kept in memory to a file, in the
+*           same format as open() does.
+*
+*  Inputs: fileName - The file to write.
+*
+*  Returns: True if the file was written.
+*/
+
+bool ChecksumStream::save(const char * fileName) const
+{
+	vector <uint8> bytes;
+	writeHeader( bytes );
+
+	ByteWriter writer( bytes );
+
+	for ( int t = 0; t < getTickCount(); t++ )
+	{
+		for ( int i = 0; i < 8; i++ )
+		{
+			writer.writeByte( (uint8)( tickHashes[t] >> ( i*8 ) ) );
+		}
+
+		if ( bubbleHashes )
+		{
+			writer.writeVarint( (uint32)getBubbleCount( t ) );
+
+			for ( int b = 0; b < getBubbleCount( t ); b++ )
+			{
+				uint32 hash = getBubbleHash( t, b );
+
+				for ( int j = 0; j < 4; j++ )
+				{
+					writer.writeByte( (uint8)( hash >> ( j*8 ) ) );
+				}
+			}
+		}
+	}
+
+	FILE * output = fopen( fileName, "wb" );
+
+	if ( output == NULL )
+	{
+		return false;
+	}
+
+	bool written = fwrite( & bytes[0], 1, bytes.size(), output ) == bytes.size();
+
+	return fclose( output ) == 0 && written;
+}
+
+/**
+*  Function: checksumFirstDifference(const ChecksumStream & a, const ChecksumStream & b, int & bubble)
+*
+*  Purpose: This function finds the first frame where two runs differ.  A run
+*           that stops early differs from the other one in the frame after its
+*           last.
+*
+*  Inputs: a, b - The two runs.
+*          bubble - Set to the first bubble that differs in that frame, or -1
+*                   if it can't be told (the streams don't both keep bubble
+*                   hashes, or only the level totals differ).
+*
+*  Returns: The first frame that differs, or -1 if the runs are the same.
+*/
+
+int checksumFirstDifference(const ChecksumStream & a, const ChecksumStream & b, int & bubble)
+{
+	bubble = -1;
+
+	int ticks = a.getTickCount() < b.getTickCount() ? a.getTickCount() : b.getTickCount();
+
+	for ( int t = 0; t < ticks; t++ )
+	{
+		if ( a.getTickHash( t ) == b.getTickHash( t ) )
+		{
+			continue;
+		}
+
+		if ( a.getBubbleHashes() && b.getBubbleHashes() )
+		{
+			int countA = a.getBubbleCount( t );
+			int countB = b.getBubbleCount( t );
+			int count = countA < countB ? countA : countB;
+
+			for ( int i = 0; i < count; i++ )
+			{
+				if ( a.getBubbleHash( t, i ) != b.getBubbleHash( t, i ) )
+				{
+					bubble = i;
+					break;
+				}
+			}
+
+			if ( bubble < 0 && countA != countB )
+			{
+				bubble = count;  // One run has a bubble the other doesn't.
+			}
+		}
+
+		return t;
+	}
+
+	if ( a.getTickCount() != b.getTickCount() )
+	{
+		return ticks;
+	}
+
+	return -1;
+}
@@ -0,0 +1,145 @@
+/**
+*  File:  Checksum.h
+*
+*  Description:  This header file contains the per-tick state checksums.  After
+*                every frame, a level can add a 64-bit hash of its whole state to
+*                a ChecksumStream: each bubble's position and heading step (the
+*                exact bits of the floats, so a run that is off by a fraction of
+*                a pixel differs in the frame it happens), radius, heading, pop
+*                flags and hold counter, plus levelPoints and currentPopping.
+*                The center isn't hashed on its own: every engine truncates it
+*                from the position, which is.  Two runs of the same game (on the scalar, SIMD
+*                or threaded engine, or on two versions of the code) can then be
+*                compared frame by frame, and checksumFirstDifference() finds
+*                the first frame where they part ways.  If the streams also keep
+*                a 32-bit hash of each bubble, it finds the first bubble that
+*                differs in that frame too.
+*
+*                A stream keeps its records in memory, or writes them straight to
+*                a file as they come in if open() is called first.
+*
+*                File format (see ByteStream.h): "PRCS", the version, 1 if there
+*                are bubble hashes and 0 if not, then for each frame the level
+*                hash as 8 raw bytes, and if there are bubble hashes, the number
+*                of bubbles followed by each bubble's hash as 4 raw bytes.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef CHECKSUM_H_
+#define CHECKSUM_H_
+
+#include "ByteStream.h"
+#include <stdio.h>
+#include <string.h>  // For memcpy().
+
+const uint32 CHECKSUM_VERSION = 2;
+
+const int CHECKSUM_PAUSED = 1;         // Bits of the flags given to checksumBubble().
+const int CHECKSUM_POPPING = 2;
+const int CHECKSUM_EXPANDING = 4;
+const int CHECKSUM_HOLDING = 8;
+const int CHECKSUM_CONTRACTING = 16;
+
+/**
+*  Function: checksumFloats(float low, float high)
+*
+*  Returns: The bits of two floats in one 64-bit word.
+*/
+
+inline uint64 checksumFloats(float low, float high)
+{
+	uint32 bits[2];
+	memcpy( & bits[0], & low, sizeof(bits[0]) );
+	memcpy( & bits[1], & high, sizeof(bits[1]) );
+
+	return (uint64)bits[0] | (uint64)bits[1] << 32;
+}
+
+/**
+*  Function: checksumBubble(int index, float x, float y, float stepX, float stepY, int radius, int degrees, int holdCounter, int flags)
+*
+*  Purpose: This function hashes one bubble.  The fields are packed into four
+*           64-bit words that are multiplied by different odd constants, so one
+*           bubble costs five multiplies, four of which don't depend on each
+*           other (or on the other bubbles), and the processor can work on
+*           several at once.
+*
+*  Inputs: index - The bubble's place in the level, so that two bubbles that
+*                  swap places change the hash.
+*          x ... holdCounter - The bubble's fields.
+*          flags - The CHECKSUM_ bits that are set.
+*
+*  Returns: The bubble's hash.  It is well mixed in its top 32 bits, which are
+*           what a stream keeps for each bubble.
+*/
+
+inline uint64 checksumBubble(int index, float x, float y, float stepX, float stepY, int radius, int degrees, int holdCounter, int flags)
+{
+	uint64 shape = (uint64)(uint32)radius | (uint64)(uint32)degrees << 32;
+	uint64 pop = (uint64)(uint32)holdCounter | (uint64)(uint32)flags << 32;
+
+	uint64 hash = checksumFloats( x, y ) * 0x9e3779b97f4a7c15ULL + checksumFloats( stepX, stepY ) * 0xbf58476d1ce4e5b9ULL +
+		          shape * 0xc2b2ae3d27d4eb4fULL + ( pop ^ (uint64)(uint32)index << 40 ) * 0x165667b19e3779f9ULL;
+
+	return ( hash ^ hash >> 29 ) * 0xd6e8feb86659fd93ULL;
+}
+
+/**
+*  Function: checksumFinish(uint64 bubbleSum, int levelPoints, int currentPopping)
+*
+*  Purpose: This function turns the sum of the bubble hashes and the level's
+*           totals into the level hash.
+*
+*  Inputs: bubbleSum - The bubble hashes added together.
+*          levelPoints, currentPopping - The level's totals.
+*
+*  Returns: The level hash.
+*/
+
+inline uint64 checksumFinish(uint64 bubbleSum, int levelPoints, int currentPopping)
+{
+	uint64 hash = bubbleSum ^ ( (uint64)(uint32)levelPoints | (uint64)(uint32)currentPopping << 32 ) * 0x9e3779b97f4a7c15ULL;
+
+	hash = ( hash ^ hash >> 33 ) * 0xff51afd7ed558ccdULL;
+	hash = ( hash ^ hash >> 33 ) * 0xc4ceb9fe1a85ec53ULL;
+
+	return hash ^ hash >> 33;
+}
+
+class ChecksumStream
+{
+private:
+	bool bubbleHashes;          // Keep a hash for each bubble as well.
+	FILE * file;                // If not NULL, records go here instead of into memory.
+	vector <uint64> tickHashes;
+	vector <int> firstBubble;   // Where each frame's bubbles start in bubbleHashList.  One extra at the end.
+	vector <uint32> bubbleHashList;
+	vector <uint8> buffer;
+
+	ChecksumStream(const ChecksumStream &);
+	ChecksumStream & operator=(const ChecksumStream &);
+
+	void writeHeader(vector <uint8> & bytes) const;
+
+public:
+	ChecksumStream(bool withBubbles = false);
+	~ChecksumStream();
+	bool open(const char * fileName);
+	bool close();
+	void clear();
+	bool getBubbleHashes() const;
+	void addTick(uint64 tickHash, const uint64 * bubbles, int bubbleCount);
+	int getTickCount() const;
+	uint64 getTickHash(int tick) const;
+	int getBubbleCount(int tick) const;
+	uint32 getBubbleHash(int tick, int bubble) const;
+	bool load(const char * fileName);
+	bool save(const char * fileName) const;
+};
+
+int checksumFirstDifference(const ChecksumStream & a, const ChecksumStream & b, int & bubble);
+
+#endif
@@ -7,7 +7,7 @@
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/2/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef CIRCLE_SPRITE_H_
@@ -15,7 +15,8 @@
 
 #include "Sprite.h"
 
-class CircleSprite : public Sprite
+template <class Platform>
+class CircleSprite : public Sprite<Platform>
 {
 private:
 	int radius;
@@ -23,8 +24,8 @@ private:
 	int centerY;
 
 public:
-	CircleSprite(int cX, int cY, int r, char * bubbleFileName, int imgID, int sprtID);
-	CircleSprite(int imgID, int sprtID, char fileName[]);
+	CircleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID);
+	CircleSprite(Platform & p, int imgID, int sprtID, MediaAsset image);
 	~CircleSprite();
 	int getRadius() const;
 	void setRadius(int r);
@@ -34,4 +35,166 @@ public:
 	int getCenterY() const;
 };
 
-#endif
\ No newline at end of file
+/**
+*  Function: CircleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID)
+*
+*  Purpose: This is the first constructor for the CircleSprite class.  It sets the radius
+*           and the x- and y-coordinates of its center point.
+*
+*           This version is called by the BubbleSprite constructor that is
+*           used to create the userBubble (the bubble created when the user
+*           clicks the mouse).
+*
+*  Inputs: p, imgID, sprtID, bubbleImage - passed up to the Sprite constructor.
+*          cX - The x-coordinate of the CircleSprite's center point.
+*          cY - The y-coordinate of the CircleSprite's center point.
+*          r - The radius (in pixels) of the CircleSprite.
+*/
+
+template <class Platform>
+CircleSprite<Platform>::CircleSprite(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID)
+            : Sprite<Platform>(p, imgID, sprtID, bubbleImage)
+{
+	setRadius( r );
+	setCenterX( cX );
+	setCenterY( cY );
+}
+
+/**
+*  Function: CircleSprite(Platform & p, int imgID, int sprtID, MediaAsset image)
+*
+*  Purpose: This is the second constructor for the CircleSprite class.  
+*
+*           This version is called by the BubbleSprite constructor that is 
+*           used to create the normal bubbles that are automatically 
+*           populated on the screen.
+*
+*  Inputs: p, imgID, sprtID, image - passed up the the Sprite constructor.
+*/
+
+template <class Platform>
+CircleSprite<Platform>::CircleSprite(Platform & p, int imgID, int sprtID, MediaAsset image)
+            : Sprite<Platform>(p, imgID, sprtID, image)
+{
+	// Pass all incoming arguments up to the Sprite constructor.
+}
+
+/**
+*  Function: ~CircleSprite() 
+*
+*  Purpose: This is the destructor for the CircleSprite class.  It is currently
+*           empty, but is here in case any new additions to the class require
+*           objects to be deleted, or memory to be freed.
+*/
+
+
+template <class Platform>
+CircleSprite<Platform>::~CircleSprite()
+{
+	// Destructor of the base class (Sprite) is automatically called.
+}
+
+/**
+*  Function: getRadius()
+*
+*  Purpose: This function is used primarily in Prisms.cpp in boundaryCollisionCheck() 
+*           and bubbleCollisionCheck().
+*
+*  Returns: The radius in pixels.
+*/
+
+template <class Platform>
+int CircleSprite<Platform>::getRadius() const
+{
+	return radius;
+}
+
+/**
+*  Function: setRadius(int r)
+*
+*  Purpose: This function sets the radius of the circle to the
+*           value passed to it.  The function ensures that the
+*           value passed in is non-negative, and sets radius
+*           to 0 otherwise.
+*
+*  Inputs: int r - The radius in pixels.
+*/
+
+template <class Platform>
+void CircleSprite<Platform>::setRadius(int r)
+{
+	if ( r >= 0 )  // Make sure r is non-negative.
+	{
+		radius = r;
+	}
+	else
+	{
+		radius = 0;  // Set to 0 otherwise.
+	}
+}
+
+/**
+*  Function: setCenterX(int cX)
+*
+*  Purpose: This function sets the x-coordinate of the circle's
+*           center point.  It is called from BubbleSprite's move()
+*           function.
+*
+*  Inputs: int cX - The x-coordinate of the circle's center point.
+*/
+
+template <class Platform>
+void CircleSprite<Platform>::setCenterX(int cX)
+{
+	centerX = cX;
+}
+
+/**
+*  Function: getCenterX()
+*
+*  Purpose: This function returns the x-coordinate of the circle's
+*           center point.  It is called from BubbleSprite's expand()
+*           and contract() methods.
+*
+*  Returns: The x-coordinate of the CircleSprite's current center point.
+*/
+
+template <class Platform>
+int CircleSprite<Platform>::getCenterX() const
+{
+	return centerX;
+}
+
+/**
+*  Function: setCenterY(int cY)
+*
+*  Purpose: This function sets the y-coordinate of the circle's
+*           center point.  It is called from BubbleSprite's move()
+*           function.
+*
+*  Inputs: int cY - The y-coordinate of the circle's center point.
+*/
+
+template <class Platform>
+void CircleSprite<Platform>::setCenterY(int cY)
+{
+	centerY = cY;
+}
+
+/**
+*  Function: getCenterY()
+*
+*  Purpose: This function returns the y-coordinate of the circle's
+*           center point.  It is called from BubbleSprite's expand()
+*           and contract() methods.
+*
+*  Returns: The y-coordinate of the CircleSprite's current center point. 
+*/
+
+template <class Platform>
+int CircleSprite<Platform>::getCenterY() const
+{
+	return centerY;
+}
+
+#endif
@@ -2,16 +2,19 @@
 *  File:  Constants.h                                                                         
 *                                                                                            
 *  Description:  This header file stores constants all in one place.                          
-*                It is imported into Sprite.h.											  
+*                It is imported into Sprite.h and Simulation.h.  It doesn't use
+*                DarkGDK, so the PrismsTools console project can use it too.
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/10/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef CONSTANTS_H_
 #define CONSTANTS_H_
 
+#include "Portable.h"  // For uint32.
+
 /**
 *  Application control constants:
 *
@@ -28,17 +31,77 @@ const int LEVELS = 12;
 const int TOTAL_POSSIBLE_POINTS = 390;
 const int MAX_ERROR_BUFFER = 150;
 
+/**
+*  Level constants:
+*
+*  LEVEL_BUBBLES holds the number of bubbles on the screen for each level,
+*  and GOAL_POINTS holds the number of bubbles that must be popped to win
+*  that level.  They are used by Prisms.cpp and by the headless simulation.
+*/
+
+const int LEVEL_BUBBLES[LEVELS] = { 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60 };
+const int GOAL_POINTS[LEVELS]   = { 1,  2,  3,  5,  7, 10, 15, 21, 27, 33, 44, 55 };
+
+/**
+*  Bubble constants:
+*
+*  BUBBLE_RADIUS is the starting radius of every bubble (the bubble images
+*  are 24 px wide).  A popping bubble expands by POP_EXPANSION pixels, holds
+*  its maximum size for POP_HOLD_TICKS frames, then contracts to nothing.
+*  Each bubble image is scaled ahead of time to every radius from 1 to
+*  MAX_FRAME_RADIUS (see BubbleFrames.h).
+*/
+
+const int BUBBLE_RADIUS = 12;
+const int POP_EXPANSION = 40;
+const int POP_HOLD_TICKS = 90;
+const int POP_ALPHA = 140;
+const int MAX_FRAME_RADIUS = BUBBLE_RADIUS + POP_EXPANSION;
+
+/**
+*  Level preparation constant:
+*
+*  While a cut-screen is up, the next level's sprites are made a few at a
+*  time, for up to PREPARE_SECONDS_PER_FRAME of each frame, so that pressing
+*  Play only has to show them.
+*/
+
+const double PREPARE_SECONDS_PER_FRAME = 0.004;
+
+/**
+*  Cut-screen constant:
+*
+*  A cut-screen is only drawn again when something on it changes.  Until
+*  then, each frame the game sleeps for MENU_IDLE_SECONDS, a frame's time,
+*  and reads the input again.
+*/
+
+const double MENU_IDLE_SECONDS = 1.0 / REFRESH_RATE;
+
+/**
+*  Rewind constants:
+*
+*  Holding REWIND_KEY (Backspace) during a level steps the game back one
+*  frame at a time, through the snapshots kept in Prisms.cpp.  Snapshots
+*  are only kept for levels of up to REWIND_MAX_BUBBLES bubbles, so stress
+*  mode doesn't spend its time copying them.
+*/
+
+const int REWIND_KEY = 14;  // Scan code for Backspace, for dbKeyState().
+const int REWIND_MAX_BUBBLES = 1000;
+
 /**
 *  Color constants:
 * 
 *  These are mainly used to change the color of the displayed text
-*  in the cut-screens.
+*  in the cut-screens.  They are written out the way dbRGB() makes
+*  them (0xAARRGGBB, opaque), so that they don't need DarkGDK.
 */
 
-const DWORD BLACK = dbRGB( 0, 0, 0 );
-const DWORD WHITE = dbRGB( 255, 255, 255 );
-const DWORD BLUE = dbRGB( 32, 171, 229 );
-const DWORD YELLOW = dbRGB( 255, 255, 0 );
+const uint32 BLACK = 0xff000000;
+const uint32 WHITE = 0xffffffff;
+const uint32 BLUE = 0xff20abe5;    // dbRGB( 32, 171, 229 )
+const uint32 YELLOW = 0xffffff00;
 
 /**
 *  Multimedia resource constants:
@@ -76,5 +139,26 @@ const int WHITE_OVERLAY_IMAGE_ID = 1011;
 const int WHITE_OVERLAY_SPRITE_ID = 1011;
 const int SPACE_BG_IMAGE_ID = 1012;
 const int GREEN_BG_IMAGE_ID = 1013;
+const int TINT_BUBBLE_IMAGE_ID = 1014;  // Shared by every tinted bubble (see FrontEnd.h).
+const int SCREEN_LAYER_IMAGE_ID = 1015;  // The cut-screen being shown, without its sprites.
+
+// Normal bubbles use IDs 1-999.  In stress mode, bubbles past that use IDs from
+// here up, to stay clear of the IDs above and below.
+const int FIRST_STRESS_RESOURCE_ID = 10000;
+
+// The bubbles' radius frames (BubbleFrames.h) use image IDs from here up,
+// MAX_FRAME_RADIUS for each bubble image, the user bubble's and the tinted
+// bubbles' (4000-7223).
+const int FIRST_BUBBLE_FRAME_IMAGE_ID = 4000;
+
+// The bubbles' circle images (BubbleCircles.h), one for each color family and
+// one for the user bubble (7500-7510).
+const int FIRST_BUBBLE_CIRCLE_IMAGE_ID = 7500;
+
+// Used by MediaLoader.cpp.  Images and sounds are made from a media pack through
+// MEDIA_MEMBLOCK_ID, and are loaded into the scratch IDs while a pack is made.
+const int MEDIA_MEMBLOCK_ID = 1;
+const int MEDIA_SCRATCH_IMAGE_ID = 3000;
+const int MEDIA_SCRATCH_SOUND_ID = 3000;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,1774 @@
+/**
+*  File:  FrontEnd.h
+*
+*  Description:  This header file contains GameFrontEnd, everything the player
+*                sees and clicks: the Intro screen and the other cut-screens,
+*                and the main game loop, which draws a GameSession (see
+*                GameSession.h) and passes it the mouse and the buttons.  It
+*                was the body of Prisms.cpp.
+*
+*                Each time through the loop, the user's first click is passed
+*                to the session, the session plays one frame, and the bubble
+*                sprites are moved, resized and faded to match its bubbles.
+*                Once enough bubbles have popped, the screen fades semi-white.
+*                When the session says the level is over, a different
+*                cut-screen function is invoked depending on the outcome, and
+*                the buttons of the cut-screens are passed back to the session.
+*
+*                The mouse is read as events (see InputEvents.h), so a click
+*                is the button going down, once, however long it is held.  A
+*                cut-screen is drawn when it comes up, and after that only when
+*                its hand pointer has to move, appear or disappear.  In between
+*                nothing is drawn and the game sleeps (see endMenuFrame()).
+*                Its background and text are only drawn once, when it comes
+*                up, and kept as an image (see cacheScreenLayer()), so drawing
+*                it again is one paste, and the buttons and the pointer, which
+*                are sprites.
+*
+*                GameFrontEnd is a template on a Backend (see Platform.h).
+*                Prisms.cpp runs it on DarkGDK, and PrismsTools' loop command
+*                runs the very same loop, cut-screens and all, on the null and
+*                software backends with scripted input.
+*
+*                Closing the window, pressing Esc or clicking an Exit button
+*                doesn't exit the program from inside a screen: it sets
+*                quitting, each screen returns, and run() cleans up and
+*                returns to its caller.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef FRONT_END_H_
+#define FRONT_END_H_
+
+#include "NormalBubble.h"
+#include "UserBubble.h"
+#include "ButtonSprite.h"
+#include "InputEvents.h"
+#include "Profiler.h"
+#include "GameSession.h"
+#include "BubbleCircles.h"
+#include <vector>  // To hold pointers to BubbleSprite objects.
+
+using namespace std;
+
+/**
+*  The bubble images, in the same order as the manifest in MediaFilePaths.h.
+*  A bubble's imageIndex (see Simulation.h) picks one of them.
+*/
+
+const MediaAsset BUBBLE_IMAGES[60] = { ASSET_red1_png, ASSET_red2_png, ASSET_red3_png, ASSET_red4_png, ASSET_red5_png,
+                                       ASSET_red6_png, ASSET_red7_png, ASSET_purple1_png, ASSET_purple2_png,
+                                       ASSET_purple3_png, ASSET_purple4_png, ASSET_blue1_png, ASSET_blue2_png,
+                                       ASSET_blue3_png, ASSET_blue4_png, ASSET_blue5_png, ASSET_blue6_png, ASSET_blue7_png,
+                                       ASSET_blue8_png, ASSET_blue9_png, ASSET_blue10_png, ASSET_green1_png,
+                                       ASSET_green2_png, ASSET_green3_png, ASSET_green4_png, ASSET_green5_png,
+                                       ASSET_green6_png, ASSET_green7_png, ASSET_green8_png, ASSET_green9_png,
+                                       ASSET_brown1_png, ASSET_brown2_png, ASSET_brown3_png, ASSET_brown4_png,
+                                       ASSET_orange1_png, ASSET_orange2_png, ASSET_orange3_png, ASSET_orange4_png,
+                                       ASSET_orange5_png, ASSET_orange6_png, ASSET_orange7_png, ASSET_orange8_png,
+                                       ASSET_yellow1_png, ASSET_yellow2_png, ASSET_yellow3_png, ASSET_yellow4_png,
+                                       ASSET_yellow5_png, ASSET_yellow6_png, ASSET_yellow7_png, ASSET_tan1_png,
+                                       ASSET_tan2_png, ASSET_tan3_png, ASSET_tan4_png, ASSET_gray1_png, ASSET_pink1_png,
+                                       ASSET_pink2_png, ASSET_pink3_png, ASSET_pink4_png, ASSET_pink5_png, ASSET_pink6_png };
+
+/**
+*  The colors of the bubble images, in the same order.  Each image is a disc of
+*  one color, so a tinted bubble shows tint_bubble.png, a white disc, tinted
+*  with its image's color (see setTintedBubbles()), and looks the same.
+*/
+
+const uint32 BUBBLE_TINTS[60] = { 0xffd90000, 0xffc40000, 0xffa00000, 0xffe70000, 0xffed0000, 0xffc40000, 0xffe70000,
+                                  0xff6f3198, 0xff6f1d98, 0xff921d98, 0xff921d98, 0xff6495ed, 0xff6a5acd, 0xff1e90ff,
+                                  0xff87cefa, 0xff5f9ea0, 0xff0000cd, 0xff6495ed, 0xff1e90ff, 0xff87cefa, 0xff5f9ea0,
+                                  0xff66cdaa, 0xff3cb371, 0xff98fb98, 0xff00ff7f, 0xff32cd32, 0xff22b14c, 0xff22674c,
+                                  0xff66cdaa, 0xff98fb98, 0xffcd853f, 0xfff4a460, 0xffcd743f, 0xfff4b460, 0xffffa500,
+                                  0xffff5000, 0xffffb800, 0xffff5000, 0xffff8200, 0xffff7000, 0xffffa500, 0xffffb800,
+                                  0xffffd700, 0xfffcff00, 0xffffb300, 0xfffcd600, 0xffffd700, 0xfffcff00, 0xffffb300,
+                                  0xffeee9e9, 0xffcdc0b0, 0xff8b7d6b, 0xffcdaf95, 0xff778899, 0xffff1493, 0xffff80f0,
+                                  0xffe54545, 0xffff15c2, 0xffff62c2, 0xffff62c2 };
+
+const MediaAsset NOTE_SOUNDS[6] = { ASSET_note1_wav, ASSET_note2_wav, ASSET_note3_wav, ASSET_note4_wav, ASSET_note5_wav,
+                                    ASSET_note6_wav };
+
+template <class Platform>
+class GameFrontEnd
+{
+private:
+	Platform & platform;
+	typename Platform::Renderer & renderer;
+	typename Platform::Audio & audio;
+	typename Platform::Input & input;
+
+	char lineBuffer[MAX_ERROR_BUFFER];  // Used for error reporting.
+
+	int halfScreenWidth;
+	int halfScreenHeight;
+
+	GameSession session;          // The game being played.  Everything drawn comes from it.
+
+	Replay replay;                // Every level played, added to replayFileName after each one.
+	const char * replayFileName;
+
+	bool quitting;                // Set once the user has closed the window, pressed Esc or clicked Exit.
+	InputEvents events;           // What the mouse has done since the events were last read.
+	bool hovering;                // Whether a cut-screen's hand pointer is showing.
+	int levelsPlayed;
+
+	SnapshotHistory rewindHistory;  // The session at the start of each frame of the level, for rewinding.
+	GameSnapshot snapshot;          // Working space for saving and restoring.
+	vector <uint8> snapshotBytes;
+
+	Sprite<Platform> * whiteOverlay;
+	Sprite<Platform> * handPointer;
+
+	ButtonSprite<Platform> * introPlayButton;
+	ButtonSprite<Platform> * instructionsButton;
+	ButtonSprite<Platform> * aboutButton;
+	ButtonSprite<Platform> * okButton;
+	ButtonSprite<Platform> * playButton;
+	ButtonSprite<Platform> * retryButton;
+	ButtonSprite<Platform> * playAgainButton;
+	ButtonSprite<Platform> * exitButton;
+
+	vector <BubbleSprite<Platform>*> bubbles;  // One sprite for each bubble in the session's level, in the same
+	                                           // order.  NULL where an image or sound file is missing.
+	int preparedBubbles;                       // How many of them have been made for the level (see prepareBubbles()).
+	BubbleFrames<Platform> bubbleFrames;       // The bubble images scaled to each radius.
+	BubbleCircles<Platform> bubbleCircles;     // Or, a circle for each color family.
+	bool circleBubbles;                        // Whether the bubbles are drawn as circles.
+	bool tintedBubbles;                        // Whether they share one image, tinted.
+
+	MediaAsset noteSounds[6];
+	SimRandom noteRandom;  // Shuffles noteSounds.
+
+	GameFrontEnd(const GameFrontEnd &);
+	GameFrontEnd & operator=(const GameFrontEnd &);
+
+	void loadComponents();
+	int bubbleResourceID(int index);
+	void loadImageFile(MediaAsset image, int id);
+	void loadSoundFile(MediaAsset sound, int id);
+	void sync();
+	void pollInput();
+	int readMenuEvents(ButtonSprite<Platform> * const buttons[], int count, bool & redraw);
+	void endMenuFrame(bool & redraw, bool busy);
+	void cacheScreenLayer();
+	void introScreen();
+	void instructionsScreen();
+	void aboutScreen();
+	void closeWindowListener();
+	void escapeKeyListener();
+	void levelStartScreen();
+	void showAllBubbleSprites();
+	void retryScreen();
+	void wonGameScreen();
+	void resetLevel();
+	void retryLevel();
+	void saveRewindFrame();
+	bool rewindGame();
+	void createAndLoadBubbles();
+	bool prepareBubbles(double seconds);
+	BubbleSprite<Platform> * createBubbleSprite(int index);
+	void useBubbleFrames(BubbleSprite<Platform> * bubble, int slot, int imageID);
+	void syncBubbleSprites(bool sounds);
+	void shuffle(MediaAsset assets[], int size);
+	void deleteComponents();
+	void deleteBubbles();
+
+public:
+	GameFrontEnd(Platform & p);
+	~GameFrontEnd();
+	GameSession & getSession();
+	void setReplayFileName(const char * fileName);
+	void setCircleBubbles(bool circles);
+	void setTintedBubbles(bool tinted);
+	void run(uint32 seed);
+	void quit();
+	int getLevelsPlayed() const;
+};
+
+/**
+*  Function: GameFrontEnd(Platform & p)
+*
+*  Purpose: This is the constructor for the GameFrontEnd class.  It doesn't use
+*           the backend yet, so it can be made before DarkGDK has started; the
+*           images, sounds and sprites are made by run().
+*
+*  Inputs: p - The backend to run on.  It has to outlive the front end.
+*/
+
+template <class Platform>
+GameFrontEnd<Platform>::GameFrontEnd(Platform & p)
+                      : platform(p), renderer(p.renderer), audio(p.audio), input(p.input), bubbleFrames(p), bubbleCircles(p), noteRandom(0)
+{
+	halfScreenWidth = SCREEN_WIDTH / 2;
+	halfScreenHeight = SCREEN_HEIGHT / 2;
+
+	replayFileName = REPLAY_FILE_NAME;
+	circleBubbles = false;
+	tintedBubbles = false;
+	quitting = false;
+	hovering = false;
+	levelsPlayed = 0;
+
+	whiteOverlay = NULL;
+	handPointer = NULL;
+	introPlayButton = NULL;
+	instructionsButton = NULL;
+	aboutButton = NULL;
+	okButton = NULL;
+	playButton = NULL;
+	retryButton = NULL;
+	playAgainButton = NULL;
+	exitButton = NULL;
+
+	preparedBubbles = 0;
+
+	for ( int i = 0; i < 6; i++ )
+	{
+		noteSounds[i] = NOTE_SOUNDS[i];
+	}
+}
+
+/**
+*  Function: ~GameFrontEnd()
+*
+*  Purpose: This is the destructor for the GameFrontEnd class.  Everything
+*           run() made is already gone by the time it returns, so there is
+*           nothing left to delete.
+*/
+
+template <class Platform>
+GameFrontEnd<Platform>::~GameFrontEnd()
+{
+}
+
+/**
+*  Function: getSession()
+*
+*  Purpose: This function returns the session, so that it can be set up (its
+*           config and level pack) before run() is called.
+*
+*  Returns: The session.
+*/
+
+template <class Platform>
+GameSession & GameFrontEnd<Platform>::getSession()
+{
+	return session;
+}
+
+/**
+*  Function: setReplayFileName(const char * fileName)
+*
+*  Purpose: This function sets where the replay is saved after each level.
+*           It is REPLAY_FILE_NAME unless this is called.  It must be called
+*           before run().
+*
+*  Inputs: fileName - The file, or NULL not to record a replay at all.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::setReplayFileName(const char * fileName)
+{
+	replayFileName = fileName;
+}
+
+/**
+*  Function: setCircleBubbles(bool circles)
+*
+*  Purpose: This function sets whether the bubbles are drawn as circles in
+*           their family's colors (see BubbleCircles.h) instead of from their
+*           images.  They aren't unless this is called.
+*
+*  Inputs: circles - True to draw circles.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::setCircleBubbles(bool circles)
+{
+	circleBubbles = circles;
+}
+
+/**
+*  Function: setTintedBubbles(bool tinted)
+*
+*  Purpose: This function sets whether the bubbles all share one image, a
+*           white disc loaded once, and each get their image's color from
+*           BUBBLE_TINTS when drawn, instead of each loading its own image.
+*           Only that image and its radius frames are kept, instead of one for
+*           each bubble and each color's.  They aren't unless this is called.
+*
+*  Inputs: tinted - True to tint the bubbles.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::setTintedBubbles(bool tinted)
+{
+	tintedBubbles = tinted;
+}
+
+/**
+*  Function: getLevelsPlayed()
+*
+*  Returns: How many levels have been played to the end, won or lost.
+*/
+
+template <class Platform>
+int GameFrontEnd<Platform>::getLevelsPlayed() const
+{
+	return levelsPlayed;
+}
+
+/**
+*  Function: quit()
+*
+*  Purpose: This function is called when the user closes the window, presses
+*           the Esc key or clicks an Exit button.  The screen that is up
+*           returns, and so does run(), once it has deleted everything.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::quit()
+{
+	quitting = true;
+}
+
+/**
+*  Function: run(uint32 seed)
+*
+*  Purpose: This function plays the game, from the Intro screen, until the user
+*           quits.  It contains the main game loop, which executes a maximum of
+*           60 times per second on DarkGDK.  This is the main loop that
+*           continuously checks for input, has the session play the level, and 
+*           renders the output to the screen.
+*
+*  Inputs: seed - Where the session's seeds start, so that every game is laid
+*                 out differently.  The note sounds are shuffled from it too.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::run(uint32 seed)
+{
+	quitting = false;
+
+	session.setReplay( replayFileName != NULL ? & replay : NULL );
+	session.start( seed );
+
+	noteRandom = SimRandom( seed + 156 );
+
+	loadComponents();
+
+	createAndLoadBubbles();  // Made while the first level's start screen is up.
+
+	introScreen();
+
+	input.showMouse();   
+
+	renderer.syncOn( REFRESH_RATE );  // Disable auto refresh, and refresh a maximum of 60 times per second.
+
+	while ( quitting == false && input.loop() )
+	{
+		PROFILE_SCOPE( "frame" );  // See Profiler.h.  Each phase below is timed as well.
+
+		{
+			PROFILE_SCOPE( "pasteImage" );
+			renderer.pasteImage( SPACE_BG_IMAGE_ID, 0, 0 );   // Paste background image at (0, 0).
+		}
+
+		{
+			PROFILE_SCOPE( "overlay display" );
+			whiteOverlay->display( 0, 0 );             // Paste the white overlay (normally transparent).
+		}
+
+		if ( input.keyState( REWIND_KEY ) == 1 && rewindGame() )  // Holding Backspace steps back a frame at a time,
+		{                                                         // instead of playing the next one.
+			events.clear();                                       // Clicks meanwhile don't count.
+			sync();
+			continue;
+		}
+
+		saveRewindFrame();                         // Keep this frame's starting state, for retrying and rewinding.
+
+		InputEvent event;
+
+		while ( events.next( event ) )
+		{
+			if ( event.type == MOUSE_PRESSED && session.click( event.x, event.y ) )  // The user's first click
+			{                                                                       // creates the userBubble.
+				handPointer->hide();
+			}
+		}
+
+		session.tick();                            // Play one frame of the level.
+
+		{
+			PROFILE_SCOPE( "syncBubbleSprites" );
+			syncBubbleSprites( true );             // Move, resize and fade the sprites to match.
+		}
+
+		if ( session.getOverlayAlpha() > 0 )      // Have enough bubbles popped to win the level?
+		{
+			whiteOverlay->setAlpha( session.getOverlayAlpha() );
+			whiteOverlay->show();
+		}
+
+		if ( session.getScreen() != SCREEN_PLAYING )  // Is the level over?
+		{
+			levelsPlayed++;
+
+			if ( replayFileName != NULL && replay.appendLevels( replayFileName ) == false )
+			{
+				sprintf( lineBuffer, "FrontEnd.h: Unable to write the replay file %s.", replayFileName );
+				logFile << lineBuffer << endl << endl;
+			}
+
+			if ( session.getScreen() == SCREEN_WON_GAME )  // Won entire game.
+			{
+				replay.clear();  // The next campaign gets a replay of its own.
+				resetLevel();
+				wonGameScreen();
+			}
+			else if ( session.getScreen() == SCREEN_LEVEL_START )  // Won normal level.
+			{
+				resetLevel();
+				levelStartScreen();
+			}
+			else  // Lost level.
+			{
+				renderer.hideAllSprites();
+				retryScreen();  // Puts the level back the way it started with retryLevel().
+			}
+		}
+	
+		{
+			PROFILE_SCOPE( "sync" );
+			sync();  // Refresh screen.
+		}
+	}
+
+	deleteBubbles();
+	bubbleFrames.clear();
+	bubbleCircles.clear();
+	deleteComponents();
+}
+
+/**
+*  Function: loadComponents()
+*
+*  Purpose: This function is called once, from run().  It loads the
+*           backgrounds, the success sound and, if the bubbles are tinted,
+*           their image, and creates the white overlay, the buttons and the
+*           hand pointer.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::loadComponents()
+{
+	loadImageFile( ASSET_background_space_bmp, SPACE_BG_IMAGE_ID ); 
+
+	loadImageFile( ASSET_background_green_bmp, GREEN_BG_IMAGE_ID );
+
+	if ( tintedBubbles )
+	{
+		loadImageFile( ASSET_tint_bubble_png, TINT_BUBBLE_IMAGE_ID );  // Shared by the bubbles.
+	}
+
+	whiteOverlay = new Sprite<Platform>( platform, WHITE_OVERLAY_IMAGE_ID, WHITE_OVERLAY_SPRITE_ID, ASSET_background_overlay_bmp );
+	whiteOverlay->display(0, 0);
+	whiteOverlay->setAlpha( 0 );
+	whiteOverlay->hide();
+
+	loadSoundFile( ASSET_success_wav, SUCCESS_SOUND_ID );
+
+	playButton = new ButtonSprite<Platform>(platform, PLAY_BUTTON_IMAGE_ID, PLAY_BUTTON_SPRITE_ID, 
+		                                    ASSET_play_button_png, halfScreenWidth, halfScreenHeight);
+	playButton->hide();
+
+	introPlayButton = new ButtonSprite<Platform>(platform, INTRO_PLAY_BUTTON_IMAGE_ID, INTRO_PLAY_BUTTON_SPRITE_ID, 
+		                                         ASSET_play_button_png, halfScreenWidth, 140);
+	introPlayButton->hide();
+
+	instructionsButton = new ButtonSprite<Platform>(platform, INSTRUCTIONS_BUTTON_IMAGE_ID, INSTRUCTIONS_BUTTON_SPRITE_ID,
+		                                            ASSET_instructions_button_png, halfScreenWidth, 210);
+
+	instructionsButton->hide();
+
+	aboutButton = new ButtonSprite<Platform>(platform, ABOUT_BUTTON_IMAGE_ID, ABOUT_BUTTON_SPRITE_ID,
+								             ASSET_about_button_png, halfScreenWidth, 280);
+
+	aboutButton->hide();
+
+	okButton = new ButtonSprite<Platform>(platform, OK_BUTTON_IMAGE_ID, OK_BUTTON_SPRITE_ID,
+		                                  ASSET_ok_button_png, halfScreenWidth, 300);
+
+	okButton->hide();
+
+	retryButton = new ButtonSprite<Platform>(platform, RETRY_BUTTON_IMAGE_ID, RETRY_BUTTON_SPRITE_ID, 
+		                                     ASSET_retry_button_png, halfScreenWidth, 200 );
+	retryButton->hide();
+
+	playAgainButton = new ButtonSprite<Platform>(platform, PLAY_AGAIN_BUTTON_IMAGE_ID, PLAY_AGAIN_BUTTON_SPRITE_ID, 
+		                                         ASSET_play_again_button_png, halfScreenWidth, halfScreenHeight);
+	playAgainButton->hide();
+
+	exitButton = new ButtonSprite<Platform>(platform, EXIT_BUTTON_IMAGE_ID, EXIT_BUTTON_SPRITE_ID, 
+		                                    ASSET_exit_button_png, halfScreenWidth, halfScreenHeight+100);
+	exitButton->hide();
+	
+	handPointer = new Sprite<Platform>( platform, HAND_POINTER_IMAGE_ID, HAND_POINTER_SPRITE_ID, ASSET_hand_pointer_png );
+	handPointer->display( input.mouseX(), input.mouseY() );
+	handPointer->scale( 20 );
+	handPointer->setOffset( 33, 0 );
+}
+
+/**
+*  Function: sync()
+*
+*  Purpose: This function ends a frame: it refreshes the screen, and has the
+*           input move on to the next frame.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::sync()
+{
+	renderer.sync();
+	pollInput();
+}
+
+/**
+*  Function: pollInput()
+*
+*  Purpose: This function has the input move on to the next frame, and queues
+*           the events for what the mouse did.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::pollInput()
+{
+	input.poll();
+	events.update( input.mouseX(), input.mouseY(), input.mouseClick() );
+}
+
+/**
+*  Function: readMenuEvents(ButtonSprite<Platform> * const buttons[], int count, bool & redraw)
+*
+*  Purpose: This function is called once a frame by the cut-screens.  It reads
+*           the events queued since the last frame, to find a click on one of
+*           the screen's buttons, and works out whether the mouse is over any
+*           of them.  If the screen has to be drawn, because it was already
+*           going to be, or because the hand pointer has to appear, disappear
+*           or follow the mouse, it puts the hand pointer or the normal one
+*           where the mouse is.
+*
+*  Inputs: buttons - The screen's buttons.
+*          count - How many there are.
+*          redraw - Whether the screen is to be drawn this frame.  Set if the
+*                   pointer changes.
+*
+*  Returns: Where the button that was clicked is in buttons, or -1 if none was.
+*/
+
+template <class Platform>
+int GameFrontEnd<Platform>::readMenuEvents(ButtonSprite<Platform> * const buttons[], int count, bool & redraw)
+{
+	InputEvent event;
+	bool moved = false;
+	int clicked = -1;
+
+	while ( events.next( event ) )
+	{
+		if ( event.type == MOUSE_MOVED )
+		{
+			moved = true;
+		}
+
+		for ( int i = 0; i < count && clicked < 0; i++ )
+		{
+			if ( buttons[i]->clicked( event ) )
+			{
+				clicked = i;
+			}
+		}
+	}
+
+	bool over = false;
+
+	for ( int i = 0; i < count; i++ )
+	{
+		over = over || buttons[i]->mouseOver( input.mouseX(), input.mouseY() );
+	}
+
+	if ( over != hovering || ( over && moved ) )  // Away from the buttons, the normal pointer moves by itself.
+	{
+		redraw = true;
+	}
+
+	if ( redraw )
+	{
+		if ( over )
+		{
+			input.hideMouse();
+			handPointer->display( input.mouseX(), input.mouseY() );
+			handPointer->show();
+		}
+		else
+		{
+			input.showMouse();
+			handPointer->hide();
+		}
+	}
+
+	hovering = over;
+
+	return clicked;
+}
+
+/**
+*  Function: endMenuFrame(bool & redraw, bool busy)
+*
+*  Purpose: This function ends a cut-screen's frame.  If the screen was drawn
+*           it is shown, as sync() does.  If not, and there is no work to do,
+*           the input is given time to change first (see MENU_IDLE_SECONDS).
+*           Either way the input moves on to the next frame.
+*
+*  Inputs: redraw - Whether the screen was drawn this frame.  Cleared for the
+*                   next one.
+*          busy - Whether there is work to do, so the next frame shouldn't
+*                 wait.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::endMenuFrame(bool & redraw, bool busy)
+{
+	if ( redraw )
+	{
+		sync();
+		redraw = false;
+		return;
+	}
+
+	if ( busy == false )
+	{
+		input.idle();
+	}
+
+	pollInput();
+}
+
+/**
+*  Function: bubbleResourceID(int index)
+*
+*  Purpose: This function picks the image, sprite and sound ID for the bubble
+*           at position index in the bubbles vector.  Normally that is just
+*           index+1, but in stress mode there can be more than 999 bubbles, so
+*           the IDs skip over the block starting at 1000 that is used by the
+*           buttons, backgrounds and user bubble (see Constants.h).
+*
+*  Inputs: index - The bubble's position in the bubbles vector.
+*
+*  Returns: The ID to use.
+*/
+
+template <class Platform>
+int GameFrontEnd<Platform>::bubbleResourceID(int index)
+{
+	if ( index+1 < SUCCESS_SOUND_ID )
+	{
+		return index+1;
+	}
+
+	return index+1 + FIRST_STRESS_RESOURCE_ID - SUCCESS_SOUND_ID;
+}
+
+/**
+*  Function: loadImageFile(MediaAsset image, int id)
+*
+*  Purpose: This function safely loads an image file, from the media pack if
+*           it is in it, and writes an error to the log file if it does not
+*           succeed.
+*
+*  Inputs: image - The image, from the manifest in MediaFilePaths.h.
+*          id - The image ID that will be associated with
+*               this image resource.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::loadImageFile(MediaAsset image, int id)
+{
+	if ( renderer.loadImage( image, id ) == false )
+	{
+		sprintf( lineBuffer, "FrontEnd.h: loadImageFile(): File %s does not exist.", getMediaPath( image ) );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: loadSoundFile(MediaAsset sound, int id)
+*
+*  Purpose: This function safely loads a sound file, from the media pack if
+*           it is in it, and writes an error to the log file if it does not
+*           succeed.
+*
+*  Inputs: sound - The sound, from the manifest in MediaFilePaths.h.
+*          id - The sound ID that will be associated with
+*               this sound resource.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::loadSoundFile(MediaAsset sound, int id)
+{
+	if ( audio.loadSound( sound, id ) == false )
+	{
+		sprintf( lineBuffer, "FrontEnd.h: loadSoundFile(): File %s does not exist.", getMediaPath( sound ) );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: cacheScreenLayer()
+*
+*  Purpose: This function is called by each cut-screen when it comes up, once
+*           it has pasted its background and written its text.  It keeps what
+*           is on the screen as SCREEN_LAYER_IMAGE_ID, which the screen then
+*           pastes each time it is drawn, instead of writing the text again.
+*           It writes an error to the log file if it does not succeed.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::cacheScreenLayer()
+{
+	if ( renderer.grabScreen( SCREEN_LAYER_IMAGE_ID ) == false )
+	{
+		sprintf( lineBuffer, "FrontEnd.h: cacheScreenLayer(): Unable to make the cut-screen's image." );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: introScreen()
+*
+*  Purpose: This function draws the Intro screen that appears at the start
+*           of the game.  It checks to see if the user's mouse is hovering
+*           over any of the buttons, and changes the normal arrow pointer
+*           to a hand pointer.  It also determines which button the user has
+*           clicked, and calls the function to draw that screen.  It also
+*           calls listeners that check if the user has exited the program by 
+*           clicking the X button in the top right corner, or if they have 
+*           pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::introScreen()
+{
+	ButtonSprite<Platform> * const buttons[4] = { introPlayButton, instructionsButton, aboutButton, exitButton };
+	int clicked = -1;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	int y1 = 40;
+
+	exitButton->reposition( halfScreenWidth, 350 );
+
+	renderer.ink( YELLOW, WHITE );
+
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 ); 
+
+	renderer.setTextSize(40);
+	renderer.centerText( halfScreenWidth, y1, "Prisms" );
+
+	cacheScreenLayer();
+
+	introPlayButton->show();
+	instructionsButton->show();
+	aboutButton->show();
+	exitButton->show();
+
+	while ( clicked < 0 )
+	{
+		closeWindowListener();  // Check to see if user closes the window.
+
+		escapeKeyListener();  
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		clicked = readMenuEvents( buttons, 4, redraw );
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		endMenuFrame( redraw, clicked >= 0 );
+	}
+
+	introPlayButton->hide();
+	instructionsButton->hide();
+	aboutButton->hide();
+	exitButton->hide();
+	exitButton->reposition( halfScreenWidth, halfScreenHeight+100 );
+	handPointer->hide();
+
+	if ( buttons[clicked] == introPlayButton )
+	{
+		levelStartScreen();
+	}
+	else if ( buttons[clicked] == instructionsButton )
+	{
+		instructionsScreen();
+	}
+	else if ( buttons[clicked] == aboutButton )
+	{
+		aboutScreen();
+	}
+	else if ( buttons[clicked] == exitButton )
+	{
+		quit();
+	}
+}
+
+/**
+*  Function: levelStartScreen()
+*
+*  Purpose: This function draws the screen that appears at the start of
+*           each level.  It checks to see if the user's mouse is hovering
+*           over the Play button, and changes the normal arrow pointer
+*           to a hand pointer.  While it waits, the level's sprites are made
+*           a little at a time by prepareBubbles(), so that they only have to
+*           be shown once Play is pressed.  If the Play button is clicked, the screen
+*           contents are hidden, showAllBubbleSprites() is called, the session
+*           is told to play, control is passed to the main game loop and the
+*           level begins.  It also
+*           calls listeners that check if the user has exited the program 
+*           by clicking the X button in the top right corner, or if they 
+*           have pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::levelStartScreen()
+{
+	ButtonSprite<Platform> * const buttons[1] = { playButton };
+	bool buttonClicked = false;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	renderer.setTextSize(40);
+
+	char buffer1[15];  
+
+	if ( session.getLevel() == LEVELS )
+	{
+		sprintf( buffer1, "Final Level" );
+	}
+	else
+	{
+		sprintf( buffer1, "Level %d / %d", session.getLevel(), LEVELS );  
+	}
+	
+	char buffer2[20];
+	sprintf( buffer2, "Goal: %d out of %d", session.getGoalPoints(), session.getLevelBubbleCount() );
+
+	char buffer3[20]; 
+	sprintf( buffer3, "Total Score: %d", session.getTotalPoints() );  
+
+	int y1 = 50;
+	int y2 = 100;
+	int y3 = 150;
+	int y4 = 400;
+	
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 );
+
+	if ( session.getWonLevel() == true )
+	{
+		renderer.ink( BLUE, BLUE );
+		renderer.centerText( halfScreenWidth, y1, "Good job!" );
+	}
+
+	renderer.ink( YELLOW, YELLOW );
+	renderer.centerText( halfScreenWidth, y2, buffer1 );  // Level %d  
+
+	renderer.ink( YELLOW, YELLOW );
+	renderer.centerText( halfScreenWidth, y3, buffer2 );  // Goal: %d out of %d
+
+	renderer.centerText( halfScreenWidth, y4, buffer3 );  // Total Score: %d
+
+	cacheScreenLayer();
+
+	playButton->show();
+
+	while ( buttonClicked == false )
+	{
+		closeWindowListener();  // Check to see if user closes the window.
+
+		escapeKeyListener();
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		buttonClicked = readMenuEvents( buttons, 1, redraw ) >= 0;
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		bool preparing = prepareBubbles( PREPARE_SECONDS_PER_FRAME ) == false;  // Make the level's sprites while the screen is up.
+
+		endMenuFrame( redraw, preparing || buttonClicked );
+	}
+
+	prepareBubbles( -1.0 );  // Normally already done, unless Play was pressed right away.
+
+	showAllBubbleSprites();    
+
+	playButton->hide();
+	handPointer->hide();
+
+	input.showMouse(); // Show normal mouse.
+
+	session.play();  // Resets levelPoints here so we still have access to it for output above.
+}
+
+/**
+*  Function: showAllBubbleSprites()
+*
+*  Purpose: This function renders each of the bubble sprites to the screen
+*           that are currently stored in the bubbles vector.  It is called
+*           at the end of levelStartScreen().
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::showAllBubbleSprites()
+{
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		if ( bubbles[i] != NULL )
+		{
+			bubbles[i]->show();
+		}
+	}
+}
+
+/**
+*  Function: instructionsScreen()
+*
+*  Purpose: This function draws the screen that appears when the user clicks
+*           the Instructions button on the Intro screen.  It checks to see if 
+*           the user's mouse is hovering over the OK button, and changes the 
+*           normal arrow pointer to a hand pointer.  If the OK button is clicked, 
+*           the introScreen() function is called and the user is returned to 
+*           that screen. It also checks if the user has exited the program by
+*           clicking the X button in the top right corner, or if they have
+*           pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::instructionsScreen()
+{
+	ButtonSprite<Platform> * const buttons[1] = { okButton };
+	bool buttonClicked = false;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	okButton->reposition( halfScreenWidth, 210 );
+
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 );
+
+	renderer.ink( BLUE, BLUE );
+	renderer.setTextSize( 40 );
+	renderer.centerText( halfScreenWidth, 50, "Instructions" );
+
+	renderer.ink( WHITE, WHITE );
+	renderer.setTextSize( 20 );
+
+	renderer.text( 50, 100, "Click the mouse once to create a bubble." );
+	renderer.text( 50, 120, "If your bubble touches any other bubbles on" );
+	renderer.text( 50, 140, "the screen, it will create a chain reaction!" );
+
+	cacheScreenLayer();
+
+	okButton->show();
+
+	while ( buttonClicked == false )
+	{
+		closeWindowListener();
+
+		escapeKeyListener();
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		buttonClicked = readMenuEvents( buttons, 1, redraw ) >= 0;
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		endMenuFrame( redraw, buttonClicked );
+	}
+
+	okButton->hide();
+	okButton->reposition( halfScreenWidth, 300 );  // put back in its normal position
+	handPointer->hide();
+
+	input.showMouse(); // Show normal mouse.
+
+	introScreen();
+}
+
+/**
+*  Function: aboutScreen()
+*
+*  Purpose: This function draws the screen that appears when the user clicks
+*           the About button on the Intro screen.  It checks to see if the
+*           user's mouse is hovering over the OK button, and changes the 
+*           normal arrow pointer to a hand pointer.  If the OK button is clicked, 
+*           the introScreen() function is called and the user is returned to 
+*           that screen. It also checks if the user has exited the program by
+*           clicking the X button in the top right corner, or if they have
+*           pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::aboutScreen()
+{
+	ButtonSprite<Platform> * const buttons[1] = { okButton };
+	bool buttonClicked = false;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	okButton->reposition( halfScreenWidth, 380 );
+
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 );
+
+	renderer.ink( BLUE, BLUE );
+	renderer.setTextSize( 40 );
+	renderer.centerText( halfScreenWidth, 50, "About" );
+
+	renderer.ink( WHITE, WHITE );
+	renderer.setTextSize( 20 );
+
+	renderer.text( 50, 100, "Language: C++" );
+	renderer.text( 50, 120, "Game Programming Library: DarkGDK" );
+	renderer.text( 50, 140, "IDE: Visual C++ 2008 Express Edition" );
+	renderer.text( 50, 160, "Installer: InstallShield 2010" );
+	renderer.text( 50, 180, "Graphics: GIMP" );
+	renderer.text( 50, 200, "Sound Effects: Reason" );
+
+	renderer.text( 50, 240, "The source code is available in the 'source'" );
+	renderer.text( 50, 260, "directory in the game's program directory." );
+
+	renderer.text( 50, 300, "Programmer: Jason Jobes ( jjobes@gmail.com )" );
+
+	cacheScreenLayer();
+
+	okButton->show();
+
+	while ( buttonClicked == false )
+	{
+		closeWindowListener();
+
+		escapeKeyListener();
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		buttonClicked = readMenuEvents( buttons, 1, redraw ) >= 0;
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		endMenuFrame( redraw, buttonClicked );
+	}
+
+	okButton->hide();
+	okButton->reposition( halfScreenWidth, 300 );
+	handPointer->hide();
+
+	input.showMouse(); // Show normal mouse.
+
+	introScreen();
+}
+
+/**
+*  Function: retryScreen()
+*
+*  Purpose: This function draws the screen that appears after the level when
+*           the user does not pop enough bubbles.  It checks to see if the
+*           user's mouse is hovering over the Retry or Exit buttons, and changes 
+*           the normal arrow pointer to a hand pointer.  If the Retry button is 
+*           clicked, the level is put back the way it started by retryLevel(),
+*           and levelStartScreen() is called and that screen is displayed.  
+*           If the Exit button is clicked, the program exits.  It also checks 
+*           if the user has exited the program by clicking the X button in the 
+*           top right corner, or if they have pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::retryScreen()
+{
+	ButtonSprite<Platform> * const buttons[2] = { retryButton, exitButton };
+	bool buttonClicked = false;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	exitButton->reposition( halfScreenWidth, 300 );
+
+	renderer.ink( WHITE, WHITE );
+	renderer.setTextSize(40);
+
+	char buffer1[30]; 
+	sprintf( buffer1, "You got %d out of %d.", session.getLevelPoints(), session.getGoalPoints() );
+
+	char buffer2[30];
+	sprintf( buffer2, "Total Score: %d", session.getTotalPoints() ); 
+
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 );
+
+	renderer.ink( BLUE, BLUE );
+	renderer.centerText( halfScreenWidth, 50, "Too bad." );   // Too bad.
+
+	renderer.ink( WHITE, WHITE );
+	renderer.centerText( halfScreenWidth, 100, buffer1 );     // You got %d out of %d.
+
+	renderer.centerText( halfScreenWidth, 400, buffer2 );     // Total Score: %d
+
+	cacheScreenLayer();
+
+	retryButton->show();
+	exitButton->show();
+
+	while ( buttonClicked == false )
+	{
+		closeWindowListener();
+
+		escapeKeyListener();
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		int clicked = readMenuEvents( buttons, 2, redraw );
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		if ( clicked >= 0 && buttons[clicked] == retryButton )
+		{
+			buttonClicked = true;
+			handPointer->hide();
+		}
+		else if ( clicked >= 0 && buttons[clicked] == exitButton )
+		{
+			quit();
+			return;
+		}
+
+		endMenuFrame( redraw, buttonClicked );
+	}
+
+	retryButton->hide();
+	exitButton->reposition( halfScreenWidth, halfScreenHeight+100 );
+	exitButton->hide();
+	handPointer->hide();
+
+	input.showMouse();  // Show normal mouse.
+
+	retryLevel();
+
+	levelStartScreen();
+}
+
+/**
+*  Function: wonGameScreen()
+*
+*  Purpose: This function draws the screen that appears after the user has won
+*           the final level.  It checks to see if the user's mouse is hovering 
+*           over the Play Again or Exit buttons, and changes the normal arrow 
+*           pointer to a hand pointer.  If the Play Again button is clicked, 
+*           introScreen() is called and that screen is displayed. If the Exit 
+*           button is clicked, the game quits.  It 
+*           also checks if the user has exited the program by clicking the X 
+*           button in the top right corner, or if they have pressed the Esc key.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::wonGameScreen()
+{
+	audio.playSound( SUCCESS_SOUND_ID );
+
+	ButtonSprite<Platform> * const buttons[2] = { playAgainButton, exitButton };
+	int clicked = -1;
+	bool redraw = true;  // Drawn when it comes up, then only when the pointer changes.
+
+	renderer.setTextSize(40);
+
+	char buffer1[30];  
+	sprintf( buffer1, "Final Score: %d out of %d", session.getTotalPoints(), TOTAL_POSSIBLE_POINTS ); 
+	
+	renderer.pasteImage( GREEN_BG_IMAGE_ID, 0, 0 );
+
+	renderer.ink( YELLOW, WHITE );
+
+	renderer.centerText( halfScreenWidth, 50, "Congratulations!" );
+	renderer.centerText( halfScreenWidth, 100, "You have won the game!" );
+
+	renderer.centerText( halfScreenWidth, 150, buffer1 );  // Final Score: %d out of 390
+
+	cacheScreenLayer();
+
+	playAgainButton->show();
+	exitButton->show();
+
+	while ( clicked < 0 )
+	{
+		closeWindowListener();
+
+		escapeKeyListener();
+
+		if ( quitting )
+		{
+			return;
+		}
+
+		clicked = readMenuEvents( buttons, 2, redraw );
+
+		if ( redraw )
+		{
+			renderer.pasteImage( SCREEN_LAYER_IMAGE_ID, 0, 0 );  // Everything but the buttons and the pointer.
+		}
+
+		bool preparing = prepareBubbles( PREPARE_SECONDS_PER_FRAME ) == false;  // The next campaign's first level.
+
+		endMenuFrame( redraw, preparing || clicked >= 0 );
+	}
+
+	playAgainButton->hide();
+	exitButton->hide();
+
+	handPointer->hide();
+
+	input.showMouse(); // Show normal mouse.
+
+	session.playAgain();  // Resets the score.
+
+	if ( buttons[clicked] == playAgainButton )
+	{
+		introScreen();
+	}
+	else if ( buttons[clicked] == exitButton )
+	{
+		quit();
+	}
+}
+
+/**
+*  Function: closeWindowListener()
+*
+*  Purpose: This function checks if the user has clicked on the X in the
+*           upper right-hand corner of the window.  It does this by checking
+*           if the input's loop() (LoopGDK() on DarkGDK) returns false, which
+*           is what it does when the user closes the window by pressing X.  If
+*           the user clicks the X, the game quits.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::closeWindowListener()
+{
+	if ( input.loop() == false )
+	{
+		quit();
+	}
+}
+
+/**
+*  Function: escapeKeyListener()
+*
+*  Purpose: This function checks if the user has pressed the Esc key on
+*           the keyboard.  If so, the game quits.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::escapeKeyListener()
+{
+	if ( input.escapeKey() == 1 )
+	{
+		quit();
+	}
+}
+
+/**
+*  Function: resetLevel()
+*
+*  Purpose: This function is called from the main game loop whenever the
+*           entire game is won or a level is won, once the session has laid
+*           out the next level.  It has createAndLoadBubbles() start replacing
+*           the bubble objects in the bubbles vector with new ones for the new
+*           level, which is done during the cut-screen.  It makes the white
+*           overlay invisible, then hides all currently visible sprites to
+*           prepare for entry into the cut-screen.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::resetLevel()
+{
+	createAndLoadBubbles(); 
+    whiteOverlay->setAlpha( 0 );
+	rewindHistory.clear();
+	renderer.hideAllSprites();
+}
+
+/**
+*  Function: retryLevel()
+*
+*  Purpose: This function is called from retryScreen() when the user chooses to
+*           retry a level they lost.  Instead of laying out a new level the way
+*           resetLevel() does, the session puts back the level as it was when
+*           Play was pressed, so the same bubbles are back where they started.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::retryLevel()
+{
+	session.retry();
+
+	syncBubbleSprites( false );
+	whiteOverlay->setAlpha( 0 );
+	rewindHistory.clear();
+
+	renderer.hideAllSprites();  // levelStartScreen() shows the bubbles again.
+}
+
+/**
+*  Function: saveRewindFrame()
+*
+*  Purpose: This function is called at the start of each frame of the main game
+*           loop.  It adds the state of the session to rewindHistory, where it
+*           is kept as a delta from the last keyframe, a few hundred bytes for
+*           a level of 60 bubbles.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::saveRewindFrame()
+{
+	if ( session.getSimulation().getTickCount() == 0 )
+	{
+		rewindHistory.clear();
+	}
+
+	if ( session.getLevelBubbleCount() <= REWIND_MAX_BUBBLES )
+	{
+		session.capture( snapshot );
+		writeGameSnapshot( snapshot, snapshotBytes );
+		rewindHistory.push( snapshotBytes );
+	}
+}
+
+/**
+*  Function: rewindGame()
+*
+*  Purpose: This function is called from the main game loop while the user
+*           holds the rewind key.  It puts the session back the way it was at
+*           the start of the last frame played, and forgets that frame, so
+*           holding the key steps back one frame each time through the loop.
+*           When it gets back to the level's first frame it stays there.  The
+*           sprites are redrawn without their pop sounds.
+*
+*  Returns: False if this level is too big to keep snapshots of, in which case
+*           the game should just go on playing.
+*/
+
+template <class Platform>
+bool GameFrontEnd<Platform>::rewindGame()
+{
+	if ( session.getLevelBubbleCount() > REWIND_MAX_BUBBLES )
+	{
+		return false;
+	}
+
+	int frame = rewindHistory.getCount() - 1;
+
+	if ( frame >= 0 && rewindHistory.get( frame, snapshotBytes ) &&
+		 readGameSnapshot( & snapshotBytes[0], (int)snapshotBytes.size(), snapshot ) &&
+		 session.rewind( snapshot ) )
+	{
+		rewindHistory.truncate( frame );
+	}
+
+	syncBubbleSprites( false );
+	whiteOverlay->setAlpha( session.getOverlayAlpha() );
+
+	return true;
+}
+
+/**
+*  Function: createAndLoadBubbles()
+*
+*  Purpose: This function starts making a sprite for each bubble in the
+*           session's level, to be loaded into the bubbles vector.  It is
+*           called from resetLevel(), which gets called after every level, and
+*           before the first level.  The sprites themselves are made by
+*           prepareBubbles() while the cut-screen is up.  The layout comes
+*           from LevelSimulation::generate(), seeded by the session, so each
+*           level has a uniquely filled bubbles vector, with different colored
+*           bubbles and sounds, and yet can be played again exactly from its
+*           seed (see Replay.h).
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::createAndLoadBubbles()
+{
+	shuffle( noteSounds, 6 );  // For the userBubble's note.
+
+	preparedBubbles = 0;  // Every sprite in the bubbles vector belongs to the last level.
+}
+
+/**
+*  Function: prepareBubbles(double seconds)
+*
+*  Purpose: This function is called each time through the cut-screen loops.
+*           It replaces the last level's sprites in the bubbles vector with
+*           hidden ones for the session's level, one at a time, for as long
+*           as it is given, so that no single frame has to load a whole
+*           level's images and sounds.  Each old sprite is deleted just before
+*           the new one at its place is made, as they share IDs.  (DarkGDK
+*           only makes images, sounds and sprites on the thread that owns the
+*           window, so this can't be done on another thread.)
+*
+*  Inputs: seconds - How long it may take, or less than 0 to finish.
+*
+*  Returns: True once every sprite for the level has been made.
+*/
+
+template <class Platform>
+bool GameFrontEnd<Platform>::prepareBubbles(double seconds)
+{
+	PROFILE_SCOPE( "prepareBubbles" );
+
+	const LevelSimulation & sim = session.getSimulation();
+	double stop = getSeconds() + seconds;
+	bool made = false;
+
+	while ( (int)bubbles.size() > sim.getBubbleCount() || preparedBubbles < sim.getBubbleCount() )
+	{
+		if ( seconds >= 0.0 && getSeconds() >= stop )
+		{
+			return false;
+		}
+
+		if ( (int)bubbles.size() > sim.getBubbleCount() )  // The last level had more.
+		{
+			delete bubbles.back();
+			bubbles.pop_back();
+			continue;
+		}
+
+		if ( preparedBubbles < (int)bubbles.size() )
+		{
+			delete bubbles[preparedBubbles];
+			bubbles[preparedBubbles] = createBubbleSprite( preparedBubbles );
+		}
+		else
+		{
+			bubbles.push_back( createBubbleSprite( preparedBubbles ) );
+		}
+
+		if ( bubbles[preparedBubbles] != NULL )
+		{
+			bubbles[preparedBubbles]->hide();  // Shown by showAllBubbleSprites() once Play is pressed.
+		}
+
+		preparedBubbles++;
+		made = true;
+	}
+
+	if ( made )  // Just finished: only keep the radius frames the level uses.
+	{
+		bool used[BUBBLE_FRAME_SLOTS] = { false };
+
+		used[USER_BUBBLE_FRAME_SLOT] = true;  // Every level has one.
+
+		for ( int i = 0; i < (int)bubbles.size(); i++ )
+		{
+			if ( bubbles[i] != NULL && bubbles[i]->getFrameSlot() >= 0 )
+			{
+				used[bubbles[i]->getFrameSlot()] = true;
+			}
+		}
+
+		bubbleFrames.trim( used );
+	}
+
+	return true;
+}
+
+/**
+*  Function: createBubbleSprite(int index)
+*
+*  Purpose: This function creates the sprite for the bubble at position index
+*           in the session's level: a UserBubble for the user bubble, and a
+*           NormalBubble with the bubble's image and note for the others.  If
+*           it is unable to load one of the image or sound files, it writes an
+*           error to the log file.
+*
+*  Inputs: index - The bubble's position in the level, and in the bubbles vector.
+*
+*  Returns: The new sprite, or NULL if a file is missing.
+*/
+
+template <class Platform>
+BubbleSprite<Platform> * GameFrontEnd<Platform>::createBubbleSprite(int index)
+{
+	const SimBubble & b = session.getSimulation().getBubble( index );
+	int id = bubbleResourceID( index );
+
+	if ( b.isUserBubble )
+	{
+		if ( mediaExists( ASSET_user_bubble_png ) )
+		{
+			BubbleSprite<Platform> * bubble = new UserBubble<Platform>( platform, b.centerX, b.centerY, b.radius, ASSET_user_bubble_png,
+				                                                        USER_BUBBLE_IMAGE_ID, USER_BUBBLE_SPRITE_ID, noteSounds[b.noteIndex], id );
+			useBubbleFrames( bubble, USER_BUBBLE_FRAME_SLOT, USER_BUBBLE_IMAGE_ID );
+
+			return bubble;
+		}
+
+		sprintf( lineBuffer, "FrontEnd.h: createBubbleSprite(): Image file %s does not exist.", getMediaPath( ASSET_user_bubble_png ) );
+		logFile << lineBuffer << endl << endl;
+
+		return NULL;
+	}
+
+	// Past 60 bubbles (stress mode) the images are reused in turn.
+	MediaAsset bubbleImage = BUBBLE_IMAGES[b.imageIndex];
+	MediaAsset noteSound = noteSounds[b.noteIndex];
+
+	if ( tintedBubbles )
+	{
+		bubbleImage = ASSET_tint_bubble_png;
+	}
+
+	if ( mediaExists( bubbleImage ) )
+	{
+		if ( mediaExists( noteSound ) )
+		{
+			BubbleSprite<Platform> * bubble = NULL;
+
+			if ( tintedBubbles )
+			{
+				bubble = new NormalBubble<Platform>( platform, b.centerX, b.centerY, b.radius, b.degrees, SHARED_IMAGE,
+					                                 TINT_BUBBLE_IMAGE_ID, id, noteSound, id );
+				bubble->setTint( BUBBLE_TINTS[b.imageIndex] );
+				useBubbleFrames( bubble, TINT_BUBBLE_FRAME_SLOT, TINT_BUBBLE_IMAGE_ID );
+			}
+			else
+			{
+				bubble = new NormalBubble<Platform>( platform, b.centerX, b.centerY, b.radius, b.degrees, bubbleImage,
+					                                 id, id, noteSound, id );
+				useBubbleFrames( bubble, b.imageIndex, id );
+			}
+
+			return bubble;
+		}
+		else
+		{
+			sprintf( lineBuffer, "FrontEnd.h: createBubbleSprite(): Sound file %s does not exist.", getMediaPath( noteSound ) );
+			logFile << lineBuffer << endl << endl;
+		}
+	}
+	else
+	{
+		sprintf( lineBuffer, "FrontEnd.h: createBubbleSprite(): Image file %s does not exist.", getMediaPath( bubbleImage ) );
+		logFile << lineBuffer << endl << endl;
+	}	
+
+	return NULL;
+}
+
+/**
+*  Function: useBubbleFrames(BubbleSprite<Platform> * bubble, int slot, int imageID)
+*
+*  Purpose: This function gives a new bubble sprite its image's radius frames
+*           (see BubbleFrames.h), making them from the image it just loaded if
+*           no other bubble has.  If they can't be made, the bubble's image is
+*           scaled instead, as it always was.  When the bubbles are drawn as
+*           circles, it gives the bubble its family's circle instead.
+*
+*  Inputs: bubble - The new sprite.
+*          slot - Which bubble image it has.
+*          imageID - Its image.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::useBubbleFrames(BubbleSprite<Platform> * bubble, int slot, int imageID)
+{
+	PROFILE_SCOPE( "useBubbleFrames" );
+
+	if ( circleBubbles )
+	{
+		int circleImageID = bubbleCircles.make( slot == USER_BUBBLE_FRAME_SLOT ? USER_BUBBLE_CIRCLE : getBubbleFamily( slot ) );
+
+		if ( circleImageID >= 0 )
+		{
+			bubble->useCircle( circleImageID );
+			return;
+		}
+	}
+
+	if ( bubbleFrames.make( slot, imageID ) )
+	{
+		bubble->useFrames( & bubbleFrames, slot );
+	}
+}
+
+/**
+*  Function: syncBubbleSprites(bool sounds)
+*
+*  Purpose: This function makes the sprites match the session's level.  It is
+*           called each time through the main game loop, and whenever the
+*           session is put back to an earlier state.  A sprite is created for
+*           a bubble that has none yet (the userBubble, once the user clicks),
+*           and deleted for one that no longer exists (the userBubble, when
+*           the level goes back to before the click).  Each sprite is then
+*           updated from its bubble.
+*
+*  Inputs: sounds - False to keep the pop sounds quiet.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::syncBubbleSprites(bool sounds)
+{
+	const LevelSimulation & sim = session.getSimulation();
+
+	while ( (int)bubbles.size() > sim.getBubbleCount() )
+	{
+		delete bubbles.back();
+		bubbles.pop_back();
+	}
+
+	while ( (int)bubbles.size() < sim.getBubbleCount() )
+	{
+		bubbles.push_back( createBubbleSprite( (int)bubbles.size() ) );
+	}
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		if ( bubbles[i] != NULL )
+		{
+			bubbles[i]->update( sim.getBubble( i ), sounds );
+		}
+	}
+}
+
+/**
+*  Function: shuffle(MediaAsset assets[], int size)
+*
+*  Purpose: This function randomly shuffles the contents of an array of media assets
+*           that is passed to it.  It is called by createAndLoadBubbles() to
+*           shuffle the noteSounds[] array.  (The bubble images are shuffled
+*           by LevelSimulation::generate(), so that a replay shows the same ones.)
+*           noteRandom was seeded by run(), so the notes are shuffled the same
+*           way on every backend.
+*
+*  Inputs: assets[] - The array of media assets that needs shuffling.
+*          size - The size of this array.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::shuffle(MediaAsset assets[], int size)
+{
+	int randomIndex;
+
+	for ( int i = 0; i < size; i++ )
+	{
+		randomIndex = noteRandom.next( size-1 );
+
+		MediaAsset temp = assets[i];
+		assets[i] = assets[randomIndex];
+		assets[randomIndex] = temp;
+	}
+}
+
+/**
+*  Function: deleteComponents()
+*
+*  Purpose: This function is called at the end of run() and removes from memory
+*           the sounds and images loaded by loadComponents(), and the sprites it
+*           created, whose images are removed from memory in their destructors.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::deleteComponents()
+{
+	audio.deleteSound( SUCCESS_SOUND_ID );
+	renderer.deleteImage( SPACE_BG_IMAGE_ID );  
+	renderer.deleteImage( GREEN_BG_IMAGE_ID );
+
+	if ( renderer.imageExists( TINT_BUBBLE_IMAGE_ID ) )
+	{
+		renderer.deleteImage( TINT_BUBBLE_IMAGE_ID );
+	}
+
+	if ( renderer.imageExists( SCREEN_LAYER_IMAGE_ID ) )
+	{
+		renderer.deleteImage( SCREEN_LAYER_IMAGE_ID );
+	}
+
+	delete whiteOverlay;
+	delete handPointer;
+	delete introPlayButton;
+	delete instructionsButton;
+	delete aboutButton;
+	delete okButton;
+	delete playButton;
+	delete retryButton;
+	delete playAgainButton;
+	delete exitButton;
+
+	whiteOverlay = NULL;
+	handPointer = NULL;
+	introPlayButton = NULL;
+	instructionsButton = NULL;
+	aboutButton = NULL;
+	okButton = NULL;
+	playButton = NULL;
+	retryButton = NULL;
+	playAgainButton = NULL;
+	exitButton = NULL;
+}
+
+/**
+*  Function: deleteBubbles()
+*
+*  Purpose: This function is called at the end of run(). 
+*           It removes the objects from memory that are being stored in
+*           the bubbles vector.
+*/
+
+template <class Platform>
+void GameFrontEnd<Platform>::deleteBubbles()
+{
+	typename vector <BubbleSprite<Platform>*>::iterator pb;
+
+	for ( pb = bubbles.begin(); pb != bubbles.end(); pb++ )
+	{
+		delete *pb;	
+	}
+
+	bubbles.clear();
+}
+
+#endif
@@ -0,0 +1,613 @@
+/**
+*  File:  GameSession.cpp
+*
+*  Description:  This file contains the method implementations for the GameSession
+*                class.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "GameSession.h"
+#include "Profiler.h"
+
+/**
+*  Function: GameSession(uint32 seed)
+*
+*  Purpose: This is the constructor for the GameSession class.  The session uses
+*           the game's own sizes until setConfig() is called, and waits on the
+*           first level's start screen.
+*
+*  Inputs: seed - Picks the seed of every level in the game, so two sessions
+*                 with the same seed are laid out the same.
+*/
+
+GameSession::GameSession(uint32 seed)
+           : seeds( seed )
+{
+	stressBubbles = 0;
+	replay = NULL;
+	pack = NULL;
+
+	start( seed );
+}
+
+/**
+*  Function: setConfig(const SimConfig & simConfig, int levelBubbles)
+*
+*  Purpose: This function changes the sizes used for stress mode.  They are used
+*           from the next level laid out, so start() should be called next.
+*
+*  Inputs: simConfig - The arena, bubble radius and pop expansion.
+*          levelBubbles - The number of bubbles in every level, or 0 for each
+*                         level's own number.
+*/
+
+void GameSession::setConfig(const SimConfig & simConfig, int levelBubbles)
+{
+	config = simConfig;
+	stressBubbles = levelBubbles;
+}
+
+/**
+*  Function: getConfig()
+*
+*  Returns: The sizes the session plays with.
+*/
+
+const SimConfig & GameSession::getConfig() const
+{
+	return config;
+}
+
+/**
+*  Function: setReplay(Replay * recorder)
+*
+*  Purpose: This function records each level the session plays from now on into
+*           a replay.  The session doesn't save or clear it.
+*
+*  Inputs: recorder - The replay to record to, or NULL to stop recording.
+*/
+
+void GameSession::setReplay(Replay * recorder)
+{
+	replay = recorder;
+}
+
+/**
+*  Function: setLevelPack(const LevelPack * levelPack)
+*
+*  Purpose: This function plays the levels of a pack instead of laying them out
+*           as they start, from the next start() on.  The pack is only used
+*           while it fits the session's config and stress mode is off.
+*
+*  Inputs: levelPack - The pack, which must stay open while it is set, or NULL
+*                      to lay the levels out again.
+*/
+
+void GameSession::setLevelPack(const LevelPack * levelPack)
+{
+	pack = levelPack;
+}
+
+/**
+*  Function: start(uint32 seed)
+*
+*  Purpose: This function starts the game over, on the first level's start screen,
+*           with a score of 0.
+*
+*  Inputs: seed - Picks the seed of every level in the game, or with a level
+*                 pack, the campaign to play first.
+*/
+
+void GameSession::start(uint32 seed)
+{
+	seeds = SimRandom( seed );
+	packCampaign = pack != NULL && pack->getCampaignCount() > 0 ? (int)( seed % (uint32)pack->getCampaignCount() ) : 0;
+	level = 1;
+	levelPoints = 0;
+	totalPoints = 0;
+	wonLevel = false;
+
+	newLevel();
+
+	screen = SCREEN_LEVEL_START;
+}
+
+/**
+*  Function: newLevel()
+*
+*  Purpose: This function lays out the current level with a new seed, or takes
+*           it from the level pack, and resets the flags that track its end.
+*           The first level of a campaign also notes the campaign seed its
+*           level seeds follow from, for the replay.
+*/
+
+void GameSession::newLevel()
+{
+	const PackLevel * packed = NULL;
+	const SimLayoutBubble * layout = NULL;
+
+	if ( pack != NULL && stressBubbles == 0 && pack->fits( config ) )
+	{
+		packed = pack->getLevel( packCampaign, level );
+		layout = packed != NULL && packed->bubbleCount == getLevelBubbleCount() ? pack->getBubbles( *packed ) : NULL;
+	}
+
+	sim.setConfig( config );
+
+	if ( layout != NULL )
+	{
+		if ( level == 1 )
+		{
+			campaignSeed = pack->getCampaignSeed( packCampaign );
+		}
+
+		levelSeed = packed->seed;
+		sim.setLayout( layout, packed->bubbleCount );
+	}
+	else
+	{
+		if ( level == 1 )
+		{
+			campaignSeed = seeds.getState();
+		}
+
+		levelSeed = (uint32)seeds.next( 0x7fffffff );
+		sim.generate( levelSeed, getLevelBubbleCount() );
+	}
+
+	fadeCounter = 0;
+	fadeToWhite = false;
+	fadeComplete = false;
+	remainingBubblesContracted = false;
+}
+
+/**
+*  Function: play()
+*
+*  Purpose: This is the Play button of the level start screen.  The level starts
+*           on the next tick().  It is snapshotted first, so retry() can put it
+*           back.
+*/
+
+void GameSession::play()
+{
+	if ( screen != SCREEN_LEVEL_START )
+	{
+		return;
+	}
+
+	levelPoints = 0;  // Kept until now so the cut-screens can show it.
+	wonLevel = false;
+	screen = SCREEN_PLAYING;
+
+	capture( levelStart );
+
+	if ( replay != NULL )
+	{
+		replay->setConfig( config );
+		replay->setCampaignSeed( campaignSeed );
+		replay->beginLevel( level, levelSeed, getLevelBubbleCount(), getGoalPoints() );
+	}
+}
+
+/**
+*  Function: retry()
+*
+*  Purpose: This is the Retry button of the retry screen.  Instead of laying out
+*           a new level, it puts back the snapshot taken when Play was pressed,
+*           so the same bubbles are back where they started.
+*/
+
+void GameSession::retry()
+{
+	if ( screen != SCREEN_RETRY )
+	{
+		return;
+	}
+
+	restore( levelStart );
+
+	screen = SCREEN_LEVEL_START;
+}
+
+/**
+*  Function: playAgain()
+*
+*  Purpose: This is the Play Again button of the won game screen.  The first
+*           level is already laid out, so only the score is reset.
+*/
+
+void GameSession::playAgain()
+{
+	if ( screen != SCREEN_WON_GAME )
+	{
+		return;
+	}
+
+	totalPoints = 0;
+	levelPoints = 0;
+	wonLevel = false;
+	screen = SCREEN_LEVEL_START;
+}
+
+/**
+*  Function: click(int x, int y)
+*
+*  Purpose: This function passes the user's mouse click to the level.  Only the
+*           first click of a level is taken.  It creates the user bubble on the
+*           next tick().
+*
+*  Inputs: x, y - Where the user clicked.
+*
+*  Returns: True if the click was taken.
+*/
+
+bool GameSession::click(int x, int y)
+{
+	if ( screen != SCREEN_PLAYING || sim.getUserBubbleCreated() )
+	{
+		return false;
+	}
+
+	sim.click( x, y );
+
+	if ( replay != NULL )
+	{
+		replay->recordClick( sim.getTickCount(), x, y );
+	}
+
+	return true;
+}
+
+/**
+*  Function: tick()
+*
+*  Purpose: This function plays one frame of the main game loop: a frame of the
+*           level, then the fade to white, then the end of the level.  It does
+*           nothing unless the session is on SCREEN_PLAYING.
+*/
+
+void GameSession::tick()
+{
+	if ( screen != SCREEN_PLAYING )
+	{
+		return;
+	}
+
+	sim.tick();
+
+	if ( replay != NULL )
+	{
+		replay->recordTick( sim );
+	}
+
+	levelPoints = sim.getLevelPoints();
+
+	updateFade();
+	checkLevelEnd();
+}
+
+/**
+*  Function: updateFade()
+*
+*  Purpose: This function starts the screen fading to white once enough bubbles
+*           have popped to win the level, and counts the fade's 60 frames.
+*/
+
+void GameSession::updateFade()
+{
+	if ( levelPoints >= getGoalPoints() && fadeComplete == false )  // Have enough bubbles popped to win the level?
+	{
+		fadeToWhite = true;
+	}
+
+	if ( fadeToWhite == true )
+	{
+		PROFILE_SCOPE( "fade" );
+
+		fadeCounter++;
+
+		if ( fadeCounter >= 60 )
+		{
+			fadeComplete = true;
+			fadeToWhite = false;
+			fadeCounter = 0;
+		}
+	}
+}
+
+/**
+*  Function: checkLevelEnd()
+*
+*  Purpose: This function shrinks away the bubbles left over once the chain
+*           reaction is done, and on the frame after they are all gone, ends
+*           the level.
+*/
+
+void GameSession::checkLevelEnd()
+{
+	if ( sim.getChainReactionDone() == false )
+	{
+		return;
+	}
+
+	if ( remainingBubblesContracted == false )  // Still need to contract remaining bubbles on the screen.
+	{
+		PROFILE_SCOPE( "end of reaction scan" );
+
+		remainingBubblesContracted = sim.contractRemainingBubbles();
+	}
+	else  // Remaining bubbles done contracting, so check to see if you've won or lost the level.
+	{
+		endLevel();
+	}
+}
+
+/**
+*  Function: endLevel()
+*
+*  Purpose: This function moves the session on to the next screen once the level
+*           is over.  A won level lays out the next one (or the first one, after
+*           the last level), and a lost level waits for Retry.
+*/
+
+void GameSession::endLevel()
+{
+	if ( replay != NULL )
+	{
+		replay->endLevel( levelPoints );
+	}
+
+	if ( levelPoints >= getGoalPoints() )  // Won level.
+	{
+		totalPoints += levelPoints;
+
+		if ( level == LEVELS )  // Won entire game.
+		{
+			level = 1;
+			packCampaign = pack != NULL && pack->getCampaignCount() > 0 ? ( packCampaign + 1 ) % pack->getCampaignCount() : 0;
+			newLevel();
+			screen = SCREEN_WON_GAME;
+		}
+		else  // Won normal level.
+		{
+			wonLevel = true;  // Used for output.
+			level++;
+			newLevel();
+			screen = SCREEN_LEVEL_START;
+		}
+	}
+	else  // Lost level.
+	{
+		screen = SCREEN_RETRY;
+	}
+}
+
+/**
+*  Function: capture(GameSnapshot & snapshot)
+*
+*  Purpose: This function copies the state of the session into a snapshot (see
+*           Snapshot.h).
+*
+*  Inputs: snapshot - Filled in with the state of the session.
+*/
+
+void GameSession::capture(GameSnapshot & snapshot) const
+{
+	snapshot.screen = (int32)screen;
+	snapshot.level = level;
+	snapshot.levelPoints = levelPoints;
+	snapshot.totalPoints = totalPoints;
+	snapshot.fadeCounter = fadeCounter;
+	snapshot.levelSeed = levelSeed;
+	snapshot.flags = ( fadeToWhite ? SNAPSHOT_FADE_TO_WHITE : 0 ) |
+		             ( fadeComplete ? SNAPSHOT_FADE_COMPLETE : 0 ) |
+		             ( remainingBubblesContracted ? SNAPSHOT_REMAINING_BUBBLES_CONTRACTED : 0 ) |
+		             ( wonLevel ? SNAPSHOT_WON_LEVEL : 0 );
+
+	snapshot.levelState.clear();
+
+	ByteWriter writer( snapshot.levelState );
+	sim.saveState( writer );
+}
+
+/**
+*  Function: restore(const GameSnapshot & snapshot)
+*
+*  Purpose: This function puts the session back the way it was when a snapshot
+*           was taken with capture().  The snapshot must come from a session
+*           with the same config.
+*
+*  Inputs: snapshot - The state of the session to put back.
+*
+*  Returns: True if the snapshot could be put back.  If it is damaged, false
+*           is returned, and if it got as far as the level, the level is left
+*           empty.
+*/
+
+bool GameSession::restore(const GameSnapshot & snapshot)
+{
+	if ( snapshot.levelState.empty() || snapshot.level < 1 || snapshot.level > LEVELS ||
+		 snapshot.screen < SCREEN_LEVEL_START || snapshot.screen > SCREEN_WON_GAME )
+	{
+		return false;
+	}
+
+	ByteReader reader( & snapshot.levelState[0], (int)snapshot.levelState.size() );
+
+	if ( sim.loadState( reader ) == false )
+	{
+		return false;
+	}
+
+	screen = (GameScreen)snapshot.screen;
+	level = snapshot.level;
+	levelPoints = snapshot.levelPoints;
+	totalPoints = snapshot.totalPoints;
+	fadeCounter = snapshot.fadeCounter;
+	levelSeed = snapshot.levelSeed;
+	fadeToWhite = ( snapshot.flags & SNAPSHOT_FADE_TO_WHITE ) != 0;
+	fadeComplete = ( snapshot.flags & SNAPSHOT_FADE_COMPLETE ) != 0;
+	remainingBubblesContracted = ( snapshot.flags & SNAPSHOT_REMAINING_BUBBLES_CONTRACTED ) != 0;
+	wonLevel = ( snapshot.flags & SNAPSHOT_WON_LEVEL ) != 0;
+
+	return true;
+}
+
+/**
+*  Function: rewind(const GameSnapshot & snapshot)
+*
+*  Purpose: This function puts the level being played back to an earlier frame,
+*           from a snapshot captured during it.  Unlike restore(), it tells the
+*           replay being recorded, which forgets everything after that frame
+*           (see Replay::rewindTo()), so the replay holds only what was played
+*           from there on.  retry() doesn't need this: it starts the level over
+*           as a new entry in the replay.
+*
+*  Inputs: snapshot - The level being played, as it was at an earlier frame.
+*
+*  Returns: True if the level was put back.  A snapshot of another level, or one
+*           that isn't from the middle of play, is turned down and nothing
+*           changes.  If the snapshot is damaged, see restore().
+*/
+
+bool GameSession::rewind(const GameSnapshot & snapshot)
+{
+	if ( screen != SCREEN_PLAYING || snapshot.screen != SCREEN_PLAYING ||
+		 snapshot.level != level || snapshot.levelSeed != levelSeed )
+	{
+		return false;
+	}
+
+	if ( restore( snapshot ) == false )
+	{
+		return false;
+	}
+
+	if ( replay != NULL )
+	{
+		replay->rewindTo( sim.getTickCount() );
+	}
+
+	return true;
+}
+
+/**
+*  Function: getScreen()
+*
+*  Returns: The screen the session is on.
+*/
+
+GameScreen GameSession::getScreen() const
+{
+	return screen;
+}
+
+/**
+*  Function: getLevel()
+*
+*  Returns: The level being played, from 1 to LEVELS.
+*/
+
+int GameSession::getLevel() const
+{
+	return level;
+}
+
+/**
+*  Function: getLevelBubbleCount()
+*
+*  Returns: The number of bubbles in the current level.
+*/
+
+int GameSession::getLevelBubbleCount() const
+{
+	if ( stressBubbles != 0 )
+	{
+		return stressBubbles;
+	}
+
+	return LEVEL_BUBBLES[level-1];
+}
+
+/**
+*  Function: getGoalPoints()
+*
+*  Returns: The number of bubbles that have to pop to win the current level.
+*/
+
+int GameSession::getGoalPoints() const
+{
+	return GOAL_POINTS[level-1];
+}
+
+/**
+*  Function: getLevelPoints()
+*
+*  Returns: The bubbles popped so far in the current level, or in the level just
+*           played while on a cut-screen.
+*/
+
+int GameSession::getLevelPoints() const
+{
+	return levelPoints;
+}
+
+/**
+*  Function: getTotalPoints()
+*
+*  Returns: The bubbles popped in every level won so far.
+*/
+
+int GameSession::getTotalPoints() const
+{
+	return totalPoints;
+}
+
+/**
+*  Function: getLevelSeed()
+*
+*  Returns: The seed the current level was laid out with.
+*/
+
+uint32 GameSession::getLevelSeed() const
+{
+	return levelSeed;
+}
+
+/**
+*  Function: getWonLevel()
+*
+*  Returns: True on the level start screen after a level was won.
+*/
+
+bool GameSession::getWonLevel() const
+{
+	return wonLevel;
+}
+
+/**
+*  Function: getOverlayAlpha()
+*
+*  Returns: How white the screen is, from 0 (not at all) to 60 (once the fade is
+*           done).
+*/
+
+int GameSession::getOverlayAlpha() const
+{
+	return fadeComplete ? 60 : fadeCounter;
+}
+
+/**
+*  Function: getSimulation()
+*
+*  Returns: The current level, for drawing it.
+*/
+
+const LevelSimulation & GameSession::getSimulation() const
+{
+	return sim;
+}
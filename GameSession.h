@@ -0,0 +1,107 @@
+/**
+*  File:  GameSession.h
+*
+*  Description:  This header file contains the GameSession class, which is one
+*                game of Prisms from the first level to the last: the screen the
+*                game is on, the level and score, the fade to white once the goal
+*                is reached, the shrinking of the bubbles left over when the chain
+*                reaction is done, and the level itself, on a LevelSimulation.
+*                Prisms.cpp only draws a session and passes it the user's clicks
+*                and button presses.
+*
+*                A session has no globals or statics and doesn't use DarkGDK, so
+*                any number of them can be played at once, each on its own thread,
+*                without a window.  DarkGDK's sprites, sounds and text belong to
+*                the whole program, so only one session at a time can be drawn.
+*
+*                Each call to tick() is one frame of the main game loop.  The
+*                buttons of the cut-screens are play(), retry() and playAgain().
+*                rewind() steps the level being played back to an earlier frame,
+*                and keeps the replay being recorded in step with it.
+*
+*                The levels are laid out from their seeds as they start, unless a
+*                LevelPack is set, in which case each campaign is taken from the
+*                pack instead.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef GAME_SESSION_H_
+#define GAME_SESSION_H_
+
+#include "Simulation.h"
+#include "Replay.h"
+#include "Snapshot.h"
+#include "LevelPack.h"
+
+/**
+*  The screens a session can be on.  Every screen but SCREEN_PLAYING is waiting
+*  for a button.
+*/
+
+enum GameScreen
+{
+	SCREEN_LEVEL_START,  // levelStartScreen(): waiting for Play.
+	SCREEN_PLAYING,      // The main game loop.
+	SCREEN_RETRY,        // retryScreen(): the level was lost, waiting for Retry.
+	SCREEN_WON_GAME      // wonGameScreen(): the last level was won, waiting for Play Again.
+};
+
+class GameSession
+{
+private:
+	SimConfig config;
+	int stressBubbles;        // If not 0, every level has this many bubbles (stress mode).
+	SimRandom seeds;          // Picks each level's seed.
+	GameScreen screen;
+	int level;
+	int levelPoints;
+	int totalPoints;
+	int fadeCounter;
+	uint32 levelSeed;         // The seed the level was laid out with.
+	uint32 campaignSeed;      // What the campaign's level seeds are picked from (see Replay.h).
+	bool fadeToWhite;
+	bool fadeComplete;
+	bool remainingBubblesContracted;
+	bool wonLevel;
+	LevelSimulation sim;
+	Replay * replay;          // NULL unless the session is being recorded.
+	GameSnapshot levelStart;  // The level on its first frame, put back to retry it.
+	const LevelPack * pack;   // NULL unless the levels come from a level pack.
+	int packCampaign;         // The pack's campaign being played.
+
+	void newLevel();
+	void updateFade();
+	void checkLevelEnd();
+	void endLevel();
+
+public:
+	GameSession(uint32 seed = 1);
+	void setConfig(const SimConfig & simConfig, int levelBubbles);
+	const SimConfig & getConfig() const;
+	void setReplay(Replay * recorder);
+	void setLevelPack(const LevelPack * levelPack);
+	void start(uint32 seed);
+	void play();
+	void retry();
+	void playAgain();
+	bool click(int x, int y);
+	void tick();
+	void capture(GameSnapshot & snapshot) const;
+	bool restore(const GameSnapshot & snapshot);
+	bool rewind(const GameSnapshot & snapshot);
+	GameScreen getScreen() const;
+	int getLevel() const;
+	int getLevelBubbleCount() const;
+	int getGoalPoints() const;
+	int getLevelPoints() const;
+	int getTotalPoints() const;
+	uint32 getLevelSeed() const;
+	bool getWonLevel() const;
+	int getOverlayAlpha() const;
+	const LevelSimulation & getSimulation() const;
+};
+
+#endif
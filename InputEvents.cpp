@@ -0,0 +1,135 @@
+/**
+*  File:  InputEvents.cpp
+*
+*  Description:  This file contains the method implementations for the
+*                InputEvents class.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "InputEvents.h"
+
+/**
+*  Function: InputEvents()
+*
+*  Purpose: This is the constructor for the InputEvents class.  The queue
+*           starts empty, and the first update() only reads where the mouse
+*           is, so a button already down then isn't taken as a click.
+*/
+
+InputEvents::InputEvents()
+{
+	first = 0;
+	count = 0;
+	started = false;
+	lastX = 0;
+	lastY = 0;
+	lastDown = false;
+}
+
+/**
+*  Function: add(InputEventType type, int x, int y)
+*
+*  Purpose: This function puts an event at the back of the queue, merging it
+*           into the last event if both are moves.
+*/
+
+void InputEvents::add(InputEventType type, int x, int y)
+{
+	if ( type == MOUSE_MOVED && count > 0 )
+	{
+		InputEvent & last = queue[( first + count - 1 ) % INPUT_EVENT_CAPACITY];
+
+		if ( last.type == MOUSE_MOVED )
+		{
+			last.x = x;
+			last.y = y;
+			return;
+		}
+	}
+
+	if ( count == INPUT_EVENT_CAPACITY )  // Drop the oldest.
+	{
+		first = ( first + 1 ) % INPUT_EVENT_CAPACITY;
+		count--;
+	}
+
+	InputEvent & event = queue[( first + count ) % INPUT_EVENT_CAPACITY];
+	event.type = type;
+	event.x = x;
+	event.y = y;
+	count++;
+}
+
+/**
+*  Function: update(int x, int y, int click)
+*
+*  Purpose: This function is called each time the input is read.  It compares
+*           the mouse with the last time, and queues an event for each thing
+*           that changed: the move first, then the button.
+*
+*  Inputs: x, y - Where the mouse is.
+*          click - The mouse button, as mouseClick() returns it (1 if down).
+*/
+
+void InputEvents::update(int x, int y, int click)
+{
+	bool down = click == 1;
+
+	if ( started )
+	{
+		if ( x != lastX || y != lastY )
+		{
+			add( MOUSE_MOVED, x, y );
+		}
+
+		if ( down != lastDown )
+		{
+			add( down ? MOUSE_PRESSED : MOUSE_RELEASED, x, y );
+		}
+	}
+
+	started = true;
+	lastX = x;
+	lastY = y;
+	lastDown = down;
+}
+
+/**
+*  Function: next(InputEvent & event)
+*
+*  Purpose: This function takes the oldest event off the queue.
+*
+*  Inputs: event - Set to the event.
+*
+*  Returns: True if there was one, or false if the queue is empty.
+*/
+
+bool InputEvents::next(InputEvent & event)
+{
+	if ( count == 0 )
+	{
+		return false;
+	}
+
+	event = queue[first];
+	first = ( first + 1 ) % INPUT_EVENT_CAPACITY;
+	count--;
+
+	return true;
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function throws away every event in the queue.  The mouse is
+*           still compared with where it was last read.
+*/
+
+void InputEvents::clear()
+{
+	first = 0;
+	count = 0;
+}
@@ -0,0 +1,67 @@
+/**
+*  File:  InputEvents.h
+*
+*  Description:  This header file contains the InputEvents class, which turns
+*                the mouse as it is read each frame into a queue of events: it
+*                moved, its button went down, or its button came up.  Only a
+*                change makes an event, so a click is a single MOUSE_PRESSED
+*                however long the button is held, and the screens and the game
+*                loop don't have to wait for the button to come up before they
+*                can tell one click from the next.  A frame with no events is
+*                one in which nothing about the mouse changed.
+*
+*                Moves that follow each other in the queue are merged into one,
+*                to where the mouse ended up.  If the queue is full, the oldest
+*                event is dropped.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef INPUT_EVENTS_H_
+#define INPUT_EVENTS_H_
+
+const int INPUT_EVENT_CAPACITY = 16;
+
+enum InputEventType
+{
+	MOUSE_MOVED,
+	MOUSE_PRESSED,
+	MOUSE_RELEASED
+};
+
+/**
+*  An InputEvent is one change in the mouse, and where the mouse was when it
+*  happened.
+*/
+
+struct InputEvent
+{
+	InputEventType type;
+	int x;
+	int y;
+};
+
+class InputEvents
+{
+private:
+	InputEvent queue[INPUT_EVENT_CAPACITY];
+	int first;    // Where the oldest event is.
+	int count;
+	bool started;  // Whether the mouse has been read yet.
+	int lastX;     // The mouse as it was last read.
+	int lastY;
+	bool lastDown;
+
+	void add(InputEventType type, int x, int y);
+
+public:
+	InputEvents();
+	void update(int x, int y, int click);
+	bool next(InputEvent & event);
+	bool empty() const { return count == 0; }
+	void clear();
+};
+
+#endif
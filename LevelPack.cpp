@@ -0,0 +1,281 @@
+/**
+*  File:  LevelPack.cpp
+*
+*  Description:  This file contains the method implementations for the LevelPack
+*                class, and writeLevelPack(), which makes packs.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "LevelPack.h"
+#include <stdio.h>
+#include <string.h>  // For memcmp() and memcpy().
+
+/**
+*  Function: LevelPack()
+*
+*  Purpose: This is the constructor for the LevelPack class.  No pack is open
+*           until open() is called.
+*/
+
+LevelPack::LevelPack()
+{
+	header = NULL;
+	levels = NULL;
+	bubbles = NULL;
+}
+
+/**
+*  Function: open(const char * fileName)
+*
+*  Purpose: This function maps a pack into memory, after closing the one that
+*           was open.  Only the header is checked here; the index and the
+*           bubbles are checked as each level is looked up.
+*
+*  Inputs: fileName - The pack.
+*
+*  Returns: True if the file is a pack this version of the game can use.
+*/
+
+bool LevelPack::open(const char * fileName)
+{
+	close();
+
+	if ( file.open( fileName ) == false || file.getSize() < sizeof(LevelPackHeader) )
+	{
+		file.close();
+		return false;
+	}
+
+	const uint8 * data = file.getData();
+	size_t size = file.getSize();
+	const LevelPackHeader * h = (const LevelPackHeader *)data;
+
+	size_t levelCount = (size_t)h->campaignCount * LEVELS;
+
+	if ( memcmp( h->magic, LEVEL_PACK_MAGIC, 4 ) != 0 || h->version != LEVEL_PACK_VERSION || h->levelCount != LEVELS ||
+		 h->indexOffset % sizeof(uint32) != 0 || h->bubbleOffset % sizeof(uint32) != 0 ||
+		 h->indexOffset > size || levelCount > ( size - h->indexOffset ) / sizeof(PackLevel) ||
+		 h->bubbleOffset > size || h->bubbleCount > ( size - h->bubbleOffset ) / sizeof(SimLayoutBubble) )
+	{
+		file.close();
+		return false;
+	}
+
+	header = h;
+	levels = (const PackLevel *)( data + h->indexOffset );
+	bubbles = (const SimLayoutBubble *)( data + h->bubbleOffset );
+
+	return true;
+}
+
+/**
+*  Function: close()
+*
+*  Purpose: This function unmaps the pack.  Nothing from it may be used after
+*           this.
+*/
+
+void LevelPack::close()
+{
+	file.close();
+
+	header = NULL;
+	levels = NULL;
+	bubbles = NULL;
+}
+
+/**
+*  Function: isOpen()
+*
+*  Returns: True if a pack is open.
+*/
+
+bool LevelPack::isOpen() const
+{
+	return header != NULL;
+}
+
+/**
+*  Function: getCampaignCount()
+*
+*  Returns: The number of campaigns in the pack, or 0 if none is open.
+*/
+
+int LevelPack::getCampaignCount() const
+{
+	return header != NULL ? (int)header->campaignCount : 0;
+}
+
+/**
+*  Function: fits(const SimConfig & config)
+*
+*  Returns: True if the pack's levels were laid out for the given sizes, so
+*           they can be played with them.
+*/
+
+bool LevelPack::fits(const SimConfig & config) const
+{
+	return header != NULL && header->arenaWidth == config.arenaWidth && header->arenaHeight == config.arenaHeight &&
+		   header->bubbleRadius == config.bubbleRadius && header->popExpansion == config.popExpansion;
+}
+
+/**
+*  Function: getLevel(int campaign, int level)
+*
+*  Purpose: This function looks a level up in the pack's index.
+*
+*  Inputs: campaign - The campaign, counting from 0.
+*          level - The level, from 1 to LEVELS.
+*
+*  Returns: The level, or NULL if there is no such level.
+*/
+
+const PackLevel * LevelPack::getLevel(int campaign, int level) const
+{
+	if ( header == NULL || campaign < 0 || campaign >= (int)header->campaignCount || level < 1 || level > LEVELS )
+	{
+		return NULL;
+	}
+
+	return & levels[campaign * LEVELS + level-1];
+}
+
+/**
+*  Function: getCampaignSeed(int campaign)
+*
+*  Purpose: This function finds the seed a campaign's levels were picked from,
+*           the way writeLevelPack() picked it.  A replay of the campaign
+*           records it (see Replay.h).
+*
+*  Inputs: campaign - The campaign, counting from 0.
+*
+*  Returns: The campaign's seed, or 0 if there is no such campaign.
+*/
+
+uint32 LevelPack::getCampaignSeed(int campaign) const
+{
+	if ( header == NULL || campaign < 0 || campaign >= (int)header->campaignCount )
+	{
+		return 0;
+	}
+
+	SimRandom campaignSeeds( header->seed );
+	uint32 seed = 0;
+
+	for ( int c = 0; c <= campaign; c++ )
+	{
+		seed = (uint32)campaignSeeds.next( 0x7fffffff );
+	}
+
+	return seed;
+}
+
+/**
+*  Function: getBubbles(const PackLevel & level)
+*
+*  Returns: The bubbles of a level from getLevel(), ready for
+*           LevelSimulation::setLayout(), or NULL if the level's bubbles aren't
+*           all in the pack.
+*/
+
+const SimLayoutBubble * LevelPack::getBubbles(const PackLevel & level) const
+{
+	if ( header == NULL || level.firstBubble > header->bubbleCount || level.bubbleCount > header->bubbleCount - level.firstBubble )
+	{
+		return NULL;
+	}
+
+	return & bubbles[level.firstBubble];
+}
+
+/**
+*  Function: writeLevelPack(const char * fileName, int campaigns, uint32 seed, const SimConfig & config)
+*
+*  Purpose: This function lays out whole campaigns with LevelSimulation::generate()
+*           and writes them to a pack.  Campaign c gets the levels a GameSession
+*           started with the c-th number from SimRandom( seed ) would play.
+*
+*  Inputs: fileName - The pack to write.
+*          campaigns - The number of campaigns, up to LEVEL_PACK_MAX_CAMPAIGNS.
+*          seed - Picks the campaigns.
+*          config - The arena and bubble sizes.  The arena must be no more than
+*                   32767 wide and high, to fit the layouts' 16-bit positions.
+*
+*  Returns: True if the pack was written.
+*/
+
+bool writeLevelPack(const char * fileName, int campaigns, uint32 seed, const SimConfig & config)
+{
+	if ( campaigns < 1 || campaigns > LEVEL_PACK_MAX_CAMPAIGNS || config.valid() == false || config.arenaWidth > 32767 || config.arenaHeight > 32767 )
+	{
+		return false;
+	}
+
+	vector <PackLevel> index( campaigns * LEVELS );
+	vector <SimLayoutBubble> layouts;
+	SimRandom campaignSeeds( seed );
+	LevelSimulation sim;
+
+	sim.setConfig( config );
+
+	for ( int c = 0; c < campaigns; c++ )
+	{
+		SimRandom seeds( (uint32)campaignSeeds.next( 0x7fffffff ) );  // As GameSession::start() and newLevel() pick them.
+
+		for ( int level = 1; level <= LEVELS; level++ )
+		{
+			PackLevel & packed = index[c * LEVELS + level-1];
+
+			packed.seed = (uint32)seeds.next( 0x7fffffff );
+			packed.firstBubble = (uint32)layouts.size();
+			packed.bubbleCount = (uint16)LEVEL_BUBBLES[level-1];
+			packed.goalPoints = (uint16)GOAL_POINTS[level-1];
+
+			sim.generate( packed.seed, LEVEL_BUBBLES[level-1] );
+
+			for ( int i = 0; i < sim.getBubbleCount(); i++ )
+			{
+				const SimBubble & b = sim.getBubble( i );
+				SimLayoutBubble layout;
+
+				layout.centerX = (int16)b.centerX;
+				layout.centerY = (int16)b.centerY;
+				layout.degrees = (int16)b.degrees;
+				layout.imageIndex = (uint8)b.imageIndex;
+				layout.noteIndex = (uint8)b.noteIndex;
+
+				layouts.push_back( layout );
+			}
+		}
+	}
+
+	LevelPackHeader header;
+	memcpy( header.magic, LEVEL_PACK_MAGIC, 4 );
+	header.version = LEVEL_PACK_VERSION;
+	header.campaignCount = (uint32)campaigns;
+	header.levelCount = LEVELS;
+	header.arenaWidth = config.arenaWidth;
+	header.arenaHeight = config.arenaHeight;
+	header.bubbleRadius = config.bubbleRadius;
+	header.popExpansion = config.popExpansion;
+	header.indexOffset = sizeof(LevelPackHeader);
+	header.bubbleOffset = header.indexOffset + (uint32)( index.size() * sizeof(PackLevel) );
+	header.bubbleCount = (uint32)layouts.size();
+	header.seed = seed;
+
+	FILE * pack = fopen( fileName, "wb" );
+
+	if ( pack == NULL )
+	{
+		return false;
+	}
+
+	bool written = fwrite( & header, sizeof(header), 1, pack ) == 1 &&
+		           fwrite( & index[0], sizeof(PackLevel), index.size(), pack ) == index.size() &&
+		           fwrite( & layouts[0], sizeof(SimLayoutBubble), layouts.size(), pack ) == layouts.size();
+
+	return fclose( pack ) == 0 && written;
+}
@@ -0,0 +1,98 @@
+/**
+*  File:  LevelPack.h
+*
+*  Description:  This header file contains LevelPack, a file of levels laid out
+*                ahead of time.  Normally every level is laid out from its seed
+*                with LevelSimulation::generate() as it starts.  A pack holds the
+*                layouts of many whole campaigns instead, already worked out, in
+*                a file that is memory-mapped and used where it lies: a level is
+*                started from the pack with LevelSimulation::setLayout(), with no
+*                parsing and no allocation.
+*
+*                The levels of each campaign have the seeds a GameSession started
+*                with the campaign's seed would pick, so a level from a pack plays
+*                exactly as if it had been generated, and replays of it check out.
+*                The header keeps the seed the campaigns were picked with, so the
+*                session can record each campaign's seed in its replay.
+*
+*                File format, in the native byte order (little-endian on every
+*                machine the game runs on), with every record 4-byte aligned:
+*
+*                LevelPackHeader
+*                campaigns x LEVELS PackLevels, campaign by campaign, at indexOffset
+*                every level's SimLayoutBubbles, one level after another, at
+*                bubbleOffset
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef LEVEL_PACK_H_
+#define LEVEL_PACK_H_
+
+#include "Simulation.h"
+
+const uint32 LEVEL_PACK_VERSION = 2;
+const uint8 LEVEL_PACK_MAGIC[4] = { 'P', 'R', 'L', 'P' };
+const int LEVEL_PACK_MAX_CAMPAIGNS = 100000;  // About 300 MB, which still maps into a 32-bit process.
+
+/**
+*  LevelPackHeader is at the start of a pack.  The offsets count bytes from the
+*  start of the file.
+*/
+
+struct LevelPackHeader
+{
+	uint8 magic[4];
+	uint32 version;
+	uint32 campaignCount;
+	uint32 levelCount;       // Levels in each campaign.  Always LEVELS.
+	int32 arenaWidth;        // The SimConfig the levels were laid out with.
+	int32 arenaHeight;
+	int32 bubbleRadius;
+	int32 popExpansion;
+	uint32 indexOffset;
+	uint32 bubbleOffset;
+	uint32 bubbleCount;      // Bubbles in the whole pack.
+	uint32 seed;             // The seed the campaigns were picked with.
+};
+
+/**
+*  PackLevel is one level of a campaign in a pack's index.
+*/
+
+struct PackLevel
+{
+	uint32 seed;             // The seed the level was laid out from.
+	uint32 firstBubble;      // Where its bubbles start, counting SimLayoutBubbles from bubbleOffset.
+	uint16 bubbleCount;
+	uint16 goalPoints;
+};
+
+class LevelPack
+{
+private:
+	MappedFile file;
+	const LevelPackHeader * header;
+	const PackLevel * levels;
+	const SimLayoutBubble * bubbles;
+
+	LevelPack(const LevelPack &);
+	LevelPack & operator=(const LevelPack &);
+
+public:
+	LevelPack();
+	bool open(const char * fileName);
+	void close();
+	bool isOpen() const;
+	int getCampaignCount() const;
+	bool fits(const SimConfig & config) const;
+	const PackLevel * getLevel(int campaign, int level) const;
+	uint32 getCampaignSeed(int campaign) const;
+	const SimLayoutBubble * getBubbles(const PackLevel & level) const;
+};
+
+bool writeLevelPack(const char * fileName, int campaigns, uint32 seed, const SimConfig & config);
+
+#endif
@@ -4,118 +4,125 @@
 *  Description:  This file holds the file paths of the various media files, so they can be         
 *                easily referred to in the main application, and also easily changed from     
 *                this one location, if alterations to the directory structure are ever made.  
+*
+*                It is the game's media manifest.  Each MEDIA_FILE( name, path, kind ) line
+*                is one image or sound.  The file has no include guard: it is included
+*                wherever something is made from the list, with MEDIA_FILE defined to
+*                pick out the part that is needed.  MediaLoader.h makes the MediaAsset
+*                handles (ASSET_name) from it, and MediaLoader.cpp the table of paths
+*                that is checked once at startup.
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/10/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
-#ifndef MEDIA_FILE_PATHS_H_
-#define MEDIA_FILE_PATHS_H_
+#ifndef MEDIA_FILE
+#error Define MEDIA_FILE( name, path, kind ) before including MediaFilePaths.h.
+#endif
 
 /**
 *  File paths for the background images:
 */
 
-char * background_green_bmp = "media\\graphics\\backgrounds\\background_green.bmp";
-char * background_space_bmp = "media\\graphics\\backgrounds\\background_space.bmp";
-char * background_overlay_bmp = "media\\graphics\\backgrounds\\white_overlay.bmp";
+MEDIA_FILE( background_green_bmp, "media\\graphics\\backgrounds\\background_green.bmp", MEDIA_IMAGE )
+MEDIA_FILE( background_space_bmp, "media\\graphics\\backgrounds\\background_space.bmp", MEDIA_IMAGE )
+MEDIA_FILE( background_overlay_bmp, "media\\graphics\\backgrounds\\white_overlay.bmp", MEDIA_IMAGE )
 
 /** 
 *  File path for the hand pointer image:
 */
 
-char * hand_pointer_png = "media\\graphics\\pointers\\hand_pointer.png";
+MEDIA_FILE( hand_pointer_png, "media\\graphics\\pointers\\hand_pointer.png", MEDIA_IMAGE )
 
 /**
 *  File paths for the button images:
 */
 
-char * play_button_png = "media\\graphics\\buttons\\play_button.png";
-char * instructions_button_png = "media\\graphics\\buttons\\instructions_button.png";
-char * about_button_png = "media\\graphics\\buttons\\about_button.png";
-char * credits_button_png = "media\\graphics\\buttons\\credits_button.png";
-char * ok_button_png = "media\\graphics\\buttons\\ok_button.png";
-char * retry_button_png = "media\\graphics\\buttons\\retry_button.png";
-char * play_again_button_png = "media\\graphics\\buttons\\play_again_button.png";
-char * exit_button_png = "media\\graphics\\buttons\\exit_button.png";
+MEDIA_FILE( play_button_png, "media\\graphics\\buttons\\play_button.png", MEDIA_IMAGE )
+MEDIA_FILE( instructions_button_png, "media\\graphics\\buttons\\instructions_button.png", MEDIA_IMAGE )
+MEDIA_FILE( about_button_png, "media\\graphics\\buttons\\about_button.png", MEDIA_IMAGE )
+MEDIA_FILE( credits_button_png, "media\\graphics\\buttons\\credits_button.png", MEDIA_IMAGE )
+MEDIA_FILE( ok_button_png, "media\\graphics\\buttons\\ok_button.png", MEDIA_IMAGE )
+MEDIA_FILE( retry_button_png, "media\\graphics\\buttons\\retry_button.png", MEDIA_IMAGE )
+MEDIA_FILE( play_again_button_png, "media\\graphics\\buttons\\play_again_button.png", MEDIA_IMAGE )
+MEDIA_FILE( exit_button_png, "media\\graphics\\buttons\\exit_button.png", MEDIA_IMAGE )
 
 /**
 *  File paths for the bubble images:
 */
 
-char * user_bubble_png = "media\\graphics\\bubbles\\user_bubble.png";
-char * red1_png = "media\\graphics\\bubbles\\red1.png";
-char * red2_png = "media\\graphics\\bubbles\\red2.png";
-char * red3_png = "media\\graphics\\bubbles\\red3.png";
-char * red4_png = "media\\graphics\\bubbles\\red4.png";
-char * red5_png = "media\\graphics\\bubbles\\red5.png";
-char * red6_png = "media\\graphics\\bubbles\\red6.png";
-char * red7_png = "media\\graphics\\bubbles\\red7.png";
-char * purple1_png = "media\\graphics\\bubbles\\purple1.png";
-char * purple2_png = "media\\graphics\\bubbles\\purple2.png";
-char * purple3_png = "media\\graphics\\bubbles\\purple3.png";
-char * purple4_png = "media\\graphics\\bubbles\\purple4.png";
-char * blue1_png = "media\\graphics\\bubbles\\blue1.png";
-char * blue2_png = "media\\graphics\\bubbles\\blue2.png";
-char * blue3_png = "media\\graphics\\bubbles\\blue3.png";
-char * blue4_png = "media\\graphics\\bubbles\\blue4.png";
-char * blue5_png = "media\\graphics\\bubbles\\blue5.png";
-char * blue6_png = "media\\graphics\\bubbles\\blue6.png";
-char * blue7_png = "media\\graphics\\bubbles\\blue7.png";
-char * blue8_png = "media\\graphics\\bubbles\\blue8.png";
-char * blue9_png = "media\\graphics\\bubbles\\blue9.png";
-char * blue10_png = "media\\graphics\\bubbles\\blue10.png";
-char * green1_png = "media\\graphics\\bubbles\\green1.png";
-char * green2_png = "media\\graphics\\bubbles\\green2.png";
-char * green3_png = "media\\graphics\\bubbles\\green3.png";
-char * green4_png = "media\\graphics\\bubbles\\green4.png";
-char * green5_png = "media\\graphics\\bubbles\\green5.png";
-char * green6_png = "media\\graphics\\bubbles\\green6.png";
-char * green7_png = "media\\graphics\\bubbles\\green7.png";
-char * green8_png = "media\\graphics\\bubbles\\green8.png";
-char * green9_png = "media\\graphics\\bubbles\\green9.png";
-char * brown1_png = "media\\graphics\\bubbles\\brown1.png";
-char * brown2_png = "media\\graphics\\bubbles\\brown2.png";
-char * brown3_png = "media\\graphics\\bubbles\\brown3.png";
-char * brown4_png = "media\\graphics\\bubbles\\brown4.png";
-char * orange1_png = "media\\graphics\\bubbles\\orange1.png";
-char * orange2_png = "media\\graphics\\bubbles\\orange2.png";
-char * orange3_png = "media\\graphics\\bubbles\\orange3.png";
-char * orange4_png = "media\\graphics\\bubbles\\orange4.png";
-char * orange5_png = "media\\graphics\\bubbles\\orange5.png";
-char * orange6_png = "media\\graphics\\bubbles\\orange6.png";
-char * orange7_png = "media\\graphics\\bubbles\\orange7.png";
-char * orange8_png = "media\\graphics\\bubbles\\orange8.png";
-char * yellow1_png = "media\\graphics\\bubbles\\yellow1.png";
-char * yellow2_png = "media\\graphics\\bubbles\\yellow2.png";
-char * yellow3_png = "media\\graphics\\bubbles\\yellow3.png";
-char * yellow4_png = "media\\graphics\\bubbles\\yellow4.png";
-char * yellow5_png = "media\\graphics\\bubbles\\yellow5.png";
-char * yellow6_png = "media\\graphics\\bubbles\\yellow6.png";
-char * yellow7_png = "media\\graphics\\bubbles\\yellow7.png";
-char * tan1_png = "media\\graphics\\bubbles\\tan1.png";
-char * tan2_png = "media\\graphics\\bubbles\\tan2.png";
-char * tan3_png = "media\\graphics\\bubbles\\tan3.png";
-char * tan4_png = "media\\graphics\\bubbles\\tan4.png";
-char * gray1_png = "media\\graphics\\bubbles\\gray1.png";
-char * pink1_png = "media\\graphics\\bubbles\\pink1.png";
-char * pink2_png = "media\\graphics\\bubbles\\pink2.png";
-char * pink3_png = "media\\graphics\\bubbles\\pink3.png";
-char * pink4_png = "media\\graphics\\bubbles\\pink4.png";
-char * pink5_png = "media\\graphics\\bubbles\\pink5.png";
-char * pink6_png = "media\\graphics\\bubbles\\pink6.png";
+MEDIA_FILE( user_bubble_png, "media\\graphics\\bubbles\\user_bubble.png", MEDIA_IMAGE )
+MEDIA_FILE( tint_bubble_png, "media\\graphics\\bubbles\\tint_bubble.png", MEDIA_IMAGE )
+MEDIA_FILE( red1_png, "media\\graphics\\bubbles\\red1.png", MEDIA_IMAGE )
+MEDIA_FILE( red2_png, "media\\graphics\\bubbles\\red2.png", MEDIA_IMAGE )
+MEDIA_FILE( red3_png, "media\\graphics\\bubbles\\red3.png", MEDIA_IMAGE )
+MEDIA_FILE( red4_png, "media\\graphics\\bubbles\\red4.png", MEDIA_IMAGE )
+MEDIA_FILE( red5_png, "media\\graphics\\bubbles\\red5.png", MEDIA_IMAGE )
+MEDIA_FILE( red6_png, "media\\graphics\\bubbles\\red6.png", MEDIA_IMAGE )
+MEDIA_FILE( red7_png, "media\\graphics\\bubbles\\red7.png", MEDIA_IMAGE )
+MEDIA_FILE( purple1_png, "media\\graphics\\bubbles\\purple1.png", MEDIA_IMAGE )
+MEDIA_FILE( purple2_png, "media\\graphics\\bubbles\\purple2.png", MEDIA_IMAGE )
+MEDIA_FILE( purple3_png, "media\\graphics\\bubbles\\purple3.png", MEDIA_IMAGE )
+MEDIA_FILE( purple4_png, "media\\graphics\\bubbles\\purple4.png", MEDIA_IMAGE )
+MEDIA_FILE( blue1_png, "media\\graphics\\bubbles\\blue1.png", MEDIA_IMAGE )
+MEDIA_FILE( blue2_png, "media\\graphics\\bubbles\\blue2.png", MEDIA_IMAGE )
+MEDIA_FILE( blue3_png, "media\\graphics\\bubbles\\blue3.png", MEDIA_IMAGE )
+MEDIA_FILE( blue4_png, "media\\graphics\\bubbles\\blue4.png", MEDIA_IMAGE )
+MEDIA_FILE( blue5_png, "media\\graphics\\bubbles\\blue5.png", MEDIA_IMAGE )
+MEDIA_FILE( blue6_png, "media\\graphics\\bubbles\\blue6.png", MEDIA_IMAGE )
+MEDIA_FILE( blue7_png, "media\\graphics\\bubbles\\blue7.png", MEDIA_IMAGE )
+MEDIA_FILE( blue8_png, "media\\graphics\\bubbles\\blue8.png", MEDIA_IMAGE )
+MEDIA_FILE( blue9_png, "media\\graphics\\bubbles\\blue9.png", MEDIA_IMAGE )
+MEDIA_FILE( blue10_png, "media\\graphics\\bubbles\\blue10.png", MEDIA_IMAGE )
+MEDIA_FILE( green1_png, "media\\graphics\\bubbles\\green1.png", MEDIA_IMAGE )
+MEDIA_FILE( green2_png, "media\\graphics\\bubbles\\green2.png", MEDIA_IMAGE )
+MEDIA_FILE( green3_png, "media\\graphics\\bubbles\\green3.png", MEDIA_IMAGE )
+MEDIA_FILE( green4_png, "media\\graphics\\bubbles\\green4.png", MEDIA_IMAGE )
+MEDIA_FILE( green5_png, "media\\graphics\\bubbles\\green5.png", MEDIA_IMAGE )
+MEDIA_FILE( green6_png, "media\\graphics\\bubbles\\green6.png", MEDIA_IMAGE )
+MEDIA_FILE( green7_png, "media\\graphics\\bubbles\\green7.png", MEDIA_IMAGE )
+MEDIA_FILE( green8_png, "media\\graphics\\bubbles\\green8.png", MEDIA_IMAGE )
+MEDIA_FILE( green9_png, "media\\graphics\\bubbles\\green9.png", MEDIA_IMAGE )
+MEDIA_FILE( brown1_png, "media\\graphics\\bubbles\\brown1.png", MEDIA_IMAGE )
+MEDIA_FILE( brown2_png, "media\\graphics\\bubbles\\brown2.png", MEDIA_IMAGE )
+MEDIA_FILE( brown3_png, "media\\graphics\\bubbles\\brown3.png", MEDIA_IMAGE )
+MEDIA_FILE( brown4_png, "media\\graphics\\bubbles\\brown4.png", MEDIA_IMAGE )
+MEDIA_FILE( orange1_png, "media\\graphics\\bubbles\\orange1.png", MEDIA_IMAGE )
+MEDIA_FILE( orange2_png, "media\\graphics\\bubbles\\orange2.png", MEDIA_IMAGE )
+MEDIA_FILE( orange3_png, "media\\graphics\\bubbles\\orange3.png", MEDIA_IMAGE )
+MEDIA_FILE( orange4_png, "media\\graphics\\bubbles\\orange4.png", MEDIA_IMAGE )
+MEDIA_FILE( orange5_png, "media\\graphics\\bubbles\\orange5.png", MEDIA_IMAGE )
+MEDIA_FILE( orange6_png, "media\\graphics\\bubbles\\orange6.png", MEDIA_IMAGE )
+MEDIA_FILE( orange7_png, "media\\graphics\\bubbles\\orange7.png", MEDIA_IMAGE )
+MEDIA_FILE( orange8_png, "media\\graphics\\bubbles\\orange8.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow1_png, "media\\graphics\\bubbles\\yellow1.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow2_png, "media\\graphics\\bubbles\\yellow2.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow3_png, "media\\graphics\\bubbles\\yellow3.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow4_png, "media\\graphics\\bubbles\\yellow4.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow5_png, "media\\graphics\\bubbles\\yellow5.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow6_png, "media\\graphics\\bubbles\\yellow6.png", MEDIA_IMAGE )
+MEDIA_FILE( yellow7_png, "media\\graphics\\bubbles\\yellow7.png", MEDIA_IMAGE )
+MEDIA_FILE( tan1_png, "media\\graphics\\bubbles\\tan1.png", MEDIA_IMAGE )
+MEDIA_FILE( tan2_png, "media\\graphics\\bubbles\\tan2.png", MEDIA_IMAGE )
+MEDIA_FILE( tan3_png, "media\\graphics\\bubbles\\tan3.png", MEDIA_IMAGE )
+MEDIA_FILE( tan4_png, "media\\graphics\\bubbles\\tan4.png", MEDIA_IMAGE )
+MEDIA_FILE( gray1_png, "media\\graphics\\bubbles\\gray1.png", MEDIA_IMAGE )
+MEDIA_FILE( pink1_png, "media\\graphics\\bubbles\\pink1.png", MEDIA_IMAGE )
+MEDIA_FILE( pink2_png, "media\\graphics\\bubbles\\pink2.png", MEDIA_IMAGE )
+MEDIA_FILE( pink3_png, "media\\graphics\\bubbles\\pink3.png", MEDIA_IMAGE )
+MEDIA_FILE( pink4_png, "media\\graphics\\bubbles\\pink4.png", MEDIA_IMAGE )
+MEDIA_FILE( pink5_png, "media\\graphics\\bubbles\\pink5.png", MEDIA_IMAGE )
+MEDIA_FILE( pink6_png, "media\\graphics\\bubbles\\pink6.png", MEDIA_IMAGE )
 
 /**
 *  File paths for sound effects:
 */
 
-char * note1_wav = "media\\audio\\sound_effects\\note1.wav";
-char * note2_wav = "media\\audio\\sound_effects\\note2.wav";
-char * note3_wav = "media\\audio\\sound_effects\\note3.wav";
-char * note4_wav = "media\\audio\\sound_effects\\note4.wav";
-char * note5_wav = "media\\audio\\sound_effects\\note5.wav";
-char * note6_wav = "media\\audio\\sound_effects\\note6.wav";
-char * success_wav = "media\\audio\\sound_effects\\success.wav";
-
-#endif
\ No newline at end of file
+MEDIA_FILE( note1_wav, "media\\audio\\sound_effects\\note1.wav", MEDIA_SOUND )
+MEDIA_FILE( note2_wav, "media\\audio\\sound_effects\\note2.wav", MEDIA_SOUND )
+MEDIA_FILE( note3_wav, "media\\audio\\sound_effects\\note3.wav", MEDIA_SOUND )
+MEDIA_FILE( note4_wav, "media\\audio\\sound_effects\\note4.wav", MEDIA_SOUND )
+MEDIA_FILE( note5_wav, "media\\audio\\sound_effects\\note5.wav", MEDIA_SOUND )
+MEDIA_FILE( note6_wav, "media\\audio\\sound_effects\\note6.wav", MEDIA_SOUND )
+MEDIA_FILE( success_wav, "media\\audio\\sound_effects\\success.wav", MEDIA_SOUND )
@@ -0,0 +1,262 @@
+/**
+*  File:  MediaLoader.cpp
+*
+*  Description:  This file contains the functions that load the game's images
+*                and sounds into DarkGDK, from the media pack when there is one.
+*
+*                DarkGDK only makes images and sounds from its own memblocks, so
+*                a packed asset is copied once, from the mapping into a memblock,
+*                and then handed to dbMakeImageFromMemblock() or
+*                dbMakeSoundFromMemblock().  There is no file to find and nothing
+*                to decode.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "MediaLoader.h"
+#include <string.h>  // For memcpy().
+
+/**
+*  Function: makeFromPack(const uint8 * bytes, uint32 size, MediaKind kind, int id)
+*
+*  Purpose: This function makes an image or sound from its bytes in the pack,
+*           through MEDIA_MEMBLOCK_ID.
+*
+*  Inputs: bytes, size - The asset's bytes, from getPackedMedia().
+*          kind - What to make.
+*          id - The image or sound ID to make.
+*/
+
+static void makeFromPack(const uint8 * bytes, uint32 size, MediaKind kind, int id)
+{
+	dbMakeMemblock( MEDIA_MEMBLOCK_ID, (int)size );
+	memcpy( (void *)dbGetMemblockPtr( MEDIA_MEMBLOCK_ID ), bytes, size );
+
+	if ( kind == MEDIA_IMAGE )
+	{
+		dbMakeImageFromMemblock( id, MEDIA_MEMBLOCK_ID );
+	}
+	else
+	{
+		dbMakeSoundFromMemblock( id, MEDIA_MEMBLOCK_ID );
+	}
+
+	dbDeleteMemblock( MEDIA_MEMBLOCK_ID );
+}
+
+/**
+*  Function: loadImageMedia(MediaAsset asset, int imageID)
+*
+*  Purpose: This function makes an image from the pack, or loads it from its
+*           file if it isn't in the pack.
+*
+*  Inputs: asset - The image.
+*          imageID - The image ID to load it into.
+*
+*  Returns: True if the image was made or loaded.  False if it is missing, or
+*           isn't an image.
+*/
+
+bool loadImageMedia(MediaAsset asset, int imageID)
+{
+	if ( mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_IMAGE )
+	{
+		return false;
+	}
+
+	uint32 size;
+	const uint8 * bytes = getPackedMedia( asset, size );
+
+	if ( bytes != NULL )
+	{
+		makeFromPack( bytes, size, MEDIA_IMAGE, imageID );
+	}
+	else
+	{
+		dbLoadImage( (char *)getMediaPath( asset ), imageID );
+	}
+
+	return true;
+}
+
+/**
+*  Function: loadSoundMedia(MediaAsset asset, int soundID)
+*
+*  Purpose: This function makes a sound from the pack, or loads it from its
+*           file if it isn't in the pack.
+*
+*  Inputs: asset - The sound.
+*          soundID - The sound ID to load it into.
+*
+*  Returns: True if the sound was made or loaded.  False if it is missing, or
+*           isn't a sound.
+*/
+
+bool loadSoundMedia(MediaAsset asset, int soundID)
+{
+	if ( mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_SOUND )
+	{
+		return false;
+	}
+
+	uint32 size;
+	const uint8 * bytes = getPackedMedia( asset, size );
+
+	if ( bytes != NULL )
+	{
+		makeFromPack( bytes, size, MEDIA_SOUND, soundID );
+	}
+	else
+	{
+		dbLoadSound( (char *)getMediaPath( asset ), soundID );
+	}
+
+	return true;
+}
+
+/**
+*  Function: readImagePixels(int imageID, vector <uint32> & pixels, int & width, int & height)
+*
+*  Purpose: This function copies an image's pixels out of DarkGDK, through
+*           MEDIA_MEMBLOCK_ID.  An image memblock holds the width, height and
+*           depth, and then the pixels, top row first.
+*
+*  Inputs: imageID - The image.
+*          pixels - Set to its pixels, 0xAARRGGBB.
+*          width, height - Set to its size.
+*
+*  Returns: True if the image exists and is 32-bit.
+*/
+
+bool readImagePixels(int imageID, vector <uint32> & pixels, int & width, int & height)
+{
+	if ( dbImageExist( imageID ) == 0 )
+	{
+		return false;
+	}
+
+	dbMakeMemblockFromImage( MEDIA_MEMBLOCK_ID, imageID );
+
+	const uint32 * block = (const uint32 *)dbGetMemblockPtr( MEDIA_MEMBLOCK_ID );
+	bool read = block[2] == 32;
+
+	if ( read )
+	{
+		width = (int)block[0];
+		height = (int)block[1];
+		pixels.assign( block+3, block+3 + width*height );
+	}
+
+	dbDeleteMemblock( MEDIA_MEMBLOCK_ID );
+
+	return read;
+}
+
+/**
+*  Function: makeImageFromPixels(int imageID, const uint32 * pixels, int width, int height)
+*
+*  Purpose: This function makes a 32-bit image from pixels, through
+*           MEDIA_MEMBLOCK_ID.
+*
+*  Inputs: imageID - The image ID to make.
+*          pixels - Its pixels, 0xAARRGGBB, top row first.
+*          width, height - Its size.
+*
+*  Returns: True if it was made.
+*/
+
+bool makeImageFromPixels(int imageID, const uint32 * pixels, int width, int height)
+{
+	if ( width <= 0 || height <= 0 )
+	{
+		return false;
+	}
+
+	dbMakeMemblock( MEDIA_MEMBLOCK_ID, 12 + width*height*4 );
+
+	uint32 * block = (uint32 *)dbGetMemblockPtr( MEDIA_MEMBLOCK_ID );
+	block[0] = (uint32)width;
+	block[1] = (uint32)height;
+	block[2] = 32;
+	memcpy( block+3, pixels, width*height*4 );
+
+	dbMakeImageFromMemblock( imageID, MEDIA_MEMBLOCK_ID );
+	dbDeleteMemblock( MEDIA_MEMBLOCK_ID );
+
+	return true;
+}
+
+/**
+*  Function: addToPack(MediaPackWriter & writer, MediaAsset asset)
+*
+*  Purpose: This function decodes an image or sound file with DarkGDK, through
+*           the scratch IDs, and adds its memblock bytes to a pack.
+*
+*  Inputs: writer - The pack being made.
+*          asset - The file.
+*
+*  Returns: True if it was added.
+*/
+
+static bool addToPack(MediaPackWriter & writer, MediaAsset asset)
+{
+	char * path = (char *)getMediaPath( asset );
+
+	if ( dbFileExist( path ) == 0 )
+	{
+		return false;
+	}
+
+	if ( getMediaKind( asset ) == MEDIA_IMAGE )
+	{
+		dbLoadImage( path, MEDIA_SCRATCH_IMAGE_ID );
+		dbMakeMemblockFromImage( MEDIA_MEMBLOCK_ID, MEDIA_SCRATCH_IMAGE_ID );
+		dbDeleteImage( MEDIA_SCRATCH_IMAGE_ID );
+	}
+	else
+	{
+		dbLoadSound( path, MEDIA_SCRATCH_SOUND_ID );
+		dbMakeMemblockFromSound( MEDIA_MEMBLOCK_ID, MEDIA_SCRATCH_SOUND_ID );
+		dbDeleteSound( MEDIA_SCRATCH_SOUND_ID );
+	}
+
+	if ( dbMemblockExist( MEDIA_MEMBLOCK_ID ) == 0 )
+	{
+		return false;
+	}
+
+	bool added = writer.add( path, getMediaKind( asset ), (const uint8 *)dbGetMemblockPtr( MEDIA_MEMBLOCK_ID ),
+		                     dbGetMemblockSize( MEDIA_MEMBLOCK_ID ) );
+
+	dbDeleteMemblock( MEDIA_MEMBLOCK_ID );
+
+	return added;
+}
+
+/**
+*  Function: writeMediaPack(const char * packName)
+*
+*  Purpose: This function decodes every image and sound in the manifest and
+*           writes them to a media pack.  It is run once, with -packmedia,
+*           whenever the media changes.  The display mode has to be set first,
+*           as DarkGDK loads images for it.
+*
+*  Inputs: packName - The pack to write.
+*
+*  Returns: The number of assets in the pack, or -1 if it couldn't be written.
+*/
+
+int writeMediaPack(const char * packName)
+{
+	MediaPackWriter writer;
+	int added = 0;
+
+	for ( int i = 0; i < MEDIA_ASSET_COUNT; i++ )
+	{
+		added += addToPack( writer, (MediaAsset)i ) ? 1 : 0;
+	}
+
+	return writer.save( packName ) ? added : -1;
+}
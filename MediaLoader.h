@@ -0,0 +1,32 @@
+/**
+*  File:  MediaLoader.h
+*
+*  Description:  This header file contains the functions that load the game's
+*                images and sounds into DarkGDK, from the media pack when there
+*                is one.  The assets themselves, and finding them, are in
+*                MediaManifest.h, which doesn't need DarkGDK.  These are what the
+*                DarkGDK backend (PlatformGdk.h) loads with.  It also copies an
+*                image's pixels out of DarkGDK, and makes one from pixels, as
+*                the bubbles' radius frames (BubbleFrames.h) are made.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef MEDIA_LOADER_H_
+#define MEDIA_LOADER_H_
+
+#include "DarkGDK.h"
+#include "MediaManifest.h"
+#include <vector>
+
+using namespace std;
+
+bool loadImageMedia(MediaAsset asset, int imageID);
+bool loadSoundMedia(MediaAsset asset, int soundID);
+bool readImagePixels(int imageID, vector <uint32> & pixels, int & width, int & height);
+bool makeImageFromPixels(int imageID, const uint32 * pixels, int width, int height);
+int writeMediaPack(const char * packName);
+
+#endif
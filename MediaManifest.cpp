@@ -0,0 +1,271 @@
+/**
+*  File:  MediaManifest.cpp
+*
+*  Description:  This file contains the media manifest table, the media pack
+*                and the functions that find the game's images and sounds.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "MediaManifest.h"
+#include <fstream>
+#include <stdio.h>   // For sprintf().
+#include <string.h>  // For memcpy() and memcmp().
+
+using namespace std;
+
+extern ofstream logFile;
+
+/**
+*  MediaManifestEntry is one line of the manifest in MediaFilePaths.h.
+*/
+
+struct MediaManifestEntry
+{
+	const char * path;
+	MediaKind kind;
+};
+
+static const MediaManifestEntry MEDIA_MANIFEST[MEDIA_ASSET_COUNT] =
+{
+#define MEDIA_FILE( name, path, kind ) { path, kind },
+#include "MediaFilePaths.h"
+#undef MEDIA_FILE
+};
+
+static MediaPack mediaPack;  // The open pack, if any.
+
+// What checkMediaManifest() found.  An asset that is present and has no pack
+// entry is loaded from its own file.
+static bool present[MEDIA_ASSET_COUNT];
+static const MediaPackEntry * packed[MEDIA_ASSET_COUNT];
+
+/**
+*  Function: openMediaPack(const char * fileName)
+*
+*  Purpose: This function maps a media pack, so that checkMediaManifest() can
+*           find the assets in it.
+*
+*  Inputs: fileName - The pack.
+*
+*  Returns: True if it was opened.  If not, everything is loaded from its own
+*           file.
+*/
+
+bool openMediaPack(const char * fileName)
+{
+	return mediaPack.open( fileName );
+}
+
+/**
+*  Function: closeMediaPack()
+*
+*  Purpose: This function unmaps the media pack, and forgets what the manifest
+*           check found.  The images and sounds already made are unaffected.
+*/
+
+void closeMediaPack()
+{
+	mediaPack.close();
+
+	for ( int i = 0; i < MEDIA_ASSET_COUNT; i++ )
+	{
+		present[i] = false;
+		packed[i] = NULL;
+	}
+}
+
+/**
+*  Function: checkMediaManifest()
+*
+*  Purpose: This function is called once at startup, after openMediaPack().  It
+*           finds every asset in the manifest, in the pack or else on disk, and
+*           writes an error to the log file for each one that is missing.  It
+*           is the only place the game looks for its media.
+*
+*  Returns: The number of assets that are missing.
+*/
+
+int checkMediaManifest()
+{
+	char lineBuffer[MAX_ERROR_BUFFER];
+	int missing = 0;
+
+	for ( int i = 0; i < MEDIA_ASSET_COUNT; i++ )
+	{
+		const MediaManifestEntry & asset = MEDIA_MANIFEST[i];
+		const MediaPackEntry * entry = mediaPack.isOpen() ? mediaPack.find( asset.path ) : NULL;
+
+		if ( entry != NULL && ( entry->kind != (uint32)asset.kind || entry->size == 0 ) )
+		{
+			entry = NULL;
+		}
+
+		packed[i] = entry;
+		present[i] = entry != NULL || fileExists( asset.path );
+
+		if ( present[i] == false )
+		{
+			sprintf( lineBuffer, "MediaManifest.cpp: checkMediaManifest(): File %s does not exist.", asset.path );
+			logFile << lineBuffer << endl << endl;
+
+			missing++;
+		}
+	}
+
+	return missing;
+}
+
+/**
+*  Function: mediaExists(MediaAsset asset)
+*
+*  Returns: True if checkMediaManifest() found the asset.
+*/
+
+bool mediaExists(MediaAsset asset)
+{
+	return present[asset];
+}
+
+/**
+*  Function: getMediaPath(MediaAsset asset)
+*
+*  Returns: The asset's path, as it is in MediaFilePaths.h.
+*/
+
+const char * getMediaPath(MediaAsset asset)
+{
+	return MEDIA_MANIFEST[asset].path;
+}
+
+/**
+*  Function: getMediaKind(MediaAsset asset)
+*
+*  Returns: Whether the asset is an image or a sound.
+*/
+
+MediaKind getMediaKind(MediaAsset asset)
+{
+	return MEDIA_MANIFEST[asset].kind;
+}
+
+/**
+*  Function: getPackedMedia(MediaAsset asset, uint32 & size)
+*
+*  Purpose: This function finds an asset's bytes in the media pack.  They are
+*           what a DarkGDK memblock of the image or sound holds.
+*
+*  Inputs: asset - The asset.
+*          size - Set to the number of bytes.
+*
+*  Returns: The bytes, in the mapping, or NULL if the asset isn't in the pack
+*           (or checkMediaManifest() hasn't been called).
+*/
+
+const uint8 * getPackedMedia(MediaAsset asset, uint32 & size)
+{
+	if ( packed[asset] == NULL )
+	{
+		size = 0;
+		return NULL;
+	}
+
+	size = packed[asset]->size;
+
+	return mediaPack.getData( *packed[asset] );
+}
+
+/**
+*  Function: readInt32(const uint8 * bytes, bool bigEndian)
+*
+*  Returns: The 32-bit integer at bytes, in either byte order.
+*/
+
+static int32 readInt32(const uint8 * bytes, bool bigEndian)
+{
+	if ( bigEndian )
+	{
+		return (int32)( (uint32)bytes[0] << 24 | (uint32)bytes[1] << 16 | (uint32)bytes[2] << 8 | bytes[3] );
+	}
+
+	return (int32)( (uint32)bytes[3] << 24 | (uint32)bytes[2] << 16 | (uint32)bytes[1] << 8 | bytes[0] );
+}
+
+/**
+*  Function: getMediaImageSize(MediaAsset asset, int & width, int & height)
+*
+*  Purpose: This function finds the size of an image without decoding it, from
+*           its memblock header in the pack, or else from the header of its PNG
+*           or BMP file.  It is how a renderer that doesn't draw (see
+*           PlatformNull.h) sizes its sprites the way DarkGDK would.
+*
+*  Inputs: asset - The image.
+*          width, height - Set to its size in pixels.
+*
+*  Returns: True if the size was found.
+*/
+
+bool getMediaImageSize(MediaAsset asset, int & width, int & height)
+{
+	static const uint8 PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+	width = 0;
+	height = 0;
+
+	if ( present[asset] == false || MEDIA_MANIFEST[asset].kind != MEDIA_IMAGE )
+	{
+		return false;
+	}
+
+	uint32 size;
+	const uint8 * bytes = getPackedMedia( asset, size );
+
+	if ( bytes != NULL )
+	{
+		if ( size < 12 )
+		{
+			return false;
+		}
+
+		uint32 header[2];
+		memcpy( header, bytes, sizeof( header ) );  // Width, height, then depth.
+
+		width = (int)header[0];
+		height = (int)header[1];
+
+		return true;
+	}
+
+	MappedFile file;
+
+	if ( file.open( MEDIA_MANIFEST[asset].path ) == false || file.getSize() < 26 )
+	{
+		return false;
+	}
+
+	bytes = file.getData();
+
+	if ( memcmp( bytes, PNG_SIGNATURE, sizeof( PNG_SIGNATURE ) ) == 0 )  // The IHDR chunk comes first.
+	{
+		width = readInt32( bytes + 16, true );
+		height = readInt32( bytes + 20, true );
+	}
+	else if ( bytes[0] == 'B' && bytes[1] == 'M' )
+	{
+		width = readInt32( bytes + 18, false );
+		height = readInt32( bytes + 22, false );
+
+		if ( height < 0 )  // Stored top row first.
+		{
+			height = -height;
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	return width > 0 && height > 0;
+}
@@ -0,0 +1,50 @@
+/**
+*  File:  MediaManifest.h
+*
+*  Description:  This header file contains MediaAsset, the handle each of the
+*                game's images and sounds is known by, and the functions that
+*                find them.  The handles come from the manifest in
+*                MediaFilePaths.h, so there is one for every media file, and no
+*                others.
+*
+*                checkMediaManifest() is called once at startup.  It finds every
+*                asset, in the media pack (see MediaPack.h) if one was opened with
+*                openMediaPack(), or else as a file of its own, and remembers the
+*                result.  From then on, mediaExists() is only a look in that
+*                table, and loading an asset never has to look for it first, so
+*                nothing in the game loop touches the file system to find media.
+*
+*                None of this uses DarkGDK.  Loading an asset is up to the
+*                renderer and audio backend (see Platform.h); the DarkGDK ones
+*                use MediaLoader.h.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef MEDIA_MANIFEST_H_
+#define MEDIA_MANIFEST_H_
+
+#include "Constants.h"
+#include "MediaPack.h"
+
+enum MediaAsset
+{
+#define MEDIA_FILE( name, path, kind ) ASSET_##name,
+#include "MediaFilePaths.h"
+#undef MEDIA_FILE
+
+	MEDIA_ASSET_COUNT
+};
+
+bool openMediaPack(const char * fileName);
+void closeMediaPack();
+int checkMediaManifest();
+bool mediaExists(MediaAsset asset);
+const char * getMediaPath(MediaAsset asset);
+MediaKind getMediaKind(MediaAsset asset);
+const uint8 * getPackedMedia(MediaAsset asset, uint32 & size);
+bool getMediaImageSize(MediaAsset asset, int & width, int & height);
+
+#endif
@@ -0,0 +1,291 @@
+/**
+*  File:  MediaPack.cpp
+*
+*  Description:  This file contains the method implementations for the MediaPack
+*                and MediaPackWriter classes.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "MediaPack.h"
+#include <stdio.h>
+#include <string.h>  // For memcmp(), memcpy(), memset(), strcmp() and strlen().
+#include <algorithm>  // For sort().
+
+/**
+*  Function: MediaPack()
+*
+*  Purpose: This is the constructor for the MediaPack class.  No pack is open
+*           until open() is called.
+*/
+
+MediaPack::MediaPack()
+{
+	entries = NULL;
+	entryCount = 0;
+}
+
+/**
+*  Function: open(const char * fileName)
+*
+*  Purpose: This function maps a pack into memory, after closing the one that
+*           was open.  The table of contents is checked here, once, so that
+*           every entry's bytes are known to be inside the file.
+*
+*  Inputs: fileName - The pack.
+*
+*  Returns: True if the file is a pack this version of the game can use.
+*/
+
+bool MediaPack::open(const char * fileName)
+{
+	close();
+
+	if ( file.open( fileName ) == false || file.getSize() < sizeof(MediaPackHeader) )
+	{
+		file.close();
+		return false;
+	}
+
+	size_t size = file.getSize();
+	const MediaPackHeader * header = (const MediaPackHeader *)file.getData();
+	const MediaPackEntry * toc = (const MediaPackEntry *)( file.getData() + header->tocOffset );
+
+	bool valid = memcmp( header->magic, MEDIA_PACK_MAGIC, 4 ) == 0 && header->version == MEDIA_PACK_VERSION &&
+		         header->tocOffset % sizeof(uint32) == 0 && header->tocOffset <= size &&
+		         header->entryCount <= ( size - header->tocOffset ) / sizeof(MediaPackEntry);
+
+	for ( uint32 i = 0; valid && i < header->entryCount; i++ )
+	{
+		const MediaPackEntry & entry = toc[i];
+
+		valid = memchr( entry.name, 0, MEDIA_NAME_SIZE ) != NULL && entry.offset <= size && entry.size <= size - entry.offset &&
+			    entry.offset % MEDIA_PACK_ALIGNMENT == 0 && ( i == 0 || strcmp( toc[i-1].name, entry.name ) < 0 );
+	}
+
+	if ( valid == false )
+	{
+		file.close();
+		return false;
+	}
+
+	entries = toc;
+	entryCount = (int)header->entryCount;
+
+	return true;
+}
+
+/**
+*  Function: close()
+*
+*  Purpose: This function unmaps the pack.  Nothing from it may be used after
+*           this.
+*/
+
+void MediaPack::close()
+{
+	file.close();
+
+	entries = NULL;
+	entryCount = 0;
+}
+
+/**
+*  Function: isOpen()
+*
+*  Returns: True if a pack is open.
+*/
+
+bool MediaPack::isOpen() const
+{
+	return entries != NULL;
+}
+
+/**
+*  Function: getEntryCount()
+*
+*  Returns: The number of images and sounds in the pack.
+*/
+
+int MediaPack::getEntryCount() const
+{
+	return entryCount;
+}
+
+/**
+*  Function: find(const char * name)
+*
+*  Purpose: This function looks up an entry by name, with a binary search of
+*           the sorted table of contents.
+*
+*  Inputs: name - The path of the file the entry was made from, as it is in
+*                 MediaFilePaths.h.
+*
+*  Returns: The entry, or NULL if it isn't in the pack.
+*/
+
+const MediaPackEntry * MediaPack::find(const char * name) const
+{
+	int low = 0;
+	int high = entryCount - 1;
+
+	while ( low <= high )
+	{
+		int middle = ( low + high ) / 2;
+		int order = strcmp( entries[middle].name, name );
+
+		if ( order == 0 )
+		{
+			return & entries[middle];
+		}
+		else if ( order < 0 )
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+*  Function: getData(const MediaPackEntry & entry)
+*
+*  Returns: An entry's bytes, in the mapping.
+*/
+
+const uint8 * MediaPack::getData(const MediaPackEntry & entry) const
+{
+	return file.getData() + entry.offset;
+}
+
+/**
+*  Function: add(const char * name, MediaKind kind, const uint8 * bytes, int size)
+*
+*  Purpose: This function adds an image or sound to the pack being made.
+*
+*  Inputs: name - The path of the file it was made from.
+*          kind - Image or sound.
+*          bytes, size - Its decoded bytes.
+*
+*  Returns: True if it was added.  Names must be shorter than MEDIA_NAME_SIZE,
+*           and can only be added once.
+*/
+
+bool MediaPackWriter::add(const char * name, MediaKind kind, const uint8 * bytes, int size)
+{
+	if ( strlen( name ) >= (size_t)MEDIA_NAME_SIZE || size < 0 )
+	{
+		return false;
+	}
+
+	for ( int i = 0; i < (int)entries.size(); i++ )
+	{
+		if ( strcmp( entries[i].name, name ) == 0 )
+		{
+			return false;
+		}
+	}
+
+	MediaPackEntry entry;
+	memset( & entry, 0, sizeof(entry) );
+	strcpy( entry.name, name );
+	entry.kind = (uint32)kind;
+	entry.size = (uint32)size;
+
+	entries.push_back( entry );
+	data.push_back( vector <uint8>( bytes, bytes + size ) );
+
+	return true;
+}
+
+/**
+*  EntryOrder sorts the indexes of the entries by name.
+*/
+
+struct EntryOrder
+{
+	const vector <MediaPackEntry> * entries;
+
+	bool operator()(int a, int b) const
+	{
+		return strcmp( ( *entries )[a].name, ( *entries )[b].name ) < 0;
+	}
+};
+
+/**
+*  Function: save(const char * fileName)
+*
+*  Purpose: This function writes the pack, with its table of contents sorted by
+*           name and every entry's bytes aligned.
+*
+*  Inputs: fileName - The pack to write.
+*
+*  Returns: True if the pack was written.
+*/
+
+bool MediaPackWriter::save(const char * fileName) const
+{
+	vector <int> order( entries.size() );
+
+	for ( int i = 0; i < (int)order.size(); i++ )
+	{
+		order[i] = i;
+	}
+
+	EntryOrder byName;
+	byName.entries = & entries;
+	sort( order.begin(), order.end(), byName );
+
+	MediaPackHeader header;
+	memcpy( header.magic, MEDIA_PACK_MAGIC, 4 );
+	header.version = MEDIA_PACK_VERSION;
+	header.entryCount = (uint32)entries.size();
+	header.tocOffset = sizeof(MediaPackHeader);
+
+	vector <MediaPackEntry> toc( entries.size() );
+	size_t offset = sizeof(MediaPackHeader) + toc.size() * sizeof(MediaPackEntry);
+
+	for ( int i = 0; i < (int)order.size(); i++ )
+	{
+		offset = ( offset + MEDIA_PACK_ALIGNMENT - 1 ) / MEDIA_PACK_ALIGNMENT * MEDIA_PACK_ALIGNMENT;
+
+		toc[i] = entries[order[i]];
+		toc[i].offset = (uint32)offset;
+
+		offset += toc[i].size;
+	}
+
+	vector <uint8> bytes( offset, 0 );
+
+	memcpy( & bytes[0], & header, sizeof(header) );
+
+	if ( toc.empty() == false )
+	{
+		memcpy( & bytes[header.tocOffset], & toc[0], toc.size() * sizeof(MediaPackEntry) );
+	}
+
+	for ( int i = 0; i < (int)order.size(); i++ )
+	{
+		if ( toc[i].size > 0 )
+		{
+			memcpy( & bytes[toc[i].offset], & data[order[i]][0], toc[i].size );
+		}
+	}
+
+	FILE * pack = fopen( fileName, "wb" );
+
+	if ( pack == NULL )
+	{
+		return false;
+	}
+
+	bool written = fwrite( & bytes[0], 1, bytes.size(), pack ) == bytes.size();
+
+	return fclose( pack ) == 0 && written;
+}
@@ -0,0 +1,98 @@
+/**
+*  File:  MediaPack.h
+*
+*  Description:  This header file contains MediaPack, one file holding all of the
+*                game's images and sounds already decoded, and MediaPackWriter,
+*                which makes one.  Loading the media one file at a time means a
+*                dbFileExist() and a PNG, BMP or WAV decode for every file; with
+*                a pack, the whole lot is a single memory-mapped file, and each
+*                image or sound is made straight from its bytes in the mapping.
+*
+*                Each entry is named by its path in MediaFilePaths.h, and holds
+*                what DarkGDK's memblocks hold: for an image, its width, height
+*                and depth and then the raw 32-bit pixels, and for a sound, its
+*                format and then the raw PCM samples.
+*
+*                It doesn't use DarkGDK, so the format can be read anywhere;
+*                MediaLoader.h is what puts the entries into DarkGDK.
+*
+*                File format, in the native byte order:
+*
+*                MediaPackHeader
+*                entryCount MediaPackEntries at tocOffset, sorted by name
+*                each entry's bytes at its offset, a multiple of MEDIA_PACK_ALIGNMENT
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef MEDIA_PACK_H_
+#define MEDIA_PACK_H_
+
+#include "Portable.h"
+#include <vector>
+
+using namespace std;
+
+const uint32 MEDIA_PACK_VERSION = 1;
+const uint8 MEDIA_PACK_MAGIC[4] = { 'P', 'R', 'M', 'P' };
+const int MEDIA_NAME_SIZE = 72;                      // Longest name, with its terminating 0.
+const size_t MEDIA_PACK_ALIGNMENT = SIMD_ALIGNMENT;
+const char MEDIA_PACK_FILE_NAME[] = "Prisms.media";
+
+enum MediaKind
+{
+	MEDIA_IMAGE,
+	MEDIA_SOUND
+};
+
+struct MediaPackHeader
+{
+	uint8 magic[4];
+	uint32 version;
+	uint32 entryCount;
+	uint32 tocOffset;
+};
+
+struct MediaPackEntry
+{
+	char name[MEDIA_NAME_SIZE];
+	uint32 kind;                 // A MediaKind.
+	uint32 offset;               // From the start of the file.
+	uint32 size;
+	uint32 reserved;
+};
+
+class MediaPack
+{
+private:
+	MappedFile file;
+	const MediaPackEntry * entries;
+	int entryCount;
+
+	MediaPack(const MediaPack &);
+	MediaPack & operator=(const MediaPack &);
+
+public:
+	MediaPack();
+	bool open(const char * fileName);
+	void close();
+	bool isOpen() const;
+	int getEntryCount() const;
+	const MediaPackEntry * find(const char * name) const;
+	const uint8 * getData(const MediaPackEntry & entry) const;
+};
+
+class MediaPackWriter
+{
+private:
+	vector <MediaPackEntry> entries;
+	vector < vector <uint8> > data;
+
+public:
+	bool add(const char * name, MediaKind kind, const uint8 * bytes, int size);
+	bool save(const char * fileName) const;
+};
+
+#endif
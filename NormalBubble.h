@@ -2,14 +2,14 @@
 *  File:  NormalBubble.h                                                                      
 *                                                                                            
 *  Description:	 This header file is the class definition for the NormalBubble class,         
-*                which extends the BubbleSprite class.  Prior to each level, in Prisms.cpp's
-*                createAndLoadBubbles(), a series of NormalBubble objects are created and
-*                loaded into the bubbles vector.  These are the bubbles that appear on the
-*                screen during the level.
+*                which extends the BubbleSprite class.  Prior to each level, in FrontEnd.h's
+*                prepareBubbles(), a NormalBubble object is created for each bubble
+*                in the level and loaded into the bubbles vector.  These are the bubbles
+*                that appear on the screen during the level.
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/14/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef NORMAL_BUBBLE_H
@@ -17,11 +17,68 @@
 
 #include "BubbleSprite.h"
 
-class NormalBubble : public BubbleSprite
+template <class Platform>
+class NormalBubble : public BubbleSprite<Platform>
 {
 public:
-	NormalBubble(int cX, int cY, int radius, char * bubbleFileName, int imgID, int sprtID, char * noteFileName, int sndID);
+	NormalBubble(Platform & p, int cX, int cY, int radius, int degrees, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID);
 	~NormalBubble();
 };
 
-#endif
\ No newline at end of file
+/**
+*  Function: NormalBubble(Platform & p, int cX, int cY, int r, int degrees, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID)
+*
+*  Purpose: This is the constructor for the NormalBubble class.  It is called
+*           from createBubbleSprite() in FrontEnd.h, with the bubble's place in
+*           the level's layout.  The incoming values are all passed up to the
+*           BubbleSprite constructor.
+*
+*  Inputs: p - The backend the bubble is drawn with.
+*          cX - A randomly chosen x-value for the bubble's starting location center point.
+*          cY - A randomly chosen y-value for the bubble's starting location center point.
+*          r - The radius that is passed in (12).
+*          degrees - A randomly chosen starting angle, from 30-340 degrees.
+*          bubbleImage - The bubble's image.
+*          imgID - The image ID to assign to this image resource.
+*          sprtID - The sprite ID to assign to the sprite that is created.
+*          noteSound - The sound that is played when bubble is popped.
+*          sndID - The sound ID to assign to this sound resource.
+*/
+
+template <class Platform>
+NormalBubble<Platform>::NormalBubble(Platform & p, int cX, int cY, int r, int degrees, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID)
+            : BubbleSprite<Platform>(p, cX, cY, r, bubbleImage, imgID, sprtID)
+{
+	this->display( this->getCenterX(), this->getCenterY() );  // Create initial sprite.
+
+	this->resize( this->getRadius()*2, this->getRadius()*2 );  // Resize sprite to 24x24 px (at the normal radius).
+
+	this->rotate( degrees );  // Starting angle, chosen with the rest of the level's layout.
+
+	this->setOffsetToCenter();
+
+	this->setCenterX( p.renderer.spriteX( this->getSpriteID() ) );
+	this->setCenterY( p.renderer.spriteY( this->getSpriteID() ) );
+
+	this->setPopSound( noteSound );
+
+	this->setPopSoundID( sndID );
+
+	this->loadPopSound( this->getPopSound(), this->getPopSoundID() );
+}
+
+/**
+*  Function: ~NormalBubble()
+*
+*  Purpose: This is the destructor for the NormalBubble class.  It
+*           automatically calls the destructor of its base class
+*           (BubbleSprite).
+*/
+
+template <class Platform>
+NormalBubble<Platform>::~NormalBubble()
+{
+	// Automatically calls the destructor of the base class (BubbleSprite).
+}
+
+#endif
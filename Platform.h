@@ -0,0 +1,108 @@
+/**
+*  File:  Platform.h
+*
+*  Description:  This header file contains Backend, which puts together the
+*                three things the game needs from the machine it runs on: a
+*                renderer, audio and input.  The sprites and the front end
+*                (FrontEnd.h) are templates on a Backend, so which ones they use
+*                is chosen when they are compiled.  Every call is an ordinary,
+*                non-virtual call on a concrete class, so it can be inlined,
+*                and none of it costs anything in the game loop.
+*
+*                The backends are:
+*
+*                PlatformGdk.h - DarkGDK, which the game itself is built with.
+*                PlatformNull.h - draws and plays nothing, and is driven by a
+*                                 script of mouse moves and clicks.  It runs
+*                                 the whole game, cut-screens and all, on any
+*                                 operating system, as fast as it will go.
+*                SoftwareRenderer.h - the null backend, but drawing each frame
+*                                     into a framebuffer in memory.
+*
+*                SpriteLayer.h is a renderer that goes in front of any of them,
+*                and sends on only the sprite changes, once a frame.
+*
+*                A Renderer has:
+*
+*                bool loadImage(MediaAsset asset, int imageID)  - dbLoadImage()
+*                bool imageExists(int imageID)                  - dbImageExist()
+*                void deleteImage(int imageID)                  - dbDeleteImage()
+*                bool readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+*                                                               - dbMakeMemblockFromImage()
+*                bool makeImage(int imageID, const uint32 * pixels, int width, int height)
+*                                                               - dbMakeImageFromMemblock()
+*                                                                 (pixels are 0xAARRGGBB,
+*                                                                 top row first)
+*                bool makeCircleImage(int imageID, const CircleStyle & style, int size)
+*                                                               - makeImage() of a circle
+*                                                                 size across (BubbleCircles.h)
+*                void pasteImage(int imageID, int x, int y)     - dbPasteImage()
+*                bool grabScreen(int imageID)                   - dbGetImage() of the whole
+*                                                                 screen: what has been pasted
+*                                                                 and written on it since the
+*                                                                 last sync(), without sprites
+*                void sprite(int spriteID, int x, int y, int imageID)  - dbSprite()
+*                bool spriteExists(int spriteID)                - dbSpriteExist()
+*                void deleteSprite(int spriteID)                - dbDeleteSprite()
+*                void hideSprite(int spriteID), showSprite(int spriteID), hideAllSprites()
+*                void sizeSprite(int spriteID, int width, int height)  - dbSizeSprite()
+*                void scaleSprite(int spriteID, int percent)    - dbScaleSprite()
+*                void rotateSprite(int spriteID, int degrees)   - dbRotateSprite()
+*                void offsetSprite(int spriteID, int x, int y)  - dbOffsetSprite()
+*                int spriteX(int spriteID), spriteY(), spriteWidth(), spriteHeight()
+*                void setSpriteAlpha(int spriteID, int alpha)   - dbSetSpriteAlpha()
+*                void tintSprite(int spriteID, uint32 color)    - dbSetSpriteDiffuse()
+*                                                                 (each channel of the image
+*                                                                 times color's; WHITE is none)
+*                void ink(uint32 foreground, uint32 background) - dbInk()
+*                void setTextSize(int size)                     - dbSetTextSize()
+*                void text(int x, int y, const char * text)     - dbText()
+*                void centerText(int x, int y, const char * text)  - dbCenterText()
+*                void syncOn(int rate)                          - dbSyncOn() and dbSyncRate()
+*                void sync()                                    - dbSync()
+*
+*                An Audio has:
+*
+*                bool loadSound(MediaAsset asset, int soundID)  - dbLoadSound()
+*                bool soundExists(int soundID)                  - dbSoundExist()
+*                void deleteSound(int soundID)                  - dbDeleteSound()
+*                void playSound(int soundID)                    - dbPlaySound()
+*
+*                An Input has:
+*
+*                bool loop()              - LoopGDK(): false once the window is closed.
+*                void poll()              - Moves on to the next frame's input.
+*                                           DarkGDK does this itself.
+*                void idle()              - Nothing needs drawing: gives up the
+*                                           processor until the next frame's
+*                                           input is worth reading.
+*                int mouseX(), mouseY()   - dbMouseX() and dbMouseY()
+*                int mouseClick()         - dbMouseClick()
+*                int escapeKey()          - dbEscapeKey()
+*                int keyState(int scanCode)  - dbKeyState()
+*                void hideMouse(), showMouse()
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PLATFORM_H_
+#define PLATFORM_H_
+
+#include "MediaManifest.h"  // For MediaAsset.
+#include "BubbleCircles.h"  // For CircleStyle.
+
+template <class RendererPolicy, class AudioPolicy, class InputPolicy>
+struct Backend
+{
+	typedef RendererPolicy Renderer;
+	typedef AudioPolicy Audio;
+	typedef InputPolicy Input;
+
+	Renderer renderer;
+	Audio audio;
+	Input input;
+};
+
+#endif
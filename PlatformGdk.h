@@ -0,0 +1,111 @@
+/**
+*  File:  PlatformGdk.h
+*
+*  Description:  This header file contains the DarkGDK backend (see Platform.h),
+*                which the game is built with.  Each call is the DarkGDK
+*                function of the same name, inline, so the game makes exactly
+*                the calls it always has.  Images and sounds are loaded with
+*                MediaLoader.h, from the media pack when there is one.
+*
+*                The game's renderer is GdkRenderer behind a SpriteLayer
+*                (SpriteLayer.h), so DarkGDK is only told about the sprites
+*                that changed, once a frame, and is never asked about them.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PLATFORM_GDK_H_
+#define PLATFORM_GDK_H_
+
+#include "DarkGDK.h"
+#include "Platform.h"
+#include "MediaLoader.h"
+#include "SpriteLayer.h"
+
+class GdkRenderer
+{
+public:
+	bool loadImage(MediaAsset asset, int imageID) { return loadImageMedia( asset, imageID ); }
+	bool imageExists(int imageID) { return dbImageExist( imageID ) == 1; }
+	void deleteImage(int imageID) { dbDeleteImage( imageID ); }
+	bool readImage(int imageID, vector <uint32> & pixels, int & width, int & height) { return readImagePixels( imageID, pixels, width, height ); }
+	bool makeImage(int imageID, const uint32 * pixels, int width, int height) { return makeImageFromPixels( imageID, pixels, width, height ); }
+	bool makeCircleImage(int imageID, const CircleStyle & style, int size);
+	void pasteImage(int imageID, int x, int y) { dbPasteImage( imageID, x, y ); }
+	bool grabScreen(int imageID) { dbGetImage( imageID, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT ); return dbImageExist( imageID ) == 1; }
+	void sprite(int spriteID, int x, int y, int imageID) { dbSprite( spriteID, x, y, imageID ); }
+	bool spriteExists(int spriteID) { return dbSpriteExist( spriteID ) == 1; }
+	void deleteSprite(int spriteID) { dbDeleteSprite( spriteID ); }
+	void hideSprite(int spriteID) { dbHideSprite( spriteID ); }
+	void showSprite(int spriteID) { dbShowSprite( spriteID ); }
+	void hideAllSprites() { dbHideAllSprites(); }
+	void sizeSprite(int spriteID, int width, int height) { dbSizeSprite( spriteID, width, height ); }
+	void scaleSprite(int spriteID, int percent) { dbScaleSprite( spriteID, percent ); }
+	void rotateSprite(int spriteID, int degrees) { dbRotateSprite( spriteID, degrees ); }
+	void offsetSprite(int spriteID, int x, int y) { dbOffsetSprite( spriteID, x, y ); }
+	int spriteX(int spriteID) { return dbSpriteX( spriteID ); }
+	int spriteY(int spriteID) { return dbSpriteY( spriteID ); }
+	int spriteWidth(int spriteID) { return dbSpriteWidth( spriteID ); }
+	int spriteHeight(int spriteID) { return dbSpriteHeight( spriteID ); }
+	void setSpriteAlpha(int spriteID, int alpha) { dbSetSpriteAlpha( spriteID, alpha ); }
+	void tintSprite(int spriteID, uint32 color) { dbSetSpriteDiffuse( spriteID, ( color >> 16 ) & 0xff, ( color >> 8 ) & 0xff, color & 0xff ); }
+	void ink(uint32 foreground, uint32 background) { dbInk( foreground, background ); }
+	void setTextSize(int size) { dbSetTextSize( size ); }
+	void text(int x, int y, const char * text) { dbText( x, y, (char *)text ); }
+	void centerText(int x, int y, const char * text) { dbCenterText( x, y, (char *)text ); }
+	void syncOn(int rate) { dbSyncOn(); dbSyncRate( rate ); }
+	void sync() { dbSync(); }
+};
+
+/**
+*  Function: makeCircleImage(int imageID, const CircleStyle & style, int size)
+*
+*  Purpose: This function makes an image of a circle.  DarkGDK can only draw
+*           images, so the circle is drawn into one and scaled with the sprite.
+*
+*  Returns: True if the image was made.
+*/
+
+inline bool GdkRenderer::makeCircleImage(int imageID, const CircleStyle & style, int size)
+{
+	if ( size <= 0 )
+	{
+		return false;
+	}
+
+	vector <uint32> pixels( size*size );
+
+	drawCircleImage( style, & pixels[0], size );
+
+	return makeImageFromPixels( imageID, & pixels[0], size, size );
+}
+
+class GdkAudio
+{
+public:
+	bool loadSound(MediaAsset asset, int soundID) { return loadSoundMedia( asset, soundID ); }
+	bool soundExists(int soundID) { return dbSoundExist( soundID ) == 1; }
+	void deleteSound(int soundID) { dbDeleteSound( soundID ); }
+	void playSound(int soundID) { dbPlaySound( soundID ); }
+};
+
+class GdkInput
+{
+public:
+	bool loop() { return LoopGDK() != 0; }
+	void poll() { }  // DarkGDK reads the mouse and keyboard itself.
+	void idle() { sleepSeconds( MENU_IDLE_SECONDS ); }
+	int mouseX() { return dbMouseX(); }
+	int mouseY() { return dbMouseY(); }
+	int mouseClick() { return dbMouseClick(); }
+	int escapeKey() { return dbEscapeKey(); }
+	int keyState(int scanCode) { return dbKeyState( scanCode ); }
+	void hideMouse() { dbHideMouse(); }
+	void showMouse() { dbShowMouse(); }
+};
+
+typedef Backend <SpriteLayer <GdkRenderer>, GdkAudio, GdkInput> GdkBackend;
+
+#endif
@@ -0,0 +1,643 @@
+/**
+*  File:  PlatformNull.cpp
+*
+*  Description:  This file contains the method implementations for the null
+*                backend's NullRenderer, NullAudio and ScriptedInput classes.
+*                Where DarkGDK would stop the game with an error, as when a
+*                sprite that doesn't exist is moved, these just do nothing.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PlatformNull.h"
+
+/**
+*  Function: NullRenderer()
+*
+*  Purpose: This is the constructor for the NullRenderer class.  It starts with
+*           no images or sprites.
+*/
+
+NullRenderer::NullRenderer()
+{
+	calls = 0;
+	frames = 0;
+}
+
+/**
+*  Function: findImage(int imageID)
+*
+*  Returns: The image, or NULL if there is no image with that ID.
+*/
+
+NullImage * NullRenderer::findImage(int imageID)
+{
+	if ( imageID < 0 || imageID >= (int)images.size() || images[imageID].exists == false )
+	{
+		return NULL;
+	}
+
+	return & images[imageID];
+}
+
+/**
+*  Function: findSprite(int spriteID)
+*
+*  Returns: The sprite, or NULL if there is no sprite with that ID.
+*/
+
+NullSprite * NullRenderer::findSprite(int spriteID)
+{
+	if ( spriteID < 0 || spriteID >= (int)sprites.size() || sprites[spriteID].exists == false )
+	{
+		return NULL;
+	}
+
+	return & sprites[spriteID];
+}
+
+/**
+*  Function: loadImage(MediaAsset asset, int imageID)
+*
+*  Purpose: This function makes an image the size the asset is, without
+*           decoding it (see getMediaImageSize()).
+*
+*  Inputs: asset - The image.
+*          imageID - The image ID to load it into.
+*
+*  Returns: True if the image was made.  False if it is missing, or isn't an
+*           image.
+*/
+
+bool NullRenderer::loadImage(MediaAsset asset, int imageID)
+{
+	calls++;
+
+	if ( imageID < 0 || mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_IMAGE )
+	{
+		return false;
+	}
+
+	if ( imageID >= (int)images.size() )
+	{
+		NullImage none = { false, 0, 0 };
+		images.resize( imageID+1, none );
+	}
+
+	NullImage & image = images[imageID];
+
+	image.exists = true;
+	getMediaImageSize( asset, image.width, image.height );
+
+	return true;
+}
+
+/**
+*  Function: deleteImage(int imageID)
+*
+*  Purpose: This function deletes an image.
+*/
+
+void NullRenderer::deleteImage(int imageID)
+{
+	calls++;
+
+	if ( findImage( imageID ) != NULL )
+	{
+		images[imageID].exists = false;
+	}
+}
+
+/**
+*  Function: readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+*
+*  Purpose: This function gives an image's pixels.  The null renderer keeps
+*           none, so they are all opaque white.
+*
+*  Returns: True if the image exists.
+*/
+
+bool NullRenderer::readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+{
+	calls++;
+
+	const NullImage * image = findImage( imageID );
+
+	if ( image == NULL )
+	{
+		return false;
+	}
+
+	width = image->width;
+	height = image->height;
+	pixels.assign( width*height, WHITE );
+
+	return true;
+}
+
+/**
+*  Function: makeImage(int imageID, const uint32 * pixels, int width, int height)
+*
+*  Purpose: This function makes an image of the given size.  Its pixels are
+*           not kept.
+*
+*  Returns: True if the image was made.
+*/
+
+bool NullRenderer::makeImage(int imageID, const uint32 * /*pixels*/, int width, int height)
+{
+	calls++;
+
+	if ( imageID < 0 || width <= 0 || height <= 0 )
+	{
+		return false;
+	}
+
+	if ( imageID >= (int)images.size() )
+	{
+		NullImage none = { false, 0, 0 };
+		images.resize( imageID+1, none );
+	}
+
+	NullImage & image = images[imageID];
+
+	image.exists = true;
+	image.width = width;
+	image.height = height;
+
+	return true;
+}
+
+/**
+*  Function: sprite(int spriteID, int x, int y, int imageID)
+*
+*  Purpose: This function does what dbSprite() does.  The first time, it makes
+*           the sprite, visible and the size of its image.  After that, it
+*           moves the sprite and changes its image, and leaves the rest alone.
+*
+*  Inputs: spriteID - The sprite.
+*          x, y - Where its offset point goes.
+*          imageID - Its image.
+*/
+
+void NullRenderer::sprite(int spriteID, int x, int y, int imageID)
+{
+	calls++;
+
+	if ( spriteID < 0 )
+	{
+		return;
+	}
+
+	if ( spriteID >= (int)sprites.size() )
+	{
+		NullSprite none = { false, false, 0, 0, 0, 0, 0, 0, 0, 0, 255, WHITE };
+		sprites.resize( spriteID+1, none );
+	}
+
+	NullSprite & s = sprites[spriteID];
+
+	if ( s.exists == false )
+	{
+		const NullImage * image = findImage( imageID );
+
+		s.exists = true;
+		s.visible = true;
+		s.width = image != NULL ? image->width : 0;
+		s.height = image != NULL ? image->height : 0;
+		s.offsetX = 0;
+		s.offsetY = 0;
+		s.degrees = 0;
+		s.alpha = 255;
+		s.tint = WHITE;
+	}
+
+	s.x = x;
+	s.y = y;
+	s.imageID = imageID;
+}
+
+/**
+*  Function: deleteSprite(int spriteID)
+*
+*  Purpose: This function deletes a sprite.
+*/
+
+void NullRenderer::deleteSprite(int spriteID)
+{
+	calls++;
+
+	if ( findSprite( spriteID ) != NULL )
+	{
+		sprites[spriteID].exists = false;
+	}
+}
+
+/**
+*  Function: hideSprite(int spriteID)
+*
+*  Purpose: This function hides a sprite.
+*/
+
+void NullRenderer::hideSprite(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->visible = false;
+	}
+}
+
+/**
+*  Function: showSprite(int spriteID)
+*
+*  Purpose: This function shows a sprite.
+*/
+
+void NullRenderer::showSprite(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->visible = true;
+	}
+}
+
+/**
+*  Function: hideAllSprites()
+*
+*  Purpose: This function hides every sprite.
+*/
+
+void NullRenderer::hideAllSprites()
+{
+	calls++;
+
+	for ( int i = 0; i < (int)sprites.size(); i++ )
+	{
+		sprites[i].visible = false;
+	}
+}
+
+/**
+*  Function: sizeSprite(int spriteID, int width, int height)
+*
+*  Purpose: This function sets the size a sprite is drawn at.
+*/
+
+void NullRenderer::sizeSprite(int spriteID, int width, int height)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->width = width;
+		s->height = height;
+	}
+}
+
+/**
+*  Function: scaleSprite(int spriteID, int percent)
+*
+*  Purpose: This function sets the size a sprite is drawn at to a percentage of
+*           its image's size.
+*/
+
+void NullRenderer::scaleSprite(int spriteID, int percent)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+	const NullImage * image = s != NULL ? findImage( s->imageID ) : NULL;
+
+	if ( image != NULL )
+	{
+		s->width = image->width * percent / 100;
+		s->height = image->height * percent / 100;
+	}
+}
+
+/**
+*  Function: rotateSprite(int spriteID, int degrees)
+*
+*  Purpose: This function sets a sprite's angle, clockwise, around its offset
+*           point.
+*/
+
+void NullRenderer::rotateSprite(int spriteID, int degrees)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->degrees = degrees;
+	}
+}
+
+/**
+*  Function: offsetSprite(int spriteID, int x, int y)
+*
+*  Purpose: This function sets a sprite's offset point, which it is positioned
+*           and rotated by, from its top left corner.
+*/
+
+void NullRenderer::offsetSprite(int spriteID, int x, int y)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->offsetX = x;
+		s->offsetY = y;
+	}
+}
+
+/**
+*  Function: spriteX(int spriteID)
+*
+*  Returns: The x-coordinate of the sprite's offset point, or 0 if there is no
+*           such sprite.
+*/
+
+int NullRenderer::spriteX(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	return s != NULL ? s->x : 0;
+}
+
+/**
+*  Function: spriteY(int spriteID)
+*
+*  Returns: The y-coordinate of the sprite's offset point, or 0 if there is no
+*           such sprite.
+*/
+
+int NullRenderer::spriteY(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	return s != NULL ? s->y : 0;
+}
+
+/**
+*  Function: spriteWidth(int spriteID)
+*
+*  Returns: The width the sprite is drawn at, or 0 if there is no such sprite.
+*/
+
+int NullRenderer::spriteWidth(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	return s != NULL ? s->width : 0;
+}
+
+/**
+*  Function: spriteHeight(int spriteID)
+*
+*  Returns: The height the sprite is drawn at, or 0 if there is no such sprite.
+*/
+
+int NullRenderer::spriteHeight(int spriteID)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	return s != NULL ? s->height : 0;
+}
+
+/**
+*  Function: setSpriteAlpha(int spriteID, int alpha)
+*
+*  Purpose: This function sets how opaque a sprite is, from 0 to 255.
+*/
+
+void NullRenderer::setSpriteAlpha(int spriteID, int alpha)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->alpha = alpha;
+	}
+}
+
+/**
+*  Function: tintSprite(int spriteID, uint32 color)
+*
+*  Purpose: This function sets the color a sprite's image is multiplied by.
+*/
+
+void NullRenderer::tintSprite(int spriteID, uint32 color)
+{
+	calls++;
+
+	NullSprite * s = findSprite( spriteID );
+
+	if ( s != NULL )
+	{
+		s->tint = color;
+	}
+}
+
+/**
+*  Function: NullAudio()
+*
+*  Purpose: This is the constructor for the NullAudio class.
+*/
+
+NullAudio::NullAudio()
+{
+	played = 0;
+}
+
+/**
+*  Function: loadSound(MediaAsset asset, int soundID)
+*
+*  Purpose: This function marks a sound ID as loaded, if the asset is a sound
+*           that exists.
+*
+*  Returns: True if it was loaded.
+*/
+
+bool NullAudio::loadSound(MediaAsset asset, int soundID)
+{
+	if ( soundID < 0 || mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_SOUND )
+	{
+		return false;
+	}
+
+	if ( soundID >= (int)sounds.size() )
+	{
+		sounds.resize( soundID+1, false );
+	}
+
+	sounds[soundID] = true;
+
+	return true;
+}
+
+/**
+*  Function: soundExists(int soundID)
+*
+*  Returns: True if the sound has been loaded.
+*/
+
+bool NullAudio::soundExists(int soundID)
+{
+	return soundID >= 0 && soundID < (int)sounds.size() && sounds[soundID];
+}
+
+/**
+*  Function: deleteSound(int soundID)
+*
+*  Purpose: This function deletes a sound.
+*/
+
+void NullAudio::deleteSound(int soundID)
+{
+	if ( soundExists( soundID ) )
+	{
+		sounds[soundID] = false;
+	}
+}
+
+/**
+*  Function: playSound(int soundID)
+*
+*  Purpose: This function counts the sound as played, if it exists.
+*/
+
+void NullAudio::playSound(int soundID)
+{
+	if ( soundExists( soundID ) )
+	{
+		played++;
+	}
+}
+
+/**
+*  Function: ScriptedInput()
+*
+*  Purpose: This is the constructor for the ScriptedInput class.  Until it is
+*           given a script, loop() returns false straight away.
+*/
+
+ScriptedInput::ScriptedInput()
+{
+	step = 0;
+	stepFrame = 0;
+	frame = 0;
+	frameLimit = 0;
+	x = 0;
+	y = 0;
+	random = 1;
+	idled = 0;
+}
+
+/**
+*  Function: setScript(const ScriptStep steps[], int count, int frames, uint32 seed)
+*
+*  Purpose: This function sets the script, which is played from its first step
+*           and repeated until frames frames have gone by.
+*
+*  Inputs: steps - The script.
+*          count - The number of steps.
+*          frames - How many frames loop() returns true for.
+*          seed - Where the scattering starts, so a run can be repeated.
+*/
+
+void ScriptedInput::setScript(const ScriptStep steps[], int count, int frames, uint32 seed)
+{
+	script.assign( steps, steps+count );
+
+	step = 0;
+	stepFrame = 0;
+	frame = 0;
+	frameLimit = frames;
+	random = seed;
+	idled = 0;
+
+	startStep();
+}
+
+/**
+*  Function: startStep()
+*
+*  Purpose: This function moves the mouse to where the step being started puts
+*           it.
+*/
+
+void ScriptedInput::startStep()
+{
+	if ( script.empty() )
+	{
+		return;
+	}
+
+	const ScriptStep & s = script[step];
+
+	x = s.x;
+	y = s.y;
+
+	if ( s.scatter > 0 )
+	{
+		random = random * 1664525u + 1013904223u;
+		x += (int)( ( random >> 8 ) % (uint32)( s.scatter*2 + 1 ) ) - s.scatter;
+
+		random = random * 1664525u + 1013904223u;
+		y += (int)( ( random >> 8 ) % (uint32)( s.scatter*2 + 1 ) ) - s.scatter;
+	}
+}
+
+/**
+*  Function: poll()
+*
+*  Purpose: This function is called once each frame, after sync().  It moves on
+*           a frame, and on to the script's next step once this one has had its
+*           frames.
+*/
+
+void ScriptedInput::poll()
+{
+	frame++;
+
+	if ( script.empty() )
+	{
+		return;
+	}
+
+	stepFrame++;
+
+	if ( stepFrame >= script[step].frames )
+	{
+		step = ( step+1 ) % (int)script.size();
+		stepFrame = 0;
+
+		startStep();
+	}
+}
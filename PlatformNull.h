@@ -0,0 +1,169 @@
+/**
+*  File:  PlatformNull.h
+*
+*  Description:  This header file contains the null backend (see Platform.h).
+*                NullRenderer keeps track of every image and sprite the way
+*                DarkGDK would, with their sizes, positions, angles and alpha,
+*                so the game can ask about them, but draws nothing.  NullAudio
+*                plays nothing.  ScriptedInput moves the mouse and clicks it
+*                from a script instead of reading the user's.
+*
+*                Together they run the whole game, from the Intro screen through
+*                every level and cut-screen, without a window, on any operating
+*                system.  PrismsTools' loop command uses them to time the front
+*                end, and to count the calls it makes each frame.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PLATFORM_NULL_H_
+#define PLATFORM_NULL_H_
+
+#include "Platform.h"
+#include <vector>
+
+using namespace std;
+
+/**
+*  NullImage and NullSprite are what NullRenderer knows about each image and
+*  sprite, by ID.
+*/
+
+struct NullImage
+{
+	bool exists;
+	int width;
+	int height;
+};
+
+struct NullSprite
+{
+	bool exists;
+	bool visible;
+	int x;            // Where the offset point is.
+	int y;
+	int imageID;
+	int width;        // As drawn, after sizing or scaling.
+	int height;
+	int offsetX;
+	int offsetY;
+	int degrees;
+	int alpha;
+	uint32 tint;      // WHITE if it isn't tinted.
+};
+
+class NullRenderer
+{
+protected:
+	vector <NullImage> images;
+	vector <NullSprite> sprites;
+	int calls;   // Calls made to the renderer.
+	int frames;  // Calls to sync().
+
+	NullImage * findImage(int imageID);
+	NullSprite * findSprite(int spriteID);
+
+public:
+	NullRenderer();
+	bool loadImage(MediaAsset asset, int imageID);
+	bool imageExists(int imageID) { calls++; return findImage( imageID ) != NULL; }
+	void deleteImage(int imageID);
+	bool readImage(int imageID, vector <uint32> & pixels, int & width, int & height);
+	bool makeImage(int imageID, const uint32 * pixels, int width, int height);
+	bool makeCircleImage(int imageID, const CircleStyle & /*style*/, int size) { return makeImage( imageID, NULL, size, size ); }
+	void pasteImage(int /*imageID*/, int /*x*/, int /*y*/) { calls++; }
+	bool grabScreen(int imageID) { return makeImage( imageID, NULL, SCREEN_WIDTH, SCREEN_HEIGHT ); }
+	void sprite(int spriteID, int x, int y, int imageID);
+	bool spriteExists(int spriteID) { calls++; return findSprite( spriteID ) != NULL; }
+	void deleteSprite(int spriteID);
+	void hideSprite(int spriteID);
+	void showSprite(int spriteID);
+	void hideAllSprites();
+	void sizeSprite(int spriteID, int width, int height);
+	void scaleSprite(int spriteID, int percent);
+	void rotateSprite(int spriteID, int degrees);
+	void offsetSprite(int spriteID, int x, int y);
+	int spriteX(int spriteID);
+	int spriteY(int spriteID);
+	int spriteWidth(int spriteID);
+	int spriteHeight(int spriteID);
+	void setSpriteAlpha(int spriteID, int alpha);
+	void tintSprite(int spriteID, uint32 color);
+	void ink(uint32 /*foreground*/, uint32 /*background*/) { calls++; }
+	void setTextSize(int /*size*/) { calls++; }
+	void text(int /*x*/, int /*y*/, const char * /*text*/) { calls++; }
+	void centerText(int /*x*/, int /*y*/, const char * /*text*/) { calls++; }
+	void syncOn(int /*rate*/) { calls++; }
+	void sync() { calls++; frames++; }
+	int getCallCount() const { return calls; }
+	int getFrameCount() const { return frames; }
+};
+
+class NullAudio
+{
+private:
+	vector <bool> sounds;  // Whether each sound ID has been loaded.
+	int played;
+
+public:
+	NullAudio();
+	bool loadSound(MediaAsset asset, int soundID);
+	bool soundExists(int soundID);
+	void deleteSound(int soundID);
+	void playSound(int soundID);
+	int getPlayedCount() const { return played; }
+};
+
+/**
+*  A ScriptStep puts the mouse at (x, y) for a number of frames, clicking it
+*  on the first of them if click is set.  If scatter isn't 0, the mouse is put
+*  up to scatter pixels either way of (x, y) instead, somewhere different each
+*  time the step comes around.
+*/
+
+struct ScriptStep
+{
+	int x;
+	int y;
+	bool click;
+	int frames;
+	int scatter;
+};
+
+class ScriptedInput
+{
+private:
+	vector <ScriptStep> script;
+	int step;       // The step being played.
+	int stepFrame;  // How many frames into it.
+	int frame;
+	int frameLimit;
+	int x;          // Where the mouse is.
+	int y;
+	uint32 random;  // For scattering.
+	int idled;      // Frames in which nothing was drawn.
+
+	void startStep();
+
+public:
+	ScriptedInput();
+	void setScript(const ScriptStep steps[], int count, int frames, uint32 seed);
+	bool loop() { return frame < frameLimit; }
+	void poll();
+	void idle() { idled++; }  // Counted, but the script doesn't wait.
+	int mouseX() const { return x; }
+	int mouseY() const { return y; }
+	int mouseClick() const { return script.empty() == false && script[step].click && stepFrame == 0 ? 1 : 0; }
+	int escapeKey() const { return 0; }
+	int keyState(int /*scanCode*/) const { return 0; }
+	void hideMouse() { }
+	void showMouse() { }
+	int getFrame() const { return frame; }
+	int getIdleCount() const { return idled; }
+};
+
+typedef Backend <NullRenderer, NullAudio, ScriptedInput> NullBackend;
+
+#endif
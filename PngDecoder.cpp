@@ -0,0 +1,686 @@
+/**
+*  File:  PngDecoder.cpp
+*
+*  Description:  This file contains decodePng() and the inflater it uses.
+*
+*                A PNG is a signature and then chunks: IHDR (the size and
+*                color type), PLTE and tRNS (the palette and its alpha), the
+*                IDAT chunks, which together are one zlib stream, and IEND.
+*                Inflated, the stream is the rows, top first, each starting
+*                with a byte that says how it was filtered against the row
+*                above and the pixel to the left.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PngDecoder.h"
+#include <string.h>  // For memcmp() and memcpy().
+
+/**
+*  Huffman is one Huffman code, in canonical form: how many codes there are
+*  of each length, and the symbols in order of their codes.
+*/
+
+struct Huffman
+{
+	short count[16];
+	short symbol[288];
+};
+
+/**
+*  Inflater reads a zlib stream (RFC 1950 and 1951) a bit at a time.
+*/
+
+class Inflater
+{
+private:
+	const uint8 * data;
+	size_t size;
+	size_t position;
+	uint32 bitBuffer;
+	int bitCount;
+	bool failed;
+	vector <uint8> & out;
+
+	int bits(int count);
+	int decode(const Huffman & h);
+	void stored();
+	void codes(const Huffman & lengths, const Huffman & distances);
+	void fixed();
+	void dynamic();
+
+public:
+	Inflater(const uint8 * d, size_t s, vector <uint8> & o);
+	bool inflate();
+};
+
+// The base values and extra bits of the length and distance codes.
+static const short LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const short LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                        4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const short DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                         257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                         8193, 12289, 16385, 24577 };
+static const short DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+                                          9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// The order the code length code lengths are stored in.
+static const short CODE_LENGTH_ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/**
+*  Function: buildHuffman(Huffman & h, const short * lengths, int n)
+*
+*  Purpose: This function makes a Huffman code from the length of each
+*           symbol's code (0 for a symbol that isn't used).
+*
+*  Returns: False if there are more codes of some length than can exist.
+*/
+
+static bool buildHuffman(Huffman & h, const short * lengths, int n)
+{
+	short offsets[16];
+
+	for ( int i = 0; i < 16; i++ )
+	{
+		h.count[i] = 0;
+	}
+
+	for ( int i = 0; i < n; i++ )
+	{
+		h.count[lengths[i]]++;
+	}
+
+	int left = 1;
+
+	for ( int length = 1; length < 16; length++ )
+	{
+		left = left*2 - h.count[length];
+
+		if ( left < 0 )
+		{
+			return false;
+		}
+	}
+
+	offsets[1] = 0;
+
+	for ( int length = 1; length < 15; length++ )
+	{
+		offsets[length+1] = offsets[length] + h.count[length];
+	}
+
+	for ( int i = 0; i < n; i++ )
+	{
+		if ( lengths[i] != 0 )
+		{
+			h.symbol[offsets[lengths[i]]++] = (short)i;
+		}
+	}
+
+	return true;
+}
+
+/**
+*  Function: Inflater(const uint8 * d, size_t s, vector <uint8> & o)
+*
+*  Purpose: This is the constructor for the Inflater class.
+*
+*  Inputs: d, s - The zlib stream.
+*          o - Where the inflated bytes are added.
+*/
+
+Inflater::Inflater(const uint8 * d, size_t s, vector <uint8> & o)
+        : out(o)
+{
+	data = d;
+	size = s;
+	position = 0;
+	bitBuffer = 0;
+	bitCount = 0;
+	failed = false;
+}
+
+/**
+*  Function: bits(int count)
+*
+*  Returns: The next count bits of the stream, first bit lowest.  Past the
+*           end, the stream has failed and 0s are returned.
+*/
+
+int Inflater::bits(int count)
+{
+	while ( bitCount < count )
+	{
+		if ( position >= size )
+		{
+			failed = true;
+			return 0;
+		}
+
+		bitBuffer |= (uint32)data[position++] << bitCount;
+		bitCount += 8;
+	}
+
+	int value = (int)( bitBuffer & ( ( 1u << count ) - 1 ) );
+
+	bitBuffer >>= count;
+	bitCount -= count;
+
+	return value;
+}
+
+/**
+*  Function: decode(const Huffman & h)
+*
+*  Returns: The next symbol in the stream, read with a Huffman code, or -1 if
+*           the bits aren't a code.
+*/
+
+int Inflater::decode(const Huffman & h)
+{
+	int code = 0;
+	int first = 0;
+	int index = 0;
+
+	for ( int length = 1; length < 16; length++ )
+	{
+		code |= bits( 1 );
+
+		int count = h.count[length];
+
+		if ( code - count < first )
+		{
+			return h.symbol[index + ( code - first )];
+		}
+
+		index += count;
+		first = ( first + count ) << 1;
+		code <<= 1;
+	}
+
+	failed = true;
+
+	return -1;
+}
+
+/**
+*  Function: stored()
+*
+*  Purpose: This function copies a block that isn't compressed.
+*/
+
+void Inflater::stored()
+{
+	bitBuffer = 0;  // Stored blocks start on a byte.
+	bitCount = 0;
+
+	if ( position + 4 > size )
+	{
+		failed = true;
+		return;
+	}
+
+	size_t length = data[position] | data[position+1] << 8;
+	size_t check = data[position+2] | data[position+3] << 8;
+	position += 4;
+
+	if ( length != ( ~check & 0xffff ) || position + length > size )
+	{
+		failed = true;
+		return;
+	}
+
+	out.insert( out.end(), data + position, data + position + length );
+	position += length;
+}
+
+/**
+*  Function: codes(const Huffman & lengths, const Huffman & distances)
+*
+*  Purpose: This function inflates a compressed block: literal bytes, and
+*           copies of bytes already inflated, until the end-of-block symbol.
+*/
+
+void Inflater::codes(const Huffman & lengths, const Huffman & distances)
+{
+	while ( failed == false )
+	{
+		int symbol = decode( lengths );
+
+		if ( symbol < 256 )
+		{
+			if ( symbol >= 0 )
+			{
+				out.push_back( (uint8)symbol );
+			}
+		}
+		else if ( symbol == 256 )
+		{
+			return;
+		}
+		else
+		{
+			symbol -= 257;
+
+			if ( symbol >= 29 )
+			{
+				failed = true;
+				return;
+			}
+
+			int length = LENGTH_BASE[symbol] + bits( LENGTH_EXTRA[symbol] );
+			int code = decode( distances );
+
+			if ( code < 0 || code >= 30 )
+			{
+				failed = true;
+				return;
+			}
+
+			size_t distance = DISTANCE_BASE[code] + bits( DISTANCE_EXTRA[code] );
+
+			if ( distance > out.size() )
+			{
+				failed = true;
+				return;
+			}
+
+			size_t from = out.size() - distance;
+
+			for ( int i = 0; i < length; i++ )  // May overlap what it adds.
+			{
+				out.push_back( out[from + i] );
+			}
+		}
+	}
+}
+
+/**
+*  Function: fixed()
+*
+*  Purpose: This function inflates a block compressed with the fixed codes.
+*/
+
+void Inflater::fixed()
+{
+	static Huffman lengths;
+	static Huffman distances;
+	static bool built = false;
+
+	if ( built == false )
+	{
+		short l[288];
+
+		for ( int i = 0; i < 288; i++ )
+		{
+			l[i] = i < 144 ? 8 : ( i < 256 ? 9 : ( i < 280 ? 7 : 8 ) );
+		}
+
+		buildHuffman( lengths, l, 288 );
+
+		for ( int i = 0; i < 30; i++ )
+		{
+			l[i] = 5;
+		}
+
+		buildHuffman( distances, l, 30 );
+
+		built = true;
+	}
+
+	codes( lengths, distances );
+}
+
+/**
+*  Function: dynamic()
+*
+*  Purpose: This function inflates a block compressed with codes of its own,
+*           which come first, themselves compressed with a third code.
+*/
+
+void Inflater::dynamic()
+{
+	short l[320];
+	Huffman lengthCode;
+	Huffman lengths;
+	Huffman distances;
+
+	int literalCount = bits( 5 ) + 257;
+	int distanceCount = bits( 5 ) + 1;
+	int codeCount = bits( 4 ) + 4;
+
+	if ( literalCount > 286 || distanceCount > 30 )
+	{
+		failed = true;
+		return;
+	}
+
+	for ( int i = 0; i < 19; i++ )
+	{
+		l[CODE_LENGTH_ORDER[i]] = (short)( i < codeCount ? bits( 3 ) : 0 );
+	}
+
+	if ( buildHuffman( lengthCode, l, 19 ) == false )
+	{
+		failed = true;
+		return;
+	}
+
+	int n = 0;
+
+	while ( n < literalCount + distanceCount && failed == false )
+	{
+		int symbol = decode( lengthCode );
+
+		if ( symbol < 16 )
+		{
+			if ( symbol >= 0 )
+			{
+				l[n++] = (short)symbol;
+			}
+
+			continue;
+		}
+
+		int repeat;
+		short value = 0;
+
+		if ( symbol == 16 )
+		{
+			if ( n == 0 )
+			{
+				failed = true;
+				return;
+			}
+
+			value = l[n-1];
+			repeat = 3 + bits( 2 );
+		}
+		else if ( symbol == 17 )
+		{
+			repeat = 3 + bits( 3 );
+		}
+		else
+		{
+			repeat = 11 + bits( 7 );
+		}
+
+		if ( n + repeat > literalCount + distanceCount )
+		{
+			failed = true;
+			return;
+		}
+
+		while ( repeat-- > 0 )
+		{
+			l[n++] = value;
+		}
+	}
+
+	if ( failed || buildHuffman( lengths, l, literalCount ) == false ||
+		 buildHuffman( distances, l + literalCount, distanceCount ) == false )
+	{
+		failed = true;
+		return;
+	}
+
+	codes( lengths, distances );
+}
+
+/**
+*  Function: inflate()
+*
+*  Purpose: This function inflates the whole stream, block by block, after
+*           its 2-byte zlib header.  The checksum at the end isn't checked.
+*
+*  Returns: True if the stream was inflated.
+*/
+
+bool Inflater::inflate()
+{
+	if ( size < 2 || ( data[0] & 0x0f ) != 8 || ( data[0] << 8 | data[1] ) % 31 != 0 || ( data[1] & 0x20 ) != 0 )
+	{
+		return false;
+	}
+
+	position = 2;
+
+	bool last = false;
+
+	while ( last == false && failed == false )
+	{
+		last = bits( 1 ) == 1;
+
+		int type = bits( 2 );
+
+		if ( type == 0 )
+		{
+			stored();
+		}
+		else if ( type == 1 )
+		{
+			fixed();
+		}
+		else if ( type == 2 )
+		{
+			dynamic();
+		}
+		else
+		{
+			failed = true;
+		}
+	}
+
+	return failed == false;
+}
+
+/**
+*  Function: readBig32(const uint8 * bytes)
+*
+*  Returns: The big-endian 32-bit integer at bytes.
+*/
+
+static uint32 readBig32(const uint8 * bytes)
+{
+	return (uint32)bytes[0] << 24 | (uint32)bytes[1] << 16 | (uint32)bytes[2] << 8 | bytes[3];
+}
+
+/**
+*  Function: paeth(int a, int b, int c)
+*
+*  Returns: Whichever of the left, above and upper left bytes is closest to
+*           left + above - upper left.
+*/
+
+static int paeth(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = p > a ? p - a : a - p;
+	int pb = p > b ? p - b : b - p;
+	int pc = p > c ? p - c : c - p;
+
+	if ( pa <= pb && pa <= pc )
+	{
+		return a;
+	}
+
+	return pb <= pc ? b : c;
+}
+
+/**
+*  Function: decodePng(const uint8 * bytes, size_t size, vector <uint32> & pixels, int & width, int & height)
+*
+*  Purpose: This function decodes a PNG file.
+*
+*  Inputs: bytes, size - The file.
+*          pixels - Set to its pixels, 0xAARRGGBB, top row first.
+*          width, height - Set to its size.
+*
+*  Returns: True if it was decoded.  False if it isn't a PNG, is damaged, or
+*           is a kind this doesn't decode (16 bits per channel, fewer than 8,
+*           or interlaced).
+*/
+
+bool decodePng(const uint8 * bytes, size_t size, vector <uint32> & pixels, int & width, int & height)
+{
+	static const uint8 PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	static const int CHANNELS[7] = { 1, 0, 3, 1, 2, 0, 4 };  // By color type.
+
+	if ( size < 8 || memcmp( bytes, PNG_SIGNATURE, 8 ) != 0 )
+	{
+		return false;
+	}
+
+	vector <uint8> compressed;
+	uint32 palette[256];
+	int colorType = -1;
+
+	for ( int i = 0; i < 256; i++ )
+	{
+		palette[i] = 0xff000000;
+	}
+
+	width = 0;
+	height = 0;
+
+	size_t position = 8;
+
+	while ( position + 12 <= size )
+	{
+		uint32 length = readBig32( bytes + position );
+		const uint8 * type = bytes + position + 4;
+		const uint8 * chunk = bytes + position + 8;
+
+		if ( length > size - position - 12 )
+		{
+			return false;
+		}
+
+		if ( memcmp( type, "IHDR", 4 ) == 0 && length >= 13 )
+		{
+			width = (int)readBig32( chunk );
+			height = (int)readBig32( chunk + 4 );
+			colorType = chunk[9];
+
+			if ( chunk[8] != 8 || colorType > 6 || CHANNELS[colorType] == 0 || chunk[12] != 0 ||
+				 width <= 0 || height <= 0 || width > 16384 || height > 16384 )
+			{
+				return false;
+			}
+		}
+		else if ( memcmp( type, "PLTE", 4 ) == 0 )
+		{
+			for ( uint32 i = 0; i < length/3 && i < 256; i++ )
+			{
+				palette[i] = 0xff000000 | (uint32)chunk[i*3] << 16 | (uint32)chunk[i*3 + 1] << 8 | chunk[i*3 + 2];
+			}
+		}
+		else if ( memcmp( type, "tRNS", 4 ) == 0 && colorType == 3 )
+		{
+			for ( uint32 i = 0; i < length && i < 256; i++ )
+			{
+				palette[i] = ( palette[i] & 0x00ffffff ) | (uint32)chunk[i] << 24;
+			}
+		}
+		else if ( memcmp( type, "IDAT", 4 ) == 0 )
+		{
+			compressed.insert( compressed.end(), chunk, chunk + length );
+		}
+		else if ( memcmp( type, "IEND", 4 ) == 0 )
+		{
+			break;
+		}
+
+		position += length + 12;
+	}
+
+	if ( colorType < 0 || compressed.empty() )
+	{
+		return false;
+	}
+
+	int channels = CHANNELS[colorType];
+	size_t stride = (size_t)width * channels;
+	vector <uint8> raw;
+
+	raw.reserve( ( stride + 1 ) * height );
+
+	Inflater inflater( & compressed[0], compressed.size(), raw );
+
+	if ( inflater.inflate() == false || raw.size() < ( stride + 1 ) * height )
+	{
+		return false;
+	}
+
+	// Undo each row's filter, in place.  Each byte is filtered against the one
+	// a pixel to the left and the one in the row above.
+	for ( int y = 0; y < height; y++ )
+	{
+		uint8 * row = & raw[y * ( stride + 1 )];
+		uint8 filter = row[0];
+		uint8 * current = row + 1;
+		const uint8 * above = y > 0 ? current - ( stride + 1 ) : NULL;
+
+		for ( size_t x = 0; x < stride; x++ )
+		{
+			int a = x >= (size_t)channels ? current[x - channels] : 0;
+			int b = above != NULL ? above[x] : 0;
+			int c = above != NULL && x >= (size_t)channels ? above[x - channels] : 0;
+
+			switch ( filter )
+			{
+			case 0:
+				break;
+			case 1:
+				current[x] = (uint8)( current[x] + a );
+				break;
+			case 2:
+				current[x] = (uint8)( current[x] + b );
+				break;
+			case 3:
+				current[x] = (uint8)( current[x] + ( a + b ) / 2 );
+				break;
+			case 4:
+				current[x] = (uint8)( current[x] + paeth( a, b, c ) );
+				break;
+			default:
+				return false;
+			}
+		}
+	}
+
+	pixels.resize( (size_t)width * height );
+
+	for ( int y = 0; y < height; y++ )
+	{
+		const uint8 * p = & raw[y * ( stride + 1 ) + 1];
+		uint32 * out = & pixels[(size_t)y * width];
+
+		for ( int x = 0; x < width; x++, p += channels )
+		{
+			switch ( colorType )
+			{
+			case 0:
+				out[x] = 0xff000000 | (uint32)p[0] << 16 | (uint32)p[0] << 8 | p[0];
+				break;
+			case 2:
+				out[x] = 0xff000000 | (uint32)p[0] << 16 | (uint32)p[1] << 8 | p[2];
+				break;
+			case 3:
+				out[x] = palette[p[0]];
+				break;
+			case 4:
+				out[x] = (uint32)p[1] << 24 | (uint32)p[0] << 16 | (uint32)p[0] << 8 | p[0];
+				break;
+			default:
+				out[x] = (uint32)p[3] << 24 | (uint32)p[0] << 16 | (uint32)p[1] << 8 | p[2];
+				break;
+			}
+		}
+	}
+
+	return true;
+}
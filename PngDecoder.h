@@ -0,0 +1,27 @@
+/**
+*  File:  PngDecoder.h
+*
+*  Description:  This header file contains decodePng(), which decodes a PNG
+*                file into 32-bit pixels without DarkGDK, for the software
+*                renderer (SoftwareRenderer.h).  It handles what the game's
+*                images use: 8 bits per channel, gray, RGB or palette colors,
+*                with or without alpha, and no interlacing.  The compressed
+*                data is inflated here too, so nothing outside the repository
+*                is needed.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PNG_DECODER_H_
+#define PNG_DECODER_H_
+
+#include "Portable.h"
+#include <vector>
+
+using namespace std;
+
+bool decodePng(const uint8 * bytes, size_t size, vector <uint32> & pixels, int & width, int & height);
+
+#endif
@@ -0,0 +1,362 @@
+/**
+*  File:  Portable.cpp
+*
+*  Description:  This file contains the operating system specific implementations
+*                of the functions declared in Portable.h.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Portable.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <malloc.h>  // For _aligned_malloc() and _aligned_free().
+#else
+#include <stdlib.h>  // For posix_memalign() and free().
+#include <time.h>    // For clock_gettime() and nanosleep().
+#include <fcntl.h>   // For open().
+#include <unistd.h>  // For close().
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string.h>  // For strlen().
+#endif
+
+#ifndef _WIN32
+
+/**
+*  Function: nativePath(const char * fileName, char * path, size_t size)
+*
+*  Purpose: This function turns the backslashes of a Windows path, such as the
+*           ones in MediaFilePaths.h, into forward slashes.
+*
+*  Inputs: fileName - The path.
+*          path - Where to write the converted path.
+*          size - The size of path, in chars.
+*
+*  Returns: path, or fileName itself if it is too long to convert.
+*/
+
+static const char * nativePath(const char * fileName, char * path, size_t size)
+{
+	size_t length = strlen( fileName );
+
+	if ( length >= size )
+	{
+		return fileName;
+	}
+
+	for ( size_t i = 0; i <= length; i++ )
+	{
+		path[i] = fileName[i] == '\\' ? '/' : fileName[i];
+	}
+
+	return path;
+}
+
+#endif
+
+/**
+*  Function: getSeconds()
+*
+*  Purpose: This function reads the high resolution timer.  The value has no
+*           fixed starting point, so it is only useful for measuring the time
+*           between two calls.  dbTimer() only has millisecond resolution,
+*           which is too coarse for timing individual frames.
+*
+*  Returns: The current time in seconds.
+*/
+
+double getSeconds()
+{
+#ifdef _WIN32
+	static double secondsPerCount = 0.0;
+
+	if ( secondsPerCount == 0.0 )
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency( & frequency );
+		secondsPerCount = 1.0 / (double)frequency.QuadPart;
+	}
+
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter( & counter );
+
+	return (double)counter.QuadPart * secondsPerCount;
+#else
+	timespec now;
+	clock_gettime( CLOCK_MONOTONIC, & now );
+
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+*  Function: sleepSeconds(double seconds)
+*
+*  Purpose: This function gives up the processor for a while.  The operating
+*           system may wake the thread late: on Windows, Sleep() only counts
+*           whole milliseconds, and rounds up to the timer's tick unless the
+*           program has asked for a finer one with timeBeginPeriod().
+*
+*  Inputs: seconds - How long to sleep.  0 or less only gives up the rest of
+*                    the thread's time slice.
+*/
+
+void sleepSeconds(double seconds)
+{
+#ifdef _WIN32
+	Sleep( seconds > 0.0 ? (DWORD)( seconds * 1000.0 ) : 0 );
+#else
+	timespec duration;
+	duration.tv_sec = 0;
+	duration.tv_nsec = 0;
+
+	if ( seconds > 0.0 )
+	{
+		duration.tv_sec = (time_t)seconds;
+		duration.tv_nsec = (long)( ( seconds - (double)duration.tv_sec ) * 1e9 );
+	}
+
+	nanosleep( & duration, NULL );
+#endif
+}
+
+/**
+*  Function: alignedAlloc(size_t size, size_t alignment)
+*
+*  Purpose: This function allocates a block of memory whose address is a
+*           multiple of alignment.  Memory from alignedAlloc() must be
+*           released with alignedFree().
+*
+*  Inputs: size - The number of bytes to allocate.
+*          alignment - The required alignment in bytes (a power of two).
+*
+*  Returns: A pointer to the memory, or NULL if it could not be allocated.
+*/
+
+void * alignedAlloc(size_t size, size_t alignment)
+{
+	if ( alignment < SIMD_ALIGNMENT )
+	{
+		alignment = SIMD_ALIGNMENT;
+	}
+
+#ifdef _WIN32
+	return _aligned_malloc( size, alignment );
+#else
+	void * p = NULL;
+
+	if ( posix_memalign( & p, alignment, size ) != 0 )
+	{
+		return NULL;
+	}
+
+	return p;
+#endif
+}
+
+/**
+*  Function: alignedFree(void * p)
+*
+*  Purpose: This function releases memory that was allocated with alignedAlloc().
+*
+*  Inputs: p - The pointer returned by alignedAlloc().  NULL is ignored.
+*/
+
+void alignedFree(void * p)
+{
+#ifdef _WIN32
+	_aligned_free( p );
+#else
+	free( p );
+#endif
+}
+
+/**
+*  Function: fileExists(const char * fileName)
+*
+*  Purpose: This function is the portable version of dbFileExist().
+*
+*  Inputs: fileName - The file, with either kind of slash.
+*
+*  Returns: True if the file exists, and isn't a directory.
+*/
+
+bool fileExists(const char * fileName)
+{
+#ifdef _WIN32
+	DWORD attributes = GetFileAttributesA( fileName );
+
+	return attributes != INVALID_FILE_ATTRIBUTES && ( attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0;
+#else
+	char path[1024];
+	struct stat status;
+
+	return stat( nativePath( fileName, path, sizeof( path ) ), & status ) == 0 && S_ISDIR( status.st_mode ) == 0;
+#endif
+}
+
+/**
+*  Function: MappedFile()
+*
+*  Purpose: This is the constructor for the MappedFile class.  No file is
+*           mapped until open() is called.
+*/
+
+MappedFile::MappedFile()
+{
+	data = NULL;
+	size = 0;
+}
+
+/**
+*  Function: ~MappedFile()
+*
+*  Purpose: This is the destructor for the MappedFile class.  It unmaps the file.
+*/
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+/**
+*  Function: open(const char * fileName)
+*
+*  Purpose: This function maps a file, after unmapping the one mapped before.
+*           The file itself is closed again straight away; the mapping keeps
+*           its contents available until close().
+*
+*  Inputs: fileName - The file to map.
+*
+*  Returns: True if the file was mapped.  An empty file is mapped with a size
+*           of 0 and no data.
+*/
+
+bool MappedFile::open(const char * fileName)
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA( fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+
+	if ( file == INVALID_HANDLE_VALUE )
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if ( GetFileSizeEx( file, & fileSize ) == FALSE || (uint64)fileSize.QuadPart > (uint64)(size_t)-1 )
+	{
+		CloseHandle( file );
+		return false;
+	}
+
+	if ( fileSize.QuadPart == 0 )
+	{
+		CloseHandle( file );
+		return true;
+	}
+
+	HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+	void * view = mapping != NULL ? MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+
+	if ( mapping != NULL )
+	{
+		CloseHandle( mapping );
+	}
+
+	CloseHandle( file );
+
+	if ( view == NULL )
+	{
+		return false;
+	}
+
+	data = (const uint8 *)view;
+	size = (size_t)fileSize.QuadPart;
+#else
+	char path[1024];
+	int file = ::open( nativePath( fileName, path, sizeof( path ) ), O_RDONLY );
+
+	if ( file < 0 )
+	{
+		return false;
+	}
+
+	struct stat status;
+
+	if ( fstat( file, & status ) != 0 )
+	{
+		::close( file );
+		return false;
+	}
+
+	if ( status.st_size == 0 )
+	{
+		::close( file );
+		return true;
+	}
+
+	void * view = mmap( NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+	::close( file );
+
+	if ( view == MAP_FAILED )
+	{
+		return false;
+	}
+
+	data = (const uint8 *)view;
+	size = (size_t)status.st_size;
+#endif
+
+	return true;
+}
+
+/**
+*  Function: close()
+*
+*  Purpose: This function unmaps the file, if one is mapped.
+*/
+
+void MappedFile::close()
+{
+	if ( data != NULL )
+	{
+#ifdef _WIN32
+		UnmapViewOfFile( data );
+#else
+		munmap( (void *)data, size );
+#endif
+	}
+
+	data = NULL;
+	size = 0;
+}
+
+/**
+*  Function: getData()
+*
+*  Returns: The file's contents, or NULL if no file (or an empty one) is mapped.
+*/
+
+const uint8 * MappedFile::getData() const
+{
+	return data;
+}
+
+/**
+*  Function: getSize()
+*
+*  Returns: The size of the mapped file in bytes.
+*/
+
+size_t MappedFile::getSize() const
+{
+	return size;
+}
@@ -0,0 +1,86 @@
+/**
+*  File:  Portable.h
+*
+*  Description:  This header file holds the small number of things that differ
+*                between compilers and operating systems: fixed-size integer
+*                types, a high resolution timer, sleeping, aligned memory
+*                allocation, finding files and memory-mapped files.
+*                Visual C++ 2008 has no <stdint.h>, so the integer types are
+*                declared here instead.
+*
+*                It does not depend on DarkGDK, so it can be used both by the
+*                game and by the headless PrismsTools console project.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PORTABLE_H_
+#define PORTABLE_H_
+
+#include <stddef.h>  // For size_t.
+
+#ifdef _MSC_VER
+typedef signed __int8 int8;
+typedef unsigned __int8 uint8;
+typedef signed __int16 int16;
+typedef unsigned __int16 uint16;
+typedef signed __int32 int32;
+typedef unsigned __int32 uint32;
+typedef signed __int64 int64;
+typedef unsigned __int64 uint64;
+#else
+#include <stdint.h>
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+typedef int64_t int64;
+typedef uint64_t uint64;
+#endif
+
+/**
+*  SIMD_ALIGNMENT is the alignment (in bytes) of memory handed out by
+*  alignedAlloc() unless a larger value is asked for.  It is enough for
+*  SSE loads and stores.
+*/
+
+const size_t SIMD_ALIGNMENT = 16;
+
+double getSeconds();
+void sleepSeconds(double seconds);
+void * alignedAlloc(size_t size, size_t alignment);
+void alignedFree(void * p);
+bool fileExists(const char * fileName);
+
+/**
+*  MappedFile maps a whole file into memory, read-only, so it can be read
+*  in place without copying it into a buffer first.  The operating system
+*  only reads the pages that are touched.
+*
+*  Like fileExists(), it takes the game's paths as they are written in
+*  MediaFilePaths.h, with backslashes, on any operating system.
+*/
+
+class MappedFile
+{
+private:
+	const uint8 * data;
+	size_t size;
+
+	MappedFile(const MappedFile &);
+	MappedFile & operator=(const MappedFile &);
+
+public:
+	MappedFile();
+	~MappedFile();
+	bool open(const char * fileName);
+	void close();
+	const uint8 * getData() const;
+	size_t getSize() const;
+};
+
+#endif
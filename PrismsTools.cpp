@@ -0,0 +1,102 @@
+/**
+*  File:  PrismsTools.cpp
+*
+*  Description:  This is the main file of PrismsTools, a console program that runs
+*                the headless level simulation without DarkGDK.  It looks up the
+*                command named by the first argument and runs it.
+*
+*                Usage:  PrismsTools <command> [arguments]
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "Profiler.h"
+#include <stdio.h>
+#include <stdlib.h>  // For atoi().
+#include <string.h>  // For strcmp().
+
+struct ToolCommand
+{
+	const char * name;
+	int (*run)(int argc, char * argv[]);
+	const char * usage;
+};
+
+ToolCommand commands[] =
+{
+	{ "calibrate", calibrateCommand, "calibrate [instances] [level]   Play out random levels with the scalar and SIMD engines." },
+	{ "threads", threadsCommand, "threads [bubbles] [ticks] [threads]  Check that a big level plays the same on any number of threads." },
+	{ "stress", stressCommand, "stress [bubbles] [arena] [ticks] [threads] [radius] [expansion]  Time each step of levels with up to a million bubbles." },
+	{ "bench", benchCommand, "bench [bubbles] [ms] [threads] [json]  Time each simulation kernel on sparse, dense and overlapping layouts." },
+	{ "replay", replayCommand, "replay <file> [level] [tick] | replay make <file> [seed]  Play back a recorded replay, or record a random one." },
+	{ "checksum", checksumCommand, "checksum compare|record|diff ...  Find the first frame where two runs of a game differ." },
+	{ "snapshot", snapshotCommand, "snapshot [level] [games]  Measure snapshot deltas and restore time, and check rewinding a replay." },
+	{ "host", hostCommand, "host [sessions] [seconds] [threads]  Play thousands of games at 60 Hz on one host and report tick lateness." },
+	{ "validate", validateCommand, "validate <list> [verdicts] [threads] | validate make <list> [count] [seed]  Validate submitted replays in parallel." },
+	{ "levels", levelsCommand, "levels make <file> [campaigns] [seed] | levels check <file>  Write or check a pack of laid out levels." },
+	{ "loop", loopCommand, "loop [frames] [seed] [software|circles|tinted|pipelined]  Run the game's front end on the null or software backend with scripted clicks." },
+};
+
+const int COMMAND_COUNT = sizeof(commands) / sizeof(commands[0]);
+
+/**
+*  Function: intArgument(int argc, char * argv[], int index, int defaultValue)
+*
+*  Purpose: This function reads an optional whole-number argument.  It is used
+*           by the commands to read their arguments.
+*
+*  Inputs: argc, argv - The command's arguments.
+*          index - The position of the argument.
+*          defaultValue - The value to use if the argument is missing.
+*
+*  Returns: The argument's value, or defaultValue.
+*/
+
+int intArgument(int argc, char * argv[], int index, int defaultValue)
+{
+	if ( index < argc )
+	{
+		return atoi( argv[index] );
+	}
+
+	return defaultValue;
+}
+
+/**
+*  Function: main(int argc, char * argv[])
+*
+*  Purpose: This is the entry point of PrismsTools.  It prints the list of
+*           commands if the command is missing or unknown.
+*/
+
+int main(int argc, char * argv[])
+{
+	if ( argc >= 2 )
+	{
+		for ( int i = 0; i < COMMAND_COUNT; i++ )
+		{
+			if ( strcmp( argv[1], commands[i].name ) == 0 )
+			{
+				int result = commands[i].run( argc-2, argv+2 );
+
+				PROFILE_WRITE_TRACE( "PrismsTools.trace.json" );  // Only when built with PRISMS_PROFILER.
+
+				return result;
+			}
+		}
+
+		printf( "Unknown command: %s\n\n", argv[1] );
+	}
+
+	printf( "Usage: PrismsTools <command> [arguments]\n\n" );
+
+	for ( int i = 0; i < COMMAND_COUNT; i++ )
+	{
+		printf( "  %s\n", commands[i].usage );
+	}
+
+	return 1;
+}
@@ -0,0 +1,34 @@
+/**
+*  File:  PrismsTools.h
+*
+*  Description:  This header file declares the commands of PrismsTools, the console
+*                program that runs the headless simulation outside of the game.
+*                Each command lives in its own Tool*.cpp file and is listed in the
+*                command table in PrismsTools.cpp.
+*
+*                A command receives the arguments that follow its name on the
+*                command line, and returns the program's exit code.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PRISMS_TOOLS_H_
+#define PRISMS_TOOLS_H_
+
+int calibrateCommand(int argc, char * argv[]);
+int threadsCommand(int argc, char * argv[]);
+int stressCommand(int argc, char * argv[]);
+int benchCommand(int argc, char * argv[]);
+int replayCommand(int argc, char * argv[]);
+int checksumCommand(int argc, char * argv[]);
+int snapshotCommand(int argc, char * argv[]);
+int hostCommand(int argc, char * argv[]);
+int validateCommand(int argc, char * argv[]);
+int levelsCommand(int argc, char * argv[]);
+int loopCommand(int argc, char * argv[]);
+
+int intArgument(int argc, char * argv[], int index, int defaultValue);
+
+#endif
@@ -0,0 +1,163 @@
+/**
+*  File:  Profiler.cpp
+*
+*  Description:  This file contains the ring buffer behind PROFILE_SCOPE() and the
+*                Chrome trace writer.  Everything in it is left out unless
+*                PRISMS_PROFILER is defined.
+*
+*                A thread claims the next slot of the ring buffer with atomicAdd(),
+*                fills it in, and then stores the slot's sequence number last.  The
+*                trace writer skips any slot whose sequence number doesn't match,
+*                so an event that was being written (or overwritten) at that moment
+*                is left out instead of coming out half finished.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Profiler.h"
+
+#ifdef PRISMS_PROFILER
+
+#include "Threading.h"
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+struct ProfileEvent
+{
+	const char * name;
+	uint64 start;
+	uint64 end;
+	uint32 thread;
+	volatile int32 sequence;  // The event's number plus one, written after the rest.
+};
+
+static ProfileEvent events[PROFILER_CAPACITY];
+static volatile int32 eventCount = 0;
+
+/**
+*  ProfileClock remembers when the program started, in both time stamp counter
+*  ticks and seconds.  Comparing that with the same two readings when the trace
+*  is written gives the number of ticks per second.
+*/
+
+struct ProfileClock
+{
+	uint64 startTicks;
+	double startSeconds;
+
+	ProfileClock()
+	{
+		startTicks = profilerTicks();
+		startSeconds = getSeconds();
+	}
+};
+
+static ProfileClock profileClock;
+
+/**
+*  Function: profilerThreadID()
+*
+*  Returns: A number that identifies the calling thread.
+*/
+
+static uint32 profilerThreadID()
+{
+#ifdef _WIN32
+	return (uint32)GetCurrentThreadId();
+#else
+	return (uint32)(size_t)pthread_self();
+#endif
+}
+
+/**
+*  Function: profilerRecord(const char * name, uint64 start, uint64 end)
+*
+*  Purpose: This function adds an event to the ring buffer.  It is called by
+*           ProfileScope's destructor, and may be called from any thread.
+*
+*  Inputs: name - The event's name (a string literal).
+*          start, end - When the event started and ended, from profilerTicks().
+*/
+
+void profilerRecord(const char * name, uint64 start, uint64 end)
+{
+	int32 number = atomicAdd( & eventCount, 1 ) - 1;
+
+	ProfileEvent & event = events[number & ( PROFILER_CAPACITY-1 )];
+
+	event.sequence = 0;
+	event.name = name;
+	event.start = start;
+	event.end = end;
+	event.thread = profilerThreadID();
+
+	atomicCompareExchange( & event.sequence, number + 1, 0 );  // Publish it last.
+}
+
+/**
+*  Function: profilerWriteTrace(const char * fileName)
+*
+*  Purpose: This function writes the events in the ring buffer to a file in the
+*           Chrome trace_event format, as complete ("X") events with times in
+*           microseconds from the start of the program.
+*
+*  Inputs: fileName - The file to write.
+*
+*  Returns: True if the file was written.
+*/
+
+bool profilerWriteTrace(const char * fileName)
+{
+	FILE * file = fopen( fileName, "w" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	double seconds = getSeconds() - profileClock.startSeconds;
+	double ticksPerMicrosecond = 1.0;
+
+	if ( seconds > 0.0 )
+	{
+		ticksPerMicrosecond = (double)( profilerTicks() - profileClock.startTicks ) / ( seconds * 1e6 );
+	}
+
+	int32 count = eventCount;
+	int32 first = count > PROFILER_CAPACITY ? count - PROFILER_CAPACITY : 0;
+	bool comma = false;
+
+	fprintf( file, "{\"traceEvents\":[\n" );
+
+	for ( int32 number = first; number < count; number++ )
+	{
+		const ProfileEvent & event = events[number & ( PROFILER_CAPACITY-1 )];
+
+		if ( event.sequence != number + 1 )  // Still being written, or already overwritten.
+		{
+			continue;
+		}
+
+		double start = (double)(int64)( event.start - profileClock.startTicks ) / ticksPerMicrosecond;
+		double duration = (double)(int64)( event.end - event.start ) / ticksPerMicrosecond;
+
+		fprintf( file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+			     comma ? ",\n" : "", event.name, start, duration, event.thread );
+
+		comma = true;
+	}
+
+	fprintf( file, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+	fclose( file );
+
+	return true;
+}
+
+#endif
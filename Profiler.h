@@ -0,0 +1,99 @@
+/**
+*  File:  Profiler.h
+*
+*  Description:  This header file contains a small frame profiler.  PROFILE_SCOPE( name )
+*                times the rest of the block it is in and records it as one event,
+*                and PROFILE_WRITE_TRACE( fileName ) saves the recorded events as a
+*                Chrome trace (load it at chrome://tracing to see each frame laid
+*                out phase by phase, one row per thread).  Only the pointer to the
+*                name is stored, so it should be a string literal.
+*
+*                The profiler is only built when PRISMS_PROFILER is defined (add it
+*                to the project's Preprocessor Definitions).  Otherwise both macros
+*                expand to nothing and Profiler.cpp is empty, so normal builds pay
+*                nothing for it.
+*
+*                Times are read with the processor's time stamp counter (rdtsc), so
+*                starting and stopping a scope costs a few nanoseconds.  Events go
+*                into a fixed-size ring buffer that any thread can write to without
+*                locking.  When it is full the oldest events are overwritten, so the
+*                trace always holds the most recent PROFILER_CAPACITY events.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#ifdef PRISMS_PROFILER
+
+#include "Portable.h"
+
+#if defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) )
+#include <intrin.h>     // For __rdtsc().
+#define PROFILER_RDTSC
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>  // For __rdtsc().
+#define PROFILER_RDTSC
+#endif
+
+const int PROFILER_CAPACITY = 1 << 16;  // Events kept in the ring buffer.  Must be a power of two.
+
+/**
+*  Function: profilerTicks()
+*
+*  Returns: The time stamp counter, or on processors without one, nanoseconds
+*           from getSeconds().
+*/
+
+inline uint64 profilerTicks()
+{
+#ifdef PROFILER_RDTSC
+	return __rdtsc();
+#else
+	return (uint64)( getSeconds() * 1e9 );
+#endif
+}
+
+void profilerRecord(const char * name, uint64 start, uint64 end);
+bool profilerWriteTrace(const char * fileName);
+
+/**
+*  ProfileScope records one event from when it is created until it goes out
+*  of scope.  Use it through PROFILE_SCOPE().
+*/
+
+class ProfileScope
+{
+private:
+	const char * name;
+	uint64 start;
+
+public:
+	ProfileScope(const char * eventName)
+	{
+		name = eventName;
+		start = profilerTicks();
+	}
+
+	~ProfileScope()
+	{
+		profilerRecord( name, start, profilerTicks() );
+	}
+};
+
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_JOIN(profileScope, __LINE__)( name )
+#define PROFILE_WRITE_TRACE(fileName) profilerWriteTrace( fileName )
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_WRITE_TRACE(fileName)
+
+#endif
+
+#endif
@@ -0,0 +1,576 @@
+/**
+*  File:  RenderPipeline.cpp
+*
+*  Description:  This file contains the method implementations for the
+*                RenderPipeline class and the game's side of it:
+*                PipelineRenderer, PipelineAudio and PipelineInput.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "RenderPipeline.h"
+#include <string.h>  // For strlen().
+
+/**
+*  A thread waiting for the other one gives up its time slice this many times
+*  before it starts sleeping a millisecond at a time, so a short wait stays
+*  short and a long one doesn't keep a processor busy.
+*/
+
+const int PIPELINE_YIELDS = 50;
+
+/**
+*  Function: waitBriefly(int & tries)
+*
+*  Purpose: This function lets the other thread run for a while, before a
+*           waiting thread looks again.
+*
+*  Inputs: tries - How many times this wait has already waited.
+*/
+
+static void waitBriefly(int & tries)
+{
+	sleepSeconds( tries < PIPELINE_YIELDS ? 0.0 : 0.001 );
+	tries++;
+}
+
+/**
+*  Function: clearBatch(FrameBatch & batch)
+*
+*  Purpose: This function empties a batch to be written again, keeping the
+*           memory its vectors have.
+*/
+
+static void clearBatch(FrameBatch & batch)
+{
+	batch.commands.clear();
+	batch.text.clear();
+	batch.pixels.clear();
+	batch.styles.clear();
+	batch.imageRead = NULL;
+	batch.presents = false;
+	batch.handedOver = 0.0;
+}
+
+/**
+*  Function: RenderPipeline()
+*
+*  Purpose: This is the constructor for the RenderPipeline class.  Nothing
+*           can be drawn until start() is called.
+*/
+
+RenderPipeline::RenderPipeline()
+{
+	InputState closed = { false, 0, 0, 0, 0, 0 };
+	RenderPipelineStats none = { 0, 0.0, 0.0, 0.0, 0.0 };
+
+	for ( int i = 0; i < PIPELINE_BATCHES; i++ )
+	{
+		clearBatch( batches[i] );
+		batches[i].input = closed;
+	}
+
+	written = 0;
+	drawn = 0;
+	finished = 0;
+	input = closed;
+	stats = none;
+}
+
+/**
+*  Function: start(const InputState & first)
+*
+*  Purpose: This function gets the pipeline ready for a game, before either
+*           thread uses it.
+*
+*  Inputs: first - The input the game starts with, until the first batches
+*                  have been drawn.
+*/
+
+void RenderPipeline::start(const InputState & first)
+{
+	RenderPipelineStats none = { 0, 0.0, 0.0, 0.0, 0.0 };
+
+	for ( int i = 0; i < PIPELINE_BATCHES; i++ )
+	{
+		clearBatch( batches[i] );
+		batches[i].input = first;
+	}
+
+	written = 0;
+	drawn = 0;
+	finished = 0;
+	input = first;
+	stats = none;
+}
+
+/**
+*  Function: handOver(bool presents)
+*
+*  Purpose: This function, on the game's thread, hands the batch being written
+*           over to be drawn, and starts on the next one.  That batch is free
+*           once the batch before it in the same place has been drawn, so if
+*           the drawing thread is two batches behind, this waits.  The input
+*           read after that batch was drawn becomes the game's.
+*
+*  Inputs: presents - Whether the batch ends with a sync(), so its frame is
+*                     presented once it is drawn.
+*/
+
+void RenderPipeline::handOver(bool presents)
+{
+	FrameBatch & batch = getBatch();
+	batch.presents = presents;
+	batch.handedOver = getSeconds();
+
+	int32 next = atomicAdd( & written, 1 );
+
+	if ( next >= PIPELINE_BATCHES )
+	{
+		int32 needed = next - PIPELINE_BATCHES + 1;  // The batch before it, drawn.
+
+		if ( atomicAdd( & drawn, 0 ) < needed )
+		{
+			double start = getSeconds();
+			int tries = 0;
+
+			while ( atomicAdd( & drawn, 0 ) < needed )
+			{
+				waitBriefly( tries );
+			}
+
+			stats.gameWaiting += getSeconds() - start;
+		}
+	}
+
+	FrameBatch & reused = getBatch();
+
+	if ( next >= PIPELINE_BATCHES )
+	{
+		input = reused.input;
+	}
+
+	clearBatch( reused );
+}
+
+/**
+*  Function: flush()
+*
+*  Purpose: This function, on the game's thread, hands the batch being written
+*           over, and waits until every batch has been drawn.
+*/
+
+void RenderPipeline::flush()
+{
+	handOver( false );
+
+	int tries = 0;
+
+	while ( atomicAdd( & drawn, 0 ) < written )
+	{
+		waitBriefly( tries );
+	}
+}
+
+/**
+*  Function: finish()
+*
+*  Purpose: This function, on the game's thread, hands over whatever is left
+*           and tells the drawing thread there will be no more batches.
+*/
+
+void RenderPipeline::finish()
+{
+	if ( getBatch().commands.empty() == false )
+	{
+		handOver( false );
+	}
+
+	atomicAdd( & finished, 1 );
+}
+
+/**
+*  Function: waitForBatch()
+*
+*  Purpose: This function, on the drawing thread, waits for the next batch to
+*           be handed over.
+*
+*  Returns: The batch, or NULL once the game has finished and every batch has
+*           been drawn.
+*/
+
+FrameBatch * RenderPipeline::waitForBatch()
+{
+	double start = getSeconds();
+	int tries = 0;
+
+	for ( ;; )
+	{
+		if ( drawn < atomicAdd( & written, 0 ) )
+		{
+			break;
+		}
+
+		// written is read again after finished, since the last batch is handed
+		// over before finished is set.
+		if ( atomicAdd( & finished, 0 ) != 0 && drawn == atomicAdd( & written, 0 ) )
+		{
+			return NULL;
+		}
+
+		waitBriefly( tries );
+	}
+
+	stats.renderWaiting += getSeconds() - start;
+
+	return & batches[drawn % PIPELINE_BATCHES];
+}
+
+/**
+*  Function: doneBatch(const InputState & drawnInput)
+*
+*  Purpose: This function, on the drawing thread, gives the batch from
+*           waitForBatch() back to the game once it has been drawn (and
+*           presented, if it presents).
+*
+*  Inputs: drawnInput - The input read after it was drawn.
+*/
+
+void RenderPipeline::doneBatch(const InputState & drawnInput)
+{
+	FrameBatch & batch = batches[drawn % PIPELINE_BATCHES];
+	batch.input = drawnInput;
+
+	if ( batch.presents )
+	{
+		double latency = getSeconds() - batch.handedOver;
+
+		stats.frames++;
+		stats.totalLatency += latency;
+
+		if ( latency > stats.maxLatency )
+		{
+			stats.maxLatency = latency;
+		}
+	}
+
+	atomicAdd( & drawn, 1 );  // The game can reuse the batch from here on.
+}
+
+/**
+*  Function: PipelineRenderer()
+*
+*  Purpose: This is the constructor for the PipelineRenderer class.  It must
+*           be connected to a pipeline before it is used.
+*/
+
+PipelineRenderer::PipelineRenderer()
+{
+	pipeline = NULL;
+	calls = 0;
+}
+
+/**
+*  Function: loadImage(MediaAsset asset, int imageID)
+*
+*  Purpose: This function loads an image, if the asset is an image that exists,
+*           which is when the real backend will load it.
+*
+*  Returns: True if it will be loaded.
+*/
+
+bool PipelineRenderer::loadImage(MediaAsset asset, int imageID)
+{
+	if ( imageID < 0 || mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_IMAGE )
+	{
+		calls++;
+		return false;
+	}
+
+	add( COMMAND_LOAD_IMAGE, imageID, (int)asset, 0, 0 );
+
+	return true;
+}
+
+/**
+*  Function: deleteImage(int imageID)
+*
+*  Purpose: This function deletes an image.
+*/
+
+void PipelineRenderer::deleteImage(int imageID)
+{
+	add( COMMAND_DELETE_IMAGE, imageID, 0, 0, 0 );
+}
+
+/**
+*  Function: readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+*
+*  Purpose: This function reads an image's pixels from the real backend.  It
+*           waits for everything before it to be drawn.
+*
+*  Returns: True if the image was read.
+*/
+
+bool PipelineRenderer::readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+{
+	ImageRead request = { imageID, & pixels, & width, & height, false };
+
+	pipeline->getBatch().imageRead = & request;
+	add( COMMAND_READ_IMAGE, imageID, 0, 0, 0 );
+	pipeline->flush();
+
+	return request.read;
+}
+
+/**
+*  Function: makeImage(int imageID, const uint32 * pixels, int width, int height)
+*
+*  Purpose: This function makes an image from a copy of pixels.
+*
+*  Returns: True if it will be made.
+*/
+
+bool PipelineRenderer::makeImage(int imageID, const uint32 * pixels, int width, int height)
+{
+	if ( imageID < 0 || width <= 0 || height <= 0 )
+	{
+		calls++;
+		return false;
+	}
+
+	int start = -1;
+
+	if ( pixels != NULL )
+	{
+		vector <uint32> & batchPixels = pipeline->getBatch().pixels;
+
+		start = (int)batchPixels.size();
+		batchPixels.insert( batchPixels.end(), pixels, pixels + width * height );
+	}
+
+	add( COMMAND_MAKE_IMAGE, imageID, width, height, start );
+
+	return true;
+}
+
+/**
+*  Function: makeCircleImage(int imageID, const CircleStyle & style, int size)
+*
+*  Purpose: This function makes a circle image (see BubbleCircles.h).
+*
+*  Returns: True if it will be made.
+*/
+
+bool PipelineRenderer::makeCircleImage(int imageID, const CircleStyle & style, int size)
+{
+	if ( imageID < 0 || size <= 0 )
+	{
+		calls++;
+		return false;
+	}
+
+	vector <CircleStyle> & styles = pipeline->getBatch().styles;
+
+	styles.push_back( style );
+	add( COMMAND_MAKE_CIRCLE_IMAGE, imageID, (int)styles.size() - 1, size, 0 );
+
+	return true;
+}
+
+/**
+*  Function: text(int x, int y, const char * text)
+*
+*  Purpose: This function writes text, keeping a copy of the string.
+*/
+
+void PipelineRenderer::text(int x, int y, const char * text)
+{
+	vector <char> & batchText = pipeline->getBatch().text;
+	int start = (int)batchText.size();
+
+	batchText.insert( batchText.end(), text, text + strlen( text ) + 1 );
+	add( COMMAND_TEXT, 0, x, y, start );
+}
+
+/**
+*  Function: centerText(int x, int y, const char * text)
+*
+*  Purpose: This function writes text centered on x, keeping a copy of the
+*           string.
+*/
+
+void PipelineRenderer::centerText(int x, int y, const char * text)
+{
+	vector <char> & batchText = pipeline->getBatch().text;
+	int start = (int)batchText.size();
+
+	batchText.insert( batchText.end(), text, text + strlen( text ) + 1 );
+	add( COMMAND_CENTER_TEXT, 0, x, y, start );
+}
+
+/**
+*  Function: sync()
+*
+*  Purpose: This function hands the frame over to be drawn and presented.
+*/
+
+void PipelineRenderer::sync()
+{
+	calls++;
+	pipeline->handOver( true );
+}
+
+/**
+*  Function: PipelineAudio()
+*
+*  Purpose: This is the constructor for the PipelineAudio class.  It must be
+*           connected to a pipeline before it is used.
+*/
+
+PipelineAudio::PipelineAudio()
+{
+	pipeline = NULL;
+	played = 0;
+}
+
+/**
+*  Function: loadSound(MediaAsset asset, int soundID)
+*
+*  Purpose: This function loads a sound, if the asset is a sound that exists,
+*           which is when the real backend will load it.
+*
+*  Returns: True if it will be loaded.
+*/
+
+bool PipelineAudio::loadSound(MediaAsset asset, int soundID)
+{
+	if ( soundID < 0 || mediaExists( asset ) == false || getMediaKind( asset ) != MEDIA_SOUND )
+	{
+		return false;
+	}
+
+	if ( soundID >= (int)sounds.size() )
+	{
+		sounds.resize( soundID+1, false );
+	}
+
+	sounds[soundID] = true;
+	pipeline->addCommand( COMMAND_LOAD_SOUND, soundID, (int)asset, 0, 0 );
+
+	return true;
+}
+
+/**
+*  Function: deleteSound(int soundID)
+*
+*  Purpose: This function deletes a sound.
+*/
+
+void PipelineAudio::deleteSound(int soundID)
+{
+	if ( soundExists( soundID ) )
+	{
+		sounds[soundID] = false;
+		pipeline->addCommand( COMMAND_DELETE_SOUND, soundID, 0, 0, 0 );
+	}
+}
+
+/**
+*  Function: playSound(int soundID)
+*
+*  Purpose: This function plays a sound, once the batch is drawn.
+*/
+
+void PipelineAudio::playSound(int soundID)
+{
+	if ( soundExists( soundID ) )
+	{
+		played++;
+		pipeline->addCommand( COMMAND_PLAY_SOUND, soundID, 0, 0, 0 );
+	}
+}
+
+/**
+*  Function: PipelineInput()
+*
+*  Purpose: This is the constructor for the PipelineInput class.  Until it is
+*           connected to a pipeline and takes its input, loop() returns false.
+*/
+
+PipelineInput::PipelineInput()
+{
+	InputState closed = { false, 0, 0, 0, 0, 0 };
+
+	pipeline = NULL;
+	state = closed;
+	polled = 0;
+}
+
+/**
+*  Function: poll()
+*
+*  Purpose: This function moves on to the next frame's input.  If nothing has
+*           been handed over since the last poll(), the batch is handed over
+*           now, so that the input keeps moving.
+*/
+
+void PipelineInput::poll()
+{
+	if ( pipeline->getWrittenCount() == polled )
+	{
+		pipeline->handOver( false );
+	}
+
+	takeInput();
+}
+
+/**
+*  Function: takeInput()
+*
+*  Purpose: This function takes the newest input the pipeline has given back,
+*           without handing anything over.
+*/
+
+void PipelineInput::takeInput()
+{
+	state = pipeline->getInput();
+	polled = pipeline->getWrittenCount();
+}
+
+/**
+*  Function: idle()
+*
+*  Purpose: This function has the drawing thread idle once the batch is drawn,
+*           as the game would have without the pipeline.  The game waits for
+*           it there, when the batches run out.
+*/
+
+void PipelineInput::idle()
+{
+	pipeline->addCommand( COMMAND_IDLE, 0, 0, 0, 0 );
+}
+
+/**
+*  Function: hideMouse()
+*
+*  Purpose: This function hides the mouse, once the batch is drawn.
+*/
+
+void PipelineInput::hideMouse()
+{
+	pipeline->addCommand( COMMAND_HIDE_MOUSE, 0, 0, 0, 0 );
+}
+
+/**
+*  Function: showMouse()
+*
+*  Purpose: This function shows the mouse, once the batch is drawn.
+*/
+
+void PipelineInput::showMouse()
+{
+	pipeline->addCommand( COMMAND_SHOW_MOUSE, 0, 0, 0, 0 );
+}
@@ -0,0 +1,487 @@
+/**
+*  File:  RenderPipeline.h
+*
+*  Description:  This header file contains RenderPipeline, which lets the game
+*                run on one thread while its frames are drawn on another, so
+*                the time the game takes on frame N+1 overlaps the time the
+*                renderer takes to draw and present frame N.
+*
+*                The game runs on PipelinedBackend.  Its renderer is a
+*                SpriteLayer (SpriteLayer.h) in front of PipelineRenderer,
+*                which doesn't draw anything: it writes each call the layer
+*                sends on into a FrameBatch, as a RenderCommand of a few ints
+*                (a sprite's ID, where it is, its size, alpha or tint; text's
+*                place and string; and so on).  The sounds played, the mouse
+*                being hidden or shown and the game idling go in the batch
+*                too.  sync() hands the batch over, and drawPipeline() (below),
+*                on the thread that owns the real backend, plays each batch's
+*                commands on it in order, and then presents the frame.
+*
+*                There are three batches, used in turn: one being written by
+*                the game, one waiting and one being drawn.  The two threads
+*                only share two counters, the batches written and the batches
+*                drawn, which are changed with atomicAdd() (Threading.h), so no
+*                lock is ever taken.  A thread with nothing to do sleeps for a
+*                moment and looks again.  The vectors in a batch keep their
+*                memory from one use to the next, so after the first few frames
+*                nothing is allocated either.
+*
+*                The input the game sees is read on the drawing thread, after
+*                each batch is drawn, and goes back to the game with the batch
+*                when it is reused.  So the game always sees the input from the
+*                batch three before the one it is writing: two frames later than
+*                without the pipeline, but the same from run to run.  The
+*                pipeline measures how long each frame took from being handed
+*                over to being presented, and how long each thread waited for
+*                the other (see RenderPipelineStats).
+*
+*                Answers the game needs straight away are worked out on its own
+*                thread: the SpriteLayer answers the sprite questions, and image
+*                and sound IDs are kept track of as they are loaded.  The one
+*                exception is readImage(), which hands the batch over at once
+*                and waits for every batch to be drawn.  The game only reads
+*                images while loading, where waiting costs nothing.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef RENDER_PIPELINE_H_
+#define RENDER_PIPELINE_H_
+
+#include "Constants.h"
+#include "SpriteLayer.h"
+#include "Threading.h"
+#include <vector>
+
+using namespace std;
+
+const int PIPELINE_BATCHES = 3;
+
+enum RenderCommandType
+{
+	COMMAND_LOAD_IMAGE,         // id, asset in a
+	COMMAND_DELETE_IMAGE,       // id
+	COMMAND_READ_IMAGE,         // id, into the batch's imageRead
+	COMMAND_MAKE_IMAGE,         // id, width, height, where the pixels start (-1 for none)
+	COMMAND_MAKE_CIRCLE_IMAGE,  // id, which style, size
+	COMMAND_PASTE_IMAGE,        // id, x, y
+	COMMAND_GRAB_SCREEN,        // id
+	COMMAND_SPRITE,             // id, x, y, image ID
+	COMMAND_DELETE_SPRITE,      // id
+	COMMAND_HIDE_SPRITE,        // id
+	COMMAND_SHOW_SPRITE,        // id
+	COMMAND_SIZE_SPRITE,        // id, width, height
+	COMMAND_OFFSET_SPRITE,      // id, x, y
+	COMMAND_ROTATE_SPRITE,      // id, degrees
+	COMMAND_SPRITE_ALPHA,       // id, alpha
+	COMMAND_TINT_SPRITE,        // id, color
+	COMMAND_INK,                // foreground, background
+	COMMAND_TEXT_SIZE,          // size
+	COMMAND_TEXT,               // x, y, where the string starts
+	COMMAND_CENTER_TEXT,        // x, y, where the string starts
+	COMMAND_SYNC_ON,            // rate
+	COMMAND_LOAD_SOUND,         // id, asset
+	COMMAND_DELETE_SOUND,       // id
+	COMMAND_PLAY_SOUND,         // id
+	COMMAND_HIDE_MOUSE,
+	COMMAND_SHOW_MOUSE,
+	COMMAND_IDLE
+};
+
+/**
+*  A RenderCommand is one call to play on the real backend.  What a, b and c
+*  hold depends on the type (see RenderCommandType).
+*/
+
+struct RenderCommand
+{
+	int type;
+	int id;  // The sprite, image or sound.
+	int a;
+	int b;
+	int c;
+};
+
+/**
+*  InputState is the input read after a batch was drawn.
+*/
+
+struct InputState
+{
+	bool open;  // What loop() returned.
+	int mouseX;
+	int mouseY;
+	int mouseClick;
+	int escapeKey;
+	int rewindKey;  // keyState( REWIND_KEY ), the only key the game asks about.
+};
+
+/**
+*  ImageRead is where readImage() wants an image's pixels put.
+*/
+
+struct ImageRead
+{
+	int imageID;
+	vector <uint32> * pixels;
+	int * width;
+	int * height;
+	bool read;
+};
+
+/**
+*  A FrameBatch is everything the game asked for between two hand-overs.
+*/
+
+struct FrameBatch
+{
+	vector <RenderCommand> commands;
+	vector <char> text;           // The text commands' strings, each ending in a 0.
+	vector <uint32> pixels;       // The made images' pixels.
+	vector <CircleStyle> styles;  // The circle images' styles.
+	ImageRead * imageRead;        // Set if the batch ends with a readImage().
+	bool presents;                // Whether it ends with a sync().
+	double handedOver;            // When, by getSeconds().
+	InputState input;             // Set once it has been drawn.
+};
+
+/**
+*  RenderPipelineStats is what the pipeline measured.  The latency is from a
+*  frame being handed over to it being presented, and does not count the two
+*  frames the input is behind.
+*/
+
+struct RenderPipelineStats
+{
+	int frames;            // Frames presented.
+	double totalLatency;   // In seconds.
+	double maxLatency;
+	double gameWaiting;    // Time the game's thread spent waiting for a batch to be free.
+	double renderWaiting;  // Time the drawing thread spent waiting for a batch.
+};
+
+class RenderPipeline
+{
+private:
+	FrameBatch batches[PIPELINE_BATCHES];
+	volatile int32 written;   // Batches handed over.  Only the game's thread changes it.
+	volatile int32 drawn;     // Batches drawn.  Only the drawing thread changes it.
+	volatile int32 finished;  // Set once the game has stopped.
+	InputState input;         // The newest input the game has been given back.
+	RenderPipelineStats stats;
+
+	RenderPipeline(const RenderPipeline &);
+	RenderPipeline & operator=(const RenderPipeline &);
+
+public:
+	RenderPipeline();
+	void start(const InputState & first);
+	FrameBatch & getBatch() { return batches[written % PIPELINE_BATCHES]; }
+	void addCommand(int type, int id, int a, int b, int c);
+	void handOver(bool presents);
+	void flush();
+	void finish();
+	int getWrittenCount() const { return written; }
+	const InputState & getInput() const { return input; }
+	FrameBatch * waitForBatch();
+	void doneBatch(const InputState & drawnInput);
+	const RenderPipelineStats & getStats() const { return stats; }
+};
+
+/**
+*  Function: addCommand(int type, int id, int a, int b, int c)
+*
+*  Purpose: This function adds a command to the batch being written.
+*/
+
+inline void RenderPipeline::addCommand(int type, int id, int a, int b, int c)
+{
+	RenderCommand command = { type, id, a, b, c };
+	getBatch().commands.push_back( command );
+}
+
+/**
+*  PipelineRenderer is the game's side of the pipeline, behind a SpriteLayer.
+*  It only has the calls the layer sends on; the layer keeps track of the
+*  images itself.
+*/
+
+class PipelineRenderer
+{
+private:
+	RenderPipeline * pipeline;
+	int calls;
+
+	void add(int type, int id, int a, int b, int c) { calls++; pipeline->addCommand( type, id, a, b, c ); }
+
+public:
+	PipelineRenderer();
+	void connect(RenderPipeline & p) { pipeline = & p; }
+	bool loadImage(MediaAsset asset, int imageID);
+	void deleteImage(int imageID);
+	bool readImage(int imageID, vector <uint32> & pixels, int & width, int & height);
+	bool makeImage(int imageID, const uint32 * pixels, int width, int height);
+	bool makeCircleImage(int imageID, const CircleStyle & style, int size);
+	void pasteImage(int imageID, int x, int y) { add( COMMAND_PASTE_IMAGE, imageID, x, y, 0 ); }
+	bool grabScreen(int imageID) { add( COMMAND_GRAB_SCREEN, imageID, 0, 0, 0 ); return imageID >= 0; }
+	void sprite(int spriteID, int x, int y, int imageID) { add( COMMAND_SPRITE, spriteID, x, y, imageID ); }
+	void deleteSprite(int spriteID) { add( COMMAND_DELETE_SPRITE, spriteID, 0, 0, 0 ); }
+	void hideSprite(int spriteID) { add( COMMAND_HIDE_SPRITE, spriteID, 0, 0, 0 ); }
+	void showSprite(int spriteID) { add( COMMAND_SHOW_SPRITE, spriteID, 0, 0, 0 ); }
+	void sizeSprite(int spriteID, int width, int height) { add( COMMAND_SIZE_SPRITE, spriteID, width, height, 0 ); }
+	void offsetSprite(int spriteID, int x, int y) { add( COMMAND_OFFSET_SPRITE, spriteID, x, y, 0 ); }
+	void rotateSprite(int spriteID, int degrees) { add( COMMAND_ROTATE_SPRITE, spriteID, degrees, 0, 0 ); }
+	void setSpriteAlpha(int spriteID, int alpha) { add( COMMAND_SPRITE_ALPHA, spriteID, alpha, 0, 0 ); }
+	void tintSprite(int spriteID, uint32 color) { add( COMMAND_TINT_SPRITE, spriteID, (int)color, 0, 0 ); }
+	void ink(uint32 foreground, uint32 background) { add( COMMAND_INK, 0, (int)foreground, (int)background, 0 ); }
+	void setTextSize(int size) { add( COMMAND_TEXT_SIZE, 0, size, 0, 0 ); }
+	void text(int x, int y, const char * text);
+	void centerText(int x, int y, const char * text);
+	void syncOn(int rate) { add( COMMAND_SYNC_ON, 0, rate, 0, 0 ); }
+	void sync();
+	int getCallCount() const { return calls; }
+};
+
+/**
+*  PipelineAudio is the game's side of the pipeline's audio.  It keeps track
+*  of which sounds are loaded, which are the ones the real backend will load.
+*/
+
+class PipelineAudio
+{
+private:
+	RenderPipeline * pipeline;
+	vector <bool> sounds;  // Whether each sound ID has been loaded.
+	int played;
+
+public:
+	PipelineAudio();
+	void connect(RenderPipeline & p) { pipeline = & p; }
+	bool loadSound(MediaAsset asset, int soundID);
+	bool soundExists(int soundID) { return soundID >= 0 && soundID < (int)sounds.size() && sounds[soundID]; }
+	void deleteSound(int soundID);
+	void playSound(int soundID);
+	int getPlayedCount() const { return played; }
+};
+
+/**
+*  PipelineInput is the game's side of the pipeline's input.  poll() hands
+*  over the batch if sync() hasn't since the last poll(), so each frame is a
+*  batch even if nothing was drawn, and then takes the input given back.
+*/
+
+class PipelineInput
+{
+private:
+	RenderPipeline * pipeline;
+	InputState state;
+	int polled;  // The batches written at the last poll().
+
+public:
+	PipelineInput();
+	void connect(RenderPipeline & p) { pipeline = & p; }
+	bool loop() { return state.open; }
+	void poll();
+	void takeInput();
+	int mouseX() const { return state.mouseX; }
+	int mouseY() const { return state.mouseY; }
+	int mouseClick() const { return state.mouseClick; }
+	int escapeKey() const { return state.escapeKey; }
+	int keyState(int scanCode) const { return scanCode == REWIND_KEY ? state.rewindKey : 0; }
+	void idle();
+	void hideMouse();
+	void showMouse();
+};
+
+/**
+*  PipelinedBackend is the backend the game runs on, with the pipeline its
+*  calls go into.
+*/
+
+struct PipelinedBackend : public Backend <SpriteLayer <PipelineRenderer>, PipelineAudio, PipelineInput>
+{
+	RenderPipeline pipeline;
+
+	PipelinedBackend()
+	{
+		renderer.getEngine().connect( pipeline );
+		audio.connect( pipeline );
+		input.connect( pipeline );
+	}
+};
+
+/**
+*  Function: readInput(Input & input)
+*
+*  Purpose: This function reads everything the game asks an Input for.
+*
+*  Inputs: input - The real backend's input, already polled.
+*
+*  Returns: The input.
+*/
+
+template <class Input>
+InputState readInput(Input & input)
+{
+	InputState state;
+
+	state.open = input.loop();
+	state.mouseX = input.mouseX();
+	state.mouseY = input.mouseY();
+	state.mouseClick = input.mouseClick();
+	state.escapeKey = input.escapeKey();
+	state.rewindKey = input.keyState( REWIND_KEY );
+
+	return state;
+}
+
+/**
+*  Function: drawBatch(const FrameBatch & batch, Target & target)
+*
+*  Purpose: This function plays a batch's commands on the real backend, in
+*           the order the game made them.
+*
+*  Inputs: batch - The batch.
+*          target - The backend.
+*/
+
+template <class Target>
+void drawBatch(const FrameBatch & batch, Target & target)
+{
+	typename Target::Renderer & renderer = target.renderer;
+
+	for ( size_t i = 0; i < batch.commands.size(); i++ )
+	{
+		const RenderCommand & command = batch.commands[i];
+
+		switch ( command.type )
+		{
+		case COMMAND_LOAD_IMAGE:        renderer.loadImage( (MediaAsset)command.a, command.id ); break;
+		case COMMAND_DELETE_IMAGE:      renderer.deleteImage( command.id ); break;
+		case COMMAND_MAKE_IMAGE:        renderer.makeImage( command.id, command.c < 0 ? NULL : & batch.pixels[command.c],
+			                                                command.a, command.b ); break;
+		case COMMAND_MAKE_CIRCLE_IMAGE: renderer.makeCircleImage( command.id, batch.styles[command.a], command.b ); break;
+		case COMMAND_PASTE_IMAGE:       renderer.pasteImage( command.id, command.a, command.b ); break;
+		case COMMAND_GRAB_SCREEN:       renderer.grabScreen( command.id ); break;
+		case COMMAND_SPRITE:            renderer.sprite( command.id, command.a, command.b, command.c ); break;
+		case COMMAND_DELETE_SPRITE:     renderer.deleteSprite( command.id ); break;
+		case COMMAND_HIDE_SPRITE:       renderer.hideSprite( command.id ); break;
+		case COMMAND_SHOW_SPRITE:       renderer.showSprite( command.id ); break;
+		case COMMAND_SIZE_SPRITE:       renderer.sizeSprite( command.id, command.a, command.b ); break;
+		case COMMAND_OFFSET_SPRITE:     renderer.offsetSprite( command.id, command.a, command.b ); break;
+		case COMMAND_ROTATE_SPRITE:     renderer.rotateSprite( command.id, command.a ); break;
+		case COMMAND_SPRITE_ALPHA:      renderer.setSpriteAlpha( command.id, command.a ); break;
+		case COMMAND_TINT_SPRITE:       renderer.tintSprite( command.id, (uint32)command.a ); break;
+		case COMMAND_INK:               renderer.ink( (uint32)command.a, (uint32)command.b ); break;
+		case COMMAND_TEXT_SIZE:         renderer.setTextSize( command.a ); break;
+		case COMMAND_TEXT:              renderer.text( command.a, command.b, & batch.text[command.c] ); break;
+		case COMMAND_CENTER_TEXT:       renderer.centerText( command.a, command.b, & batch.text[command.c] ); break;
+		case COMMAND_SYNC_ON:           renderer.syncOn( command.a ); break;
+		case COMMAND_LOAD_SOUND:        target.audio.loadSound( (MediaAsset)command.a, command.id ); break;
+		case COMMAND_DELETE_SOUND:      target.audio.deleteSound( command.id ); break;
+		case COMMAND_PLAY_SOUND:        target.audio.playSound( command.id ); break;
+		case COMMAND_HIDE_MOUSE:        target.input.hideMouse(); break;
+		case COMMAND_SHOW_MOUSE:        target.input.showMouse(); break;
+		case COMMAND_IDLE:              target.input.idle(); break;
+
+		case COMMAND_READ_IMAGE:
+			{
+				ImageRead & request = *batch.imageRead;
+				request.read = renderer.readImage( command.id, *request.pixels, *request.width, *request.height );
+			}
+			break;
+		}
+	}
+}
+
+/**
+*  Function: drawPipeline(RenderPipeline & pipeline, Target & target)
+*
+*  Purpose: This function draws the pipeline's batches on the real backend as
+*           the game hands them over, presenting a frame after each one that
+*           ends with a sync(), and reading the input after each.  It returns
+*           once the game has finished and every batch has been drawn.
+*
+*  Inputs: pipeline - The pipeline.  start() must have been called.
+*          target - The backend to draw on, only ever used by this thread.
+*/
+
+template <class Target>
+void drawPipeline(RenderPipeline & pipeline, Target & target)
+{
+	FrameBatch * batch;
+
+	while ( ( batch = pipeline.waitForBatch() ) != NULL )
+	{
+		drawBatch( *batch, target );
+
+		if ( batch->presents )
+		{
+			target.renderer.sync();
+		}
+
+		target.input.poll();
+		pipeline.doneBatch( readInput( target.input ) );
+	}
+}
+
+/**
+*  PipelinedGame is the game running on its own thread, so that this one can
+*  draw it.
+*/
+
+template <class FrontEnd>
+class PipelinedGame : public ThreadTask
+{
+private:
+	FrontEnd & game;
+	RenderPipeline & pipeline;
+	uint32 seed;
+
+public:
+	PipelinedGame(FrontEnd & g, RenderPipeline & p, uint32 s) : game(g), pipeline(p), seed(s) { }
+
+	void run()
+	{
+		game.run( seed );
+		pipeline.finish();
+	}
+};
+
+/**
+*  Function: runPipelined(FrontEnd & game, PipelinedBackend & backend, Target & target, uint32 seed)
+*
+*  Purpose: This function runs the game on a thread of its own, and draws it
+*           on this one until it stops.
+*
+*  Inputs: game - The game, on backend.
+*          backend - The game's side of the pipeline.
+*          target - The backend to draw on.  Its input must be ready to read.
+*          seed - The game's seed (see GameFrontEnd::run()).
+*
+*  Returns: True if the game ran, or false if its thread couldn't be started.
+*/
+
+template <class FrontEnd, class Target>
+bool runPipelined(FrontEnd & game, PipelinedBackend & backend, Target & target, uint32 seed)
+{
+	backend.pipeline.start( readInput( target.input ) );
+	backend.input.takeInput();
+
+	PipelinedGame <FrontEnd> task( game, backend.pipeline, seed );
+	TaskThread thread;
+
+	if ( thread.start( task ) == false )
+	{
+		return false;
+	}
+
+	drawPipeline( backend.pipeline, target );
+	thread.join();
+
+	return true;
+}
+
+#endif
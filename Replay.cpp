@@ -0,0 +1,741 @@
+/**
+*  File:  Replay.cpp
+*
+*  Description:  This file contains the implementations for the replay recorder
+*                and player.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Replay.h"
+#include <stdio.h>
+
+const uint8 REPLAY_MAGIC[4] = { 'P', 'R', 'R', 'P' };
+
+/**
+*  Function: Replay()
+*
+*  Purpose: This is the constructor for the Replay class.  The replay starts
+*           out empty, with the game's normal sizes and a campaign seed of 0.
+*/
+
+Replay::Replay()
+{
+	campaignSeed = 0;
+	campaignSeedKnown = true;
+	savedLevels = 0;
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function throws away every recorded level.  The next
+*           appendLevels() starts its file over.
+*/
+
+void Replay::clear()
+{
+	levels.clear();
+	savedLevels = 0;
+}
+
+/**
+*  Function: setConfig(const SimConfig & simConfig)
+*
+*  Purpose: This function records the arena and bubble sizes the levels are
+*           played with.
+*
+*  Inputs: simConfig - The sizes.
+*/
+
+void Replay::setConfig(const SimConfig & simConfig)
+{
+	config = simConfig;
+}
+
+/**
+*  Function: getConfig()
+*
+*  Returns: The arena and bubble sizes the levels were played with.
+*/
+
+const SimConfig & Replay::getConfig() const
+{
+	return config;
+}
+
+/**
+*  Function: setCampaignSeed(uint32 seed)
+*
+*  Purpose: This function records the campaign seed (see Replay.h).
+*
+*  Inputs: seed - The state of the SimRandom the campaign's level seeds are
+*                 picked from, before the first level's was picked.
+*/
+
+void Replay::setCampaignSeed(uint32 seed)
+{
+	campaignSeed = seed;
+	campaignSeedKnown = true;
+}
+
+/**
+*  Function: getCampaignSeed(uint32 & seed)
+*
+*  Purpose: This function gets the campaign seed (see Replay.h).
+*
+*  Inputs: seed - Set to the campaign seed.
+*
+*  Returns: True, unless the replay was read from a version 1 file, which has
+*           no campaign seed.
+*/
+
+bool Replay::getCampaignSeed(uint32 & seed) const
+{
+	seed = campaignSeed;
+
+	return campaignSeedKnown;
+}
+
+/**
+*  Function: beginLevel(int level, uint32 seed, int levelBubbles, int goalPoints)
+*
+*  Purpose: This function starts recording a new level.  It is called once the
+*           level has been laid out from its seed.
+*
+*  Inputs: level - The level number (1-12).
+*          seed - The seed the level was laid out with.
+*          levelBubbles - The number of bubbles.
+*          goalPoints - The points needed to win.
+*/
+
+void Replay::beginLevel(int level, uint32 seed, int levelBubbles, int goalPoints)
+{
+	ReplayLevel r;
+	r.level = level;
+	r.seed = seed;
+	r.levelBubbles = levelBubbles;
+	r.goalPoints = goalPoints;
+	r.clickTick = -1;
+	r.clickX = 0;
+	r.clickY = 0;
+	r.points = 0;
+	r.endTick = -1;
+
+	levels.push_back( r );
+}
+
+/**
+*  Function: recordClick(int tick, int x, int y)
+*
+*  Purpose: This function records the user's click in the current level.  Only
+*           the first click starts a chain reaction, so any later ones are ignored.
+*
+*  Inputs: tick - The frame of the level the click was handled in, counting from 0.
+*          x, y - Where the user clicked.
+*/
+
+void Replay::recordClick(int tick, int x, int y)
+{
+	if ( levels.empty() || levels.back().clickTick >= 0 )
+	{
+		return;
+	}
+
+	ReplayLevel & r = levels.back();
+	r.clickTick = tick;
+	r.clickX = x;
+	r.clickY = y;
+}
+
+/**
+*  Function: recordTick(const LevelSimulation & sim)
+*
+*  Purpose: This function is called after each frame of the current level.  It
+*           saves a keyframe every REPLAY_KEYFRAME_INTERVAL frames from the
+*           level as it is, and notes the frame the chain reaction ended in.
+*           If the level goes back to an earlier frame, rewindTo() must be
+*           called first, or the keyframes would be out of order.
+*
+*  Inputs: sim - The level being recorded, just after its frame was played.
+*/
+
+void Replay::recordTick(const LevelSimulation & sim)
+{
+	if ( levels.empty() || levels.back().endTick >= 0 )
+	{
+		return;
+	}
+
+	ReplayLevel & r = levels.back();
+	int tick = sim.getTickCount();
+
+	if ( sim.getChainReactionDone() )
+	{
+		r.endTick = tick;
+	}
+	else if ( tick > 0 && tick % REPLAY_KEYFRAME_INTERVAL == 0 )
+	{
+		r.keyframes.push_back( ReplayKeyframe() );
+
+		ReplayKeyframe & keyframe = r.keyframes.back();
+		keyframe.tick = tick;
+
+		ByteWriter writer( keyframe.state );
+		sim.saveState( writer );
+	}
+}
+
+/**
+*  Function: rewindTo(int tick)
+*
+*  Purpose: This function is called when the current level is put back to an
+*           earlier frame.  Everything recorded after that frame belongs to a
+*           timeline the player abandoned, so it is dropped: the keyframes past
+*           it, the end of the chain reaction, and the click if it was handled
+*           in that frame or later.  Recording then goes on from the frame.
+*
+*  Inputs: tick - The frame the level was put back to, as getTickCount() gives
+*                 it just after the rewind.
+*/
+
+void Replay::rewindTo(int tick)
+{
+	if ( levels.empty() )
+	{
+		return;
+	}
+
+	ReplayLevel & r = levels.back();
+
+	while ( r.keyframes.empty() == false && r.keyframes.back().tick > tick )
+	{
+		r.keyframes.pop_back();
+	}
+
+	if ( r.clickTick >= tick )
+	{
+		r.clickTick = -1;
+		r.clickX = 0;
+		r.clickY = 0;
+	}
+
+	if ( r.endTick > tick )
+	{
+		r.endTick = -1;
+	}
+}
+
+/**
+*  Function: endLevel(int points)
+*
+*  Purpose: This function finishes recording the current level.
+*
+*  Inputs: points - The levelPoints the game finished the level with.
+*/
+
+void Replay::endLevel(int points)
+{
+	if ( levels.empty() )
+	{
+		return;
+	}
+
+	levels.back().points = points;
+}
+
+/**
+*  Function: getLevelCount()
+*
+*  Returns: The number of levels recorded.
+*/
+
+int Replay::getLevelCount() const
+{
+	return (int)levels.size();
+}
+
+/**
+*  Function: getLevel(int i)
+*
+*  Returns: The level recorded at index i, in the order they were played.
+*/
+
+const ReplayLevel & Replay::getLevel(int i) const
+{
+	return levels[i];
+}
+
+/**
+*  Function: writeHeader(ByteWriter & writer)
+*
+*  Purpose: This function writes everything in the file before the levels.
+*
+*  Inputs: writer - Where to write it.
+*/
+
+void Replay::writeHeader(ByteWriter & writer) const
+{
+	writer.writeBytes( REPLAY_MAGIC, 4 );
+	writer.writeVarint( REPLAY_VERSION );
+	writer.writeVarint( (uint32)config.arenaWidth );
+	writer.writeVarint( (uint32)config.arenaHeight );
+	writer.writeVarint( (uint32)config.bubbleRadius );
+	writer.writeVarint( (uint32)config.popExpansion );
+	writer.writeVarint( campaignSeed );
+}
+
+/**
+*  Function: writeLevel(ByteWriter & writer, const ReplayLevel & r)
+*
+*  Purpose: This function writes one level, with its keyframes.
+*
+*  Inputs: writer - Where to write it.
+*          r - The level.
+*/
+
+void Replay::writeLevel(ByteWriter & writer, const ReplayLevel & r) const
+{
+	writer.writeVarint( (uint32)r.level );
+	writer.writeVarint( r.seed );
+	writer.writeVarint( (uint32)r.levelBubbles );
+	writer.writeVarint( (uint32)r.goalPoints );
+	writer.writeVarint( (uint32)( r.clickTick + 1 ) );
+	writer.writeSigned( r.clickX );
+	writer.writeSigned( r.clickY );
+	writer.writeVarint( (uint32)r.points );
+	writer.writeVarint( (uint32)( r.endTick + 1 ) );
+	writer.writeVarint( (uint32)r.keyframes.size() );
+
+	int lastTick = 0;
+
+	for ( int k = 0; k < (int)r.keyframes.size(); k++ )
+	{
+		const ReplayKeyframe & keyframe = r.keyframes[k];
+
+		writer.writeVarint( (uint32)( keyframe.tick - lastTick ) );
+		writer.writeVarint( (uint32)keyframe.state.size() );
+		writer.writeBytes( & keyframe.state[0], (int)keyframe.state.size() );
+
+		lastTick = keyframe.tick;
+	}
+}
+
+/**
+*  Function: write(vector <uint8> & bytes)
+*
+*  Purpose: This function writes the replay in the format described in Replay.h.
+*
+*  Inputs: bytes - The replay is added to the end.
+*/
+
+void Replay::write(vector <uint8> & bytes) const
+{
+	ByteWriter writer( bytes );
+
+	writeHeader( writer );
+
+	for ( int i = 0; i < (int)levels.size(); i++ )
+	{
+		writeLevel( writer, levels[i] );
+	}
+}
+
+/**
+*  Function: read(const uint8 * data, int size, bool keyframes)
+*
+*  Purpose: This function reads a replay written by write().  Replays from a
+*           newer version of the game, or with impossible values, are turned down.
+*
+*  Inputs: data - The replay.
+*          size - Its size in bytes.
+*          keyframes - False to skip over the keyframes without copying them,
+*                      for playing the levels from the start only.
+*
+*  Returns: True if the replay was read.  If not, the replay is left empty.
+*/
+
+bool Replay::read(const uint8 * data, int size, bool keyframes)
+{
+	ByteReader reader( data, size );
+
+	clear();
+
+	uint8 magic[4];
+
+	if ( reader.readBytes( magic, 4 ) == false ||
+		 magic[0] != REPLAY_MAGIC[0] || magic[1] != REPLAY_MAGIC[1] ||
+		 magic[2] != REPLAY_MAGIC[2] || magic[3] != REPLAY_MAGIC[3] )
+	{
+		return false;
+	}
+
+	uint32 version = reader.readVarint();
+
+	config.arenaWidth = (int)reader.readVarint();
+	config.arenaHeight = (int)reader.readVarint();
+	config.bubbleRadius = (int)reader.readVarint();
+	config.popExpansion = (int)reader.readVarint();
+
+	campaignSeedKnown = version >= 2;
+	campaignSeed = campaignSeedKnown ? reader.readVarint() : 0;
+
+	uint32 levelCount = version < 3 ? reader.readVarint() : 0;  // From version 3 on, the levels go to the end.
+
+	if ( reader.getFailed() || version < 1 || version > REPLAY_VERSION || config.valid() == false ||
+		 levelCount > (uint32)reader.getRemaining() )
+	{
+		return false;
+	}
+
+	for ( int i = 0; version < 3 ? i < (int)levelCount : reader.getRemaining() > 0; i++ )
+	{
+		levels.push_back( ReplayLevel() );
+
+		ReplayLevel & r = levels.back();
+
+		r.level = (int)reader.readVarint();
+		r.seed = reader.readVarint();
+		r.levelBubbles = (int)reader.readVarint();
+		r.goalPoints = (int)reader.readVarint();
+		r.clickTick = (int)reader.readVarint() - 1;
+		r.clickX = reader.readSigned();
+		r.clickY = reader.readSigned();
+		r.points = (int)reader.readVarint();
+		r.endTick = (int)reader.readVarint() - 1;
+
+		uint32 keyframeCount = reader.readVarint();
+
+		if ( reader.getFailed() || r.levelBubbles < 0 || r.levelBubbles > REPLAY_MAX_BUBBLES || keyframeCount > (uint32)reader.getRemaining() )
+		{
+			clear();
+			return false;
+		}
+
+		r.keyframes.resize( keyframes ? keyframeCount : 0 );
+
+		int tick = 0;
+
+		for ( int k = 0; k < (int)keyframeCount; k++ )
+		{
+			uint32 gap = reader.readVarint();
+			uint32 stateSize = reader.readVarint();
+
+			if ( reader.getFailed() || gap == 0 || stateSize == 0 || stateSize > (uint32)reader.getRemaining() )  // Keyframes must go forward.
+			{
+				clear();
+				return false;
+			}
+
+			tick += (int)gap;
+
+			if ( keyframes == false )
+			{
+				reader.skip( (int)stateSize );
+				continue;
+			}
+
+			ReplayKeyframe & keyframe = r.keyframes[k];
+			keyframe.tick = tick;
+			keyframe.state.resize( stateSize );
+			reader.readBytes( & keyframe.state[0], (int)stateSize );
+		}
+	}
+
+	if ( reader.getFailed() )
+	{
+		clear();
+		return false;
+	}
+
+	return true;
+}
+
+/**
+*  Function: save(const char * fileName)
+*
+*  Purpose: This function writes the replay to a file.
+*
+*  Inputs: fileName - The file to write.
+*
+*  Returns: True if the file was written.
+*/
+
+bool Replay::save(const char * fileName) const
+{
+	vector <uint8> bytes;
+	write( bytes );
+
+	FILE * file = fopen( fileName, "wb" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	bool written = fwrite( & bytes[0], 1, bytes.size(), file ) == bytes.size();
+
+	return fclose( file ) == 0 && written;
+}
+
+/**
+*  Function: appendLevels(const char * fileName)
+*
+*  Purpose: This function adds the levels recorded since the last call to the
+*           end of a replay file, so the levels already in it aren't written
+*           again.  The first call after clear() (or after a failed one) writes
+*           the file over with the header and every level.
+*
+*  Inputs: fileName - The file to write.  It must be the same one each time.
+*
+*  Returns: True if the file was written.
+*/
+
+bool Replay::appendLevels(const char * fileName)
+{
+	vector <uint8> bytes;
+	ByteWriter writer( bytes );
+
+	if ( savedLevels == 0 )
+	{
+		writeHeader( writer );
+	}
+
+	for ( int i = savedLevels; i < (int)levels.size(); i++ )
+	{
+		writeLevel( writer, levels[i] );
+	}
+
+	FILE * file = fopen( fileName, savedLevels == 0 ? "wb" : "ab" );
+
+	if ( file == NULL )
+	{
+		savedLevels = 0;
+		return false;
+	}
+
+	bool written = bytes.empty() || fwrite( & bytes[0], 1, bytes.size(), file ) == bytes.size();
+
+	if ( fclose( file ) != 0 || written == false )
+	{
+		savedLevels = 0;
+		return false;
+	}
+
+	savedLevels = (int)levels.size();
+
+	return true;
+}
+
+/**
+*  Function: load(const char * fileName)
+*
+*  Purpose: This function reads a replay from a file.
+*
+*  Inputs: fileName - The file to read.
+*
+*  Returns: True if the replay was read.
+*/
+
+bool Replay::load(const char * fileName)
+{
+	clear();
+
+	FILE * file = fopen( fileName, "rb" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	vector <uint8> bytes;
+	uint8 buffer[65536];
+	size_t count;
+
+	while ( ( count = fread( buffer, 1, sizeof(buffer), file ) ) > 0 )
+	{
+		bytes.insert( bytes.end(), buffer, buffer + count );
+	}
+
+	fclose( file );
+
+	return bytes.empty() == false && read( & bytes[0], (int)bytes.size() );
+}
+
+/**
+*  Function: ReplayPlayer()
+*
+*  Purpose: This is the constructor for the ReplayPlayer class.  Nothing can be
+*           played until start() is called.
+*/
+
+ReplayPlayer::ReplayPlayer()
+{
+	level = NULL;
+}
+
+/**
+*  Function: setWorkerPool(WorkerPool * workerPool)
+*
+*  Purpose: This function chooses the threads the level is played on.  See
+*           LevelSimulation::setWorkerPool().
+*
+*  Inputs: workerPool - The pool to use, or NULL to play on the calling thread.
+*/
+
+void ReplayPlayer::setWorkerPool(WorkerPool * workerPool)
+{
+	sim.setWorkerPool( workerPool );
+}
+
+/**
+*  Function: start(const SimConfig & simConfig, const ReplayLevel & replayLevel)
+*
+*  Purpose: This function lays out a recorded level from its seed, ready to
+*           play its first frame.
+*
+*  Inputs: simConfig - The sizes the level was played with.
+*          replayLevel - The level.  It must not change or go away while it
+*                        is being played.
+*/
+
+void ReplayPlayer::start(const SimConfig & simConfig, const ReplayLevel & replayLevel)
+{
+	config = simConfig;
+	level = & replayLevel;
+
+	sim.setConfig( config );
+	sim.generate( level->seed, level->levelBubbles );
+}
+
+/**
+*  Function: step()
+*
+*  Purpose: This function plays one frame, passing on the user's click in the
+*           frame it was recorded in.
+*/
+
+void ReplayPlayer::step()
+{
+	if ( sim.getTickCount() == level->clickTick )
+	{
+		sim.click( level->clickX, level->clickY );
+	}
+
+	sim.tick();
+}
+
+/**
+*  Function: findKeyframe(int tick)
+*
+*  Purpose: This function finds the last keyframe at or before a frame with a
+*           binary search.
+*
+*  Inputs: tick - The frame.
+*
+*  Returns: The keyframe's index, or -1 if every keyframe comes after tick.
+*/
+
+int ReplayPlayer::findKeyframe(int tick) const
+{
+	const vector <ReplayKeyframe> & keyframes = level->keyframes;
+
+	int low = 0;
+	int high = (int)keyframes.size();  // The answer is below high.
+
+	while ( low < high )
+	{
+		int middle = low + ( high - low ) / 2;
+
+		if ( keyframes[middle].tick <= tick )
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low - 1;
+}
+
+/**
+*  Function: seek(int tick)
+*
+*  Purpose: This function puts the level into its state just before frame tick.
+*           It starts from the last keyframe before tick, or from where it is
+*           now if that is closer, and plays forward.
+*
+*  Inputs: tick - The frame to seek to.
+*
+*  Returns: True, unless a keyframe was damaged.  The level is then back at the
+*           start and has been played forward from there.
+*/
+
+bool ReplayPlayer::seek(int tick)
+{
+	bool loaded = true;
+	int k = findKeyframe( tick );
+	int current = sim.getTickCount();
+
+	if ( current > tick || ( k >= 0 && level->keyframes[k].tick > current ) )
+	{
+		if ( k >= 0 )
+		{
+			const vector <uint8> & state = level->keyframes[k].state;
+
+			ByteReader reader( & state[0], (int)state.size() );
+			loaded = sim.loadState( reader );
+		}
+
+		if ( k < 0 || loaded == false )
+		{
+			sim.generate( level->seed, level->levelBubbles );
+		}
+	}
+
+	while ( sim.getTickCount() < tick )
+	{
+		step();
+	}
+
+	return loaded;
+}
+
+/**
+*  Function: play(int maxTicks)
+*
+*  Purpose: This function plays frames until the chain reaction is over, or
+*           until maxTicks frames have been played.
+*
+*  Inputs: maxTicks - The most frames to play.
+*
+*  Returns: The number of frames played by this call.
+*/
+
+int ReplayPlayer::play(int maxTicks)
+{
+	int ticks = 0;
+
+	while ( sim.getChainReactionDone() == false && ticks < maxTicks )
+	{
+		step();
+		ticks++;
+	}
+
+	return ticks;
+}
+
+/**
+*  Function: getSimulation()
+*
+*  Returns: The level being played.
+*/
+
+const LevelSimulation & ReplayPlayer::getSimulation() const
+{
+	return sim;
+}
@@ -0,0 +1,149 @@
+/**
+*  File:  Replay.h
+*
+*  Description:  This header file contains the replay recorder and player.  A level
+*                of Prisms is completely determined by its seed and the user's
+*                click, so that is all a replay has to record: for each level
+*                played, the level number, seed, number of bubbles, goal, and the
+*                frame and position of the click.  The game records every level
+*                it plays to Prisms.replay, and PrismsTools can play them back
+*                headless, as fast as the CPU allows.
+*
+*                A replay also records its campaign seed: the whole state of the
+*                SimRandom the campaign's level seeds are picked from, as it was
+*                before the first level's.  The level seeds all follow from it,
+*                so ReplayValidator can check that each one is the seed the game
+*                would have picked.
+*
+*                To make seeking cheap, the state of the level is also saved every
+*                REPLAY_KEYFRAME_INTERVAL frames.  ReplayPlayer::seek() finds the
+*                last keyframe before the frame it wants with a binary search, and
+*                plays forward from there, so it never plays more than one
+*                interval's worth of frames.  The keyframes are taken from the
+*                level as it is played (see recordTick()), so recording costs
+*                one saveState() a second and never plays anything again.  When
+*                the game rewinds the level, rewindTo() drops whatever was
+*                recorded after the frame it went back to, so the replay only
+*                ever holds the timeline that was played out.
+*
+*                The game saves the replay after every level with appendLevels(),
+*                which only adds the levels that aren't in the file yet.  That
+*                is why the file has no count of levels: they simply go on to
+*                the end of it.
+*
+*                File format (see ByteStream.h for varints), all in order:
+*
+*                "PRRP", then the version
+*                arena width, arena height, bubble radius, pop expansion
+*                the campaign seed (from version 2 on; version 1 replays don't
+*                have one)
+*                the number of levels (before version 3 only), then for each
+*                level, to the end of the file:
+*                    level, seed, bubbles, goal points
+*                    click frame + 1 (0 if there was no click), click x, click y
+*                    points scored, frame the chain reaction ended + 1
+*                    the number of keyframes, then for each keyframe:
+*                        frames since the last keyframe, state size, state
+*                        (from LevelSimulation::saveState())
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include "Simulation.h"
+
+const uint32 REPLAY_VERSION = 3;
+const int REPLAY_KEYFRAME_INTERVAL = 60;      // One second of play between keyframes.
+const int REPLAY_MAX_RESOLVE_TICKS = 100000;  // Safety limit.  A real chain reaction ends long before this.
+const int REPLAY_MAX_BUBBLES = 10000000;      // Replays with more bubbles than this are turned down.
+const char REPLAY_FILE_NAME[] = "Prisms.replay";
+
+/**
+*  ReplayKeyframe is the saved state of a level just before frame tick.
+*/
+
+struct ReplayKeyframe
+{
+	int tick;
+	vector <uint8> state;
+};
+
+/**
+*  ReplayLevel is one level as it was played.
+*/
+
+struct ReplayLevel
+{
+	int level;
+	uint32 seed;
+	int levelBubbles;
+	int goalPoints;
+	int clickTick;      // The frame the user clicked in, or -1 if they didn't.
+	int clickX;
+	int clickY;
+	int points;         // The levelPoints the game reported at the end of the level.
+	int endTick;        // The frame the chain reaction ended in when played back, or -1.
+	vector <ReplayKeyframe> keyframes;
+};
+
+class Replay
+{
+private:
+	SimConfig config;
+	uint32 campaignSeed;
+	bool campaignSeedKnown;   // False for replays from before campaign seeds were recorded.
+	vector <ReplayLevel> levels;
+	int savedLevels;          // The levels appendLevels() has already written to the file.
+
+	void writeHeader(ByteWriter & writer) const;
+	void writeLevel(ByteWriter & writer, const ReplayLevel & r) const;
+
+public:
+	Replay();
+	void clear();
+	void setConfig(const SimConfig & simConfig);
+	const SimConfig & getConfig() const;
+	void setCampaignSeed(uint32 seed);
+	bool getCampaignSeed(uint32 & seed) const;
+	void beginLevel(int level, uint32 seed, int levelBubbles, int goalPoints);
+	void recordClick(int tick, int x, int y);
+	void recordTick(const LevelSimulation & sim);
+	void rewindTo(int tick);
+	void endLevel(int points);
+	int getLevelCount() const;
+	const ReplayLevel & getLevel(int i) const;
+	void write(vector <uint8> & bytes) const;
+	bool read(const uint8 * data, int size, bool keyframes = true);
+	bool save(const char * fileName) const;
+	bool appendLevels(const char * fileName);
+	bool load(const char * fileName);
+};
+
+/**
+*  ReplayPlayer plays back one level of a replay on a LevelSimulation.
+*/
+
+class ReplayPlayer
+{
+private:
+	SimConfig config;
+	const ReplayLevel * level;
+	LevelSimulation sim;
+
+	int findKeyframe(int tick) const;
+
+public:
+	ReplayPlayer();
+	void setWorkerPool(WorkerPool * workerPool);
+	void start(const SimConfig & simConfig, const ReplayLevel & replayLevel);
+	void step();
+	bool seek(int tick);
+	int play(int maxTicks);
+	const LevelSimulation & getSimulation() const;
+};
+
+#endif
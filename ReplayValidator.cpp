@@ -0,0 +1,242 @@
+/**
+*  File:  ReplayValidator.cpp
+*
+*  Description:  This file contains the method implementations for the
+*                ReplayValidator class.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "ReplayValidator.h"
+
+const char * VERDICT_NAMES[] = { "accepted", "unreadable", "config", "rules", "seed", "mismatch", "incomplete" };
+
+/**
+*  Function: getVerdictName(VerdictReason reason)
+*
+*  Returns: A one word name for a verdict, for writing verdicts out.
+*/
+
+const char * getVerdictName(VerdictReason reason)
+{
+	return VERDICT_NAMES[reason];
+}
+
+/**
+*  Function: ReplayValidator()
+*
+*  Purpose: This is the constructor for the ReplayValidator class.
+*/
+
+ReplayValidator::ReplayValidator()
+{
+}
+
+/**
+*  Function: fail(ReplayVerdict & verdict, VerdictReason reason, int entry)
+*
+*  Purpose: This function turns a replay down.
+*
+*  Inputs: verdict - The verdict to fill in.
+*          reason - Why.
+*          entry - The index of the level that failed, or the number of levels
+*                  if the replay is incomplete.
+*/
+
+void ReplayValidator::fail(ReplayVerdict & verdict, VerdictReason reason, int entry) const
+{
+	verdict.reason = reason;
+	verdict.entry = entry;
+
+	if ( entry >= 0 && entry < replay.getLevelCount() )
+	{
+		verdict.level = replay.getLevel( entry ).level;
+	}
+}
+
+/**
+*  Function: checkRules(uint32 campaignSeed, ReplayVerdict & verdict)
+*
+*  Purpose: This function checks that the levels of the replay follow each other
+*           the way the game plays them, going by the points recorded, without
+*           playing any of them.  Each new level's seed must be the next one
+*           GameSession::newLevel() picks from the campaign seed, and a retried
+*           level's the same as before.
+*
+*  Inputs: campaignSeed - The replay's campaign seed.
+*          verdict - If the replay breaks the rules, or stops before the last
+*                    level is won, it is turned down with the first level where
+*                    that happens.
+*
+*  Returns: The number of levels before the first one that broke the rules (all
+*           of them if none did).  Only those need to be played back.
+*/
+
+int ReplayValidator::checkRules(uint32 campaignSeed, ReplayVerdict & verdict) const
+{
+	SimRandom seeds( campaignSeed );
+	int expectedLevel = 1;
+	bool wonGame = false;
+
+	for ( int i = 0; i < replay.getLevelCount(); i++ )
+	{
+		const ReplayLevel & r = replay.getLevel( i );
+
+		if ( wonGame || r.level != expectedLevel || r.levelBubbles != LEVEL_BUBBLES[r.level-1] ||
+			 r.goalPoints != GOAL_POINTS[r.level-1] || r.clickTick > VALIDATOR_MAX_CLICK_TICK )
+		{
+			fail( verdict, VERDICT_RULES, i );
+			return i;
+		}
+
+		bool retried = i > 0 && replay.getLevel( i - 1 ).points < replay.getLevel( i - 1 ).goalPoints;
+
+		if ( retried && r.seed != replay.getLevel( i - 1 ).seed )
+		{
+			fail( verdict, VERDICT_RULES, i );
+			return i;
+		}
+
+		if ( retried == false && r.seed != (uint32)seeds.next( 0x7fffffff ) )
+		{
+			fail( verdict, VERDICT_SEED, i );
+			return i;
+		}
+
+		if ( r.clickTick < 0 )  // The level was never clicked, so the game was closed during it.
+		{
+			fail( verdict, i == replay.getLevelCount() - 1 ? VERDICT_INCOMPLETE : VERDICT_RULES, i );
+			return i;
+		}
+
+		if ( r.points >= r.goalPoints )  // Won level.
+		{
+			if ( r.level == LEVELS )
+			{
+				wonGame = true;
+			}
+			else
+			{
+				expectedLevel++;
+			}
+		}
+	}
+
+	if ( wonGame == false )
+	{
+		fail( verdict, VERDICT_INCOMPLETE, replay.getLevelCount() );
+		verdict.level = expectedLevel;
+	}
+
+	return replay.getLevelCount();
+}
+
+/**
+*  Function: validate(const uint8 * data, int size, ReplayVerdict & verdict)
+*
+*  Purpose: This function validates a replay whose campaign seed the player's
+*           game picked (see ReplayValidator.h).
+*
+*  Inputs: data, size - The replay file's bytes.
+*          verdict - Filled in with the verdict.
+*/
+
+void ReplayValidator::validate(const uint8 * data, int size, ReplayVerdict & verdict)
+{
+	check( data, size, false, 0, verdict );
+}
+
+/**
+*  Function: validate(const uint8 * data, int size, uint32 issuedSeed, ReplayVerdict & verdict)
+*
+*  Purpose: This function validates a replay of a campaign the server started
+*           the player on, which must have the campaign seed the server issued.
+*
+*  Inputs: data, size - The replay file's bytes.
+*          issuedSeed - The campaign seed the server issued.
+*          verdict - Filled in with the verdict.
+*/
+
+void ReplayValidator::validate(const uint8 * data, int size, uint32 issuedSeed, ReplayVerdict & verdict)
+{
+	check( data, size, true, issuedSeed, verdict );
+}
+
+/**
+*  Function: check(const uint8 * data, int size, bool issued, uint32 issuedSeed, ReplayVerdict & verdict)
+*
+*  Purpose: This function validates a replay (see ReplayValidator.h).  The rules
+*           are checked first, since that is cheap, and then the levels before
+*           the first one that broke them are played back in order.  A level
+*           that doesn't play back as recorded comes before the broken rule, so
+*           it gives the verdict instead.
+*
+*  Inputs: data, size - The replay file's bytes.
+*          issued - True if the campaign seed must be issuedSeed.
+*          issuedSeed - The campaign seed the server issued.
+*          verdict - Filled in with the verdict.
+*/
+
+void ReplayValidator::check(const uint8 * data, int size, bool issued, uint32 issuedSeed, ReplayVerdict & verdict)
+{
+	verdict.reason = VERDICT_ACCEPTED;
+	verdict.entry = -1;
+	verdict.level = 0;
+	verdict.totalPoints = 0;
+	verdict.levelsPlayed = 0;
+	verdict.ticks = 0;
+
+	if ( data == NULL || replay.read( data, size, false ) == false )
+	{
+		replay.clear();
+		verdict.reason = VERDICT_UNREADABLE;
+		return;
+	}
+
+	const SimConfig & config = replay.getConfig();
+	SimConfig gameConfig;
+
+	if ( config.arenaWidth != gameConfig.arenaWidth || config.arenaHeight != gameConfig.arenaHeight ||
+		 config.bubbleRadius != gameConfig.bubbleRadius || config.popExpansion != gameConfig.popExpansion )
+	{
+		verdict.reason = VERDICT_CONFIG;
+		return;
+	}
+
+	uint32 campaignSeed;
+
+	if ( replay.getCampaignSeed( campaignSeed ) == false || ( issued && campaignSeed != issuedSeed ) )
+	{
+		fail( verdict, VERDICT_SEED, 0 );
+		return;
+	}
+
+	int playable = checkRules( campaignSeed, verdict );
+
+	for ( int i = 0; i < playable; i++ )
+	{
+		const ReplayLevel & r = replay.getLevel( i );
+
+		player.start( config, r );
+		player.play( r.clickTick + REPLAY_MAX_RESOLVE_TICKS );
+
+		const LevelSimulation & sim = player.getSimulation();
+		int endTick = sim.getChainReactionDone() ? sim.getTickCount() : -1;
+
+		verdict.levelsPlayed++;
+		verdict.ticks += sim.getTickCount();
+
+		if ( sim.getLevelPoints() != r.points || endTick != r.endTick )
+		{
+			fail( verdict, VERDICT_MISMATCH, i );
+			return;
+		}
+
+		if ( r.points >= r.goalPoints )
+		{
+			verdict.totalPoints += r.points;
+		}
+	}
+}
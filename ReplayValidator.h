@@ -0,0 +1,98 @@
+/**
+*  File:  ReplayValidator.h
+*
+*  Description:  This header file contains ReplayValidator, which decides whether
+*                a replay submitted with a score is a real campaign of Prisms.
+*                Only the replay is trusted, not the score sent with it: every
+*                level is played again headless from its seed and click, and
+*                the score the validator reports is the one it played back.
+*
+*                Every level seed follows from the campaign seed in the replay
+*                (see Replay.h), so the whole campaign's layouts are pinned by
+*                that one number.  It is only as trustworthy as where it came
+*                from, though.  The game picks its own from the clock, and a
+*                player who can pick it can try campaign seeds until one has
+*                easy layouts.  So a server that wants scores to count should
+*                issue the campaign seed itself and validate with it; without
+*                one, the validator can only tell that the levels are the ones
+*                the replay's own campaign seed gives.
+*
+*                A replay is accepted if:
+*
+*                - it was played with the game's own arena and bubble sizes,
+*                - its levels follow each other the way GameSession plays them:
+*                  level 1 first, a won level followed by the next one, a lost
+*                  level followed by the same level with the same seed, and
+*                  nothing after the last level is won,
+*                - it has a campaign seed (version 1 replays don't), and it is
+*                  the one the server issued, if the server issued one,
+*                - each new level's seed is exactly the next one the game's
+*                  SimRandom picks from the campaign seed, so a player can't
+*                  swap in an easier layout for any level,
+*                - each level has the right number of bubbles and goal, and
+*                - each level plays back to exactly the points and end frame
+*                  that were recorded.
+*
+*                Otherwise the verdict says why, and which level failed first.
+*                A validator keeps the storage of the last replay for the next
+*                one, so each thread validating replays should have its own.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef REPLAY_VALIDATOR_H_
+#define REPLAY_VALIDATOR_H_
+
+#include "Replay.h"
+
+const int VALIDATOR_MAX_CLICK_TICK = 10 * 60 * REFRESH_RATE;  // Ten minutes.  Longer waits are turned down rather than played out.
+
+enum VerdictReason
+{
+	VERDICT_ACCEPTED,
+	VERDICT_UNREADABLE,   // Not a replay, or a damaged one.
+	VERDICT_CONFIG,       // Played with other sizes (stress mode).
+	VERDICT_RULES,        // The levels don't follow each other the way the game plays them.
+	VERDICT_SEED,         // The campaign seed is missing or wasn't issued, or a level's seed doesn't follow from it.
+	VERDICT_MISMATCH,     // A level doesn't play back to what was recorded.
+	VERDICT_INCOMPLETE    // The replay stops before the last level is won.
+};
+
+/**
+*  ReplayVerdict is the outcome of validating one replay.
+*/
+
+struct ReplayVerdict
+{
+	VerdictReason reason;
+	int entry;          // The index in the replay of the first level that failed, or -1.
+	int level;          // That level's number, or the level the replay stopped on if incomplete.
+	int totalPoints;    // The points of every level won, as played back.
+	int levelsPlayed;   // The levels played back, counting retries.
+	int64 ticks;        // The frames played back.
+};
+
+const char * getVerdictName(VerdictReason reason);
+
+class ReplayValidator
+{
+private:
+	Replay replay;
+	ReplayPlayer player;
+
+	ReplayValidator(const ReplayValidator &);
+	ReplayValidator & operator=(const ReplayValidator &);
+
+	void fail(ReplayVerdict & verdict, VerdictReason reason, int entry) const;
+	int checkRules(uint32 campaignSeed, ReplayVerdict & verdict) const;
+	void check(const uint8 * data, int size, bool issued, uint32 issuedSeed, ReplayVerdict & verdict);
+
+public:
+	ReplayValidator();
+	void validate(const uint8 * data, int size, ReplayVerdict & verdict);
+	void validate(const uint8 * data, int size, uint32 issuedSeed, ReplayVerdict & verdict);
+};
+
+#endif
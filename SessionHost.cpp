@@ -0,0 +1,602 @@
+/**
+*  File:  SessionHost.cpp
+*
+*  Description:  This file contains the method implementations for the SessionHost
+*                class.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "SessionHost.h"
+#include <algorithm>  // For fill(), min() and max().
+
+const double HOST_SLOT_SECONDS = HOST_TICK_SECONDS / HOST_SLOTS;
+
+/**
+*  HostTask runs SessionHost::tickRange() as a ParallelTask.
+*/
+
+class HostTask : public ParallelTask
+{
+private:
+	SessionHost * host;
+	void (SessionHost::*range)(int begin, int end, int worker);
+
+public:
+	HostTask(SessionHost * sessionHost, void (SessionHost::*method)(int begin, int end, int worker))
+	{
+		host = sessionHost;
+		range = method;
+	}
+
+	void run(int begin, int end, int worker)
+	{
+		( host->*range )( begin, end, worker );
+	}
+};
+
+/**
+*  Function: SessionHost(int workers)
+*
+*  Purpose: This is the constructor for the SessionHost class.  The host starts
+*           out with no sessions.  Its clock starts on the first call to run().
+*
+*  Inputs: workers - The number of threads to tick the sessions on, counting the
+*                    one that calls run(), or 0 for one per processor.
+*/
+
+SessionHost::SessionHost(int workers)
+           : pool( workers ), slots( HOST_SLOTS )
+{
+	lateness.resize( pool.getThreadCount(), vector <int64>( HOST_LATENESS_BUCKETS ) );
+	latest.resize( pool.getThreadCount() );
+	stopped.resize( pool.getThreadCount() );
+
+	nextSlot = 0;
+	nextDue = -1.0;
+	runningSlot = 0;
+	runningDue = 0.0;
+
+	clearStats();
+}
+
+/**
+*  Function: ~SessionHost()
+*
+*  Purpose: This is the destructor for the SessionHost class.  It deletes the
+*           sessions.
+*/
+
+SessionHost::~SessionHost()
+{
+	for ( int i = 0; i < (int)sessions.size(); i++ )
+	{
+		delete sessions[i];
+	}
+}
+
+/**
+*  Function: addSession(uint32 seed)
+*
+*  Purpose: This function adds a new game to the host, waiting on the first
+*           level's start screen.
+*
+*  Inputs: seed - Picks the seed of every level in the game.
+*
+*  Returns: The session's number, counting from 0.
+*/
+
+int SessionHost::addSession(uint32 seed)
+{
+	sessions.push_back( new GameSession( seed ) );
+	slotOf.push_back( -1 );
+	slotPosition.push_back( 0 );
+
+	return (int)sessions.size() - 1;
+}
+
+/**
+*  Function: getSessionCount()
+*
+*  Returns: The number of sessions on the host.
+*/
+
+int SessionHost::getSessionCount() const
+{
+	return (int)sessions.size();
+}
+
+/**
+*  Function: getSession(int id)
+*
+*  Returns: A session, for showing its screen and score.
+*/
+
+const GameSession & SessionHost::getSession(int id) const
+{
+	return *sessions[id];
+}
+
+/**
+*  Function: press(int id)
+*
+*  Purpose: This function presses the button on a session's cut-screen: Play,
+*           Retry or Play Again.  If the session is now playing, it is put in
+*           the slot with the fewest sessions, so its first tick is at most one
+*           tick period away.
+*
+*  Inputs: id - The session.
+*
+*  Returns: True if the session was on a cut-screen.
+*/
+
+bool SessionHost::press(int id)
+{
+	GameSession & session = *sessions[id];
+
+	switch ( session.getScreen() )
+	{
+	case SCREEN_LEVEL_START:
+		session.play();
+		break;
+
+	case SCREEN_RETRY:
+		session.retry();
+		break;
+
+	case SCREEN_WON_GAME:
+		session.playAgain();
+		break;
+
+	default:
+		return false;
+	}
+
+	if ( session.getScreen() == SCREEN_PLAYING && slotOf[id] == -1 )
+	{
+		schedule( id );
+	}
+
+	return true;
+}
+
+/**
+*  Function: click(int id, int x, int y)
+*
+*  Purpose: This function passes a player's mouse click to a session.  It is
+*           taken on the session's next tick.
+*
+*  Inputs: id - The session.
+*          x, y - Where the player clicked.
+*
+*  Returns: True if the click was taken (see GameSession::click()).
+*/
+
+bool SessionHost::click(int id, int x, int y)
+{
+	return sessions[id]->click( x, y );
+}
+
+/**
+*  Function: schedule(int id)
+*
+*  Purpose: This function puts a session that has started playing in the slot
+*           with the fewest sessions.
+*
+*  Inputs: id - The session.
+*/
+
+void SessionHost::schedule(int id)
+{
+	int slot = 0;
+
+	for ( int i = 1; i < HOST_SLOTS; i++ )
+	{
+		if ( slots[i].size() < slots[slot].size() )
+		{
+			slot = i;
+		}
+	}
+
+	slotOf[id] = slot;
+	slotPosition[id] = (int)slots[slot].size();
+	slots[slot].push_back( id );
+}
+
+/**
+*  Function: unschedule(int id)
+*
+*  Purpose: This function takes a session that has stopped playing out of its
+*           slot.  The last session in the slot takes its place.
+*
+*  Inputs: id - The session.
+*/
+
+void SessionHost::unschedule(int id)
+{
+	vector <int> & slot = slots[slotOf[id]];
+	int last = slot.back();
+
+	slot[slotPosition[id]] = last;
+	slotPosition[last] = slotPosition[id];
+	slot.pop_back();
+
+	slotOf[id] = -1;
+}
+
+/**
+*  Function: run()
+*
+*  Purpose: This function ticks every slot that has come due since the last
+*           call, in order.  If the host is more than HOST_MAX_LAG behind, the
+*           slots it missed are skipped, and their ticks are counted as missed.
+*
+*  Returns: The time the next slot is due, on the getSeconds() clock.  The
+*           caller should sleep until then.
+*/
+
+double SessionHost::run()
+{
+	double now = getSeconds();
+	bool woke = false;
+
+	idled.clear();
+
+	if ( nextDue < 0.0 )
+	{
+		nextDue = now;
+	}
+
+	if ( now - nextDue > HOST_MAX_LAG )
+	{
+		int64 skipped = (int64)( ( now - nextDue ) / HOST_SLOT_SECONDS );
+
+		missedTicks += skipped / HOST_SLOTS * getPlayingCount();
+
+		for ( int i = 0; i < (int)( skipped % HOST_SLOTS ); i++ )
+		{
+			missedTicks += (int64)slots[( nextSlot + i ) % HOST_SLOTS].size();
+		}
+
+		nextSlot = (int)( ( nextSlot + skipped ) % HOST_SLOTS );
+		nextDue += (double)skipped * HOST_SLOT_SECONDS;
+	}
+
+	while ( nextDue <= now )
+	{
+		if ( slots[nextSlot].empty() == false )
+		{
+			runSlot( nextSlot, nextDue );
+			woke = true;
+		}
+
+		nextSlot = ( nextSlot + 1 ) % HOST_SLOTS;
+		nextDue += HOST_SLOT_SECONDS;
+	}
+
+	if ( woke )
+	{
+		wakeups++;
+	}
+
+	return nextDue;
+}
+
+/**
+*  Function: runSlot(int slot, double due)
+*
+*  Purpose: This function ticks every session in a slot, split between the
+*           workers in chunks of HOST_BATCH, then takes the sessions that
+*           stopped playing out of the slot.
+*
+*  Inputs: slot - The slot.
+*          due - When the slot was due.
+*/
+
+void SessionHost::runSlot(int slot, double due)
+{
+	int count = (int)slots[slot].size();
+
+	runningSlot = slot;
+	runningDue = due;
+
+	HostTask task( this, & SessionHost::tickRange );
+	pool.parallelFor( count, HOST_BATCH, task );
+
+	tickCount += count;
+	batches += ( count + HOST_BATCH - 1 ) / HOST_BATCH;
+
+	for ( int w = 0; w < (int)stopped.size(); w++ )
+	{
+		for ( int i = 0; i < (int)stopped[w].size(); i++ )
+		{
+			unschedule( stopped[w][i] );
+			idled.push_back( stopped[w][i] );
+		}
+
+		stopped[w].clear();
+	}
+}
+
+/**
+*  Function: tickRange(int begin, int end, int worker)
+*
+*  Purpose: This function ticks a chunk of the running slot's sessions, and
+*           notes how late each tick started and which sessions stopped playing.
+*           Each session is only touched by the worker ticking it.
+*
+*  Inputs: begin, end - The sessions [begin, end) of the slot.
+*          worker - The worker running the chunk.
+*/
+
+void SessionHost::tickRange(int begin, int end, int worker)
+{
+	const vector <int> & slot = slots[runningSlot];
+
+	for ( int i = begin; i < end; i++ )
+	{
+		GameSession & session = *sessions[slot[i]];
+
+		countLateness( worker, getSeconds() - runningDue );
+
+		session.tick();
+
+		if ( session.getScreen() != SCREEN_PLAYING )
+		{
+			stopped[worker].push_back( slot[i] );
+		}
+	}
+}
+
+/**
+*  Function: latenessBucket(uint32 micros)
+*
+*  Purpose: This function finds the histogram bucket for a lateness.  Below 16
+*           microseconds each one has a bucket of its own.  From there on, each
+*           doubling is split into 8 buckets.
+*
+*  Inputs: micros - The lateness in microseconds, below 2^31.
+*
+*  Returns: The bucket, from 0 to HOST_LATENESS_BUCKETS - 1.
+*/
+
+static int latenessBucket(uint32 micros)
+{
+	if ( micros < 16 )
+	{
+		return (int)micros;
+	}
+
+	int bit = 4;
+
+	while ( ( micros >> ( bit + 1 ) ) != 0 )
+	{
+		bit++;
+	}
+
+	return 16 + ( bit - 4 ) * 8 + (int)( ( micros >> ( bit - 3 ) ) & 7 );
+}
+
+/**
+*  Function: bucketMiddle(int bucket)
+*
+*  Returns: The lateness in the middle of a histogram bucket, in seconds.
+*/
+
+static double bucketMiddle(int bucket)
+{
+	if ( bucket < 16 )
+	{
+		return ( (double)bucket + 0.5 ) * 1e-6;
+	}
+
+	int bit = ( bucket - 16 ) / 8 + 4;
+	double width = (double)( 1 << ( bit - 3 ) );
+	double lowest = (double)( 8 + ( bucket - 16 ) % 8 ) * width;
+
+	return ( lowest + width * 0.5 ) * 1e-6;
+}
+
+/**
+*  Function: countLateness(int worker, double seconds)
+*
+*  Purpose: This function counts how late a tick started in the worker's
+*           histogram, and keeps the latest one exactly.
+*
+*  Inputs: worker - The worker that ran the tick.
+*          seconds - How late it started.
+*/
+
+void SessionHost::countLateness(int worker, double seconds)
+{
+	if ( seconds < 0.0 )
+	{
+		seconds = 0.0;
+	}
+
+	double micros = seconds * 1e6;
+
+	if ( micros > 2147483647.0 )
+	{
+		micros = 2147483647.0;
+	}
+
+	lateness[worker][latenessBucket( (uint32)micros )]++;
+
+	if ( seconds > latest[worker] )
+	{
+		latest[worker] = seconds;
+	}
+}
+
+/**
+*  Function: getIdled()
+*
+*  Returns: The sessions that stopped playing during the last run(), and are
+*           now waiting on a cut-screen.
+*/
+
+const vector <int> & SessionHost::getIdled() const
+{
+	return idled;
+}
+
+/**
+*  Function: getPlayingCount()
+*
+*  Returns: The number of sessions that are playing, and so are being ticked.
+*/
+
+int SessionHost::getPlayingCount() const
+{
+	int count = 0;
+
+	for ( int i = 0; i < HOST_SLOTS; i++ )
+	{
+		count += (int)slots[i].size();
+	}
+
+	return count;
+}
+
+/**
+*  Function: getThreadCount()
+*
+*  Returns: The number of threads the sessions are ticked on.
+*/
+
+int SessionHost::getThreadCount() const
+{
+	return pool.getThreadCount();
+}
+
+/**
+*  Function: getTickCount()
+*
+*  Returns: The number of session ticks since the last clearStats().
+*/
+
+int64 SessionHost::getTickCount() const
+{
+	return tickCount;
+}
+
+/**
+*  Function: getMissedTicks()
+*
+*  Returns: The number of session ticks skipped for being more than HOST_MAX_LAG
+*           behind, since the last clearStats().
+*/
+
+int64 SessionHost::getMissedTicks() const
+{
+	return missedTicks;
+}
+
+/**
+*  Function: getWakeups()
+*
+*  Returns: The number of calls to run() that ticked at least one session, since
+*           the last clearStats().
+*/
+
+int64 SessionHost::getWakeups() const
+{
+	return wakeups;
+}
+
+/**
+*  Function: getBatches()
+*
+*  Returns: The number of chunks of sessions handed to the workers, since the
+*           last clearStats().
+*/
+
+int64 SessionHost::getBatches() const
+{
+	return batches;
+}
+
+/**
+*  Function: getLateness(double percentile)
+*
+*  Purpose: This function finds how late the ticks since the last clearStats()
+*           started, against the time their slot was due.  It is read from the
+*           workers' histograms, to the middle of the bucket it falls in, except
+*           for the latest, which is exact.
+*
+*  Inputs: percentile - From 0 to 100.  50 is the median and 100 the latest.
+*
+*  Returns: The lateness in seconds, or 0 if there have been no ticks.
+*/
+
+double SessionHost::getLateness(double percentile) const
+{
+	vector <int64> counts( HOST_LATENESS_BUCKETS );
+	int64 total = 0;
+	double latestTick = 0.0;
+
+	for ( int w = 0; w < (int)lateness.size(); w++ )
+	{
+		for ( int i = 0; i < HOST_LATENESS_BUCKETS; i++ )
+		{
+			counts[i] += lateness[w][i];
+			total += lateness[w][i];
+		}
+
+		latestTick = max( latestTick, latest[w] );
+	}
+
+	if ( total == 0 )
+	{
+		return 0.0;
+	}
+
+	if ( percentile >= 100.0 )
+	{
+		return latestTick;
+	}
+	else if ( percentile < 0.0 )
+	{
+		percentile = 0.0;
+	}
+
+	// The same tick a sorted list would give: index 0 is the earliest.
+
+	int64 index = (int64)( percentile / 100.0 * (double)( total - 1 ) + 0.5 );
+	int64 seen = 0;
+
+	for ( int i = 0; i < HOST_LATENESS_BUCKETS; i++ )
+	{
+		seen += counts[i];
+
+		if ( seen > index )
+		{
+			return min( bucketMiddle( i ), latestTick );
+		}
+	}
+
+	return latestTick;
+}
+
+/**
+*  Function: clearStats()
+*
+*  Purpose: This function starts the counts and the lateness of the ticks over.
+*/
+
+void SessionHost::clearStats()
+{
+	for ( int w = 0; w < (int)lateness.size(); w++ )
+	{
+		fill( lateness[w].begin(), lateness[w].end(), (int64)0 );
+		latest[w] = 0.0;
+	}
+
+	tickCount = 0;
+	missedTicks = 0;
+	wakeups = 0;
+	batches = 0;
+}
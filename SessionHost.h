@@ -0,0 +1,103 @@
+/**
+*  File:  SessionHost.h
+*
+*  Description:  This header file contains the SessionHost class, which plays
+*                thousands of GameSessions at once in one process, each ticking
+*                at REFRESH_RATE as if it had a window of its own, on a fixed
+*                WorkerPool.
+*
+*                Each tick period is split into HOST_SLOTS due times.  A session
+*                that is playing sits in one slot, and is ticked each time that
+*                slot comes due.  run() takes every slot that is due, and ticks
+*                its sessions with parallelFor() in chunks of HOST_BATCH, so each
+*                wakeup hands every worker a run of sessions to get through
+*                instead of one session at a time.  New sessions go in the slot
+*                with the fewest, which keeps the slots even.
+*
+*                A session on a cut-screen is waiting for a button, so it is taken
+*                out of its slot and costs nothing until press() starts it playing
+*                again.  The sessions that stopped playing during a run() are in
+*                getIdled() afterwards, so whatever is driving them (players on
+*                the network, or the bots of the host command) can tell.
+*
+*                The host measures how late each tick starts, against the time
+*                its slot was due.  When it falls more than HOST_MAX_LAG behind,
+*                it skips the slots it missed instead of trying to catch up, and
+*                counts the ticks it dropped.  The lateness is counted in a
+*                histogram per worker, of HOST_LATENESS_BUCKETS buckets that are
+*                exact up to 16 microseconds and then 8 to each doubling, so
+*                the percentiles are within about 6% and the host's memory
+*                stays the same however long it runs.
+*
+*                Nothing here is thread-safe: press(), click() and run() must be
+*                called from the same thread.  Sessions must be started through
+*                press(), not with their own play(), so that the host schedules
+*                them.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SESSION_HOST_H_
+#define SESSION_HOST_H_
+
+#include "GameSession.h"
+
+const int HOST_SLOTS = 16;              // Due times per tick period.
+const int HOST_BATCH = 16;              // Sessions in each chunk handed to a worker.
+const double HOST_MAX_LAG = 0.25;       // Seconds behind before the host skips slots.
+const double HOST_TICK_SECONDS = 1.0 / REFRESH_RATE;
+const int HOST_LATENESS_BUCKETS = 232;  // Lateness histogram buckets, to 2^31 microseconds.
+
+class SessionHost
+{
+private:
+	WorkerPool pool;
+	vector <GameSession *> sessions;
+	vector <int> slotOf;                 // The slot each session is in, or -1 while it is idle.
+	vector <int> slotPosition;           // Where in its slot's list the session is.
+	vector < vector <int> > slots;
+	int nextSlot;
+	double nextDue;                      // When nextSlot is due.
+	int runningSlot;                     // The slot tickRange() is ticking, and when it was due.
+	double runningDue;
+	vector < vector <int64> > lateness;  // Ticks in each lateness bucket, per worker.
+	vector <double> latest;              // The latest tick, in seconds, per worker.
+	vector < vector <int> > stopped;     // Sessions that stopped playing in runSlot(), per worker.
+	vector <int> idled;
+	int64 tickCount;
+	int64 missedTicks;
+	int64 wakeups;
+	int64 batches;
+
+	SessionHost(const SessionHost &);
+	SessionHost & operator=(const SessionHost &);
+
+	void schedule(int id);
+	void unschedule(int id);
+	void runSlot(int slot, double due);
+	void tickRange(int begin, int end, int worker);
+	void countLateness(int worker, double seconds);
+
+public:
+	SessionHost(int workers);
+	~SessionHost();
+	int addSession(uint32 seed);
+	int getSessionCount() const;
+	const GameSession & getSession(int id) const;
+	bool press(int id);
+	bool click(int id, int x, int y);
+	double run();
+	const vector <int> & getIdled() const;
+	int getPlayingCount() const;
+	int getThreadCount() const;
+	int64 getTickCount() const;
+	int64 getMissedTicks() const;
+	int64 getWakeups() const;
+	int64 getBatches() const;
+	double getLateness(double percentile) const;
+	void clearStats();
+};
+
+#endif
@@ -0,0 +1,185 @@
+/**
+*  File:  Simd.h
+*
+*  Description:  This header file wraps the handful of 4-wide SIMD operations used by
+*                BatchSimulation and SoftwareRenderer.  On x86 they map straight
+*                onto SSE2 intrinsics (every CPU that runs DirectX 9 games has
+*                SSE2).  Elsewhere a plain C++ version with the same results is
+*                used, so the code using them only has to be written once.
+*
+*                vLoad() and vStore() need 16-byte aligned addresses; vLoadU() and
+*                vStoreU() work with any address.
+*
+*                Comparisons return lane masks: every bit set (-1) where the
+*                comparison is true, and 0 where it is false.
+*
+*                The vshort functions (ending in 16) work on eight 16-bit lanes
+*                instead of four 32-bit ones.  Their adds and subtracts saturate
+*                instead of wrapping around, except for vAddWrap16() and
+*                vMulLow16(), which keep the low 16 bits as they are.
+*
+*                The byte functions are for blending pixels: vWidenLowBytes() and
+*                vWidenHighBytes() spread the bytes of two of a vint's four
+*                32-bit pixels over a vshort's eight lanes, one channel to a
+*                lane, and vNarrowBytes() packs them back.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SIMD_H_
+#define SIMD_H_
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#define PRISMS_SSE2
+#endif
+
+#ifdef PRISMS_SSE2
+
+#include <emmintrin.h>
+
+typedef __m128i vint;
+typedef __m128 vfloat;
+
+inline vint vLoad(const int * p) { return _mm_load_si128( (const __m128i *)p ); }
+inline void vStore(int * p, vint a) { _mm_store_si128( (__m128i *)p, a ); }
+inline vint vLoadU(const int * p) { return _mm_loadu_si128( (const __m128i *)p ); }
+inline void vStoreU(int * p, vint a) { _mm_storeu_si128( (__m128i *)p, a ); }
+inline vint vSet(int a) { return _mm_set1_epi32( a ); }
+inline vint vAdd(vint a, vint b) { return _mm_add_epi32( a, b ); }
+inline vint vSub(vint a, vint b) { return _mm_sub_epi32( a, b ); }
+inline vint vAnd(vint a, vint b) { return _mm_and_si128( a, b ); }
+inline vint vAndNot(vint a, vint b) { return _mm_andnot_si128( a, b ); }  // ~a & b
+inline vint vOr(vint a, vint b) { return _mm_or_si128( a, b ); }
+inline vint vCmpEq(vint a, vint b) { return _mm_cmpeq_epi32( a, b ); }
+inline vint vCmpGt(vint a, vint b) { return _mm_cmpgt_epi32( a, b ); }
+inline vint vCmpLt(vint a, vint b) { return _mm_cmplt_epi32( a, b ); }
+inline vint vSelect(vint mask, vint a, vint b) { return _mm_or_si128( _mm_and_si128( mask, a ), _mm_andnot_si128( mask, b ) ); }
+inline bool vAny(vint mask) { return _mm_movemask_epi8( mask ) != 0; }
+
+inline vfloat vLoadF(const float * p) { return _mm_load_ps( p ); }
+inline void vStoreF(float * p, vfloat a) { _mm_store_ps( p, a ); }
+inline vfloat vSetF(float a) { return _mm_set1_ps( a ); }
+inline vfloat vAddF(vfloat a, vfloat b) { return _mm_add_ps( a, b ); }
+inline vfloat vSubF(vfloat a, vfloat b) { return _mm_sub_ps( a, b ); }
+inline vfloat vMulF(vfloat a, vfloat b) { return _mm_mul_ps( a, b ); }
+inline vfloat vMaskF(vint mask, vfloat a) { return _mm_and_ps( _mm_castsi128_ps( mask ), a ); }
+inline vfloat vFlipSignF(vint mask, vfloat a) { return _mm_xor_ps( a, _mm_and_ps( _mm_castsi128_ps( mask ), _mm_set1_ps( -0.0f ) ) ); }
+inline vfloat vToFloat(vint a) { return _mm_cvtepi32_ps( a ); }
+inline vint vTruncate(vfloat a) { return _mm_cvttps_epi32( a ); }
+inline vint vCmpLeF(vfloat a, vfloat b) { return _mm_castps_si128( _mm_cmple_ps( a, b ) ); }
+inline vfloat vSetF4(float a, float b, float c, float d) { return _mm_setr_ps( a, b, c, d ); }  // a in the first lane.
+inline vfloat vMinF(vfloat a, vfloat b) { return _mm_min_ps( a, b ); }
+inline vfloat vMaxF(vfloat a, vfloat b) { return _mm_max_ps( a, b ); }
+inline vfloat vSqrtF(vfloat a) { return _mm_sqrt_ps( a ); }
+inline vint vShiftLeft(vint a, int bits) { return _mm_sll_epi32( a, _mm_cvtsi32_si128( bits ) ); }
+
+typedef __m128i vshort;
+
+inline vshort vLoad16(const short * p) { return _mm_load_si128( (const __m128i *)p ); }
+inline vshort vLoadU16(const short * p) { return _mm_loadu_si128( (const __m128i *)p ); }
+inline void vStore16(short * p, vshort a) { _mm_store_si128( (__m128i *)p, a ); }
+inline vshort vSet16(short a) { return _mm_set1_epi16( a ); }
+inline vshort vAdd16(vshort a, vshort b) { return _mm_adds_epi16( a, b ); }
+inline vshort vSub16(vshort a, vshort b) { return _mm_subs_epi16( a, b ); }
+inline vshort vMax16(vshort a, vshort b) { return _mm_max_epi16( a, b ); }
+inline vshort vAnd16(vshort a, vshort b) { return _mm_and_si128( a, b ); }
+inline vshort vAndNot16(vshort a, vshort b) { return _mm_andnot_si128( a, b ); }  // ~a & b
+inline vshort vOr16(vshort a, vshort b) { return _mm_or_si128( a, b ); }
+inline vshort vCmpGt16(vshort a, vshort b) { return _mm_cmpgt_epi16( a, b ); }
+inline bool vAny16(vshort mask) { return _mm_movemask_epi8( mask ) != 0; }
+inline vshort vPack16(vint low, vint high) { return _mm_packs_epi32( low, high ); }
+inline vint vWidenLow16(vshort a) { return _mm_srai_epi32( _mm_unpacklo_epi16( a, a ), 16 ); }
+inline vint vWidenHigh16(vshort a) { return _mm_srai_epi32( _mm_unpackhi_epi16( a, a ), 16 ); }
+inline vshort vAddWrap16(vshort a, vshort b) { return _mm_add_epi16( a, b ); }
+inline vshort vMulLow16(vshort a, vshort b) { return _mm_mullo_epi16( a, b ); }
+inline vshort vShiftRight16(vshort a, int bits) { return _mm_srl_epi16( a, _mm_cvtsi32_si128( bits ) ); }  // Unsigned.
+inline vshort vSpreadLast16(vshort a) { return _mm_shufflehi_epi16( _mm_shufflelo_epi16( a, 0xff ), 0xff ); }  // Lanes 3 and 7 to their groups of 4.
+
+inline vshort vWidenLowBytes(vint a) { return _mm_unpacklo_epi8( a, _mm_setzero_si128() ); }
+inline vshort vWidenHighBytes(vint a) { return _mm_unpackhi_epi8( a, _mm_setzero_si128() ); }
+inline vint vNarrowBytes(vshort low, vshort high) { return _mm_packus_epi16( low, high ); }
+
+#else
+
+#include <math.h>  // For sqrtf().
+
+struct vint { int v[4]; };
+struct vfloat { float v[4]; };
+
+inline vint vLoad(const int * p) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = p[i]; return r; }
+inline void vStore(int * p, vint a) { for ( int i = 0; i < 4; i++ ) p[i] = a.v[i]; }
+inline vint vLoadU(const int * p) { return vLoad( p ); }
+inline void vStoreU(int * p, vint a) { vStore( p, a ); }
+inline vint vSet(int a) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = a; return r; }
+inline vint vAdd(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] += b.v[i]; return a; }
+inline vint vSub(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] -= b.v[i]; return a; }
+inline vint vAnd(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] &= b.v[i]; return a; }
+inline vint vAndNot(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] = ~a.v[i] & b.v[i]; return a; }
+inline vint vOr(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] |= b.v[i]; return a; }
+inline vint vCmpEq(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] = a.v[i] == b.v[i] ? -1 : 0; return a; }
+inline vint vCmpGt(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] = a.v[i] > b.v[i] ? -1 : 0; return a; }
+inline vint vCmpLt(vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] = a.v[i] < b.v[i] ? -1 : 0; return a; }
+inline vint vSelect(vint mask, vint a, vint b) { for ( int i = 0; i < 4; i++ ) a.v[i] = ( mask.v[i] & a.v[i] ) | ( ~mask.v[i] & b.v[i] ); return a; }
+inline bool vAny(vint mask) { return ( mask.v[0] | mask.v[1] | mask.v[2] | mask.v[3] ) != 0; }
+
+inline vfloat vLoadF(const float * p) { vfloat r; for ( int i = 0; i < 4; i++ ) r.v[i] = p[i]; return r; }
+inline void vStoreF(float * p, vfloat a) { for ( int i = 0; i < 4; i++ ) p[i] = a.v[i]; }
+inline vfloat vSetF(float a) { vfloat r; for ( int i = 0; i < 4; i++ ) r.v[i] = a; return r; }
+inline vfloat vAddF(vfloat a, vfloat b) { for ( int i = 0; i < 4; i++ ) a.v[i] += b.v[i]; return a; }
+inline vfloat vSubF(vfloat a, vfloat b) { for ( int i = 0; i < 4; i++ ) a.v[i] -= b.v[i]; return a; }
+inline vfloat vMulF(vfloat a, vfloat b) { for ( int i = 0; i < 4; i++ ) a.v[i] *= b.v[i]; return a; }
+inline vfloat vMaskF(vint mask, vfloat a) { for ( int i = 0; i < 4; i++ ) a.v[i] = mask.v[i] ? a.v[i] : 0.0f; return a; }
+inline vfloat vFlipSignF(vint mask, vfloat a) { for ( int i = 0; i < 4; i++ ) a.v[i] = mask.v[i] ? -a.v[i] : a.v[i]; return a; }
+inline vfloat vToFloat(vint a) { vfloat r; for ( int i = 0; i < 4; i++ ) r.v[i] = (float)a.v[i]; return r; }
+inline vint vTruncate(vfloat a) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = (int)a.v[i]; return r; }
+inline vint vCmpLeF(vfloat a, vfloat b) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = a.v[i] <= b.v[i] ? -1 : 0; return r; }
+inline vfloat vSetF4(float a, float b, float c, float d) { vfloat r; r.v[0] = a; r.v[1] = b; r.v[2] = c; r.v[3] = d; return r; }
+inline vfloat vMinF(vfloat a, vfloat b) { for ( int i = 0; i < 4; i++ ) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline vfloat vMaxF(vfloat a, vfloat b) { for ( int i = 0; i < 4; i++ ) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline vfloat vSqrtF(vfloat a) { for ( int i = 0; i < 4; i++ ) a.v[i] = sqrtf( a.v[i] ); return a; }
+inline vint vShiftLeft(vint a, int bits) { for ( int i = 0; i < 4; i++ ) a.v[i] = (int)( (unsigned)a.v[i] << bits ); return a; }
+
+struct vshort { short v[8]; };
+
+inline short saturate16(int a) { return (short)( a > 32767 ? 32767 : ( a < -32768 ? -32768 : a ) ); }
+
+inline vshort vLoad16(const short * p) { vshort r; for ( int i = 0; i < 8; i++ ) r.v[i] = p[i]; return r; }
+inline vshort vLoadU16(const short * p) { return vLoad16( p ); }
+inline void vStore16(short * p, vshort a) { for ( int i = 0; i < 8; i++ ) p[i] = a.v[i]; }
+inline vshort vSet16(short a) { vshort r; for ( int i = 0; i < 8; i++ ) r.v[i] = a; return r; }
+inline vshort vAdd16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = saturate16( a.v[i] + b.v[i] ); return a; }
+inline vshort vSub16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = saturate16( a.v[i] - b.v[i] ); return a; }
+inline vshort vMax16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline vshort vAnd16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] &= b.v[i]; return a; }
+inline vshort vAndNot16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = (short)( ~a.v[i] & b.v[i] ); return a; }
+inline vshort vOr16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] |= b.v[i]; return a; }
+inline vshort vCmpGt16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = a.v[i] > b.v[i] ? -1 : 0; return a; }
+inline bool vAny16(vshort mask) { for ( int i = 0; i < 8; i++ ) if ( mask.v[i] ) return true; return false; }
+inline vshort vPack16(vint low, vint high) { vshort r; for ( int i = 0; i < 4; i++ ) { r.v[i] = saturate16( low.v[i] ); r.v[i+4] = saturate16( high.v[i] ); } return r; }
+inline vint vWidenLow16(vshort a) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = a.v[i]; return r; }
+inline vint vWidenHigh16(vshort a) { vint r; for ( int i = 0; i < 4; i++ ) r.v[i] = a.v[i+4]; return r; }
+inline vshort vAddWrap16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = (short)(unsigned short)( a.v[i] + b.v[i] ); return a; }
+inline vshort vMulLow16(vshort a, vshort b) { for ( int i = 0; i < 8; i++ ) a.v[i] = (short)(unsigned short)( (unsigned short)a.v[i] * (unsigned short)b.v[i] ); return a; }
+inline vshort vShiftRight16(vshort a, int bits) { for ( int i = 0; i < 8; i++ ) a.v[i] = (short)( (unsigned short)a.v[i] >> bits ); return a; }
+inline vshort vSpreadLast16(vshort a) { for ( int i = 0; i < 8; i++ ) a.v[i] = a.v[( i & 4 ) + 3]; return a; }
+
+inline vshort vWidenLowBytes(vint a) { vshort r; for ( int i = 0; i < 8; i++ ) r.v[i] = (short)( ( (unsigned)a.v[i/4] >> ( i%4 * 8 ) ) & 0xff ); return r; }
+inline vshort vWidenHighBytes(vint a) { vshort r; for ( int i = 0; i < 8; i++ ) r.v[i] = (short)( ( (unsigned)a.v[2 + i/4] >> ( i%4 * 8 ) ) & 0xff ); return r; }
+inline unsigned saturateByte(short a) { return a > 255 ? 255 : ( a < 0 ? 0 : a ); }
+inline vint vNarrowBytes(vshort low, vshort high)
+{
+	vint r;
+	for ( int i = 0; i < 4; i++ ) r.v[i] = 0;
+	for ( int i = 0; i < 8; i++ )
+	{
+		r.v[i/4] |= (int)( saturateByte( low.v[i] ) << ( i%4 * 8 ) );
+		r.v[2 + i/4] |= (int)( saturateByte( high.v[i] ) << ( i%4 * 8 ) );
+	}
+	return r;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,1140 @@
+/**
+*  File:  Simulation.cpp
+*
+*  Description:  This file contains the implementations for the level simulation,
+*                which holds the rules of the game.  GameSession plays every level
+*                of the game on it, and the tools play levels on it headless.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Simulation.h"
+#include "Profiler.h"
+#include <cmath>  // For sin().
+
+/**
+*  The heading table holds sin() for every whole degree.  It is built from the
+*  first quadrant only and mirrored, so that sin(360-d) is exactly -sin(d) and
+*  sin(180-d) is exactly sin(d).  Bouncing off a wall can then simply negate
+*  stepX or stepY and still land on the same value a table lookup would give.
+*/
+
+class HeadingTable
+{
+public:
+	float sine[360];
+
+	HeadingTable()
+	{
+		const double pi = 3.14159265358979323846;
+
+		for ( int d = 0; d <= 90; d++ )
+		{
+			sine[d] = (float)sin( d * pi / 180.0 );
+		}
+
+		sine[0] = 0.0f;
+		sine[90] = 1.0f;
+
+		for ( int d = 91; d <= 180; d++ )
+		{
+			sine[d] = sine[180-d];
+		}
+
+		for ( int d = 181; d < 360; d++ )
+		{
+			sine[d] = -sine[d-180];
+		}
+	}
+};
+
+static HeadingTable headingTable;
+
+const char * SIM_PHASE_NAMES[SIM_PHASE_COUNT] = { "click", "walls", "user pop", "pop", "move", "collide", "chain" };
+
+/**
+*  Function: SimConfig()
+*
+*  Purpose: This is the constructor for SimConfig.  It sets the game's normal sizes.
+*/
+
+SimConfig::SimConfig()
+{
+	arenaWidth = SCREEN_WIDTH;
+	arenaHeight = SCREEN_HEIGHT;
+	bubbleRadius = BUBBLE_RADIUS;
+	popExpansion = POP_EXPANSION;
+}
+
+/**
+*  Function: valid()
+*
+*  Returns: True if bubbles can be laid out with these sizes.  Like the game,
+*           generate() keeps each bubble 20 px away from the walls, so the arena
+*           must be at least that much bigger than a bubble.
+*/
+
+bool SimConfig::valid() const
+{
+	return bubbleRadius >= 1 && popExpansion >= 0 &&
+		   arenaWidth >= 2*bubbleRadius + 41 && arenaHeight >= 2*bubbleRadius + 41 &&
+		   arenaWidth <= 30000 && arenaHeight <= 30000;  // Keeps the 16-bit collision test in BatchSimulation exact.
+}
+
+/**
+*  Function: SimRandom(uint32 seed)
+*
+*  Purpose: This is the constructor for the SimRandom class.
+*
+*  Inputs: seed - The starting state.  The same seed always produces the
+*                 same sequence of numbers.
+*/
+
+SimRandom::SimRandom(uint32 seed)
+{
+	state = seed;
+}
+
+/**
+*  Function: next(int range)
+*
+*  Purpose: This function returns the next random number.  Like dbRND(), the
+*           result is between 0 and range, inclusive.
+*
+*  Inputs: range - The largest value that may be returned.
+*
+*  Returns: A random number from 0 to range.
+*/
+
+int SimRandom::next(int range)
+{
+	state = state * 1664525u + 1013904223u;
+
+	return (int)( ( state >> 8 ) % (uint32)( range + 1 ) );
+}
+
+/**
+*  Function: getState()
+*
+*  Returns: The generator's whole state.  A SimRandom made with it as the seed
+*           picks the same numbers from here on.
+*/
+
+uint32 SimRandom::getState() const
+{
+	return state;
+}
+
+/**
+*  Function: simHeadingStep(int degrees, float & stepX, float & stepY)
+*
+*  Purpose: This function finds how far dbMoveSprite( id, 1.0 ) moves a sprite
+*           facing the given angle.  DarkGDK measures angles clockwise from
+*           straight up, so a positive y step moves the sprite up the screen.
+*
+*  Inputs: degrees - The sprite's angle.  Values outside of 0-359 are wrapped.
+*          stepX - Set to the change in x.
+*          stepY - Set to the change in y.
+*/
+
+void simHeadingStep(int degrees, float & stepX, float & stepY)
+{
+	int d = degrees % 360;
+
+	if ( d < 0 )
+	{
+		d += 360;
+	}
+
+	stepX = headingTable.sine[d];
+	stepY = -headingTable.sine[(d+90) % 360];
+}
+
+/**
+*  Function: simInitBubble(SimBubble & b, int cX, int cY, int r, int expansion, int degrees, bool userBubble)
+*
+*  Purpose: This function puts a bubble into the state that the NormalBubble and
+*           UserBubble constructors leave it in.
+*
+*  Inputs: b - The bubble to set up.
+*          cX, cY - The center point.
+*          r - The starting radius.
+*          expansion - How much bigger than r the bubble grows when it pops.
+*          degrees - The starting heading.
+*          userBubble - True for the bubble created by the user's click.
+*/
+
+void simInitBubble(SimBubble & b, int cX, int cY, int r, int expansion, int degrees, bool userBubble)
+{
+	b.x = (float)cX;
+	b.y = (float)cY;
+	b.centerX = cX;
+	b.centerY = cY;
+	b.radius = r;
+	b.maxRadius = r + expansion;
+	b.degrees = degrees;
+	b.holdCounter = 0;
+	b.imageIndex = 0;
+	b.noteIndex = 0;
+	b.paused = false;
+	b.popping = false;
+	b.expanding = true;
+	b.holding = false;
+	b.contracting = false;
+	b.isUserBubble = userBubble;
+
+	simHeadingStep( degrees, b.stepX, b.stepY );
+}
+
+/**
+*  Function: simMove(SimBubble & b)
+*
+*  Purpose: This function moves the bubble one pixel along its heading unless
+*           it is paused.  The user bubble is paused from the start, so it never
+*           moves.
+*
+*  Inputs: b - The bubble to move.
+*/
+
+void simMove(SimBubble & b)
+{
+	if ( b.paused == false )
+	{
+		b.x += b.stepX;
+		b.y += b.stepY;
+
+		b.centerX = (int)b.x;
+		b.centerY = (int)b.y;
+	}
+}
+
+/**
+*  Function: simPop(SimBubble & b, int & currentPopping)
+*
+*  Purpose: This function takes a popping bubble one step through its pop: it
+*           expands to its maxRadius, holds there, then contracts to 0.
+*
+*  Inputs: b - The popping bubble.
+*          currentPopping - The level's count of popping bubbles.  It goes down
+*                           by one when the bubble finishes contracting.
+*/
+
+void simPop(SimBubble & b, int & currentPopping)
+{
+	if ( b.popping == true )
+	{
+		if ( b.radius == b.maxRadius )
+		{
+			b.expanding = false;
+			b.holding = true;
+		}
+
+		if ( b.expanding == true && b.radius < b.maxRadius )
+		{
+			simExpand( b );
+		}
+
+		if ( b.holding == true )
+		{
+			simHold( b );
+		}
+
+		if ( b.contracting == true && b.radius > 0 )
+		{
+			simContract( b, currentPopping );
+		}
+	}
+}
+
+/**
+*  Function: simExpand(SimBubble & b)
+*
+*  Purpose: This function grows the bubble by 1 pixel.
+*
+*  Inputs: b - The expanding bubble.
+*/
+
+void simExpand(SimBubble & b)
+{
+	b.radius++;
+}
+
+/**
+*  Function: simHold(SimBubble & b)
+*
+*  Purpose: This function counts the frames the bubble has held its maximum
+*           size, and starts it contracting after POP_HOLD_TICKS of them.
+*
+*  Inputs: b - The bubble holding its maximum size.
+*/
+
+void simHold(SimBubble & b)
+{
+	if ( b.holdCounter < POP_HOLD_TICKS )
+	{
+		b.holdCounter++;
+	}
+	else
+	{
+		b.holding = false;
+		b.contracting = true;
+	}
+}
+
+/**
+*  Function: simContract(SimBubble & b, int & currentPopping)
+*
+*  Purpose: This function shrinks the bubble by 1 pixel.  When a popping bubble
+*           reaches 0 it is done popping.
+*
+*  Inputs: b - The contracting bubble.
+*          currentPopping - Decremented when the bubble finishes popping.
+*/
+
+void simContract(SimBubble & b, int & currentPopping)
+{
+	if ( b.radius > 0 )
+	{
+		b.radius--;
+	}
+
+	if ( b.radius == 0 && b.popping == true )
+	{
+		b.popping = false;
+		currentPopping--;
+	}
+}
+
+/**
+*  Function: simBoundaryCollisionCheck(SimBubble & b, int width, int height)
+*
+*  Purpose: This function turns a bubble that is hitting a wall.  Bouncing off the left
+*           or right wall turns the bubble to 360 minus its heading, which only
+*           flips the sign of stepX.  The top and bottom walls turn it to 180 minus
+*           its heading, which only flips the sign of stepY.
+*
+*  Inputs: b - The bubble being tested against the walls.
+*          width, height - The size of the arena.
+*/
+
+void simBoundaryCollisionCheck(SimBubble & b, int width, int height)
+{
+	if ( b.centerX + b.radius >= width )  // Hitting right wall.
+	{
+		b.degrees = 360 - b.degrees;
+		b.stepX = -b.stepX;
+	}
+
+	if ( b.centerX - b.radius <= 0 )  // Hitting left wall.
+	{
+		b.degrees = 360 - b.degrees;
+		b.stepX = -b.stepX;
+	}
+
+	if ( b.centerY - b.radius <= 0 )  // Hitting top wall.
+	{
+		b.degrees = 180 - b.degrees;
+		b.stepY = -b.stepY;
+	}
+
+	if ( b.centerY + b.radius >= height )  // Hitting bottom wall.
+	{
+		b.degrees = 180 - b.degrees;
+		b.stepY = -b.stepY;
+	}
+}
+
+/**
+*  Function: simBubbleCollisionCheck(const SimBubble & b1, const SimBubble & b2)
+*
+*  Purpose: This function checks if two bubbles are touching.  The centers and radii
+*           are whole numbers, so comparing the squared distance with the squared
+*           sum of the radii gives the same answer as taking the square root,
+*           without the rounding.
+*
+*  Inputs: b1 - The first bubble to be compared.
+*          b2 - The second bubble to be compared.
+*
+*  Returns: True if b1 intersects with b2.  False otherwise.
+*/
+
+bool simBubbleCollisionCheck(const SimBubble & b1, const SimBubble & b2)
+{
+	int totalRadius = b1.radius + b2.radius;
+
+	int x = b1.centerX - b2.centerX;
+	int y = b1.centerY - b2.centerY;
+
+	return x*x + y*y <= totalRadius*totalRadius;
+}
+
+/**
+*  Function: LevelSimulation()
+*
+*  Purpose: This is the constructor for the LevelSimulation class.  The level is
+*           empty until generate() is called.
+*/
+
+LevelSimulation::LevelSimulation()
+{
+	pool = NULL;
+	checksums = NULL;
+	generate( 0, 0 );
+}
+
+/**
+*  Function: setWorkerPool(WorkerPool * workerPool)
+*
+*  Purpose: This function chooses the threads the level runs on.  With a pool,
+*           the bounce, pop, move and collision steps are split up between its
+*           workers.  The pool is kept when a new level is generated.
+*
+*  Inputs: workerPool - The pool to use, or NULL to run on the calling thread.
+*/
+
+void LevelSimulation::setWorkerPool(WorkerPool * workerPool)
+{
+	pool = workerPool;
+}
+
+/**
+*  Function: setChecksumStream(ChecksumStream * stream)
+*
+*  Purpose: This function starts or stops recording a checksum of the level's
+*           state after every frame (see Checksum.h).  The stream is kept when
+*           a new level is generated.
+*
+*  Inputs: stream - The stream to add to, or NULL to stop recording.
+*/
+
+void LevelSimulation::setChecksumStream(ChecksumStream * stream)
+{
+	checksums = stream;
+}
+
+/**
+*  Function: setConfig(const SimConfig & simConfig)
+*
+*  Purpose: This function changes the arena and bubble sizes.  It takes effect
+*           the next time generate() is called.
+*
+*  Inputs: simConfig - The new sizes.  simConfig.valid() must be true.
+*/
+
+void LevelSimulation::setConfig(const SimConfig & simConfig)
+{
+	config = simConfig;
+}
+
+/**
+*  Function: getConfig()
+*
+*  Returns: The arena and bubble sizes.
+*/
+
+const SimConfig & LevelSimulation::getConfig() const
+{
+	return config;
+}
+
+/**
+*  Function: generate(uint32 seed, int bubbleCount)
+*
+*  Purpose: This function lays out a new level: each bubble gets a random position
+*           inside the screen, a random heading from 30-340 degrees, a shuffled image
+*           and a random note.
+*
+*  Inputs: seed - The seed for the layout.
+*          bubbleCount - The number of normal bubbles.
+*/
+
+void LevelSimulation::generate(uint32 seed, int bubbleCount)
+{
+	SimRandom random( seed );
+
+	int imageIndexes[BUBBLE_IMAGE_COUNT];
+
+	for ( int i = 0; i < BUBBLE_IMAGE_COUNT; i++ )
+	{
+		imageIndexes[i] = i;
+	}
+
+	for ( int i = 0; i < BUBBLE_IMAGE_COUNT; i++ )  // Same shuffle as shuffle() in Prisms.cpp uses for the notes.
+	{
+		int randomIndex = random.next( BUBBLE_IMAGE_COUNT-1 );
+		int temp = imageIndexes[i];
+		imageIndexes[i] = imageIndexes[randomIndex];
+		imageIndexes[randomIndex] = temp;
+	}
+
+	bubbles.clear();
+	bubbles.reserve( bubbleCount+1 );  // Leave room for the user bubble.
+
+	int radius = config.bubbleRadius;
+
+	for ( int i = 0; i < bubbleCount; i++ )
+	{
+		SimBubble b;
+
+		int centerX = random.next( (config.arenaWidth-40) - 2*radius ) + radius + 5;
+		int centerY = random.next( (config.arenaHeight-40) - 2*radius ) + radius + 5;
+		int degrees = random.next( 310 ) + 30;
+
+		simInitBubble( b, centerX, centerY, radius, config.popExpansion, degrees, false );
+
+		b.imageIndex = imageIndexes[i % BUBBLE_IMAGE_COUNT];
+		b.noteIndex = random.next( NOTE_COUNT-1 );
+
+		bubbles.push_back( b );
+	}
+
+	restart();
+}
+
+/**
+*  Function: setBubbles(const vector <SimBubble> & layout)
+*
+*  Purpose: This function starts a new level with bubbles that were laid out by
+*           the caller instead of by generate().  The benchmarks use it to play
+*           the same hand-made layouts every time.
+*
+*  Inputs: layout - The normal bubbles, set up with simInitBubble().  They must
+*                   fit inside the arena of the current config.
+*/
+
+void LevelSimulation::setBubbles(const vector <SimBubble> & layout)
+{
+	bubbles.clear();
+	bubbles.reserve( layout.size()+1 );  // Leave room for the user bubble.
+	bubbles.insert( bubbles.end(), layout.begin(), layout.end() );
+
+	restart();
+}
+
+/**
+*  Function: setLayout(const SimLayoutBubble * layout, int count)
+*
+*  Purpose: This function starts a new level from a layout made earlier, such as
+*           one from a level pack.  A layout taken from the bubbles generate()
+*           laid out plays exactly the same as generate() with the same seed.
+*           Once the level has room for this many bubbles nothing is allocated,
+*           so a level from a memory-mapped pack starts without any parsing or
+*           allocation.
+*
+*  Inputs: layout - The normal bubbles.  They must fit inside the arena of the
+*                   current config.
+*          count - The number of bubbles.
+*/
+
+void LevelSimulation::setLayout(const SimLayoutBubble * layout, int count)
+{
+	if ( (int)bubbles.capacity() < count+1 )
+	{
+		bubbles.reserve( count+1 );  // Leave room for the user bubble.
+	}
+
+	bubbles.resize( count );
+
+	for ( int i = 0; i < count; i++ )
+	{
+		SimBubble & b = bubbles[i];
+
+		simInitBubble( b, layout[i].centerX, layout[i].centerY, config.bubbleRadius, config.popExpansion, layout[i].degrees, false );
+
+		b.imageIndex = layout[i].imageIndex;
+		b.noteIndex = layout[i].noteIndex;
+	}
+
+	restart();
+}
+
+/**
+*  Function: restart()
+*
+*  Purpose: This function sets the level back to before the user's click.  It is
+*           called once the bubbles have been laid out.
+*/
+
+void LevelSimulation::restart()
+{
+	userIndex = -1;
+	currentPopping = 0;
+	levelPoints = 0;
+	tickCount = 0;
+	clickX = 0;
+	clickY = 0;
+	clickPending = false;
+	userBubbleCreated = false;
+	chainReactionStarted = false;
+	chainReactionDone = false;
+}
+
+/**
+*  Function: saveState(ByteWriter & writer)
+*
+*  Purpose: This function writes everything about the level that changes as it
+*           is played, so that loadState() can pick it up again from this frame.
+*           The config and the worker pool aren't included.  centerX and centerY
+*           are always x and y truncated, so they aren't written either.
+*
+*  Inputs: writer - Where to write the state.
+*/
+
+void LevelSimulation::saveState(ByteWriter & writer) const
+{
+	writer.writeVarint( (uint32)bubbles.size() );
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		const SimBubble & b = bubbles[i];
+
+		writer.writeFloat( b.x );
+		writer.writeFloat( b.y );
+		writer.writeFloat( b.stepX );
+		writer.writeFloat( b.stepY );
+		writer.writeVarint( (uint32)b.radius );
+		writer.writeVarint( (uint32)b.maxRadius );
+		writer.writeSigned( b.degrees );
+		writer.writeVarint( (uint32)b.holdCounter );
+		writer.writeVarint( (uint32)b.imageIndex );
+		writer.writeVarint( (uint32)b.noteIndex );
+		writer.writeByte( (uint8)( b.paused | b.popping << 1 | b.expanding << 2 | b.holding << 3 |
+			                       b.contracting << 4 | b.isUserBubble << 5 ) );
+	}
+
+	writer.writeSigned( userIndex );
+	writer.writeSigned( currentPopping );
+	writer.writeVarint( (uint32)levelPoints );
+	writer.writeVarint( (uint32)tickCount );
+	writer.writeSigned( clickX );
+	writer.writeSigned( clickY );
+	writer.writeByte( (uint8)( clickPending | userBubbleCreated << 1 | chainReactionStarted << 2 | chainReactionDone << 3 ) );
+}
+
+/**
+*  Function: loadState(ByteReader & reader)
+*
+*  Purpose: This function puts the level back into a state written by saveState().
+*
+*  Inputs: reader - Where to read the state from.
+*
+*  Returns: True if the state was read.  If it is cut off or damaged, false is
+*           returned and the level is left empty.
+*/
+
+bool LevelSimulation::loadState(ByteReader & reader)
+{
+	uint32 count = reader.readVarint();
+
+	if ( count > (uint32)reader.getRemaining() )  // Every bubble takes more than a byte.
+	{
+		generate( 0, 0 );
+		return false;
+	}
+
+	bubbles.resize( count );
+
+	for ( int i = 0; i < (int)count; i++ )
+	{
+		SimBubble & b = bubbles[i];
+
+		b.x = reader.readFloat();
+		b.y = reader.readFloat();
+		b.stepX = reader.readFloat();
+		b.stepY = reader.readFloat();
+		b.centerX = (int)b.x;
+		b.centerY = (int)b.y;
+		b.radius = (int)reader.readVarint();
+		b.maxRadius = (int)reader.readVarint();
+		b.degrees = reader.readSigned();
+		b.holdCounter = (int)reader.readVarint();
+		b.imageIndex = (int)reader.readVarint();
+		b.noteIndex = (int)reader.readVarint();
+
+		uint8 flags = reader.readByte();
+
+		b.paused = ( flags & 1 ) != 0;
+		b.popping = ( flags & 2 ) != 0;
+		b.expanding = ( flags & 4 ) != 0;
+		b.holding = ( flags & 8 ) != 0;
+		b.contracting = ( flags & 16 ) != 0;
+		b.isUserBubble = ( flags & 32 ) != 0;
+	}
+
+	userIndex = reader.readSigned();
+	currentPopping = reader.readSigned();
+	levelPoints = (int)reader.readVarint();
+	tickCount = (int)reader.readVarint();
+	clickX = reader.readSigned();
+	clickY = reader.readSigned();
+
+	uint8 flags = reader.readByte();
+
+	clickPending = ( flags & 1 ) != 0;
+	userBubbleCreated = ( flags & 2 ) != 0;
+	chainReactionStarted = ( flags & 4 ) != 0;
+	chainReactionDone = ( flags & 8 ) != 0;
+
+	if ( reader.getFailed() || userIndex < -1 || userIndex >= (int)count || ( userBubbleCreated && userIndex < 0 ) )
+	{
+		generate( 0, 0 );
+		return false;
+	}
+
+	return true;
+}
+
+/**
+*  Function: click(int x, int y)
+*
+*  Purpose: This function records a mouse click.  It is handled by
+*           detectUserClick() at the start of the next tick(), the same way
+*           the main game loop polls dbMouseClick().
+*
+*  Inputs: x, y - Where the user clicked.
+*/
+
+void LevelSimulation::click(int x, int y)
+{
+	clickPending = true;
+	clickX = x;
+	clickY = y;
+}
+
+/**
+*  Function: tick(double * phaseSeconds)
+*
+*  Purpose: This function advances the level by one frame, running each step
+*           of the frame in order.
+*
+*  Inputs: phaseSeconds - If not NULL, an array of SIM_PHASE_COUNT totals.  The
+*                         time spent in each step is added to its total.
+*/
+
+void LevelSimulation::tick(double * phaseSeconds)
+{
+	PROFILE_SCOPE( "tick" );
+
+	if ( phaseSeconds == NULL )
+	{
+		detectUserClick();
+		detectBoundaryCollisions();
+		popUserBubble();
+		popBubbles();
+		moveBubbles();
+		detectBubbleCollisions();
+		checkChainReaction();
+	}
+	else
+	{
+		double times[SIM_PHASE_COUNT + 1];
+
+		times[0] = getSeconds();
+		detectUserClick();
+		times[1] = getSeconds();
+		detectBoundaryCollisions();
+		times[2] = getSeconds();
+		popUserBubble();
+		times[3] = getSeconds();
+		popBubbles();
+		times[4] = getSeconds();
+		moveBubbles();
+		times[5] = getSeconds();
+		detectBubbleCollisions();
+		times[6] = getSeconds();
+		checkChainReaction();
+		times[7] = getSeconds();
+
+		for ( int i = 0; i < SIM_PHASE_COUNT; i++ )
+		{
+			phaseSeconds[i] += times[i+1] - times[i];
+		}
+	}
+
+	if ( checksums != NULL )
+	{
+		uint64 * bubbleHashes = NULL;
+
+		if ( checksums->getBubbleHashes() )
+		{
+			bubbleChecksums.resize( bubbles.size() + 1 );
+			bubbleHashes = & bubbleChecksums[0];
+		}
+
+		checksums->addTick( hashState( bubbleHashes ), bubbleHashes, (int)bubbles.size() );
+	}
+
+	tickCount++;
+}
+
+/**
+*  Function: resolve(int maxTicks)
+*
+*  Purpose: This function keeps ticking until the chain reaction is over, or
+*           until maxTicks frames have been simulated.
+*
+*  Inputs: maxTicks - The most frames to simulate.
+*
+*  Returns: The number of frames simulated by this call.
+*/
+
+int LevelSimulation::resolve(int maxTicks)
+{
+	int ticks = 0;
+
+	while ( chainReactionDone == false && ticks < maxTicks )
+	{
+		tick();
+		ticks++;
+	}
+
+	return ticks;
+}
+
+/**
+*  Function: detectUserClick()
+*
+*  Purpose: This function handles the user's click.  On the first click the user
+*           bubble is added to the end of the level and starts popping.
+*/
+
+void LevelSimulation::detectUserClick()
+{
+	PROFILE_SCOPE( "detectUserClick" );
+
+	if ( clickPending && userBubbleCreated == false )
+	{
+		userBubbleCreated = true;
+
+		SimBubble b;
+		simInitBubble( b, clickX, clickY, config.bubbleRadius, config.popExpansion, 0, true );
+
+		bubbles.push_back( b );
+		userIndex = (int)bubbles.size() - 1;
+
+		SimBubble & user = bubbles[userIndex];
+		user.paused = true;
+		user.popping = true;
+		simPop( user, currentPopping );
+
+		currentPopping++;
+		chainReactionStarted = true;
+	}
+
+	clickPending = false;
+}
+
+/**
+*  Function: detectBoundaryCollisions()
+*
+*  Purpose: This function bounces every bubble that is not the user bubble and
+*           not popping off of the walls.
+*/
+
+void LevelSimulation::detectBoundaryCollisions()
+{
+	PROFILE_SCOPE( "detectBoundaryCollisions" );
+
+	if ( pool != NULL )
+	{
+		parallelBoundaryCollisions();
+		return;
+	}
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		if ( !bubbles[i].isUserBubble && !bubbles[i].popping )
+		{
+			simBoundaryCollisionCheck( bubbles[i], config.arenaWidth, config.arenaHeight );
+		}
+	}
+}
+
+/**
+*  Function: popUserBubble()
+*
+*  Purpose: This function continues the user bubble's pop.  Because the user bubble is
+*           also in the bubbles vector, popBubbles() pops it a second time, so
+*           it expands and contracts twice as fast as the other bubbles.
+*/
+
+void LevelSimulation::popUserBubble()
+{
+	PROFILE_SCOPE( "popUserBubble" );
+
+	if ( userBubbleCreated && bubbles[userIndex].popping )
+	{
+		simPop( bubbles[userIndex], currentPopping );
+	}
+}
+
+/**
+*  Function: popBubbles()
+*
+*  Purpose: This function continues the pop of every popping bubble.
+*/
+
+void LevelSimulation::popBubbles()
+{
+	PROFILE_SCOPE( "popBubbles" );
+
+	if ( pool != NULL )
+	{
+		parallelPopBubbles();
+		return;
+	}
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		if ( bubbles[i].popping )
+		{
+			simPop( bubbles[i], currentPopping );
+		}
+	}
+}
+
+/**
+*  Function: moveBubbles()
+*
+*  Purpose: This function moves every bubble that is not paused.
+*/
+
+void LevelSimulation::moveBubbles()
+{
+	PROFILE_SCOPE( "moveBubbles" );
+
+	if ( pool != NULL )
+	{
+		parallelMoveBubbles();
+		return;
+	}
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		simMove( bubbles[i] );
+	}
+}
+
+/**
+*  Function: detectBubbleCollisions()
+*
+*  Purpose: This function pops every bubble touched by a popping one.  The order matters: a
+*           bubble that is hit starts popping straight away, and if it comes later
+*           in the vector than the bubble that hit it, it can hit others in the
+*           same frame.
+*/
+
+void LevelSimulation::detectBubbleCollisions()
+{
+	PROFILE_SCOPE( "detectBubbleCollisions" );
+
+	if ( pool != NULL && userBubbleCreated )
+	{
+		parallelBubbleCollisions();
+		return;
+	}
+
+	if ( userBubbleCreated )
+	{
+		int count = (int)bubbles.size();
+
+		for ( int i = 0; i < count; i++ )
+		{
+			if ( bubbles[i].popping )
+			{
+				for ( int j = 0; j < count; j++ )
+				{
+					SimBubble & b = bubbles[j];
+
+					if ( b.popping == false && b.radius != 0 && simBubbleCollisionCheck( bubbles[i], b ) )
+					{
+						currentPopping++;
+						levelPoints++;
+
+						b.paused = true;
+						b.popping = true;
+						simPop( b, currentPopping );
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+*  Function: checkChainReaction()
+*
+*  Purpose: This is the check at the end of the main game loop that decides whether
+*           the chain reaction is over.  Once it is, the level's score is final.
+*/
+
+void LevelSimulation::checkChainReaction()
+{
+	PROFILE_SCOPE( "checkChainReaction" );
+
+	if ( chainReactionStarted == true && currentPopping == 0 )
+	{
+		chainReactionDone = true;
+
+		for ( int i = 0; i < (int)bubbles.size(); i++ )  // Every bubble stops moving.
+		{
+			bubbles[i].paused = true;
+		}
+	}
+}
+
+/**
+*  Function: contractRemainingBubbles()
+*
+*  Purpose: This function is called once each frame after the chain reaction
+*           is over.  Every bubble that still has a radius shrinks by one pixel,
+*           the way the bubbles left on the screen shrink away before the
+*           cut-screen.
+*
+*  Returns: True once every bubble has shrunk away.
+*/
+
+bool LevelSimulation::contractRemainingBubbles()
+{
+	int count = 0;
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		if ( bubbles[i].radius > 0 )
+		{
+			simContract( bubbles[i], currentPopping );
+		}
+
+		if ( bubbles[i].radius <= 0 )
+		{
+			count++;
+		}
+	}
+
+	return count == (int)bubbles.size();
+}
+
+/**
+*  Function: getBubbleCount()
+*
+*  Returns: The number of bubbles, including the user bubble once it exists.
+*/
+
+int LevelSimulation::getBubbleCount() const
+{
+	return (int)bubbles.size();
+}
+
+/**
+*  Function: getBubble(int i)
+*
+*  Returns: The bubble at index i.  The user bubble is always last.
+*/
+
+const SimBubble & LevelSimulation::getBubble(int i) const
+{
+	return bubbles[i];
+}
+
+/**
+*  Function: getCurrentPopping()
+*
+*  Returns: The number of bubbles that are currently popping.
+*/
+
+int LevelSimulation::getCurrentPopping() const
+{
+	return currentPopping;
+}
+
+/**
+*  Function: getLevelPoints()
+*
+*  Returns: The number of bubbles popped by the chain reaction so far.
+*/
+
+int LevelSimulation::getLevelPoints() const
+{
+	return levelPoints;
+}
+
+/**
+*  Function: getTickCount()
+*
+*  Returns: The number of frames simulated since generate().
+*/
+
+int LevelSimulation::getTickCount() const
+{
+	return tickCount;
+}
+
+/**
+*  Function: getUserBubbleCreated()
+*
+*  Returns: True once the user's click has been handled.
+*/
+
+bool LevelSimulation::getUserBubbleCreated() const
+{
+	return userBubbleCreated;
+}
+
+/**
+*  Function: getChainReactionDone()
+*
+*  Returns: True once the chain reaction has finished and the score is final.
+*/
+
+bool LevelSimulation::getChainReactionDone() const
+{
+	return chainReactionDone;
+}
+
+/**
+*  Function: checksum()
+*
+*  Returns: A 64-bit hash of the level's state (see Checksum.h).
+*/
+
+uint64 LevelSimulation::checksum() const
+{
+	return hashState( NULL );
+}
+
+/**
+*  Function: hashState(uint64 * bubbleHashes)
+*
+*  Purpose: This function hashes each bubble and the level's totals.
+*
+*  Inputs: bubbleHashes - If not NULL, each bubble's hash is stored here.
+*
+*  Returns: The level hash.
+*/
+
+uint64 LevelSimulation::hashState(uint64 * bubbleHashes) const
+{
+	uint64 sum = 0;
+
+	for ( int i = 0; i < (int)bubbles.size(); i++ )
+	{
+		const SimBubble & b = bubbles[i];
+
+		int flags = (int)b.paused * CHECKSUM_PAUSED | (int)b.popping * CHECKSUM_POPPING |
+			        (int)b.expanding * CHECKSUM_EXPANDING | (int)b.holding * CHECKSUM_HOLDING |
+			        (int)b.contracting * CHECKSUM_CONTRACTING;
+
+		uint64 hash = checksumBubble( i, b.x, b.y, b.stepX, b.stepY, b.radius, b.degrees, b.holdCounter, flags );
+
+		if ( bubbleHashes != NULL )
+		{
+			bubbleHashes[i] = hash;
+		}
+
+		sum += hash;
+	}
+
+	return checksumFinish( sum, levelPoints, currentPopping );
+}
@@ -0,0 +1,214 @@
+/**
+*  File:  Simulation.h
+*
+*  Description:  This header file contains the simulation of a single level: the
+*                rules of the game (moving, bouncing off the walls, the expand/hold/
+*                contract pop sequence and the chain reaction).  It keeps the bubbles
+*                in plain structs instead of DarkGDK sprites, so the game plays every
+*                level on it through GameSession and only draws the result, and many
+*                levels can be played out without a window, as fast as the CPU allows.
+*
+*                The random layout comes from SimRandom instead of dbRND(), so a level
+*                is completely determined by its seed and the user's click.
+*
+*                Large levels can be spread over several threads by giving the level
+*                a WorkerPool (see SimulationParallel.cpp).  The result is exactly the
+*                same with any number of threads, or without a pool at all.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SIMULATION_H_
+#define SIMULATION_H_
+
+#include "Constants.h"
+#include "Portable.h"
+#include "Threading.h"
+#include "ByteStream.h"
+#include "Checksum.h"
+#include <vector>
+
+using namespace std;
+
+const int BUBBLE_IMAGE_COUNT = 60;  // Number of images in media/graphics/bubbles (not counting user_bubble.png).
+const int NOTE_COUNT = 6;           // Number of pop sounds in media/audio/sound_effects.
+
+/**
+*  SimRandom is a small deterministic random number generator.  next() behaves
+*  like dbRND(), returning a value from 0 up to and including range.
+*/
+
+class SimRandom
+{
+private:
+	uint32 state;
+
+public:
+	SimRandom(uint32 seed);
+	int next(int range);
+	uint32 getState() const;
+};
+
+/**
+*  SimConfig holds the sizes that the game takes from Constants.h.  The defaults
+*  are the game's own values.  The stress command changes them to play levels
+*  far bigger than the game's.
+*/
+
+struct SimConfig
+{
+	int arenaWidth;     // The walls the bubbles bounce off of.
+	int arenaHeight;
+	int bubbleRadius;
+	int popExpansion;
+
+	SimConfig();
+	bool valid() const;
+};
+
+/**
+*  SimBubble holds everything about a bubble that BubbleSprite draws.  DarkGDK keeps
+*  sprite positions as floats and dbSpriteX()/dbSpriteY() truncate them, so x
+*  and y hold the exact position and centerX/centerY the truncated one that
+*  is used for collisions.  stepX/stepY are the distance moved each frame
+*  along the current heading.
+*/
+
+struct SimBubble
+{
+	float x;
+	float y;
+	float stepX;
+	float stepY;
+	int centerX;
+	int centerY;
+	int radius;
+	int maxRadius;
+	int degrees;
+	int holdCounter;
+	int imageIndex;
+	int noteIndex;
+	bool paused;
+	bool popping;
+	bool expanding;
+	bool holding;
+	bool contracting;
+	bool isUserBubble;
+};
+
+/**
+*  SimLayoutBubble is a bubble as generate() lays it out, before the level starts:
+*  everything else in SimBubble follows from these and the config.  Level packs
+*  (LevelPack.h) store their bubbles this way, so the fields have fixed sizes.
+*/
+
+struct SimLayoutBubble
+{
+	int16 centerX;
+	int16 centerY;
+	int16 degrees;
+	uint8 imageIndex;
+	uint8 noteIndex;
+};
+
+void simInitBubble(SimBubble & b, int cX, int cY, int r, int expansion, int degrees, bool userBubble);
+void simHeadingStep(int degrees, float & stepX, float & stepY);
+void simMove(SimBubble & b);
+void simPop(SimBubble & b, int & currentPopping);
+void simExpand(SimBubble & b);
+void simHold(SimBubble & b);
+void simContract(SimBubble & b, int & currentPopping);
+void simBoundaryCollisionCheck(SimBubble & b, int width, int height);
+bool simBubbleCollisionCheck(const SimBubble & b1, const SimBubble & b2);
+
+/**
+*  The steps of tick(), in order.  tick() can add the time spent in each of
+*  them to an array of SIM_PHASE_COUNT doubles.
+*/
+
+const int SIM_PHASE_COUNT = 7;
+extern const char * SIM_PHASE_NAMES[SIM_PHASE_COUNT];
+
+class LevelSimulation
+{
+private:
+	SimConfig config;
+	vector <SimBubble> bubbles;
+	int userIndex;
+	int currentPopping;
+	int levelPoints;
+	int tickCount;
+	int clickX;
+	int clickY;
+	bool clickPending;
+	bool userBubbleCreated;
+	bool chainReactionStarted;
+	bool chainReactionDone;
+
+	WorkerPool * pool;                     // NULL to run every step on the calling thread.
+	vector <int> workerCounts;             // Each worker's change to currentPopping.
+	vector <int32> claims;                 // Lowest popper to hit each bubble this frame.
+	vector <int> cellStart;                // Collision grid: where each cell's bubbles start in cellBubbles.
+	vector <int> cellFill;                 // Collision grid: where the next bubble goes in each cell while filling.
+	vector <int> cellBubbles;
+	vector <int> poppers;                  // The poppers being tested in the current wave.
+	vector < vector <int> > nextPoppers;   // Each worker's poppers for the next wave.
+	vector < vector <int> > hits;          // Each worker's newly hit bubbles.
+	vector <int> allHits;
+	int gridLeft;
+	int gridTop;
+	int gridColumns;
+	int gridRows;
+	int cellSize;
+
+	ChecksumStream * checksums;            // NULL unless every frame's checksum is being recorded.
+	vector <uint64> bubbleChecksums;
+
+	void restart();
+	uint64 hashState(uint64 * bubbleHashes) const;
+	void parallelBoundaryCollisions();
+	void parallelPopBubbles();
+	void parallelMoveBubbles();
+	void parallelBubbleCollisions();
+	void buildCollisionGrid();
+	void boundaryRange(int begin, int end, int worker);
+	void popRange(int begin, int end, int worker);
+	void moveRange(int begin, int end, int worker);
+	void collisionWaveRange(int begin, int end, int worker);
+	void applyHitRange(int begin, int end, int worker);
+
+public:
+	LevelSimulation();
+	void setWorkerPool(WorkerPool * workerPool);
+	void setChecksumStream(ChecksumStream * stream);
+	void setConfig(const SimConfig & simConfig);
+	const SimConfig & getConfig() const;
+	void generate(uint32 seed, int bubbleCount);
+	void setBubbles(const vector <SimBubble> & layout);
+	void setLayout(const SimLayoutBubble * layout, int count);
+	void saveState(ByteWriter & writer) const;
+	bool loadState(ByteReader & reader);
+	void click(int x, int y);
+	void tick(double * phaseSeconds = NULL);
+	int resolve(int maxTicks);
+	void detectUserClick();
+	void detectBoundaryCollisions();
+	void popUserBubble();
+	void popBubbles();
+	void moveBubbles();
+	void detectBubbleCollisions();
+	void checkChainReaction();
+	bool contractRemainingBubbles();
+	int getBubbleCount() const;
+	const SimBubble & getBubble(int i) const;
+	int getCurrentPopping() const;
+	int getLevelPoints() const;
+	int getTickCount() const;
+	bool getUserBubbleCreated() const;
+	bool getChainReactionDone() const;
+	uint64 checksum() const;
+};
+
+#endif
@@ -0,0 +1,436 @@
+/**
+*  File:  SimulationParallel.cpp
+*
+*  Description:  This file contains the multi-threaded versions of the LevelSimulation
+*                steps, used when the level has been given a WorkerPool.  Each step
+*                is split into chunks of bubbles that the pool's workers share out.
+*
+*                Bouncing, popping and moving only change the bubble being worked
+*                on, so the chunks can run in any order.  The one total they change,
+*                currentPopping, is kept separately by each worker and added up
+*                afterwards.
+*
+*                Collisions are harder, because in the game the order matters: the
+*                bubbles are tested in vector order and a bubble that is hit starts
+*                popping straight away.  Played out in that order, a bubble is always
+*                hit by the lowest-numbered popper that touches it, and a bubble that
+*                is hit goes on to hit others in the same frame only if its own
+*                number is higher than that popper's.  So instead of taking turns,
+*                the poppers are tested in waves:
+*
+*                1. Every popper is tested against the bubbles near it, and each hit
+*                   bubble's claim is lowered to the popper's number with atomicMin().
+*                2. A bubble whose claim drops below its own number for the first
+*                   time becomes a popper in the next wave.
+*                3. When a wave finds no new poppers, every claimed bubble starts
+*                   popping, and is counted in levelPoints and currentPopping once.
+*
+*                Claims only ever go down, and the final claim of a bubble is the
+*                lowest popper that touches it whichever thread got there first, so
+*                the result is exactly the same as detectBubbleCollisions() on one
+*                thread, for any number of threads.
+*
+*                The bubbles that can be hit are sorted into a grid of square cells
+*                first, so a popper only has to be tested against the cells around it.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Simulation.h"
+
+const int PHASE_CHUNK = 4096;   // Bubbles per chunk for the bounce, pop and move steps.
+const int WAVE_CHUNK = 16;      // Poppers per chunk for the collision waves.
+const int32 NOT_CLAIMED = 0x7fffffff;
+
+/**
+*  PhaseTask runs one of LevelSimulation's range methods as a ParallelTask.
+*/
+
+class PhaseTask : public ParallelTask
+{
+private:
+	LevelSimulation * level;
+	void (LevelSimulation::*range)(int begin, int end, int worker);
+
+public:
+	PhaseTask(LevelSimulation * sim, void (LevelSimulation::*method)(int begin, int end, int worker))
+	{
+		level = sim;
+		range = method;
+	}
+
+	void run(int begin, int end, int worker)
+	{
+		( level->*range )( begin, end, worker );
+	}
+};
+
+/**
+*  Function: parallelBoundaryCollisions()
+*
+*  Purpose: This is detectBoundaryCollisions() split between the workers.
+*/
+
+void LevelSimulation::parallelBoundaryCollisions()
+{
+	PhaseTask task( this, & LevelSimulation::boundaryRange );
+	pool->parallelFor( (int)bubbles.size(), PHASE_CHUNK, task );
+}
+
+/**
+*  Function: parallelPopBubbles()
+*
+*  Purpose: This is popBubbles() split between the workers.
+*/
+
+void LevelSimulation::parallelPopBubbles()
+{
+	workerCounts.assign( pool->getThreadCount(), 0 );
+
+	PhaseTask task( this, & LevelSimulation::popRange );
+	pool->parallelFor( (int)bubbles.size(), PHASE_CHUNK, task );
+
+	for ( int i = 0; i < (int)workerCounts.size(); i++ )
+	{
+		currentPopping += workerCounts[i];
+	}
+}
+
+/**
+*  Function: parallelMoveBubbles()
+*
+*  Purpose: This is moveBubbles() split between the workers.
+*/
+
+void LevelSimulation::parallelMoveBubbles()
+{
+	PhaseTask task( this, & LevelSimulation::moveRange );
+	pool->parallelFor( (int)bubbles.size(), PHASE_CHUNK, task );
+}
+
+/**
+*  Function: boundaryRange(int begin, int end, int worker)
+*
+*  Purpose: This function runs detectBoundaryCollisions() for the bubbles [begin, end).
+*
+*  Inputs: begin, end - The bubbles to test.
+*          worker - The worker running the chunk (not used).
+*/
+
+void LevelSimulation::boundaryRange(int begin, int end, int /*worker*/)
+{
+	for ( int i = begin; i < end; i++ )
+	{
+		if ( !bubbles[i].isUserBubble && !bubbles[i].popping )
+		{
+			simBoundaryCollisionCheck( bubbles[i], config.arenaWidth, config.arenaHeight );
+		}
+	}
+}
+
+/**
+*  Function: popRange(int begin, int end, int worker)
+*
+*  Purpose: This function runs popBubbles() for the bubbles [begin, end).
+*
+*  Inputs: begin, end - The bubbles to pop.
+*          worker - The worker running the chunk.  Bubbles that finish popping
+*                   are counted in workerCounts[worker].
+*/
+
+void LevelSimulation::popRange(int begin, int end, int worker)
+{
+	int count = 0;
+
+	for ( int i = begin; i < end; i++ )
+	{
+		if ( bubbles[i].popping )
+		{
+			simPop( bubbles[i], count );
+		}
+	}
+
+	workerCounts[worker] += count;
+}
+
+/**
+*  Function: moveRange(int begin, int end, int worker)
+*
+*  Purpose: This function runs moveBubbles() for the bubbles [begin, end).
+*
+*  Inputs: begin, end - The bubbles to move.
+*          worker - The worker running the chunk (not used).
+*/
+
+void LevelSimulation::moveRange(int begin, int end, int /*worker*/)
+{
+	for ( int i = begin; i < end; i++ )
+	{
+		simMove( bubbles[i] );
+	}
+}
+
+/**
+*  Function: buildCollisionGrid()
+*
+*  Purpose: This function sorts the bubbles that can be hit (not popping, and a
+*           radius other than 0) into a grid.  The cells are at least as wide as
+*           the two biggest radii put together, so anything a popper can touch
+*           is in its own cell or one of the cells next to it.
+*/
+
+void LevelSimulation::buildCollisionGrid()
+{
+	int count = (int)bubbles.size();
+	int largestRadius = 0;
+	int left = 0, top = 0, right = 0, bottom = 0;
+	int targets = 0;
+
+	for ( int i = 0; i < count; i++ )
+	{
+		const SimBubble & b = bubbles[i];
+
+		if ( b.radius > largestRadius )
+		{
+			largestRadius = b.radius;
+		}
+
+		if ( b.popping == false && b.radius != 0 )
+		{
+			if ( targets == 0 || b.centerX < left ) left = b.centerX;
+			if ( targets == 0 || b.centerX > right ) right = b.centerX;
+			if ( targets == 0 || b.centerY < top ) top = b.centerY;
+			if ( targets == 0 || b.centerY > bottom ) bottom = b.centerY;
+
+			targets++;
+		}
+	}
+
+	// A bubble that is hit grows by one before it is tested as a popper.
+	cellSize = 2 * ( largestRadius + 1 );
+
+	gridLeft = left;
+	gridTop = top;
+	gridColumns = ( right - left ) / cellSize + 1;
+	gridRows = ( bottom - top ) / cellSize + 1;
+
+	while ( (int64)gridColumns * gridRows > 4 * (int64)targets + 16 )  // Keep the grid from getting much bigger than the level.
+	{
+		cellSize *= 2;
+		gridColumns = ( right - left ) / cellSize + 1;
+		gridRows = ( bottom - top ) / cellSize + 1;
+	}
+
+	cellStart.assign( gridColumns * gridRows + 1, 0 );
+	cellBubbles.resize( targets );
+
+	for ( int i = 0; i < count; i++ )
+	{
+		const SimBubble & b = bubbles[i];
+
+		if ( b.popping == false && b.radius != 0 )
+		{
+			int cell = ( ( b.centerY - gridTop ) / cellSize ) * gridColumns + ( b.centerX - gridLeft ) / cellSize;
+			cellStart[cell+1]++;
+		}
+	}
+
+	for ( int cell = 0; cell < gridColumns * gridRows; cell++ )
+	{
+		cellStart[cell+1] += cellStart[cell];
+	}
+
+	cellFill.assign( cellStart.begin(), cellStart.end() - 1 );
+
+	for ( int i = 0; i < count; i++ )
+	{
+		const SimBubble & b = bubbles[i];
+
+		if ( b.popping == false && b.radius != 0 )
+		{
+			int cell = ( ( b.centerY - gridTop ) / cellSize ) * gridColumns + ( b.centerX - gridLeft ) / cellSize;
+			cellBubbles[cellFill[cell]++] = i;
+		}
+	}
+}
+
+/**
+*  Function: parallelBubbleCollisions()
+*
+*  Purpose: This is detectBubbleCollisions() split between the workers.  See the
+*           top of this file for how the result is kept the same as on one thread.
+*/
+
+void LevelSimulation::parallelBubbleCollisions()
+{
+	int count = (int)bubbles.size();
+	int threads = pool->getThreadCount();
+
+	if ( (int)claims.size() != count )
+	{
+		claims.assign( count, NOT_CLAIMED );
+	}
+
+	nextPoppers.resize( threads );
+	hits.resize( threads );
+
+	poppers.clear();
+
+	for ( int i = 0; i < count; i++ )
+	{
+		if ( bubbles[i].popping )
+		{
+			poppers.push_back( i );
+		}
+	}
+
+	if ( poppers.empty() )
+	{
+		return;
+	}
+
+	buildCollisionGrid();
+
+	PhaseTask waveTask( this, & LevelSimulation::collisionWaveRange );
+
+	while ( poppers.empty() == false )
+	{
+		pool->parallelFor( (int)poppers.size(), WAVE_CHUNK, waveTask );
+
+		poppers.clear();
+
+		for ( int w = 0; w < threads; w++ )
+		{
+			poppers.insert( poppers.end(), nextPoppers[w].begin(), nextPoppers[w].end() );
+			nextPoppers[w].clear();
+		}
+	}
+
+	allHits.clear();
+
+	for ( int w = 0; w < threads; w++ )
+	{
+		allHits.insert( allHits.end(), hits[w].begin(), hits[w].end() );
+		hits[w].clear();
+	}
+
+	workerCounts.assign( threads, 0 );
+
+	PhaseTask applyTask( this, & LevelSimulation::applyHitRange );
+	pool->parallelFor( (int)allHits.size(), PHASE_CHUNK, applyTask );
+
+	currentPopping += (int)allHits.size();
+	levelPoints += (int)allHits.size();
+
+	for ( int w = 0; w < threads; w++ )
+	{
+		currentPopping += workerCounts[w];
+	}
+}
+
+/**
+*  Function: collisionWaveRange(int begin, int end, int worker)
+*
+*  Purpose: This function tests the poppers [begin, end) of the current wave
+*           against the bubbles around them, and claims every bubble they touch.
+*           No bubble is changed until the last wave is done, so a bubble that
+*           was hit in an earlier wave is tested here as it was before it was hit.
+*
+*  Inputs: begin, end - Indexes into poppers.
+*          worker - The worker running the chunk.  New poppers go in
+*                   nextPoppers[worker] and newly claimed bubbles in hits[worker].
+*/
+
+void LevelSimulation::collisionWaveRange(int begin, int end, int worker)
+{
+	for ( int n = begin; n < end; n++ )
+	{
+		int p = poppers[n];
+		SimBubble popper = bubbles[p];
+
+		if ( popper.popping == false )  // Hit this frame, so it has already had its first pop().
+		{
+			int unused = 0;
+			popper.paused = true;
+			popper.popping = true;
+			simPop( popper, unused );
+		}
+
+		int firstColumn = ( popper.centerX - cellSize - gridLeft ) / cellSize;
+		int lastColumn = ( popper.centerX + cellSize - gridLeft ) / cellSize;
+		int firstRow = ( popper.centerY - cellSize - gridTop ) / cellSize;
+		int lastRow = ( popper.centerY + cellSize - gridTop ) / cellSize;
+
+		if ( popper.centerX + cellSize < gridLeft || popper.centerY + cellSize < gridTop )
+		{
+			continue;
+		}
+
+		if ( firstColumn < 0 ) firstColumn = 0;
+		if ( firstRow < 0 ) firstRow = 0;
+		if ( lastColumn >= gridColumns ) lastColumn = gridColumns - 1;
+		if ( lastRow >= gridRows ) lastRow = gridRows - 1;
+
+		for ( int row = firstRow; row <= lastRow; row++ )
+		{
+			for ( int column = firstColumn; column <= lastColumn; column++ )
+			{
+				int cell = row * gridColumns + column;
+
+				for ( int c = cellStart[cell]; c < cellStart[cell+1]; c++ )
+				{
+					int t = cellBubbles[c];
+
+					if ( t == p || simBubbleCollisionCheck( popper, bubbles[t] ) == false )
+					{
+						continue;
+					}
+
+					int32 old = atomicMin( (volatile int32 *) & claims[t], p );
+
+					if ( old == NOT_CLAIMED )
+					{
+						hits[worker].push_back( t );
+					}
+
+					if ( p < t && old > t )  // Its claim just dropped below its own number.
+					{
+						nextPoppers[worker].push_back( t );
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+*  Function: applyHitRange(int begin, int end, int worker)
+*
+*  Purpose: This function starts the bubbles hit this frame popping, the same way
+*           detectBubbleCollisions() does, and clears their claims for next time.
+*
+*  Inputs: begin, end - Indexes into allHits.
+*          worker - The worker running the chunk.  Changes to currentPopping
+*                   from the pop() are counted in workerCounts[worker].
+*/
+
+void LevelSimulation::applyHitRange(int begin, int end, int worker)
+{
+	int count = 0;
+
+	for ( int n = begin; n < end; n++ )
+	{
+		int t = allHits[n];
+		SimBubble & b = bubbles[t];
+
+		b.paused = true;
+		b.popping = true;
+		simPop( b, count );
+
+		claims[t] = NOT_CLAIMED;
+	}
+
+	workerCounts[worker] += count;
+}
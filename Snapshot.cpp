@@ -0,0 +1,336 @@
+/**
+*  File:  Snapshot.cpp
+*
+*  Description:  This file contains the implementations for the game snapshot
+*                functions and the SnapshotHistory class.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Snapshot.h"
+#include <string.h>  // For memcpy().
+
+const int SNAPSHOT_HEADER_WORDS = 7;  // The GameSnapshot fields before the level's state.
+const int SNAPSHOT_MIN_SAME_RUN = 4;  // Shorter runs of matching bytes are cheaper to store as part of a change.
+
+/**
+*  Function: writeGameSnapshot(const GameSnapshot & snapshot, vector <uint8> & bytes)
+*
+*  Purpose: This function turns a snapshot into bytes: the session's fields as
+*           they are, then the level's state.
+*
+*  Inputs: snapshot - The snapshot.
+*          bytes - Replaced with the snapshot's bytes.
+*/
+
+void writeGameSnapshot(const GameSnapshot & snapshot, vector <uint8> & bytes)
+{
+	int32 header[SNAPSHOT_HEADER_WORDS] = { snapshot.screen, snapshot.level, snapshot.levelPoints,
+		                                    snapshot.totalPoints, snapshot.fadeCounter,
+		                                    (int32)snapshot.levelSeed, snapshot.flags };
+
+	bytes.resize( sizeof(header) + snapshot.levelState.size() );
+	memcpy( & bytes[0], header, sizeof(header) );
+
+	if ( snapshot.levelState.empty() == false )
+	{
+		memcpy( & bytes[sizeof(header)], & snapshot.levelState[0], snapshot.levelState.size() );
+	}
+}
+
+/**
+*  Function: readGameSnapshot(const uint8 * data, int size, GameSnapshot & snapshot)
+*
+*  Purpose: This function turns bytes from writeGameSnapshot() back into a snapshot.
+*           The level's state is only checked when it is loaded.
+*
+*  Inputs: data, size - The bytes.
+*          snapshot - Filled in from the bytes.
+*
+*  Returns: True if there were enough bytes for a snapshot.
+*/
+
+bool readGameSnapshot(const uint8 * data, int size, GameSnapshot & snapshot)
+{
+	int32 header[SNAPSHOT_HEADER_WORDS];
+
+	if ( size < (int)sizeof(header) )
+	{
+		return false;
+	}
+
+	memcpy( header, data, sizeof(header) );
+
+	snapshot.screen = header[0];
+	snapshot.level = header[1];
+	snapshot.levelPoints = header[2];
+	snapshot.totalPoints = header[3];
+	snapshot.fadeCounter = header[4];
+	snapshot.levelSeed = (uint32)header[5];
+	snapshot.flags = header[6];
+
+	snapshot.levelState.assign( data + sizeof(header), data + size );
+
+	return true;
+}
+
+/**
+*  Function: snapshotDelta(const vector <uint8> & base, const vector <uint8> & next, vector <uint8> & delta)
+*
+*  Purpose: This function stores a state as the bytes where it differs from
+*           another one (see Snapshot.h for the format).  Matching runs shorter
+*           than SNAPSHOT_MIN_SAME_RUN are kept in with the changed bytes around
+*           them, since their two run lengths would take about as much room.
+*
+*  Inputs: base - The state the delta is from.
+*          next - The state to store.
+*          delta - Replaced with the delta.
+*/
+
+void snapshotDelta(const vector <uint8> & base, const vector <uint8> & next, vector <uint8> & delta)
+{
+	delta.clear();
+
+	ByteWriter writer( delta );
+
+	int size = (int)next.size();
+	int common = base.size() < next.size() ? (int)base.size() : size;
+	int position = 0;
+
+	writer.writeVarint( (uint32)size );
+
+	while ( position < size )
+	{
+		int changeStart = position;
+
+		while ( changeStart < common && base[changeStart] == next[changeStart] )
+		{
+			changeStart++;
+		}
+
+		if ( changeStart == size )
+		{
+			break;  // The rest is the same as the base.
+		}
+
+		int changeEnd = changeStart + 1;
+
+		while ( changeEnd < size )
+		{
+			int same = changeEnd;
+
+			while ( same < common && same < changeEnd + SNAPSHOT_MIN_SAME_RUN && base[same] == next[same] )
+			{
+				same++;
+			}
+
+			if ( same == changeEnd + SNAPSHOT_MIN_SAME_RUN || same == size )
+			{
+				break;
+			}
+
+			changeEnd = same + 1;
+		}
+
+		if ( changeEnd > size )
+		{
+			changeEnd = size;
+		}
+
+		writer.writeVarint( (uint32)( changeStart - position ) );
+		writer.writeVarint( (uint32)( changeEnd - changeStart ) );
+		writer.writeBytes( & next[changeStart], changeEnd - changeStart );
+
+		position = changeEnd;
+	}
+}
+
+/**
+*  Function: applySnapshotDelta(const vector <uint8> & base, const uint8 * delta, int size, vector <uint8> & next)
+*
+*  Purpose: This function rebuilds a state from its base and a delta made by
+*           snapshotDelta().
+*
+*  Inputs: base - The state the delta is from.
+*          delta, size - The delta.
+*          next - Replaced with the rebuilt state.
+*
+*  Returns: True if the delta fit the base.  If not, next is left empty.
+*/
+
+bool applySnapshotDelta(const vector <uint8> & base, const uint8 * delta, int size, vector <uint8> & next)
+{
+	ByteReader reader( delta, size );
+
+	int nextSize = (int)reader.readVarint();
+	int baseSize = (int)base.size();
+	int position = 0;
+
+	next.resize( reader.getFailed() || nextSize < 0 ? 0 : nextSize );
+
+	while ( reader.getFailed() == false && reader.getRemaining() > 0 )
+	{
+		int same = (int)reader.readVarint();
+		int changed = (int)reader.readVarint();
+
+		if ( same < 0 || changed < 0 || same > baseSize - position || changed > nextSize - position - same )
+		{
+			next.clear();
+			return false;
+		}
+
+		if ( same > 0 )
+		{
+			memcpy( & next[position], & base[position], same );
+			position += same;
+		}
+
+		if ( changed > 0 )
+		{
+			if ( reader.readBytes( & next[position], changed ) == false )
+			{
+				next.clear();
+				return false;
+			}
+
+			position += changed;
+		}
+	}
+
+	if ( reader.getFailed() || ( position < nextSize && nextSize > baseSize ) )
+	{
+		next.clear();
+		return false;
+	}
+
+	if ( position < nextSize )
+	{
+		memcpy( & next[position], & base[position], nextSize - position );
+	}
+
+	return true;
+}
+
+/**
+*  Function: SnapshotHistory(int interval)
+*
+*  Purpose: This is the constructor for the SnapshotHistory class.  The history
+*           starts out empty.
+*
+*  Inputs: interval - How often a whole state is kept.
+*/
+
+SnapshotHistory::SnapshotHistory(int interval)
+{
+	keyframeInterval = interval > 0 ? interval : 1;
+	byteCount = 0;
+}
+
+/**
+*  Function: clear()
+*
+*  Purpose: This function throws away every state in the history.
+*/
+
+void SnapshotHistory::clear()
+{
+	entries.clear();
+	byteCount = 0;
+}
+
+/**
+*  Function: push(const vector <uint8> & state)
+*
+*  Purpose: This function adds a state to the end of the history.
+*
+*  Inputs: state - The state's bytes.
+*/
+
+void SnapshotHistory::push(const vector <uint8> & state)
+{
+	int index = (int)entries.size();
+
+	entries.resize( index + 1 );
+
+	if ( index % keyframeInterval == 0 )
+	{
+		entries[index] = state;
+	}
+	else
+	{
+		snapshotDelta( entries[index - index % keyframeInterval], state, entries[index] );
+	}
+
+	byteCount += (int)entries[index].size();
+}
+
+/**
+*  Function: get(int index, vector <uint8> & state)
+*
+*  Purpose: This function gets a state back out of the history.
+*
+*  Inputs: index - Which state, counting from 0.
+*          state - Replaced with the state's bytes.
+*
+*  Returns: True if there is such a state.
+*/
+
+bool SnapshotHistory::get(int index, vector <uint8> & state) const
+{
+	if ( index < 0 || index >= (int)entries.size() )
+	{
+		return false;
+	}
+
+	if ( index % keyframeInterval == 0 )
+	{
+		state = entries[index];
+		return true;
+	}
+
+	const vector <uint8> & delta = entries[index];
+
+	return applySnapshotDelta( entries[index - index % keyframeInterval], & delta[0], (int)delta.size(), state );
+}
+
+/**
+*  Function: truncate(int count)
+*
+*  Purpose: This function throws away the states after the first count, as
+*           when the game rewinds and then plays on from an earlier frame.
+*
+*  Inputs: count - The number of states to keep.
+*/
+
+void SnapshotHistory::truncate(int count)
+{
+	while ( (int)entries.size() > count && entries.empty() == false )
+	{
+		byteCount -= (int)entries.back().size();
+		entries.pop_back();
+	}
+}
+
+/**
+*  Function: getCount()
+*
+*  Returns: The number of states in the history.
+*/
+
+int SnapshotHistory::getCount() const
+{
+	return (int)entries.size();
+}
+
+/**
+*  Function: getByteCount()
+*
+*  Returns: The bytes the history's states take up, keyframes and deltas together.
+*/
+
+int SnapshotHistory::getByteCount() const
+{
+	return byteCount;
+}
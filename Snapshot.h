@@ -0,0 +1,97 @@
+/**
+*  File:  Snapshot.h
+*
+*  Description:  This header file contains the game snapshots.  A GameSnapshot
+*                holds everything a GameSession depends on: the screen it is on,
+*                the level and score, the fade counter and the flags that track
+*                the end of the level, and the level itself, as written by
+*                LevelSimulation::saveState().  GameSession::capture() fills one
+*                in and GameSession::restore() puts it back, which is how a lost
+*                level is retried without laying it out again, and how the game
+*                rewinds while Backspace is held.
+*
+*                A snapshot is turned into bytes with writeGameSnapshot().  The
+*                session's fields have a fixed size and place, and from one frame
+*                to the next most of the level's bytes stay where they were, so
+*                snapshotDelta() can store the next snapshot as little more than
+*                the bytes that changed.
+*                SnapshotHistory keeps a run of states that way: a full copy every
+*                SNAPSHOT_KEYFRAME_INTERVAL states, and in between, each state as a
+*                delta from its keyframe, so getting any state back takes a single
+*                delta, never a chain of them.
+*
+*                SnapshotHistory and the deltas work on any bytes, so LevelSimulation
+*                states (LevelSimulation::saveState()) can be checkpointed with them
+*                too, as PrismsTools snapshot does.
+*
+*                GameSnapshot bytes are written in the machine's own byte order.
+*                They are meant to be read back by the same program, not kept in
+*                files.  (Replay.h is the format for files.)
+*
+*                Delta format (see ByteStream.h for varints): the size of the new
+*                state, then runs of: bytes the same as the base, bytes that
+*                differ, and those bytes.  Past the end of the base every byte
+*                counts as different.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include "ByteStream.h"
+
+const int SNAPSHOT_KEYFRAME_INTERVAL = 30;  // Half a second of play between full copies.
+
+const int SNAPSHOT_FADE_TO_WHITE = 1;                  // Bits of GameSnapshot::flags, one
+const int SNAPSHOT_FADE_COMPLETE = 2;                  // for each of the bool members of
+const int SNAPSHOT_REMAINING_BUBBLES_CONTRACTED = 4;   // GameSession.
+const int SNAPSHOT_WON_LEVEL = 8;
+
+/**
+*  GameSnapshot is the state of a GameSession between two frames.
+*/
+
+struct GameSnapshot
+{
+	int32 screen;               // A GameScreen.
+	int32 level;
+	int32 levelPoints;
+	int32 totalPoints;
+	int32 fadeCounter;
+	uint32 levelSeed;
+	int32 flags;                // SNAPSHOT_FADE_TO_WHITE ... SNAPSHOT_WON_LEVEL
+	vector <uint8> levelState;  // LevelSimulation::saveState()
+};
+
+void writeGameSnapshot(const GameSnapshot & snapshot, vector <uint8> & bytes);
+bool readGameSnapshot(const uint8 * data, int size, GameSnapshot & snapshot);
+
+void snapshotDelta(const vector <uint8> & base, const vector <uint8> & next, vector <uint8> & delta);
+bool applySnapshotDelta(const vector <uint8> & base, const uint8 * delta, int size, vector <uint8> & next);
+
+/**
+*  SnapshotHistory keeps a run of states, one for each frame, in as little memory
+*  as it can while still getting any of them back quickly.
+*/
+
+class SnapshotHistory
+{
+private:
+	int keyframeInterval;
+	vector < vector <uint8> > entries;  // Every keyframeInterval-th one is a whole state, the rest are deltas from it.
+	int byteCount;
+
+public:
+	SnapshotHistory(int interval = SNAPSHOT_KEYFRAME_INTERVAL);
+	void clear();
+	void push(const vector <uint8> & state);
+	bool get(int index, vector <uint8> & state) const;
+	void truncate(int count);
+	int getCount() const;
+	int getByteCount() const;
+};
+
+#endif
@@ -0,0 +1,655 @@
+/**
+*  File:  SoftwareFont.cpp
+*
+*  Description:  This file contains the font SoftwareRenderer draws text with:
+*                the printable ASCII characters of DejaVu Sans, drawn at 40
+*                pixels to the em, 8x8 samples to a pixel.  Each pixel's
+*                coverage, 0 to 15, is one hex digit of FONT_COVERAGE.
+*
+*                DejaVu Sans is derived from Bitstream Vera Sans.
+*                Copyright (c) 2003 by Bitstream, Inc.  All Rights Reserved.
+*                Bitstream Vera is a trademark of Bitstream, Inc.  DejaVu
+*                changes are in the public domain.  The font may be embedded
+*                and redistributed as long as this notice is kept; its full
+*                license is at https://dejavu-fonts.github.io/License.html.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "SoftwareFont.h"
+
+const FontGlyph FONT_GLYPHS[FONT_CHARACTERS] =
+{
+	{  0,  0,   0,   0, 13,     0 },  // ' '
+	{  4, 30,   6,   7, 16,     0 },  // '!'
+	{ 12, 12,   3,   7, 18,   120 },  // '"'
+	{ 28, 29,   3,   8, 34,   264 },  // '#'
+	{ 20, 37,   3,   6, 25,  1076 },  // '$'
+	{ 34, 31,   2,   7, 38,  1816 },  // '%'
+	{ 28, 31,   2,   7, 31,  2870 },  // '&'
+	{  5, 12,   3,   7, 11,  3738 },  // '\''
+	{ 10, 37,   3,   6, 16,  3798 },  // '('
+	{ 10, 37,   3,   6, 16,  4168 },  // ')'
+	{ 18, 19,   1,   7, 20,  4538 },  // '*'
+	{ 26, 26,   4,  11, 34,  4880 },  // '+'
+	{  6, 10,   3,  32, 13,  5556 },  // ','
+	{ 12,  4,   1,  24, 14,  5616 },  // '-'
+	{  5,  5,   4,  32, 13,  5664 },  // '.'
+	{ 14, 34,   0,   7, 13,  5689 },  // '/'
+	{ 21, 31,   2,   7, 25,  6165 },  // '0'
+	{ 18, 30,   4,   7, 25,  6816 },  // '1'
+	{ 20, 30,   2,   7, 25,  7356 },  // '2'
+	{ 20, 31,   3,   7, 25,  7956 },  // '3'
+	{ 23, 30,   1,   7, 25,  8576 },  // '4'
+	{ 19, 31,   3,   7, 25,  9266 },  // '5'
+	{ 21, 31,   2,   7, 25,  9855 },  // '6'
+	{ 20, 30,   3,   7, 25, 10506 },  // '7'
+	{ 21, 31,   2,   7, 25, 11106 },  // '8'
+	{ 21, 31,   2,   7, 25, 11757 },  // '9'
+	{  5, 21,   4,  16, 13, 12408 },  // ':'
+	{  6, 26,   3,  16, 13, 12513 },  // ';'
+	{ 26, 23,   4,  13, 34, 12669 },  // '<'
+	{ 26, 13,   4,  18, 34, 13267 },  // '='
+	{ 26, 23,   4,  13, 34, 13605 },  // '>'
+	{ 17, 30,   2,   7, 21, 14203 },  // '?'
+	{ 36, 36,   2,   8, 40, 14713 },  // '@'
+	{ 28, 30,   0,   7, 27, 16009 },  // 'A'
+	{ 22, 30,   3,   7, 27, 16849 },  // 'B'
+	{ 24, 31,   2,   7, 28, 17509 },  // 'C'
+	{ 26, 30,   3,   7, 31, 18253 },  // 'D'
+	{ 20, 30,   3,   7, 25, 19033 },  // 'E'
+	{ 18, 30,   3,   7, 23, 19633 },  // 'F'
+	{ 26, 31,   2,   7, 31, 20173 },  // 'G'
+	{ 24, 30,   3,   7, 30, 20979 },  // 'H'
+	{  5, 30,   3,   7, 12, 21699 },  // 'I'
+	{ 11, 39,  -3,   7, 12, 21849 },  // 'J'
+	{ 25, 30,   3,   7, 26, 22278 },  // 'K'
+	{ 20, 30,   3,   7, 22, 23028 },  // 'L'
+	{ 28, 30,   3,   7, 35, 23628 },  // 'M'
+	{ 23, 30,   3,   7, 30, 24468 },  // 'N'
+	{ 28, 31,   2,   7, 31, 25158 },  // 'O'
+	{ 20, 30,   3,   7, 24, 26026 },  // 'P'
+	{ 28, 36,   2,   7, 31, 26626 },  // 'Q'
+	{ 24, 30,   3,   7, 28, 27634 },  // 'R'
+	{ 22, 31,   2,   7, 25, 28354 },  // 'S'
+	{ 26, 30,  -1,   7, 24, 29036 },  // 'T'
+	{ 23, 31,   3,   7, 29, 29816 },  // 'U'
+	{ 28, 30,   0,   7, 27, 30529 },  // 'V'
+	{ 38, 30,   1,   7, 40, 31369 },  // 'W'
+	{ 26, 30,   1,   7, 27, 32509 },  // 'X'
+	{ 26, 30,  -1,   7, 24, 33289 },  // 'Y'
+	{ 25, 30,   1,   7, 27, 34069 },  // 'Z'
+	{  9, 37,   3,   6, 16, 34819 },  // '['
+	{ 14, 34,   0,   7, 13, 35152 },  // '\\'
+	{ 10, 37,   3,   6, 16, 35628 },  // ']'
+	{ 26, 12,   4,   7, 34, 35998 },  // '^'
+	{ 22,  4,  -1,  43, 20, 36310 },  // '_'
+	{ 10,  8,   3,   5, 20, 36398 },  // '`'
+	{ 19, 24,   2,  14, 25, 36478 },  // 'a'
+	{ 21, 32,   3,   6, 25, 36934 },  // 'b'
+	{ 18, 24,   2,  14, 22, 37606 },  // 'c'
+	{ 20, 32,   2,   6, 25, 38038 },  // 'd'
+	{ 21, 24,   2,  14, 25, 38678 },  // 'e'
+	{ 15, 31,   0,   6, 14, 39182 },  // 'f'
+	{ 20, 32,   2,  14, 25, 39647 },  // 'g'
+	{ 19, 31,   3,   6, 25, 40287 },  // 'h'
+	{  5, 31,   3,   6, 11, 40876 },  // 'i'
+	{  9, 40,  -1,   6, 11, 41031 },  // 'j'
+	{ 21, 31,   3,   6, 23, 41391 },  // 'k'
+	{  5, 31,   3,   6, 11, 42042 },  // 'l'
+	{ 33, 23,   3,  14, 39, 42197 },  // 'm'
+	{ 19, 23,   3,  14, 25, 42956 },  // 'n'
+	{ 21, 24,   2,  14, 24, 43393 },  // 'o'
+	{ 21, 32,   3,  14, 25, 43897 },  // 'p'
+	{ 20, 32,   2,  14, 25, 44569 },  // 'q'
+	{ 14, 23,   3,  14, 16, 45209 },  // 'r'
+	{ 17, 24,   2,  14, 21, 45531 },  // 's'
+	{ 14, 29,   1,   8, 16, 45939 },  // 't'
+	{ 19, 24,   3,  14, 25, 46345 },  // 'u'
+	{ 22, 22,   1,  15, 24, 46801 },  // 'v'
+	{ 31, 22,   1,  15, 33, 47285 },  // 'w'
+	{ 22, 22,   1,  15, 24, 47967 },  // 'x'
+	{ 22, 31,   1,  15, 24, 48451 },  // 'y'
+	{ 19, 22,   1,  15, 21, 49133 },  // 'z'
+	{ 16, 38,   5,   6, 25, 49551 },  // '{'
+	{  4, 41,   5,   6, 13, 50159 },  // '|'
+	{ 16, 38,   5,   6, 25, 50323 },  // '}'
+	{ 26,  7,   4,  21, 34, 50931 }   // '~'
+};
+
+const char FONT_COVERAGE[] =
+	"2222ffffffffffffffffffffffffffffffffffffffffffffffffffffdfffdffdcffdbffbaffb9ffa6996000000000000"
+	"0000ffffffffffffffffffff0222000012212fff2000bff82fff2000bff82fff2000bff82fff2000bff82fff2000bff8"
+	"2fff2000bff82fff2000bff82fff2000bff82fff2000bff82fff2000bff8199910007995000000000008bb5000009bb3"
+	"000000000000000eff300001fff1000000000000003ffe000005ffc0000000000000007ffb000008ff80000000000000"
+	"00aff700000cff5000000000000000eff300001fff1000000000000003ffe000005ffc0000000000000006ffb000009f"
+	"f8000000006999999dffc99999effc999995009ffffffffffffffffffffffff8009ffffffffffffffffffffffff80046"
+	"6666affc66666bffb666666300000000aff800000cff5000000000000000eff400001fff1000000000000003fff00000"
+	"5ffd0000000000000007ffb000008ff9000000000000000aff700000cff5000000002222222eff522223fff322222000"
+	"dffffffffffffffffffffffff400dffffffffffffffffffffffff400bdddddfffedddddfffedddddd300000000eff300"
+	"001fff1000000000000002ffe000005ffd0000000000000006ffb000008ff9000000000000000aff700000cff5000000"
+	"000000000eff300001fff1000000000000002ffe000005ffc0000000000000006ffb000008ff8000000000000000aff7"
+	"00000cff50000000000000000000263000000000000000006f8000000000000000006f8000000000000000006f800000"
+	"0000000000006f80000000000000048adfecb86200000006efffffffffffe40000bffffffffffffff60009fffd726f81"
+	"36aef6002fffc1006f80000064007fff30006f80000000009ffe00006f80000000009ffe00006f80000000009fff3000"
+	"6f80000000005fffd2006f80000000000dfffe947f800000000003efffffffc841000000002bffffffffffa400000000"
+	"39dfffffffffa100000000028fdefffffb00000000006f804affff60000000006f80006fffd0000000006f80000bfff1"
+	"000000006f800008fff2000000006f800008fff1100000006f80000cffe0992000006f80007fff809ffb62006f804bff"
+	"fe109fffffecdfefffffe4003afffffffffffffa200000148bdffffdb7200000000000008f8000000000000000008f80"
+	"00000000000000008f8000000000000000008f8000000000000000008f8000000000000000007d700000000000004899"
+	"83000000000000007bb6000000002cffffffb1000000000003ffe100000001efffcdfffc10000000000bff500000000a"
+	"ffd2003eff80000000005ffb000000002fff200004fff100000001eff3000000007ffb000000dff600000008ff800000"
+	"0000aff70000009ff80000003ffe1000000000bff60000008ff9000000bff50000000000bff60000008ff9000006ffb0"
+	"0000000000bff60000008ff900001eff2000000000009ff8000000aff700009ff80000000000005ffd000001eff40003"
+	"ffd10000000000000eff700009ffd0000cff5000000000000006fff955bfff40006ffb00000000000000008ffffffff7"
+	"0001eff2000002443000000004bffffb400009ff800005dffffd6000000001221000003ffd10008ffffffffa00000000"
+	"00000000cff50005fff9438fff7000000000000006ffb0000dff800006ffe10000000000001eff20004ffe000000dff6"
+	"0000000000009ff800007ffa0000008ff9000000000003ffd000009ff80000006ffb00000000000cff5000009ff80000"
+	"006ffb00000000006ffb0000009ff80000006ffb0000000001eff20000008ff90000007ffa0000000009ff800000005f"
+	"fd000000bff7000000004ffd000000001eff500003fff200000000cff40000000008ffe5004eff9000000007ffa00000"
+	"000000bfffeefffd100000001eff20000000000019ffffffa10000000059960000000000000026887200000000000037"
+	"9999730000000000000000003bffffffffe91000000000000004efffffffffff400000000000002efffe9768bfff4000"
+	"00000000009fffb10000016d40000000000000effe100000000010000000000002fffa000000000000000000000002ff"
+	"f8000000000000000000000001fffc000000000000000000000000bfff4000000000000000000000005fffe100000000"
+	"000000000000000bfffd10000000000000000000001affffb100000000000000000001bffffffb100000000000000000"
+	"1bfff9efffb100000000099950009fff802efffb100000002fff7004fffb0004efffb00000004fff400cfff200004eff"
+	"fa0000008fff002fffa0000004efffa00000bffa005fff600000004efffa0002fff5007fff4000000004efffa008ffd0"
+	"008fff50000000005ffffa2fff60005fff800000000005ffffeffc00002fffd000000000005ffffff300000dfff70000"
+	"00000005ffffb0000006ffff600000000019fffff8000000bffffa20000016dfffffff8000001cfffffda9acfffffb7f"
+	"fff8000001affffffffffffe7007ffff70000004bffffffffd7100007ffff70000000157888630000000000000022202"
+	"fff22fff22fff22fff22fff22fff22fff22fff22fff22fff2199910000005662000004ffd000000cff6000006ffd0000"
+	"00eff6000007ffe000000dff8000005fff300000bffd000001fff8000006fff400000afff000000dffc000001fffa000"
+	"004fff8000006fff6000008fff4000008fff4000008fff4000008fff4000008fff5000006fff6000004fff8000001fff"
+	"a000000dffc0000009fff1000005fff4000001fff9000000affd0000004fff4000000dff90000006ffe1000000dff700"
+	"00006ffe0000000cff70000003ffe1000000344146620000005ffd0000000cff70000004ffe1000000cff80000005ffe"
+	"1000000eff70000009ffd0000004fff4000000effa000000affe0000006fff4000003fff8000001fffa000000dffd000"
+	"000bfff000000bfff2000009fff2000009fff2000009fff200000bfff100000cfff000000effd000001fffa000004fff"
+	"7000007fff300000affe000000eff9000004fff4000009ffd000000eff7000006ffe100000cff8000005ffe100000cff"
+	"6000005ffc000000344200000000000001bb1000000000000002ff2000000000000002ff2000000001000002ff200000"
+	"102f910002ff200019f28ffe5002ff2005eff805dffb32ff23bffd500007effaffaffe7000000018ffffff8100000000"
+	"004ffff4000000000029ffffff9200000018ffe8ff8eff810007effa12ff21affe709ffc4002ff2004cff92d700002ff"
+	"200007d200000002ff2000000000000002ff2000000000000002ff200000000000000188100000000000000000022210"
+	"000000000000000000000dff60000000000000000000000dff60000000000000000000000dff60000000000000000000"
+	"000dff60000000000000000000000dff60000000000000000000000dff60000000000000000000000dff600000000000"
+	"00000000000dff60000000000000000000000dff60000000000000000000000dff60000000000034444444444eff8444"
+	"44444441bffffffffffffffffffffffff4bffffffffffffffffffffffff4bffffffffffffffffffffffff41222222222"
+	"2dff72222222222000000000000dff60000000000000000000000dff60000000000000000000000dff60000000000000"
+	"000000000dff60000000000000000000000dff60000000000000000000000dff60000000000000000000000dff600000"
+	"00000000000000000dff60000000000000000000000dff60000000000000000000000dff60000000000004fffb04fffb"
+	"04fffb05fffa09fff40dffb01fff306ffa009ff3008970000888888888840ffffffffff80ffffffffff8099999999995"
+	"bfff6bfff6bfff6bfff6bfff6000000000022210000000001fff40000000005ffe0000000000affa0000000000eff500"
+	"00000004fff10000000009ffb0000000000dff60000000003fff20000000008ffc0000000000cff70000000002fff300"
+	"00000007ffd0000000000bff80000000001fff40000000006ffe0000000000affa0000000000eff50000000004fff100"
+	"00000009ffb0000000000eff60000000004fff20000000008ffc0000000000dff70000000002fff20000000007ffd000"
+	"0000000bff80000000001fff40000000006ffe0000000000bff90000000001fff50000000005fff00000000009ffa000"
+	"0000000abb50000000000000000037999840000000000003bfffffffe70000000005fffffffffffb10000004ffffe988"
+	"bffffa000001dfff9000004efff600008fffb00000004fffe0000efff200000000afff6005fffa0000000004fffb009f"
+	"ff60000000000efff10cfff20000000000afff40fffe000000000007fff72fffc000000000006fff84fffb0000000000"
+	"04fffa5fff9000000000003fffb6fff9000000000002fffb6fff9000000000002fffb6fff9000000000002fffb4fff90"
+	"00000000004fffb4fffb000000000004fffa2fffc000000000006fff80fffe000000000008fff60cfff20000000000af"
+	"ff408fff60000000000efff004fffb0000000004fffa000efff300000000bfff50007fffc00000005fffd00000dfffb1"
+	"00006ffff5000003effffb9adffff900000004effffffffff900000000029fffffffc500000000000015788630000000"
+	"00000002222100000000369cfffff60000008ffffffffff60000009ffffffffff60000009ffffc9cfff6000000796300"
+	"09fff600000000000009fff600000000000009fff600000000000009fff600000000000009fff600000000000009fff6"
+	"00000000000009fff600000000000009fff600000000000009fff600000000000009fff600000000000009fff6000000"
+	"00000009fff600000000000009fff600000000000009fff600000000000009fff600000000000009fff6000000000000"
+	"09fff600000000000009fff600000000000009fff600000000000009fff600000000000009fff60000000666666bfff9"
+	"6666640ffffffffffffffffb0ffffffffffffffffb0ffffffffffffffffb000003689998520000000049efffffffffb3"
+	"00000cffffffffffffff80000dfffffca9befffff8000dffa40000005dffff400c810000000001dfffb0010000000000"
+	"004ffff1000000000000000dfff3000000000000000bfff4000000000000000bfff4000000000000000efff100000000"
+	"0000005fffc000000000000000cfff6000000000000008fffc000000000000005ffff300000000000004efff60000000"
+	"0000002efff800000000000002efff900000000000002efffa00000000000002efffa00000000000002efffa00000000"
+	"000001dfffa00000000000001dfffb10000000000001dfffb10000000000001dfffb10000000000001dfffb100000000"
+	"00001dfffe666666666666632ffffffffffffffffff82ffffffffffffffffff82ffffffffffffffffff8000147899997"
+	"4000000019dffffffffffe8100002ffffffffffffffd30002ffffeba9acfffffe2002d95100000018ffffb0000000000"
+	"000004ffff3000000000000000bfff70000000000000006fff80000000000000006fff80000000000000008fff600000"
+	"0000000001dfff100000000000001bfff800000003444459efffa00000000dffffffffd5000000000dfffffffd500000"
+	"00000dfffffffffd4000000000000137dffff60000000000000007ffff30000000000000008fffa0000000000000001f"
+	"fff0000000000000000cfff3000000000000000bfff4000000000000000bfff3000000000000000efff1000000000000"
+	"007fffc070000000000005ffff70fe9410000004affffc00fffffdcbbdffffffe200fffffffffffffffb100049dfffff"
+	"fffffb40000000014688886410000000000000000000022222000000000000000005fffff00000000000000001efffff"
+	"0000000000000000affffff0000000000000005ffeefff000000000000001eff5dfff000000000000009ffb0dfff0000"
+	"0000000004ffe20dfff0000000000001dff600dfff0000000000009ffc000dfff000000000004fff2000dfff00000000"
+	"001dff80000dfff00000000009ffd00000dfff0000000004fff300000dfff000000000dff9000000dfff000000008ffd"
+	"1000000dfff00000003fff40000000dfff0000000dffa00000000dfff0000008ffe100000000dfff000000fff7222222"
+	"222dfff222200fffffffffffffffffffff40fffffffffffffffffffff40fffffffffffffffffffff402222222222222d"
+	"fff2222000000000000000dfff0000000000000000000dfff0000000000000000000dfff0000000000000000000dfff0"
+	"000000000000000000dfff0000000000000000000dfff00000012222222222222210009ffffffffffffffb0009ffffff"
+	"ffffffffb0009ffffffffffffffb0009ffd2222222222210009ffd0000000000000009ffd0000000000000009ffd0000"
+	"000000000009ffd0000000000000009ffd0000000000000009ffd0144420000000009fffdfffffea40000009ffffffff"
+	"ffffc200009fffffffffffffe40009ea6320137cffffe200310000000006ffffb000000000000005ffff300000000000"
+	"000afff8000000000000004fffb000000000000001fffd000000000000000ffff000000000000001fffd000000000000"
+	"003fffc000000000000008fff900000000000002ffff55000000000002dfffd0de9410000028fffff40dffffdcbcefff"
+	"fff700dfffffffffffffe60006befffffffffd810000000357888853000000000000000037999974000000000007dfff"
+	"ffffffa00000002cffffffffffff0000002effffeb99bdfff000001dfffd500000027c00000afffb1000000000000004"
+	"fffd1000000000000000bfff50000000000000002fffc00000000000000007fff70000000000000000bfff3000144410"
+	"0000000efff004bfffffd8100000fffd0afffffffffe60002fffbbffffddffffff7002ffffffe710004cffff404fffff"
+	"e40000000bfffd02fffff6000000001efff42ffffe00000000008fff81ffffa00000000004fffb0efff800000000002f"
+	"ffd0cfff800000000000fffd0afff800000000001fffd06fff900000000003fffc01fffd00000000007fff900bfff400"
+	"0000000dfff5004fffd100000008fffd00009fffc3000018ffff500001dffffc99aeffff80000001cfffffffffff8000"
+	"0000007efffffffb4000000000000478885200000012222222222222222220bffffffffffffffffff0bfffffffffffff"
+	"fffff0bfffffffffffffffffa012222222222222dfff4000000000000004fffd0000000000000009fff8000000000000"
+	"001efff2000000000000006fffb000000000000000cfff5000000000000002fffe0000000000000008fff90000000000"
+	"00000efff3000000000000005fffc000000000000000bfff6000000000000001ffff1000000000000007fffa00000000"
+	"0000000dfff4000000000000004fffd0000000000000009fff7000000000000001ffff2000000000000006fffb000000"
+	"000000000cfff5000000000000003fffe0000000000000008fff8000000000000000efff3000000000000005fffc0000"
+	"00000000000bfff6000000000000002ffff1000000000000007fffa0000000000000000015899997300000000002afff"
+	"ffffffd500000005effffffffffffa000004fffffb888aeffffa0000dfffd30000009ffff4004ffff200000000afffa0"
+	"07fff90000000002fffe009fff60000000000efff009fff60000000000dfff007fff70000000000fffd002fffc000000"
+	"0005fff80009fff700000002effe10001bfffb410027efff40000008fffffffffffc3000000003dffffffff800000000"
+	"2afffffffffffe5000004efffc74235affff80001efff700000003dfff7008fff90000000003fffe10efff1000000000"
+	"09fff63fffc000000000005fff94fffb000000000004fffb4fffb000000000004fffa2fffd000000000007fff90efff4"
+	"0000000000cfff60afffc1000000007ffff103ffffd40000019ffff90007fffffda99bfffffd100007fffffffffffffb"
+	"10000002afffffffffc6000000000004688875200000000000016899973000000000002affffffffc4000000004effff"
+	"fffffff70000004fffffa888dffff600001efffb2000006ffff30008fffc100000006fffb000efff4000000000bfff30"
+	"3fffd00000000005fff805fff900000000002fffd07fff800000000000ffff18fff800000000000ffff46fff80000000"
+	"0001ffff65fffb00000000004ffff81ffff10000000008ffff90bfff8000000002effff905ffff50000001bfffff900b"
+	"ffff930016dffefff9001cfffffffffffe8fff80001afffffffffc27fff70000039dffffb6009fff4000000000220000"
+	"0cfff10000000000000002fffd00000000000000007fff80000000000000000efff20000000000000009fffa00001000"
+	"00000007fffe200009b61000004bffff4000009fffecbcffffff70000009fffffffffffe400000005bffffffffe81000"
+	"000000014688863000000000299974fffb4fffb4fffb4fffb14443000000000000000000000000000000000000000000"
+	"000000004fffb4fffb4fffb4fffb4fffb02999704fffb04fffb04fffb04fffb014443000000000000000000000000000"
+	"00000000000000000000000000000000004fffb04fffb04fffb05fffa09fff40dffb01fff306ffa009ff300897000000"
+	"00000000000000000000001000000000000000000000049e4000000000000000000028dfff4000000000000000016cff"
+	"ffff4000000000000005afffffffe910000000000049efffffffa50000000000028dfffffffb51000000000017cfffff"
+	"ffc71000000000005bfffffffd820000000000039effffffe8300000000000000bfffffea400000000000000000bffff"
+	"b10000000000000000000bffffffa50000000000000000038dffffffe940000000000000000049effffffd8300000000"
+	"0000000005bfffffffd72000000000000000017cfffffffc71000000000000000038dfffffffb6100000000000000004"
+	"9efffffffa2000000000000000005bffffff4000000000000000000017cfff4000000000000000000000028d40000000"
+	"000000000000000000012222222222222222222222220bffffffffffffffffffffffff4bffffffffffffffffffffffff"
+	"4bffffffffffffffffffffffff4122222222222222222222222200000000000000000000000000000000000000000000"
+	"0000000000000000000000000000000000034444444444444444444444441bffffffffffffffffffffffff4bffffffff"
+	"ffffffffffffffff4bffffffffffffffffffffffff41222222222222222222222222010000000000000000000000000b"
+	"c610000000000000000000000bfffa500000000000000000000bfffffe94000000000000000005bfffffffd820000000"
+	"00000000027cfffffffc71000000000000000038dfffffffb50000000000000000049effffffe9400000000000000000"
+	"5afffffffd83000000000000000016bfffffffc71000000000000000027cffffff400000000000000000006effff4000"
+	"000000000000028dffffff4000000000000027cfffffffb50000000000016bfffffffc72000000000005afffffffd830"
+	"000000000049effffffe940000000000038dfffffffb50000000000006dfffffffc7100000000000000bfffffd830000"
+	"0000000000000bffe9400000000000000000000bb5000000000000000000000000000000000000000000000000000002"
+	"589998400000005bffffffffe50001cffffffffffff8002ffffda88bfffff602ffa3000002dfffe02c3000000001efff"
+	"4000000000000afff60000000000008fff6000000000000bfff4000000000003fffe000000000001dfff700000000001"
+	"dfffb00000000001dfffb10000000001dfffb10000000000cfffb100000000007fffb100000000000dffe20000000000"
+	"02fffa0000000000004fff80000000000004fff80000000000004fff80000000000004fff80000000000000222100000"
+	"000000000000000000000000000000000000000006fff90000000000006fff90000000000006fff90000000000006fff"
+	"90000000000006fff9000000000000000000000001222100000000000000000000000000038befffffeb830000000000"
+	"000000000006cfffffffffffffc5000000000000000004dfffffeca9abefffffc3000000000000008ffffc7200000002"
+	"7cffff6000000000001bfffc400000000000004cfff80000000000bfff7000000000000000008fff7000000009ffe400"
+	"000000000000000007fff40000005ffe40000000000000000000007ffe100001eff500000000144310000000000aff80"
+	"0008ffa00000004bfffffa307dd50001eff1000eff10000007fffffffff68ff600008ff7005ff90000006ffffb99bfff"
+	"dff600003ffb00aff3000001effd300002cffff600000efe00efd0000008ffe10000001dfff600000bff22ffa000000d"
+	"ff7000000005fff6000009ff34ff8000001fff2000000000fff6000009ff35ff6000003ffe0000000000cff600000aff"
+	"26ff6000004ffd0000000000bff600000cff05ff6000003ffe0000000000cff600001ffc04ff8000001fff1000000000"
+	"fff600007ff801ffa000000dff6000000005fff60001eff200efe0000008ffd10000001cfff6000bff8000aff4000001"
+	"effc200001bffff603cffb00005ffa0000006ffffb88afffdffbcfffb100000eff20000008fffffffff78ffffff80000"
+	"0008ffb00000004bfffffb308fffc71000000001eff7000000001443100034310000000000005fff5000000000000000"
+	"000000000000000008fff500000000000000000000000000000000afff800000000000000004d30000000000000afffd"
+	"60000000000003bffe100000000000007ffffd8410000037cffffb1000000000000002bffffffedddffffffe50000000"
+	"000000000004affffffffffffc60000000000000000000000159bdefdca7200000000000000000000000122220000000"
+	"0000000000000000cffff30000000000000000000003fffff80000000000000000000009fffffe000000000000000000"
+	"000effffff500000000000000000005fff7fffb0000000000000000000bfff1afff1000000000000000002fffa04fff7"
+	"000000000000000007fff400effd00000000000000000dffd0008fff30000000000000004fff80003fff900000000000"
+	"00009fff30000cffe000000000000001effc000007fff500000000000006fff7000001fffb0000000000000bfff10000"
+	"00bfff2000000000002fffb00000005fff8000000000008fff500000000effd00000000000effe0000000009fff40000"
+	"000004fff90000000004fffa000000000afffdbbbbbbbbbbffff100000001fffffffffffffffffff600000007fffffff"
+	"ffffffffffffc0000000cfff8888888888888cfff3000003fffb00000000000006fff8000009fff700000000000001ff"
+	"fe00000efff100000000000000afff50005fffb0000000000000005fffb000bfff50000000000000000efff102ffff10"
+	"0000000000000009fff708fffa000000000000000004fffd002222222222220000000002fffffffffffffc82000002ff"
+	"ffffffffffffff910002fffffffffffffffffb0002fffd222222237dffff8002fffd0000000000afffe002fffd000000"
+	"00000efff402fffd00000000000afff602fffd000000000009fff602fffd00000000000afff402fffd00000000001eff"
+	"f102fffd0000000000afffa002fffd222222247dfffd1002ffffffffffffffff910002ffffffffffffffe7100002ffff"
+	"fffffffffffff70002fffd2222222249ffffa002fffd00000000002dfff702fffd000000000003fffe02fffd00000000"
+	"0000cfff42fffd0000000000009fff82fffd0000000000008fff92fffd000000000000afff92fffd000000000000dfff"
+	"72fffd000000000005ffff42fffd00000000004efffc02fffe444444457bfffff402ffffffffffffffffff5002ffffff"
+	"ffffffffffc30002ffffffffffffdb8300000000000000047999997400000000000039efffffffffe93000000019ffff"
+	"fffffffffffa200002dfffffeb989adfffffb0002effffb4000000027effb000cfffe50000000000008fb008fffe4000"
+	"000000000003a02ffff60000000000000000008fffc0000000000000000000dfff50000000000000000003ffff100000"
+	"00000000000006fffc00000000000000000008fff90000000000000000000afff80000000000000000000bfff6000000"
+	"0000000000000bfff60000000000000000000bfff70000000000000000000afff800000000000000000008fffa000000"
+	"00000000000005fffc00000000000000000002ffff10000000000000000000dfff600000000000000000008fffd00000"
+	"000000000000001efff700000000000000001007ffff5000000000000005b000bffff70000000000019fb0001dffffc5"
+	"100000049fffb00001cffffffdbabcefffffb0000008fffffffffffffff81000000018dfffffffffc710000000000002"
+	"5788875100000022222222221000000000000002ffffffffffffdb740000000002ffffffffffffffffd810000002ffff"
+	"ffffffffffffffe6000002fffd222222247aefffff800002fffd000000000017effff80002fffd0000000000002cffff"
+	"4002fffd00000000000001dfffd002fffd000000000000004ffff402fffd000000000000000bfffa02fffd0000000000"
+	"000006fffe02fffd0000000000000002ffff22fffd0000000000000000efff42fffd0000000000000000cfff62fffd00"
+	"00000000000000bfff62fffd0000000000000000bfff62fffd0000000000000000bfff62fffd0000000000000000dfff"
+	"52fffd0000000000000000efff42fffd0000000000000002ffff12fffd0000000000000007fffd02fffd000000000000"
+	"000cfff902fffd000000000000005ffff302fffd00000000000002efffb002fffd0000000000003effff3002fffd0000"
+	"00000029fffff60002fffe444444569dffffff600002ffffffffffffffffffc3000002ffffffffffffffffb500000002"
+	"ffffffffffdca851000000000022222222222222222212ffffffffffffffffff62ffffffffffffffffff62ffffffffff"
+	"ffffffff62fffd2222222222222212fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd00"
+	"00000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffe4444444444444302ff"
+	"fffffffffffffffb02fffffffffffffffffb02fffffffffffffffffb02fffd2222222222222102fffd00000000000000"
+	"02fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000"
+	"000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffe6666666666666642ffffffffff"
+	"ffffffffb2ffffffffffffffffffb2ffffffffffffffffffb0222222222222222212ffffffffffffffff92ffffffffff"
+	"ffffff92ffffffffffffffff92fffd22222222222212fffd00000000000002fffd00000000000002fffd000000000000"
+	"02fffd00000000000002fffd00000000000002fffd00000000000002fffd00000000000002fffe44444444444102ffff"
+	"fffffffffff602fffffffffffffff602fffffffffffffff602fffd22222222222102fffd00000000000002fffd000000"
+	"00000002fffd00000000000002fffd00000000000002fffd00000000000002fffd00000000000002fffd000000000000"
+	"02fffd00000000000002fffd00000000000002fffd00000000000002fffd00000000000002fffd00000000000002fffd"
+	"000000000000000000000003689999852000000000000039effffffffffd830000000019ffffffffffffffffb3000002"
+	"dfffffeca989beffffff00002effffb40000000049efff0001dfffe500000000000018ff0008fffe4000000000000000"
+	"3d002ffff6000000000000000001008fffc000000000000000000000efff5000000000000000000003ffff1000000000"
+	"000000000006fffc0000000000000000000008fff9000000000000000000000afff8000000000000000000000bfff600"
+	"0000000024444444443bfff600000000009fffffffffbbfff700000000009fffffffffbafff800000000009fffffffff"
+	"b8fff900000000000000004fffb6fffc00000000000000004fffb2ffff10000000000000004fffb0dfff600000000000"
+	"00004fffb08fffc0000000000000004fffb01ffff7000000000000004fffb007ffff500000000000004fffb000cffff7"
+	"0000000000004fffb0001dffffd62000000038efffb00001bffffffebbabcefffffe60000007efffffffffffffff9200"
+	"00000017cffffffffffc71000000000000015688886410000000222200000000000000122202fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffe44444444444444cfff22ffffffffffffffffffff"
+	"ff22ffffffffffffffffffffff22ffffffffffffffffffffff22fffd22222222222222cfff22fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bf"
+	"ff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bfff22fffd00000000000000bf"
+	"ff2022222fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2ff"
+	"fd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd2fffd000000022220000002fffd0000002fffd000000"
+	"2fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd000"
+	"0002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd"
+	"0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002fffd0000002f"
+	"ffc0000004fffb0000006fff9000000bfff6000007ffff11667bffff902fffffffd102ffffffc2002fffda4000000000"
+	"00000002222000000000000022222002fffd000000000001affff5002fffd00000000001bfffe50002fffd0000000001"
+	"bfffe400002fffd000000001dfffe4000002fffd00000002dfffe20000002fffd0000002efffd200000002fffd000003"
+	"efffd1000000002fffd00004efffc10000000002fffd0004efffb100000000002fffd005ffffb1000000000002fffd05"
+	"ffffa00000000000002fffd7ffff9000000000000002ffffffff80000000000000002fffffffd00000000000000002ff"
+	"ffffff90000000000000002fffd8ffff8000000000000002fffd08ffff800000000000002fffd008ffff800000000000"
+	"02fffd0008ffff8000000000002fffd00008ffff800000000002fffd000008ffff80000000002fffd0000008ffff8000"
+	"000002fffd00000008ffff800000002fffd000000008ffff80000002fffd0000000008ffff8000002fffd00000000008"
+	"ffff800002fffd000000000008ffff80002fffd0000000000008ffff8002fffd00000000000008ffff80022220000000"
+	"000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd000"
+	"0000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fff"
+	"d0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd000000000000000"
+	"2fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd00000000000"
+	"00002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000"
+	"000000002fffd0000000000000002fffe6666666666666612ffffffffffffffffff22ffffffffffffffffff22fffffff"
+	"fffffffffff202222220000000000000002222212ffffff100000000000008fffff92ffffff60000000000000dfffff9"
+	"2ffffffc0000000000004ffffff92fffefff300000000000affefff92fffbcff800000000001fff9fff92fffb7ffe000"
+	"00000006ffe4fff92fffb1fff4000000000cff94fff92fffb0bffa000000002fff34fff92fffb05fff100000008ffd04"
+	"fff92fffb00eff60000000eff704fff92fffb009ffc0000004fff204fff92fffb003fff300000affb004fff92fffb000"
+	"cff800001fff5004fff92fffb0007ffe00006ffe0004fff92fffb0001fff4000cff90004fff92fffb0000affa003fff3"
+	"0004fff92fffb00005fff108ffc00004fff92fffb00000eff60eff700004fff92fffb000008ffc5fff100004fff92fff"
+	"b000003fffcffb000004fff92fffb000000cfffff5000004fff92fffb0000007ffffe0000004fff92fffb0000001ffff"
+	"90000004fff92fffb0000000466620000004fff92fffb0000000000000000004fff92fffb0000000000000000004fff9"
+	"2fffb0000000000000000004fff92fffb0000000000000000004fff92fffb0000000000000000004fff9022222000000"
+	"000000022222fffff9000000000000dfff2ffffff200000000000dfff2ffffffa00000000000dfff2fffffff30000000"
+	"000dfff2fffffffb0000000000dfff2fffbbfff4000000000dfff2fffb4fffb000000000dfff2fffb0bfff500000000d"
+	"fff2fffb03fffc00000000dfff2fffb00afff60000000dfff2fffb002fffd0000000dfff2fffb0009fff6000000dfff2"
+	"fffb0001fffe000000dfff2fffb00008fff800000dfff2fffb00001effe10000dfff2fffb000007fff80000dfff2fffb"
+	"000000efff1000dfff2fffb0000006fff9000dfff2fffb0000000dfff200dfff2fffb00000005fffa00dfff2fffb0000"
+	"0000cfff30dfff2fffb000000004fffb0dfff2fffb000000000bfff4dfff2fffb0000000004fffbdfff2fffb00000000"
+	"00afffffff2fffb00000000003fffffff2fffb000000000009ffffff2fffb000000000002ffffff2fffb000000000000"
+	"9fffff000000000158999974000000000000000005bfffffffffe810000000000002bfffffffffffffe600000000004e"
+	"fffffc988aefffff9000000003effff810000004cffff90000001dfffe300000000009ffff6000009fffe30000000000"
+	"009fffe20002ffff600000000000001dfff90008fffc0000000000000005ffff100efff60000000000000000dfff603f"
+	"fff100000000000000009fffa06fffc000000000000000005fffd08fff9000000000000000002ffff1afff8000000000"
+	"000000000ffff2bfff6000000000000000000ffff4bfff6000000000000000000dfff4bfff7000000000000000000fff"
+	"f4afff8000000000000000000ffff28fffa000000000000000002ffff06fffc000000000000000005fffd02ffff10000"
+	"0000000000009fffa00dfff60000000000000000efff5008fffd0000000000000006fffe1001ffff700000000000001e"
+	"fff800008ffff4000000000000bfffe100000cfffe40000000001affff50000002effffa30000016dffff8000000002d"
+	"fffffeb9acffffff8000000000019fffffffffffffd400000000000003aeffffffffc700000000000000000036888752"
+	"0000000000022222222221000000002fffffffffffeb7100002fffffffffffffff70002ffffffffffffffffa002fffd2"
+	"2222248effff702fffd000000002dfffe12fffd0000000002ffff52fffd0000000000bfff92fffd00000000007fffb2f"
+	"ffd00000000006fffb2fffd00000000007fffb2fffd0000000000afff92fffd0000000002ffff62fffd000000001bfff"
+	"f12fffd00000026dffff802ffffffffffffffffb002fffffffffffffff91002ffffffffffffd9300002fffe444444310"
+	"0000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd00000"
+	"00000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0000000000000002fffd0"
+	"000000000000002fffd000000000000000000000000158999974000000000000000005bfffffffffe810000000000002"
+	"bfffffffffffffe600000000004efffffc988aefffff9000000003effff810000004cffff90000001dfffe3000000000"
+	"09ffff6000009fffe30000000000009fffe20002ffff600000000000001dfff90008fffc0000000000000005ffff100e"
+	"fff60000000000000000dfff603ffff100000000000000009fffa06fffc000000000000000005fffd08fff9000000000"
+	"000000002ffff1afff8000000000000000000ffff2bfff6000000000000000000ffff4bfff6000000000000000000dff"
+	"f4bfff7000000000000000000ffff4afff8000000000000000000ffff28fffa000000000000000002ffff06fffc00000"
+	"0000000000005fffd02ffff100000000000000009fff900dfff60000000000000000efff5008fffd0000000000000006"
+	"fffe0001ffff700000000000001efff800008ffff4000000000000bfffe100000cfffe40000000001affff50000002ef"
+	"fffa30000016dffff7000000002dfffffeb9acffffff6000000000019fffffffffffffd400000000000003aeffffffff"
+	"fa00000000000000000036888affff400000000000000000000000afffe300000000000000000000000bfffe20000000"
+	"0000000000000001bfffd100000000000000000000001dfffd1000000000000000000000012222100002222222222100"
+	"00000000002ffffffffffffc83000000002fffffffffffffff910000002ffffffffffffffffc1000002fffd22222237d"
+	"ffff9000002fffd000000001bffff200002fffd0000000001efff600002fffd00000000009fff900002fffd000000000"
+	"07fffb00002fffd00000000006fffb00002fffd00000000008fffa00002fffd0000000000cfff800002fffd000000000"
+	"5ffff300002fffd000000006ffffa000002fffe999999beffffd1000002fffffffffffffff910000002fffffffffffff"
+	"f6000000002fffe9999aceffff800000002fffd00000006efff80000002fffd000000004ffff3000002fffd000000000"
+	"7fffc000002fffd0000000000dfff600002fffd00000000005fffd00002fffd00000000000cfff60002fffd000000000"
+	"005fffd0002fffd000000000000cfff6002fffd0000000000005fffd002fffd0000000000000dfff602fffd000000000"
+	"00006fffd02fffd00000000000000dfff6000000158999986410000000004bfffffffffffc72000008ffffffffffffff"
+	"f600009fffffca889adffff60004ffffa2000000027cf6000cfff900000000000043002fffe000000000000000004fff"
+	"a000000000000000006fff9000000000000000005fffb000000000000000003ffff300000000000000000dfffe400000"
+	"000000000006fffffd8510000000000000affffffffda7300000000008fffffffffffd700000000029effffffffffd40"
+	"00000000047bdffffffff4000000000000015afffffe10000000000000001bffff800000000000000000bfffd0000000"
+	"00000000004ffff100000000000000000ffff200000000000000000ffff200000000000000001ffff110000000000000"
+	"007fffd04e71000000000004efff804fffa5100000028ffffe104ffffffdb99bdffffff4003efffffffffffffffd3000"
+	"0049dffffffffffc6000000000014688887410000000022222222222222222222222212ffffffffffffffffffffffff8"
+	"2ffffffffffffffffffffffff82ffffffffffffffffffffffff802222222222cfff5222222222100000000000bfff400"
+	"0000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff400000000000000000000"
+	"0bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000"
+	"000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff40000"
+	"00000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000b"
+	"fff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff400000000000000"
+	"0000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000"
+	"000000000000000bfff4000000000000000000000bfff40000000000122210000000000000022218fff8000000000000"
+	"02fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002ff"
+	"fb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8f"
+	"ff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff80"
+	"0000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000000000002fffb8fff800000"
+	"000000002fffb8fff800000000000003fffb7fff800000000000004fffb5fffa00000000000006fffa3fffd000000000"
+	"00009fff70efff2000000000000dfff40afff9000000000005fffe003ffff50000000002efff80009ffff920000017ef"
+	"ffd10001bfffffcb9acfffffe2000001afffffffffffffc2000000004bfffffffffc6000000000000147888752000000"
+	"012221000000000000000000222207fffa000000000000000005fffc01ffff10000000000000000bfff600afff700000"
+	"00000000001ffff1004fffc0000000000000007fffa0000dfff300000000000000cfff400008fff800000000000003ff"
+	"fd000002fffe00000000000009fff8000000bfff5000000000000efff20000006fffa000000000005fffb00000001eff"
+	"f10000000000bfff5000000009fff70000000002fffe0000000004fffc0000000007fff90000000000dfff300000000d"
+	"fff300000000007fff900000003fffc000000000002fffe00000009fff7000000000000bfff5000000efff1000000000"
+	"0005fffb000005fffa00000000000000efff10000bfff4000000000000008fff70002fffe0000000000000003fffc000"
+	"7fff80000000000000000cfff300dfff200000000000000006fff904fffc000000000000000001fffe09fff600000000"
+	"0000000000afff6efff10000000000000000004fffefff900000000000000000000dffffff4000000000000000000008"
+	"fffffd0000000000000000000002fffff70000000000000000000000bffff20000000000012221000000000001222200"
+	"0000000000122208fff7000000000009ffff200000000000efff14fffb00000000000dffff600000000003fffc00fffe"
+	"00000000001fffffa00000000006fff800bfff30000000005fffffe0000000000afff5008fff70000000009ff9fff200"
+	"0000000efff1004fffb000000000dff5bff6000000002fffc0000fffe000000001fff28ffa000000006fff80000bfff3"
+	"00000005ffd04ffe00000000afff500008fff700000009ff901fff20000000efff100004fffb0000000dff600cff6000"
+	"0002fffc000000fffe0000001fff2008ffa0000006fff8000000bfff3000005ffd0004ffe000000afff50000008fff70"
+	"00009ffa0001fff200000efff10000004fffb00000dff60000cff600002fffc00000000fffe00001fff200008ff90000"
+	"6fff800000000bfff30005ffe000005ffd0000afff5000000008fff70008ffa000001fff2000efff1000000004fffb00"
+	"0cff6000000dff6002fffc0000000000fffe001fff30000009ff9006fff80000000000bfff305ffe00000005ffd009ff"
+	"f500000000008fff708ffa00000002fff20dfff100000000004fffa0cff700000000dff62fffc000000000000fffe1ff"
+	"f3000000009ff96fff8000000000000bfff8ffe0000000006ffd9fff50000000000008fffeffa0000000002fffefff10"
+	"000000000004ffffff70000000000efffffc00000000000000ffffff30000000000afffff800000000000000bffffe00"
+	"0000000006fffff4000000000000008ffffb000000000002fffff100000000122220000000000000012221002efff300"
+	"00000000003fffe20006fffd000000000000cfff600000bfff800000000008fffb0000002efff3000000003fffe20000"
+	"0006fffd00000000cfff6000000000bfff80000008fffb00000000002efff300003fffe2000000000006fffd0000dfff"
+	"60000000000000bfff8008fffb000000000000002efff33fffe20000000000000006fffddfff600000000000000000bf"
+	"fffffb0000000000000000002effffe200000000000000000009ffff600000000000000000002fffff90000000000000"
+	"000000cffffff4000000000000000007fffefffd10000000000000002ffff2bfff9000000000000000cfff702efff300"
+	"000000000007fffc0006fffd0000000000002ffff20000bfff800000000000cfff7000002efff30000000007fffc0000"
+	"0006fffd000000002ffff200000000bfff80000000cfff70000000002efff3000007fffc000000000006fffc00002fff"
+	"f2000000000000bfff8000cfff700000000000002efff307fffc0000000000000006fffc002222000000000000000012"
+	"22109fff9000000000000003fffe201dfff40000000000000cfff60004fffd1000000000008fffb000009fff90000000"
+	"0003fffe2000001dfff4000000000cfff600000004fffd100000008fffb0000000009fffa0000003fffe10000000001d"
+	"fff500000cfff5000000000004fffe10008fffa00000000000008fffa003fffe100000000000000dfff50dfff5000000"
+	"0000000003fffe9fff9000000000000000008ffffffd1000000000000000000cfffff400000000000000000003ffff90"
+	"00000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff40000000000000000000"
+	"00bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff400000000000"
+	"0000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000"
+	"000000000000000000bfff4000000000000000000000bfff4000000000000000000000bfff4000000000001222222222"
+	"222222222222200bffffffffffffffffffffff20bffffffffffffffffffffff20bffffffffffffffffffffff20122222"
+	"222222222224efff90000000000000000001cfffc0000000000000000000afffe20000000000000000007ffff3000000"
+	"0000000000004ffff60000000000000000002efff90000000000000000001cfffb0000000000000000000bfffd100000"
+	"00000000000008ffff30000000000000000004ffff50000000000000000003efff80000000000000000001dfffb00000"
+	"00000000000000bfffd10000000000000000008fffe30000000000000000005ffff50000000000000000003efff80000"
+	"000000000000001dfffb0000000000000000000bfffd10000000000000000009fffe20000000000000000006ffff4000"
+	"0000000000000003ffff70000000000000000001efffa0000000000000000000cffff66666666666666666644fffffff"
+	"ffffffffffffffff94fffffffffffffffffffffff94fffffffffffffffffffffff93666666648fffffffb8fffffffb8f"
+	"ff666648fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff0000"
+	"08fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff0"
+	"00008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff000008fff888868fffffffb8f"
+	"ffffffb24444444322210000000000cff800000000007ffd00000000003fff20000000000dff700000000008ffb00000"
+	"000004fff10000000000eff60000000000affa00000000005fff00000000001fff50000000000bff900000000006ffe0"
+	"0000000001fff40000000000bff800000000007ffd00000000002fff20000000000dff700000000008ffb00000000004"
+	"fff10000000000eff600000000009ffb00000000005fff10000000000fff50000000000affa00000000006ffe0000000"
+	"0001fff40000000000bff800000000007ffd00000000002fff30000000000dff700000000008ffc00000000004fff200"
+	"00000000bbb416666666612ffffffff22ffffffff216666afff2000008fff2000008fff2000008fff2000008fff20000"
+	"08fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2"
+	"000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008fff2000008"
+	"fff2000008fff2000008fff2000008fff2000008fff2000008fff218888bfff22ffffffff22ffffffff2044444444000"
+	"0000000002221000000000000000000001bffff50000000000000000001bffffff500000000000000000bffffffff500"
+	"0000000000000afffe4affff40000000000000afffe3008fffe400000000000afffd200007fffe4000000000afffb100"
+	"00005fffe400000009fffb1000000004effe4000008fff9000000000003effe20008fff800000000000002dffe205bbb"
+	"60000000000000001abba126666666666666666666626ffffffffffffffffffff66ffffffffffffffffffff626666666"
+	"666666666666624fff80000006fff40000008ffe2000000affc0000000bff80000001dff50000002efe2000000244200"
+	"000024666410000000016befffffffc6000000fffffffffffffc10000ffffdb99beffffd1000fb510000005dfff80003"
+	"00000000001cfff1000000000000003fff6000000000000000dff9000000000000000bffb0000037abbbbbbbeffd0005"
+	"dfffffffffffffd009fffffffffffffffd07ffffa53100000bffd1effe3000000000bffd5fff60000000000cffd8fff1"
+	"0000000001fffd9fff00000000005fffd8fff2000000000dfffd6fff8000000009ffffd2ffff6000001afffffd09ffff"
+	"c888afffbbffd00bffffffffffb1bffd0008effffffe700bffd00001578874000000002666100000000000000006fff4"
+	"00000000000000006fff400000000000000006fff400000000000000006fff400000000000000006fff4000000000000"
+	"00006fff400000000000000006fff400000000000000006fff400014665200000006fff4029ffffffb4000006fff44ef"
+	"ffffffff800006fff6effda9beffff70006fffefe5000018ffff4006fffff400000007fffc006ffff7000000000bfff4"
+	"06fffe10000000004fff906fffa00000000000effc06fff700000000000bfff06fff5000000000009fff26fff4000000"
+	"000008fff36fff4000000000008fff36fff5000000000009fff26fff700000000000bfff16fff900000000000effd06f"
+	"ffe00000000004fffa06ffff6000000000afff506ffffe200000005fffd006fffffd3000006ffff5006fff8fffb888cf"
+	"fff90006fff46ffffffffffa00006fff404cffffffe6000000000000036887400000000000000024665310000000029e"
+	"fffffffc7100007ffffffffffff8000afffffca9bcfff8008ffff920000016c804ffff5000000000010bfff700000000"
+	"00002fffd00000000000006fff700000000000009fff40000000000000bfff10000000000000bfff00000000000000bf"
+	"ff00000000000000bfff100000000000009fff300000000000007fff700000000000002fffc00000000000000cfff500"
+	"000000000004fffe30000000000000afffe600000004a7001bffffea888aeff80001affffffffffff8000004bfffffff"
+	"fe92000000025788863000000000000000000056640000000000000000dffb0000000000000000dffb00000000000000"
+	"00dffb0000000000000000dffb0000000000000000dffb0000000000000000dffb0000000000000000dffb0000000466"
+	"520000dffb000018efffffc500dffb0003dfffffffff90dffb002effffc99cfff8dffb00cfffc300002bfffffb06fffc"
+	"10000000bffffb0dfff2000000002ffffb3fffa00000000009fffb7fff500000000004fffb9fff200000000001fffbbf"
+	"ff000000000000effbbffe000000000000dffbbffd000000000000dffbbfff000000000000dffb9fff100000000000ff"
+	"fb7fff500000000003fffb3fff900000000008fffb0dfff1000000001efffb07fffb00000000affffb00dfffa1000019"
+	"fffffb003ffffea889effadffb0005efffffffffb1dffb00002bffffffe700dffb000000268874000000000000000035"
+	"664200000000000029effffffc60000000007fffffffffffc1000000afffffcaacffffd100007fffe6000002bfffb000"
+	"3fffe200000000afff500afff30000000001effb01fffb000000000008fff15fff5000000000004fff48fff200000000"
+	"0002fff6bfffdddddddddddddfff8bfffffffffffffffffff8bfffdddddddddddddddd7bfff000000000000000009fff"
+	"300000000000000007fff600000000000000002fffc00000000000000000cfff500000000000000004fffe3000000000"
+	"00030009ffff71000000038e90000affffeb8889befff9000008ffffffffffffff90000003afffffffffea5000000000"
+	"046888753000000000000014666650000002affffffd000003efffffffd00000cfffda999800004fffa00000000007ff"
+	"f200000000009fff000000000009fff000000000009fff00000002dddefffdddddb02ffffffffffffd02dddefffddddd"
+	"b000009fff000000000009fff000000000009fff000000000009fff000000000009fff000000000009fff00000000000"
+	"9fff000000000009fff000000000009fff000000000009fff000000000009fff000000000009fff000000000009fff00"
+	"0000000009fff000000000009fff000000000009fff000000000009fff000000000009fff000000000009fff00000000"
+	"0000004665200000000000029ffffffc500bdda0004efffffffff90dffb003effffc99cfff8dffb00dfffb200002bfff"
+	"ffb08fffb00000000affffb0efff2000000001efffb4fff900000000008fffb7fff400000000003fffbafff100000000"
+	"000fffbbfff000000000000dffbbffd000000000000dffbbffe000000000000dffbbfff000000000000effb9fff30000"
+	"0000001fffb6fff600000000005fffb2fffb0000000000afffb0bfff4000000003ffffb04fffe30000002effffb00aff"
+	"ff830038efdeffb001bffffffffffe4dffb00019ffffffffd30dffb0000039dffeb6000eff90000000000000001fff80"
+	"000000000000006fff5000000000000000cfff1000100000000009fff90002e830000004bfffe20002fffeba9befffff"
+	"500002ffffffffffffe40000006aefffffffc7100000000001345431000000026661000000000000006fff4000000000"
+	"000006fff4000000000000006fff4000000000000006fff4000000000000006fff4000000000000006fff40000000000"
+	"00006fff4000000000000006fff4000036652000006fff4018efffffd50006fff42dfffffffff8006fff5efffcbcffff"
+	"f606fffefe600001afffe16ffffe20000000afff56ffff4000000003fff96fffc0000000000dffc6fff70000000000bf"
+	"fd6fff500000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009ff"
+	"f6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff"
+	"6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff166624fff64fff64fff6"
+	"4fff6022210000000000000003ddd54fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64"
+	"fff64fff64fff64fff64fff64fff64fff64fff600001666200004fff600004fff600004fff600004fff6000002221000"
+	"00000000000000000000000000003ddd500004fff600004fff600004fff600004fff600004fff600004fff600004fff6"
+	"00004fff600004fff600004fff600004fff600004fff600004fff600004fff600004fff600004fff600004fff600004f"
+	"ff600004fff600004fff600004fff600004fff600004fff500005fff400009fff10004effc08bdffff60bfffffa00bff"
+	"fd70004543000002666100000000000000006fff400000000000000006fff400000000000000006fff40000000000000"
+	"0006fff400000000000000006fff400000000000000006fff400000000000000006fff400000000000000006fff40000"
+	"0000000000006fff40000000007dddc206fff4000000009fffd2006fff40000001afffb10006fff4000001cfffa10000"
+	"6fff400002dfff90000006fff40004efff700000006fff4005efff5000000006fff406fffe40000000006fff48fffe20"
+	"0000000006fffdfffc1000000000006fffffff30000000000006fffbfffe4000000000006fff48fffe400000000006ff"
+	"f407fffe40000000006fff4007fffe5000000006fff40007ffff500000006fff400005ffff50000006fff4000005ffff"
+	"6000006fff40000005ffff700006fff400000004efff70006fff4000000004efff7006fff40000000004efff80166624"
+	"fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff64f"
+	"ff64fff64fff64fff64fff64fff64fff64fff64fff64fff64fff60000000004665100000000035652000005ddd3019ff"
+	"ffffa2000018efffffb30006fff42effffffffe3002dfffffffff4006fff5effebbdffffd01dfffcbcffffe206fffefd"
+	"500004efff7bfe600002cfff906ffffd10000003fffefe20000001effe06ffff300000000affff6000000008fff46fff"
+	"b0000000006fffd0000000004fff66fff70000000004fffa0000000002fff86fff50000000004fff70000000000fff86"
+	"fff40000000004fff60000000000fff96fff40000000004fff60000000000fff96fff40000000004fff60000000000ff"
+	"f96fff40000000004fff60000000000fff96fff40000000004fff60000000000fff96fff40000000004fff6000000000"
+	"0fff96fff40000000004fff60000000000fff96fff40000000004fff60000000000fff96fff40000000004fff6000000"
+	"0000fff96fff40000000004fff60000000000fff96fff40000000004fff60000000000fff96fff40000000004fff6000"
+	"0000000fff96fff40000000004fff60000000000fff900000000036652000005ddd3018efffffd50006fff42dfffffff"
+	"ff8006fff5efffcbcfffff606fffefe600001afffe16ffffe20000000afff56ffff4000000003fff96fffc0000000000"
+	"dffc6fff70000000000bffd6fff500000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009"
+	"fff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009f"
+	"ff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009fff6fff400000000009ff"
+	"f000000014665300000000000006cffffffe92000000001cfffffffffff60000001dffffda9cfffff700000bfffe5000"
+	"01affff40006fffe100000009fffd000dfff4000000000cfff503fffc00000000005fffa07fff700000000000effe09f"
+	"ff300000000000bfff1bfff1000000000009fff3bfff0000000000008fff4bfff0000000000008fff4bfff1000000000"
+	"009fff49fff300000000000bfff27fff600000000000effe03fffb00000000004fffb00dfff3000000000bfff6007fff"
+	"c100000006fffe0000dfffc2000007ffff500003effffb889effff90000003dfffffffffff80000000018efffffffb40"
+	"00000000000478885200000000000000014665200000005ddd3029ffffffb4000006fff44efffffffff800006fff6eff"
+	"da9beffff70006fffefe5000018ffff4006fffff400000007fffc006ffff7000000000bfff406fffe10000000004fff9"
+	"06fffa00000000000effc06fff700000000000bfff06fff5000000000009fff26fff4000000000008fff36fff4000000"
+	"000008fff36fff5000000000009fff26fff700000000000bfff16fff900000000000effd06fffe00000000004fffa06f"
+	"fff6000000000afff506ffffe200000005fffd006fffffd3000006ffff5006fff8fffb888cffff90006fff46ffffffff"
+	"ffa00006fff404cffffffe6000006fff400036887400000006fff400000000000000006fff400000000000000006fff4"
+	"00000000000000006fff400000000000000006fff400000000000000006fff400000000000000006fff4000000000000"
+	"000026661000000000000000000000004665200000000000018efffffc500bdda0003dfffffffff90dffb002effffc99"
+	"cfff8dffb00cfffc300002bfffffb06fffc10000000bffffb0dfff2000000002ffffb3fffa00000000009fffb7fff500"
+	"000000004fffb9fff200000000001fffbbfff000000000000effbbffe000000000000dffbbffd000000000000dffbbff"
+	"f000000000000dffb9fff100000000000fffb7fff500000000003fffb3fff900000000008fffb0dfff1000000001efff"
+	"b07fffb00000000affffb00dfffa1000019fffffb003ffffea889effadffb0005efffffffffb1dffb00002bffffffe70"
+	"0dffb0000002688740000dffb0000000000000000dffb0000000000000000dffb0000000000000000dffb00000000000"
+	"00000dffb0000000000000000dffb0000000000000000dffb0000000000000000dffb000000000000000056640000000"
+	"00356515ddd3018effff66fff44effffff66fff6efffdcdf86fffeff81000136ffffe400000006ffff6000000006fffd"
+	"0000000006fff90000000006fff60000000006fff40000000006fff40000000006fff40000000006fff40000000006ff"
+	"f40000000006fff40000000006fff40000000006fff40000000006fff40000000006fff40000000006fff40000000006"
+	"fff40000000006fff4000000000000001466654100000005bffffffffea4001affffffffffffb00affffdb99acfffb03"
+	"fffd4000000049b08fff20000000000009ffc00000000000009ffd00000000000008fff70000000000003ffffb510000"
+	"000000affffffc95100000009fffffffffb500000039effffffffc10000000369dfffffd0000000000038ffff6000000"
+	"0000005fffb0000000000000effd0000000000000cffd4000000000002fffbdd7200000002cfff5dfffda8888bffffb0"
+	"dfffffffffffffb1049dfffffffffc60000001468888520000000022210000000004fff60000000004fff60000000004"
+	"fff60000000004fff60000000004fff60000000004fff60000000bdefffeddddddadffffffffffffbbdefffedddddda0"
+	"04fff60000000004fff60000000004fff60000000004fff60000000004fff60000000004fff60000000004fff6000000"
+	"0004fff60000000004fff60000000004fff60000000004fff60000000004fff60000000004fff60000000003fff60000"
+	"000001fffa0000000000cfff72000000006fffffffffb00009ffffffffb0000049ceffffb00000000000000000008ddd"
+	"00000000000bdda9fff00000000000dffb9fff00000000000dffb9fff00000000000dffb9fff00000000000dffb9fff0"
+	"0000000000dffb9fff00000000000dffb9fff00000000000dffb9fff00000000000dffb9fff00000000000dffb9fff00"
+	"000000000dffb9fff00000000000dffb9fff00000000000dffb9fff00000000000effb8fff10000000001fffb7fff300"
+	"00000005fffb5fff7000000000cfffb1fffe100000008ffffb0afffb1000019fffffb03fffffb99bfff8dffb006fffff"
+	"fffff80dffb0004dffffffd500dffb00000378874000000008ddd20000000000007ddd44fff8000000000000dffe00ef"
+	"fd000000000003fff9008fff400000000009fff3003fff90000000000effd0000cffe1000000005fff700006fff60000"
+	"0000bfff200001fffb00000001fffb000000afff20000007fff50000004fff7000000cffe00000000effd000003fff90"
+	"00000008fff400008fff3000000003fff90000effd0000000000cffe0005fff700000000006fff500afff20000000000"
+	"1fffb01fffb000000000000afff26fff50000000000004fff7cffe00000000000000effefff9000000000000008fffff"
+	"f3000000000000003fffffd0000000000000000cffff7000000003ddd500000000bddd8000000009ddc00eff90000000"
+	"2ffffd00000000effa00bffe00000006fffff10000003fff6007fff2000000afffff60000007fff2003fff6000000eff"
+	"cff9000000bffd0000effa000002fff4ffd000000eff90000affe000007ffb0fff200003fff600006fff30000aff70bf"
+	"f600008fff200002fff70000eff307ffa0000bffd000000dffb0003ffe003ffe0001fff90000009fff0007ffa000eff3"
+	"004fff50000005fff400bff6000aff7008fff10000001fff800fff20006ffb00cffc00000000cffc04ffd00002fff01f"
+	"ff8000000008fff18ff900000eff45fff4000000004fff5cff5000009ff89fff0000000001fffafff1000006ffcdffb0"
+	"000000000cfffffc0000002ffffff800000000008fffff80000000dfffff300000000004fffff400000009ffffe00000"
+	"0000000fffff100000005ffffb000000000000bfffc000000001ffff70000000addd600000000008ddd8002effe30000"
+	"00005fffd10005fffc10000002efff3000009fff9000000cfff70000001cfff600008fffb000000003effe3004fffd10"
+	"000000006fffc02efff4000000000009fff9bfff70000000000001cffffffb000000000000003effffe1000000000000"
+	"0008ffff40000000000000002effff9000000000000000cffffff500000000000008fffbfffe2000000000004fffd17f"
+	"ffc00000000002efff400afff8000000000bfff70001dfff400000008fffb000004fffe2000004fffe10000007fffb00"
+	"001efff400000000bfff8000bfff80000000001efff407fffb000000000004fffe18ddd20000000000007ddd44fff800"
+	"0000000000dffe00cffe000000000004fff8006fff50000000000afff2001effb0000000001fffb00009fff200000000"
+	"7fff500003fff800000000dffe000000cffe00000004fff80000005fff5000000afff20000000effb000001fffb00000"
+	"0008fff200007fff4000000002fff80000dffd0000000000bffe0004fff800000000005fff500afff200000000000dff"
+	"b01fffb0000000000007fff27fff40000000000001fff8dffd00000000000000affffff8000000000000004ffffff200"
+	"0000000000000dffffb00000000000000006ffff400000000000000001fffd000000000000000004fff7000000000000"
+	"00000afff100000000000000002fffa000000000000000009fff400000000000000005fffb0000000000000abbdffff3"
+	"0000000000000dffffff800000000000000dffffe6000000000000000566430000000000000000adddddddddddddddd3"
+	"0bffffffffffffffff40bffffffffffffffff400000000000004ffff20000000000002efff50000000000001dfff7000"
+	"0000000000bfff90000000000000afffb00000000000008fffd10000000000005fffe20000000000004fffe300000000"
+	"00002efff50000000000001dfff70000000000000bfff90000000000000afffb00000000000008fffc10000000000006"
+	"fffe20000000000004fffe30000000000002efff500000000000004ffffddddddddddddd34fffffffffffffffff44fff"
+	"ffffffffffffff40000000000145663000000007dfffff80000000afffffff80000004ffffb86630000009fff6000000"
+	"00000cffe000000000000dffb000000000000dffb000000000000dffb000000000000dffb000000000000dffb0000000"
+	"00000dffb000000000000dffb000000000000fff9000000000001fff9000000000006fff700000000002dfff20000006"
+	"67affff80000000ffffffc500000000ffffffb400000000678bffff6000000000003efff1000000000006fff60000000"
+	"00002fff9000000000000fff9000000000000dffb000000000000dffb000000000000dffb000000000000dffb0000000"
+	"00000dffb000000000000dffb000000000000dffb000000000000cffe0000000000009fff4000000000004ffff964420"
+	"000000bfffffff8000000018efffff800000000003678848994dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6d"
+	"ff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6dff6d"
+	"ff6dff6dff6dff656626664300000000000fffffea200000000fffffffe200000006679efffa000000000001dfff0000"
+	"000000007fff3000000000004fff5000000000004fff6000000000004fff6000000000004fff6000000000004fff6000"
+	"000000004fff6000000000004fff6000000000004fff6000000000002fff8000000000000fffc000000000000afff700"
+	"0000000002efffc866300000002affffff8000000018efffff80000001dfffd98630000009fff800000000000effd000"
+	"000000002fff8000000000004fff6000000000004fff6000000000004fff6000000000004fff6000000000004fff6000"
+	"000000004fff6000000000004fff6000000000004fff5000000000007fff300000000000cfff10000004457cfffb0000"
+	"000ffffffff30000000ffffffc4000000008886510000000000000004687510000000000000530029effffffb6100000"
+	"0001af407ffffffffffffa5100028eff4affffecbdffffffffddeffffe2bffa4000016bfffffffffffb20bd300000000"
+	"027cffffffb400061000000000000014664100000";
@@ -0,0 +1,35 @@
+/**
+*  File:  SoftwareFont.h
+*
+*  Description:  This header file declares the font SoftwareRenderer draws
+*                text with (SoftwareFont.cpp).  Each printable ASCII character
+*                has a glyph: a box of coverage values, and where the box goes
+*                relative to the pen, whose y is the top of the line of text.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SOFTWARE_FONT_H_
+#define SOFTWARE_FONT_H_
+
+const int FONT_SIZE = 40;            // Pixels to the em, the text size it is drawn at.
+const int FONT_FIRST_CHARACTER = 32;
+const int FONT_CHARACTERS = 95;
+const int FONT_MAX_COVERAGE = 15;
+
+struct FontGlyph
+{
+	int width;    // The size of the box.
+	int height;
+	int left;     // Its top left corner, from the pen.
+	int top;
+	int advance;  // How far the pen moves on.
+	int offset;   // Where its coverage starts in FONT_COVERAGE, top row first.
+};
+
+extern const FontGlyph FONT_GLYPHS[FONT_CHARACTERS];
+extern const char FONT_COVERAGE[];
+
+#endif
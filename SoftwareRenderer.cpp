@@ -0,0 +1,1482 @@
+/**
+*  File:  SoftwareRenderer.cpp
+*
+*  Description:  This file contains the method implementations for the
+*                SoftwareRenderer class, the image decoders it uses (besides
+*                decodePng()), and its blending.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "SoftwareRenderer.h"
+#include "PngDecoder.h"
+#include "Simd.h"
+#include <math.h>    // For sin(), cos(), floor() and ceil().
+#include <stdio.h>   // For fopen().
+#include <string.h>  // For memcpy(), strlen() and strcmp().
+
+const double SOFTWARE_PI = 3.14159265358979;
+
+/**
+*  Function: readLittle(const uint8 * bytes, int count)
+*
+*  Returns: The little-endian integer of count bytes at bytes.
+*/
+
+static uint32 readLittle(const uint8 * bytes, int count)
+{
+	uint32 value = 0;
+
+	for ( int i = count-1; i >= 0; i-- )
+	{
+		value = value << 8 | bytes[i];
+	}
+
+	return value;
+}
+
+/**
+*  Function: decodePacked(const uint8 * bytes, uint32 size, vector <uint32> & out, int width, int height)
+*
+*  Purpose: This function copies the pixels of an image in the media pack.  It
+*           holds a DarkGDK image memblock: the width, height and depth, and
+*           then 32-bit pixels, top row first.
+*
+*  Returns: True if the entry was a 32-bit image of the size expected.
+*/
+
+static bool decodePacked(const uint8 * bytes, uint32 size, vector <uint32> & out, int width, int height)
+{
+	const uint32 headerSize = 12;
+
+	if ( size < headerSize || readLittle( bytes+8, 4 ) != 32 ||
+		 size - headerSize < (uint32)width * (uint32)height * 4 )
+	{
+		return false;
+	}
+
+	out.resize( width * height );
+	memcpy( & out[0], bytes + headerSize, out.size() * 4 );
+
+	return true;
+}
+
+/**
+*  Function: decodeBmp(const char * path, vector <uint32> & out, int width, int height)
+*
+*  Purpose: This function decodes an uncompressed 24- or 32-bit BMP file, like
+*           the game's backgrounds.  Its rows are stored bottom row first unless
+*           its height is negative, and each is padded to a multiple of 4 bytes.
+*
+*  Returns: True if it was decoded.
+*/
+
+static bool decodeBmp(const char * path, vector <uint32> & out, int width, int height)
+{
+	MappedFile file;
+
+	if ( file.open( path ) == false || file.getSize() < 54 )
+	{
+		return false;
+	}
+
+	const uint8 * bytes = file.getData();
+	uint32 dataOffset = readLittle( bytes+10, 4 );
+	int32 storedHeight = (int32)readLittle( bytes+22, 4 );
+	int bytesPerPixel = (int)readLittle( bytes+28, 2 ) / 8;
+	int rowSize = ( width * bytesPerPixel + 3 ) & ~3;
+
+	if ( bytes[0] != 'B' || bytes[1] != 'M' || readLittle( bytes+30, 4 ) != 0 ||
+		 ( bytesPerPixel != 3 && bytesPerPixel != 4 ) ||
+		 dataOffset + (size_t)rowSize * height > file.getSize() )
+	{
+		return false;
+	}
+
+	out.resize( width * height );
+
+	for ( int y = 0; y < height; y++ )
+	{
+		const uint8 * row = bytes + dataOffset + (size_t)rowSize * ( storedHeight < 0 ? y : height-1-y );
+
+		for ( int x = 0; x < width; x++ )
+		{
+			const uint8 * p = row + x * bytesPerPixel;
+
+			out[y*width + x] = 0xff000000 | (uint32)p[2] << 16 | (uint32)p[1] << 8 | p[0];
+		}
+	}
+
+	return true;
+}
+
+/**
+*  Function: makeDisc(const char * path, vector <uint32> & out, int width, int height)
+*
+*  Purpose: This function stands in for an image that can't be decoded.  It
+*           draws an opaque disc that fills the image, in a color picked from
+*           the image's path, so each image still looks different.
+*/
+
+static void makeDisc(const char * path, vector <uint32> & out, int width, int height)
+{
+	uint32 hash = 2166136261u;  // FNV-1a.
+
+	for ( const char * c = path; *c != 0; c++ )
+	{
+		hash = ( hash ^ (uint8)*c ) * 16777619u;
+	}
+
+	uint32 color = 0xff000000 | ( hash & 0x00ffffff );
+	double rx = width / 2.0;
+	double ry = height / 2.0;
+
+	out.resize( width * height );
+
+	for ( int y = 0; y < height; y++ )
+	{
+		for ( int x = 0; x < width; x++ )
+		{
+			double dx = ( x + 0.5 - rx ) / rx;
+			double dy = ( y + 0.5 - ry ) / ry;
+
+			out[y*width + x] = dx*dx + dy*dy <= 1.0 ? color : 0;
+		}
+	}
+}
+
+/**
+*  Function: blendChannel(int over, int under, int alpha)
+*
+*  Returns: over blended over under, (over*alpha + under*(255-alpha)) / 255,
+*           rounded.  Adding the quotient by 256 and dividing by 256 again
+*           is the same as dividing by 255 for every value this can be.
+*/
+
+static inline int blendChannel(int over, int under, int alpha)
+{
+	int t = over * alpha + under * ( 255-alpha ) + 128;
+
+	return ( t + ( t >> 8 ) ) >> 8;
+}
+
+/**
+*  Function: blend(uint32 & pixel, uint32 color, int alpha)
+*
+*  Purpose: This function blends a color over a framebuffer pixel.
+*
+*  Inputs: pixel - The framebuffer pixel.
+*          color - The color, whose own alpha is ignored.
+*          alpha - How opaque it is, 0 to 255.
+*/
+
+static void blend(uint32 & pixel, uint32 color, int alpha)
+{
+	uint32 result = 0xff000000;
+
+	for ( int shift = 0; shift < 24; shift += 8 )
+	{
+		result |= (uint32)blendChannel( ( color >> shift ) & 0xff, ( pixel >> shift ) & 0xff, alpha ) << shift;
+	}
+
+	pixel = result;
+}
+
+/**
+*  Function: divide255(vshort t)
+*
+*  Returns: Each lane of t, rounded, divided by 255 as blendChannel() does.
+*           Each has to be at most 65535 less 128.
+*/
+
+static inline vshort divide255(vshort t)
+{
+	t = vAddWrap16( t, vSet16( 128 ) );
+
+	return vShiftRight16( vAddWrap16( t, vShiftRight16( t, 8 ) ), 8 );
+}
+
+/**
+*  Function: blendHalf(vshort over, vshort under, vshort alpha)
+*
+*  Returns: The channels of two pixels, widened, blended as blendChannel() does.
+*/
+
+static inline vshort blendHalf(vshort over, vshort under, vshort alpha)
+{
+	vshort t = vAddWrap16( vMulLow16( over, alpha ), vMulLow16( under, vSub16( vSet16( 255 ), alpha ) ) );
+
+	return divide255( t );
+}
+
+/**
+*  Function: blendFour(uint32 * pixels, const uint32 * colors, int spriteAlpha)
+*
+*  Purpose: This function blends four colors over four framebuffer pixels,
+*           each by its own alpha times spriteAlpha.  It gives the same
+*           results as blend(), four at a time.
+*
+*  Inputs: pixels - The framebuffer pixels.
+*          colors - The colors, 0xAARRGGBB.
+*          spriteAlpha - 0 to 255.
+*/
+
+static inline void blendFour(uint32 * pixels, const uint32 * colors, int spriteAlpha)
+{
+	vint over = vLoadU( (const int *)colors );
+	vint under = vLoadU( (const int *)pixels );
+
+	vshort overLow = vWidenLowBytes( over );
+	vshort overHigh = vWidenHighBytes( over );
+	vshort alphaLow = vSpreadLast16( overLow );
+	vshort alphaHigh = vSpreadLast16( overHigh );
+
+	if ( spriteAlpha < 255 )
+	{
+		vshort scale = vSet16( (short)spriteAlpha );
+
+		alphaLow = divide255( vMulLow16( alphaLow, scale ) );
+		alphaHigh = divide255( vMulLow16( alphaHigh, scale ) );
+	}
+
+	vshort low = blendHalf( overLow, vWidenLowBytes( under ), alphaLow );
+	vshort high = blendHalf( overHigh, vWidenHighBytes( under ), alphaHigh );
+
+	vStoreU( (int *)pixels, vOr( vNarrowBytes( low, high ), vSet( (int)0xff000000 ) ) );
+}
+
+/**
+*  Function: tintFour(const uint32 * colors, uint32 tint, uint32 * tinted)
+*
+*  Purpose: This function multiplies each channel of four colors by the
+*           tint's, as DarkGDK's sprite diffuse color does.  Alpha is kept.
+*
+*  Inputs: colors - The colors, 0xAARRGGBB.
+*          tint - The tint; its alpha is ignored.
+*          tinted - Where the four results go.
+*/
+
+static inline void tintFour(const uint32 * colors, uint32 tint, uint32 * tinted)
+{
+	vint over = vLoadU( (const int *)colors );
+	vint by = vSet( (int)( tint | 0xff000000 ) );
+
+	vshort low = divide255( vMulLow16( vWidenLowBytes( over ), vWidenLowBytes( by ) ) );
+	vshort high = divide255( vMulLow16( vWidenHighBytes( over ), vWidenHighBytes( by ) ) );
+
+	vStoreU( (int *)tinted, vNarrowBytes( low, high ) );
+}
+
+/**
+*  Function: putFour(uint32 * pixels, const uint32 * colors, int count, int spriteAlpha)
+*
+*  Purpose: This function draws up to four of a sprite's pixels over the
+*           framebuffer: nothing if they are all clear, a copy if they are all
+*           opaque, and blendFour() otherwise.
+*
+*  Inputs: pixels - The framebuffer pixels.
+*          colors - The sprite's pixels, 0xAARRGGBB.  There are always four.
+*          count - How many of them to draw.
+*          spriteAlpha - 0 to 255.
+*/
+
+static inline void putFour(uint32 * pixels, const uint32 * colors, int count, int spriteAlpha)
+{
+	uint32 any = ( colors[0] | colors[1] | colors[2] | colors[3] ) >> 24;
+	uint32 all = ( colors[0] & colors[1] & colors[2] & colors[3] ) >> 24;
+
+	if ( any == 0 )
+	{
+		return;  // All clear.
+	}
+
+	if ( count < 4 )
+	{
+		uint32 under[4] = { 0, 0, 0, 0 };
+
+		memcpy( under, pixels, count * 4 );
+		blendFour( under, colors, spriteAlpha );
+		memcpy( pixels, under, count * 4 );
+	}
+	else if ( all == 0xff && spriteAlpha == 255 )
+	{
+		memcpy( pixels, colors, 4 * 4 );
+	}
+	else
+	{
+		blendFour( pixels, colors, spriteAlpha );
+	}
+}
+
+/**
+*  Function: isOpaque(const vector <uint32> & image)
+*
+*  Returns: True if none of the image's pixels are at all transparent.
+*/
+
+static bool isOpaque(const vector <uint32> & image)
+{
+	for ( size_t i = 0; i < image.size(); i++ )
+	{
+		if ( ( image[i] >> 24 ) != 0xff )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+*  Function: SoftwareRenderer()
+*
+*  Purpose: This is the constructor for the SoftwareRenderer class.  The
+*           framebuffer and background start out black, and the font's
+*           coverage is decoded.
+*/
+
+SoftwareRenderer::SoftwareRenderer()
+                : framebuffer( SCREEN_WIDTH * SCREEN_HEIGHT, BLACK ), background( SCREEN_WIDTH * SCREEN_HEIGHT, BLACK ),
+                  inkColor( WHITE ), textSize( FONT_SIZE ), allDirty( true ), lastDirtyPixels( 0 ), dirtyPixels( 0 )
+{
+	const FontGlyph & last = FONT_GLYPHS[FONT_CHARACTERS-1];
+
+	glyphCoverage.resize( last.offset + last.width * last.height );
+
+	for ( size_t i = 0; i < glyphCoverage.size(); i++ )
+	{
+		char digit = FONT_COVERAGE[i];
+		int value = digit >= 'a' ? digit - 'a' + 10 : digit - '0';
+
+		glyphCoverage[i] = (uint8)( value * 255 / FONT_MAX_COVERAGE );
+	}
+}
+
+/**
+*  Function: setPixels(int imageID)
+*
+*  Purpose: This function notes whether an image whose pixels have just been
+*           set is opaque, so that pasting it can be a copy, and that it isn't
+*           a circle until makeCircleImage() says so.  Sprites may show the
+*           image, so the whole screen is drawn again.
+*/
+
+void SoftwareRenderer::setPixels(int imageID)
+{
+	allDirty = true;
+
+	if ( imageID >= (int)opaque.size() )
+	{
+		const CircleStyle none = { 0, 0, -1 };
+
+		opaque.resize( imageID+1 );
+		circles.resize( imageID+1, none );
+	}
+
+	opaque[imageID] = isOpaque( pixels[imageID] );
+	circles[imageID].alpha = -1;
+}
+
+/**
+*  Function: loadImage(MediaAsset asset, int imageID)
+*
+*  Purpose: This function makes an image the way NullRenderer does, and then
+*           decodes its pixels.  An image that can't be decoded, or isn't the
+*           size the manifest says, is drawn as a disc (see makeDisc()).
+*
+*  Returns: True if the image was made.
+*/
+
+bool SoftwareRenderer::loadImage(MediaAsset asset, int imageID)
+{
+	if ( NullRenderer::loadImage( asset, imageID ) == false )
+	{
+		return false;
+	}
+
+	if ( imageID >= (int)pixels.size() )
+	{
+		pixels.resize( imageID+1 );
+	}
+
+	const NullImage & image = images[imageID];
+	vector <uint32> & out = pixels[imageID];
+	const char * path = getMediaPath( asset );
+	size_t length = strlen( path );
+	bool decoded = false;
+
+	uint32 size;
+	const uint8 * bytes = getPackedMedia( asset, size );
+
+	if ( bytes != NULL )
+	{
+		decoded = decodePacked( bytes, size, out, image.width, image.height );
+	}
+	else if ( length > 4 && strcmp( path + length-4, ".png" ) == 0 )
+	{
+		MappedFile file;
+		int width = 0;
+		int height = 0;
+
+		decoded = file.open( path ) && decodePng( file.getData(), file.getSize(), out, width, height ) &&
+			      width == image.width && height == image.height;
+	}
+	else
+	{
+		decoded = decodeBmp( path, out, image.width, image.height );
+	}
+
+	if ( decoded == false )
+	{
+		makeDisc( path, out, image.width, image.height );
+	}
+
+	setPixels( imageID );
+
+	return true;
+}
+
+/**
+*  Function: deleteImage(int imageID)
+*
+*  Purpose: This function deletes an image and frees its pixels.  Sprites
+*           may have shown it, so the whole screen is drawn again.
+*/
+
+void SoftwareRenderer::deleteImage(int imageID)
+{
+	NullRenderer::deleteImage( imageID );
+
+	allDirty = true;
+
+	if ( imageID >= 0 && imageID < (int)pixels.size() )
+	{
+		vector <uint32>().swap( pixels[imageID] );
+	}
+
+	if ( imageID >= 0 && imageID < (int)circles.size() )
+	{
+		circles[imageID].alpha = -1;
+	}
+}
+
+/**
+*  Function: readImage(int imageID, vector <uint32> & imagePixels, int & width, int & height)
+*
+*  Purpose: This function copies an image's pixels.
+*
+*  Returns: True if the image exists.
+*/
+
+bool SoftwareRenderer::readImage(int imageID, vector <uint32> & imagePixels, int & width, int & height)
+{
+	if ( NullRenderer::readImage( imageID, imagePixels, width, height ) == false )
+	{
+		return false;
+	}
+
+	imagePixels = pixels[imageID];
+
+	return true;
+}
+
+/**
+*  Function: makeImage(int imageID, const uint32 * imagePixels, int width, int height)
+*
+*  Purpose: This function makes an image from a copy of the given pixels.
+*
+*  Returns: True if the image was made.
+*/
+
+bool SoftwareRenderer::makeImage(int imageID, const uint32 * imagePixels, int width, int height)
+{
+	if ( NullRenderer::makeImage( imageID, imagePixels, width, height ) == false )
+	{
+		return false;
+	}
+
+	if ( imageID >= (int)pixels.size() )
+	{
+		pixels.resize( imageID+1 );
+	}
+
+	pixels[imageID].assign( imagePixels, imagePixels + width*height );
+	setPixels( imageID );
+
+	return true;
+}
+
+/**
+*  Function: makeCircleImage(int imageID, const CircleStyle & style, int size)
+*
+*  Purpose: This function makes an image of a circle.  Its pixels are drawn
+*           too, for pasting and reading it, but a sprite showing it draws the
+*           circle itself, at the sprite's size (see drawCircleSprite()).
+*
+*  Returns: True if the image was made.
+*/
+
+bool SoftwareRenderer::makeCircleImage(int imageID, const CircleStyle & style, int size)
+{
+	if ( size <= 0 )
+	{
+		return false;
+	}
+
+	vector <uint32> circle( size*size );
+
+	drawCircleImage( style, & circle[0], size );
+
+	if ( makeImage( imageID, & circle[0], size, size ) == false )
+	{
+		return false;
+	}
+
+	circles[imageID] = style;
+
+	return true;
+}
+
+/**
+*  Function: BackgroundCommand::operator==(const BackgroundCommand & other)
+*
+*  Returns: True if the two are the same paste, or the same text.
+*/
+
+bool BackgroundCommand::operator==(const BackgroundCommand & other) const
+{
+	return imageID == other.imageID && x == other.x && y == other.y &&
+		   color == other.color && size == other.size && text == other.text;
+}
+
+/**
+*  Function: pasteImage(int imageID, int x, int y)
+*
+*  Purpose: This function pastes an image, with its top left corner at (x, y),
+*           as dbPasteImage() does.  It is drawn at sync(), into the
+*           background, if the frame's pastes and text aren't the same as the
+*           last frame's.
+*/
+
+void SoftwareRenderer::pasteImage(int imageID, int x, int y)
+{
+	NullRenderer::pasteImage( imageID, x, y );
+
+	if ( findImage( imageID ) == NULL )
+	{
+		return;
+	}
+
+	BackgroundCommand command;
+
+	command.imageID = imageID;
+	command.x = x;
+	command.y = y;
+	command.color = 0;
+	command.size = 0;
+
+	commands.push_back( command );
+}
+
+/**
+*  Function: grabScreen(int imageID)
+*
+*  Purpose: This function makes an image of the background, as dbGetImage()
+*           does of the screen before the sprites are drawn.  The frame's
+*           pastes and text so far are drawn into the background first, and
+*           count as the last frame's, so they aren't drawn again at sync()
+*           unless they are pasted and written again.
+*
+*  Returns: True if the image was made.
+*/
+
+bool SoftwareRenderer::grabScreen(int imageID)
+{
+	for ( int i = 0; i < (int)commands.size(); i++ )
+	{
+		drawBackground( commands[i] );
+	}
+
+	lastCommands.swap( commands );
+	commands.clear();
+
+	return makeImage( imageID, & background[0], SCREEN_WIDTH, SCREEN_HEIGHT );
+}
+
+/**
+*  Function: drawBackground(const BackgroundCommand & command)
+*
+*  Purpose: This function draws a paste or text into the background.  An
+*           image's transparent pixels are skipped, and the rows of an opaque
+*           image, like a background, are just copied.
+*/
+
+void SoftwareRenderer::drawBackground(const BackgroundCommand & command)
+{
+	if ( command.imageID < 0 )
+	{
+		drawText( command.x, command.y, command.text.c_str(), command.color, command.size );
+		return;
+	}
+
+	const NullImage * image = findImage( command.imageID );
+
+	if ( image == NULL )
+	{
+		return;
+	}
+
+	int imageID = command.imageID;
+	int x = command.x;
+	int y = command.y;
+	int left = x < 0 ? 0 : x;
+	int right = x + image->width > SCREEN_WIDTH ? SCREEN_WIDTH : x + image->width;
+	int top = y < 0 ? 0 : y;
+	int bottom = y + image->height > SCREEN_HEIGHT ? SCREEN_HEIGHT : y + image->height;
+
+	if ( left >= right || top >= bottom )
+	{
+		return;
+	}
+
+	const vint alphaMask = vSet( (int)0xff000000 );
+	const vint zero = vSet( 0 );
+
+	for ( int screenY = top; screenY < bottom; screenY++ )
+	{
+		const uint32 * source = & pixels[imageID][( screenY-y ) * image->width + left-x];
+		uint32 * target = & background[screenY*SCREEN_WIDTH + left];
+		int count = right - left;
+
+		if ( opaque[imageID] )
+		{
+			memcpy( target, source, count * 4 );
+			continue;
+		}
+
+		int i = 0;
+
+		for ( ; i + 4 <= count; i += 4 )
+		{
+			vint color = vLoadU( (const int *)source + i );
+			vint clear = vCmpEq( vAnd( color, alphaMask ), zero );
+
+			vStoreU( (int *)target + i, vSelect( clear, vLoadU( (const int *)target + i ), vOr( color, alphaMask ) ) );
+		}
+
+		for ( ; i < count; i++ )
+		{
+			if ( ( source[i] >> 24 ) != 0 )
+			{
+				target[i] = source[i] | 0xff000000;
+			}
+		}
+	}
+}
+
+/**
+*  Function: clipSpan(double start, double step, double size, double & first, double & last)
+*
+*  Purpose: This function narrows a span of pixels along a row, first to last
+*           (not included), to those where a coordinate that starts at start
+*           and goes up by step each pixel is from 0 up to size.
+*/
+
+static void clipSpan(double start, double step, double size, double & first, double & last)
+{
+	if ( step == 0.0 )
+	{
+		if ( start < 0.0 || start >= size )
+		{
+			last = first;
+		}
+
+		return;
+	}
+
+	double enter = ( step > 0.0 ? -start : size - start ) / step;
+	double leave = ( step > 0.0 ? size - start : -start ) / step;
+
+	if ( enter > first )
+	{
+		first = enter;
+	}
+
+	if ( leave < last )
+	{
+		last = leave;
+	}
+}
+
+/**
+*  Function: spriteBounds(const NullSprite & s)
+*
+*  Returns: The rectangle of the screen a sprite can draw in, from the corners
+*           of its box turned about its offset point, with a pixel to spare for
+*           rounding.  It is empty if the sprite draws nothing.
+*/
+
+static ScreenRect spriteBounds(const NullSprite & s)
+{
+	ScreenRect bounds = { 0, 0, 0, 0 };
+
+	if ( s.exists == false || s.visible == false || s.width <= 0 || s.height <= 0 || s.alpha <= 0 )
+	{
+		return bounds;
+	}
+
+	double radians = s.degrees * SOFTWARE_PI / 180.0;
+	double cosine = cos( radians );
+	double sine = sin( radians );
+	double lowX = 0.0, highX = 0.0, lowY = 0.0, highY = 0.0;
+
+	for ( int corner = 0; corner < 4; corner++ )
+	{
+		double cornerX = ( corner & 1 ? s.width : 0 ) - s.offsetX;
+		double cornerY = ( corner & 2 ? s.height : 0 ) - s.offsetY;
+		double x = cornerX * cosine - cornerY * sine;
+		double y = cornerX * sine + cornerY * cosine;
+
+		lowX = corner == 0 || x < lowX ? x : lowX;
+		highX = corner == 0 || x > highX ? x : highX;
+		lowY = corner == 0 || y < lowY ? y : lowY;
+		highY = corner == 0 || y > highY ? y : highY;
+	}
+
+	bounds.left = s.x + (int)floor( lowX ) - 1;
+	bounds.top = s.y + (int)floor( lowY ) - 1;
+	bounds.right = s.x + (int)ceil( highX ) + 1;
+	bounds.bottom = s.y + (int)ceil( highY ) + 1;
+
+	return bounds;
+}
+
+/**
+*  Function: intersect(const ScreenRect & a, const ScreenRect & b)
+*
+*  Returns: The rectangle that is in both, which may be empty.
+*/
+
+static ScreenRect intersect(const ScreenRect & a, const ScreenRect & b)
+{
+	ScreenRect both;
+
+	both.left = a.left > b.left ? a.left : b.left;
+	both.top = a.top > b.top ? a.top : b.top;
+	both.right = a.right < b.right ? a.right : b.right;
+	both.bottom = a.bottom < b.bottom ? a.bottom : b.bottom;
+
+	return both;
+}
+
+/**
+*  Function: isEmpty(const ScreenRect & rect)
+*
+*  Returns: True if the rectangle has no pixels.
+*/
+
+static bool isEmpty(const ScreenRect & rect)
+{
+	return rect.left >= rect.right || rect.top >= rect.bottom;
+}
+
+/**
+*  Function: drawSprite(const NullSprite & s, const ScreenRect & clip)
+*
+*  Purpose: This function draws the part of a sprite inside a rectangle into
+*           the framebuffer.  Each pixel the
+*           sprite covers is turned back through the sprite's rotation, offset
+*           and size to find the pixel of the image it shows, so there are no
+*           gaps at any angle or size.  That is linear along a row, so the part
+*           of each row inside the image is found first, and then the image is
+*           stepped through in 16.16 fixed point, four pixels at a time.
+*/
+
+void SoftwareRenderer::drawSprite(const NullSprite & s, const ScreenRect & clip)
+{
+	const NullImage * image = findImage( s.imageID );
+
+	if ( image != NULL && circles[s.imageID].alpha >= 0 )
+	{
+		drawCircleSprite( s, circles[s.imageID], clip );
+		return;
+	}
+
+	ScreenRect bounds = spriteBounds( s );
+	ScreenRect area = intersect( bounds, clip );
+
+	if ( image == NULL || isEmpty( area ) )
+	{
+		return;
+	}
+
+	const uint32 * source = & pixels[s.imageID][0];
+	const int imageWidth = image->width;
+	const int imageHeight = image->height;
+	const int spriteAlpha = s.alpha > 255 ? 255 : s.alpha;
+	const bool tinted = ( s.tint & 0x00ffffff ) != 0x00ffffff;
+
+	double radians = s.degrees * SOFTWARE_PI / 180.0;
+	double cosine = cos( radians );
+	double sine = sin( radians );
+	double scaleX = (double)imageWidth / s.width;
+	double scaleY = (double)imageHeight / s.height;
+
+	// Rotated back the other way (DarkGDK's angles are clockwise), a step
+	// across the screen is a step of (stepU, stepV) in the image.
+	double stepU = cosine * scaleX;
+	double stepV = -sine * scaleY;
+
+	// The rows are worked out across the whole sprite, from its left, so
+	// that what a pixel shows doesn't depend on where it is clipped.
+	int left = bounds.left;
+	int right = bounds.right;
+	int top = area.top;
+	int bottom = area.bottom;
+
+	const double one = 65536.0;
+	const int fixedStepU = (int)floor( stepU * one + 0.5 );
+	const int fixedStepV = (int)floor( stepV * one + 0.5 );
+	const int fixedWidth = imageWidth << 16;
+	const int fixedHeight = imageHeight << 16;
+	const bool straight = fixedStepU == 0x10000 && fixedStepV == 0;
+
+	for ( int screenY = top; screenY < bottom; screenY++ )
+	{
+		double dx = left + 0.5 - s.x;
+		double dy = screenY + 0.5 - s.y;
+
+		// Where the row's first pixel is in the image.
+		double u = ( dx * cosine + dy * sine + s.offsetX ) * scaleX;
+		double v = ( -dx * sine + dy * cosine + s.offsetY ) * scaleY;
+
+		double first = 0.0;
+		double last = right - left;
+
+		clipSpan( u, stepU, imageWidth, first, last );
+		clipSpan( v, stepV, imageHeight, first, last );
+
+		if ( first >= last )
+		{
+			continue;
+		}
+
+		int start = (int)ceil( first );
+		int end = (int)ceil( last );
+
+		if ( start >= end )
+		{
+			continue;
+		}
+
+		int fixedU = (int)floor( ( u + start * stepU ) * one );
+		int fixedV = (int)floor( ( v + start * stepV ) * one );
+
+		// Rounding can leave an end pixel just outside the image, and since
+		// the steps are even, checking the ends checks the whole span.
+		while ( start < end && ( fixedU < 0 || fixedU >= fixedWidth || fixedV < 0 || fixedV >= fixedHeight ) )
+		{
+			start++;
+			fixedU += fixedStepU;
+			fixedV += fixedStepV;
+		}
+
+		while ( start < end )
+		{
+			int endU = fixedU + ( end-1 - start ) * fixedStepU;
+			int endV = fixedV + ( end-1 - start ) * fixedStepV;
+
+			if ( endU >= 0 && endU < fixedWidth && endV >= 0 && endV < fixedHeight )
+			{
+				break;
+			}
+
+			end--;
+		}
+
+		if ( start < area.left - left )
+		{
+			fixedU += ( area.left - left - start ) * fixedStepU;
+			fixedV += ( area.left - left - start ) * fixedStepV;
+			start = area.left - left;
+		}
+
+		if ( end > area.right - left )
+		{
+			end = area.right - left;
+		}
+
+		if ( start >= end )
+		{
+			continue;
+		}
+
+		uint32 * target = & framebuffer[screenY*SCREEN_WIDTH + left + start];
+		int length = end - start;
+
+		// Unrotated and unscaled, like a bubble's radius frame, the span is
+		// a run of the image's own row and needn't be gathered.
+		const uint32 * run = straight ? source + ( fixedV >> 16 ) * imageWidth + ( fixedU >> 16 ) : NULL;
+
+		for ( int i = 0; i < length; i += 4 )
+		{
+			uint32 gathered[4] = { 0, 0, 0, 0 };
+			const uint32 * colors = gathered;
+			int count = length - i < 4 ? length - i : 4;
+
+			if ( run != NULL && count == 4 )
+			{
+				colors = run + i;
+			}
+			else
+			{
+				for ( int k = 0; k < count; k++ )
+				{
+					gathered[k] = run != NULL ? run[i+k] : source[( fixedV >> 16 ) * imageWidth + ( fixedU >> 16 )];
+					fixedU += fixedStepU;
+					fixedV += fixedStepV;
+				}
+			}
+
+			if ( tinted )
+			{
+				tintFour( colors, s.tint, gathered );
+				colors = gathered;
+			}
+
+			putFour( target + i, colors, count, spriteAlpha );
+		}
+	}
+}
+
+/**
+*  Function: drawCircleSprite(const NullSprite & s, const CircleStyle & circle, const ScreenRect & clip)
+*
+*  Purpose: This function draws the part of a circle image's sprite inside a
+*           rectangle into the framebuffer.  The circle fills the sprite's box,
+*           or the square in its middle if it isn't square, and turning it
+*           only moves its center.  Each row is only visited where the circle
+*           is, give or take its edge, and shaded four pixels at a time (see
+*           shadeCircle()), so the cost is the pixels it covers, whatever its
+*           radius.
+*/
+
+void SoftwareRenderer::drawCircleSprite(const NullSprite & s, const CircleStyle & circle, const ScreenRect & clip)
+{
+	ScreenRect area = intersect( spriteBounds( s ), clip );
+
+	if ( isEmpty( area ) )
+	{
+		return;
+	}
+
+	const int spriteAlpha = s.alpha > 255 ? 255 : s.alpha;
+	const bool tinted = ( s.tint & 0x00ffffff ) != 0x00ffffff;
+	const float radius = ( s.width < s.height ? s.width : s.height ) * 0.5f;
+
+	double radians = s.degrees * SOFTWARE_PI / 180.0;
+	double middleX = s.width * 0.5 - s.offsetX;
+	double middleY = s.height * 0.5 - s.offsetY;
+	double centerX = s.x + middleX * cos( radians ) - middleY * sin( radians );
+	double centerY = s.y + middleX * sin( radians ) + middleY * cos( radians );
+
+	// Past half a pixel outside the edge, nothing is covered.
+	double reach = radius + 0.5;
+
+	for ( int screenY = area.top; screenY < area.bottom; screenY++ )
+	{
+		double dy = screenY + 0.5 - centerY;
+
+		if ( dy <= -reach || dy >= reach )
+		{
+			continue;
+		}
+
+		double halfChord = sqrt( reach*reach - dy*dy );
+		int start = (int)floor( centerX - halfChord );
+		int end = (int)ceil( centerX + halfChord );
+
+		start = start < area.left ? area.left : start;
+		end = end > area.right ? area.right : end;
+
+		uint32 * target = & framebuffer[screenY*SCREEN_WIDTH];
+
+		for ( int screenX = start; screenX < end; screenX += 4 )
+		{
+			uint32 colors[4];
+			int count = end - screenX < 4 ? end - screenX : 4;
+
+			shadeCircle( circle, radius, (float)( screenX + 0.5 - centerX ), (float)dy, colors );
+
+			if ( tinted )
+			{
+				tintFour( colors, s.tint, colors );
+			}
+
+			putFour( target + screenX, colors, count, spriteAlpha );
+		}
+	}
+}
+
+/**
+*  Function: ink(uint32 inkForeground, uint32 inkBackground)
+*
+*  Purpose: This function sets the color text is drawn in.  As in the game,
+*           text has no background; only its letters are drawn.
+*/
+
+void SoftwareRenderer::ink(uint32 inkForeground, uint32 inkBackground)
+{
+	NullRenderer::ink( inkForeground, inkBackground );
+
+	inkColor = inkForeground;
+}
+
+/**
+*  Function: setTextSize(int size)
+*
+*  Purpose: This function sets the size text is drawn at, in pixels to the em.
+*/
+
+void SoftwareRenderer::setTextSize(int size)
+{
+	NullRenderer::setTextSize( size );
+
+	textSize = size > 0 ? size : 1;
+}
+
+/**
+*  Function: measureText(const char * text)
+*
+*  Returns: How wide the text is at the text size, in pixels.
+*/
+
+double SoftwareRenderer::measureText(const char * text) const
+{
+	double scale = (double)textSize / FONT_SIZE;
+	int width = 0;
+
+	for ( const char * c = text; *c != 0; c++ )
+	{
+		int index = *c - FONT_FIRST_CHARACTER;
+
+		if ( index >= 0 && index < FONT_CHARACTERS )
+		{
+			width += FONT_GLYPHS[index].advance;
+		}
+	}
+
+	return width * scale;
+}
+
+/**
+*  Function: coverageAt(const uint8 * coverage, const FontGlyph & glyph, int x, int y)
+*
+*  Returns: The coverage of a pixel of a glyph's box, or 0 outside the box.
+*/
+
+static inline int coverageAt(const uint8 * coverage, const FontGlyph & glyph, int x, int y)
+{
+	if ( x < 0 || y < 0 || x >= glyph.width || y >= glyph.height )
+	{
+		return 0;
+	}
+
+	return coverage[y*glyph.width + x];
+}
+
+/**
+*  Function: drawGlyph(const FontGlyph & glyph, double glyphLeft, double glyphTop, double scale, uint32 color)
+*
+*  Purpose: This function draws a glyph into the background in a color,
+*           scaled, with its box's top left corner at (glyphLeft, glyphTop).
+*           Each pixel blends the four glyph pixels nearest to it, so at the
+*           font's own size, on whole pixels, the glyph is drawn as it is.
+*/
+
+void SoftwareRenderer::drawGlyph(const FontGlyph & glyph, double glyphLeft, double glyphTop, double scale, uint32 color)
+{
+	int left = (int)floor( glyphLeft );
+	int right = (int)ceil( glyphLeft + glyph.width * scale );
+	int top = (int)floor( glyphTop );
+	int bottom = (int)ceil( glyphTop + glyph.height * scale );
+
+	left = left < 0 ? 0 : left;
+	right = right > SCREEN_WIDTH ? SCREEN_WIDTH : right;
+	top = top < 0 ? 0 : top;
+	bottom = bottom > SCREEN_HEIGHT ? SCREEN_HEIGHT : bottom;
+
+	if ( glyphCoverage.empty() || left >= right || top >= bottom )
+	{
+		return;
+	}
+
+	const uint8 * coverage = & glyphCoverage[glyph.offset];
+
+	// Each screen column's glyph column, and how far it is towards the next
+	// one, in 256ths.
+	int columns[SCREEN_WIDTH];
+	int weights[SCREEN_WIDTH];
+
+	for ( int screenX = left; screenX < right; screenX++ )
+	{
+		double glyphX = ( screenX + 0.5 - glyphLeft ) / scale - 0.5;
+
+		columns[screenX] = (int)floor( glyphX );
+		weights[screenX] = (int)( ( glyphX - columns[screenX] ) * 256.0 + 0.5 );
+	}
+
+	for ( int screenY = top; screenY < bottom; screenY++ )
+	{
+		double glyphY = ( screenY + 0.5 - glyphTop ) / scale - 0.5;
+		int row = (int)floor( glyphY );
+		int weightY = (int)( ( glyphY - row ) * 256.0 + 0.5 );
+
+		for ( int screenX = left; screenX < right; screenX++ )
+		{
+			int column = columns[screenX];
+			int weightX = weights[screenX];
+
+			int above = coverageAt( coverage, glyph, column, row ) * ( 256-weightX ) +
+				        coverageAt( coverage, glyph, column+1, row ) * weightX;
+			int below = coverageAt( coverage, glyph, column, row+1 ) * ( 256-weightX ) +
+				        coverageAt( coverage, glyph, column+1, row+1 ) * weightX;
+			int alpha = ( above * ( 256-weightY ) + below * weightY + 32768 ) >> 16;
+
+			if ( alpha > 0 )
+			{
+				blend( background[screenY*SCREEN_WIDTH + screenX], color, alpha );
+			}
+		}
+	}
+}
+
+/**
+*  Function: drawText(double x, int y, const char * text, uint32 color, int size)
+*
+*  Purpose: This function draws text into the background, with its top left
+*           corner at (x, y), in a color, scaled from the font's size to a text
+*           size.  Characters the font doesn't have are skipped.
+*/
+
+void SoftwareRenderer::drawText(double x, int y, const char * text, uint32 color, int size)
+{
+	double scale = (double)size / FONT_SIZE;
+	double penX = x;
+
+	for ( const char * c = text; *c != 0; c++ )
+	{
+		int index = *c - FONT_FIRST_CHARACTER;
+
+		if ( index < 0 || index >= FONT_CHARACTERS )
+		{
+			continue;
+		}
+
+		const FontGlyph & glyph = FONT_GLYPHS[index];
+
+		drawGlyph( glyph, penX + glyph.left * scale, y + glyph.top * scale, scale, color );
+		penX += glyph.advance * scale;
+	}
+}
+
+/**
+*  Function: addText(int x, int y, const char * text)
+*
+*  Purpose: This function adds text, in the ink color and at the text size, to
+*           the frame's pastes and text.
+*/
+
+void SoftwareRenderer::addText(int x, int y, const char * text)
+{
+	BackgroundCommand command;
+
+	command.imageID = -1;
+	command.x = x;
+	command.y = y;
+	command.color = inkColor;
+	command.size = textSize;
+	command.text = text;
+
+	commands.push_back( command );
+}
+
+/**
+*  Function: text(int x, int y, const char * text)
+*
+*  Purpose: This function writes text with its top left corner at (x, y), as
+*           dbText() does.
+*/
+
+void SoftwareRenderer::text(int x, int y, const char * text)
+{
+	NullRenderer::text( x, y, text );
+
+	addText( x, y, text );
+}
+
+/**
+*  Function: centerText(int x, int y, const char * text)
+*
+*  Purpose: This function writes text centered across x, with its top at y,
+*           as dbCenterText() does.  It starts on a whole pixel, so text at the
+*           font's own size stays sharp.
+*/
+
+void SoftwareRenderer::centerText(int x, int y, const char * text)
+{
+	NullRenderer::centerText( x, y, text );
+
+	addText( (int)floor( x - measureText( text ) / 2.0 + 0.5 ), y, text );
+}
+
+/**
+*  Function: sameSprite(const NullSprite & a, const NullSprite & b)
+*
+*  Returns: True if the two would be drawn the same.
+*/
+
+static bool sameSprite(const NullSprite & a, const NullSprite & b)
+{
+	return a.exists == b.exists && a.visible == b.visible && a.x == b.x && a.y == b.y &&
+		   a.imageID == b.imageID && a.width == b.width && a.height == b.height &&
+		   a.offsetX == b.offsetX && a.offsetY == b.offsetY && a.degrees == b.degrees && a.alpha == b.alpha &&
+		   a.tint == b.tint;
+}
+
+/**
+*  Function: addDirty(const ScreenRect & rect)
+*
+*  Purpose: This function marks the part of a rectangle on the screen to be
+*           drawn again.  A rectangle that covers the screen makes all of it
+*           dirty.
+*/
+
+void SoftwareRenderer::addDirty(const ScreenRect & rect)
+{
+	ScreenRect screen = { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+	ScreenRect part = intersect( rect, screen );
+
+	if ( isEmpty( part ) == false )
+	{
+		dirty.push_back( part );
+		allDirty = allDirty || ( part.right - part.left ) * ( part.bottom - part.top ) == SCREEN_WIDTH * SCREEN_HEIGHT;
+	}
+}
+
+/**
+*  Function: mergeDirty()
+*
+*  Purpose: This function joins dirty rectangles that overlap into the
+*           rectangle around both, until none overlap, so that no pixel is
+*           drawn twice.
+*/
+
+void SoftwareRenderer::mergeDirty()
+{
+	bool merged = true;
+
+	while ( merged )
+	{
+		merged = false;
+
+		for ( int i = 0; i < (int)dirty.size() && merged == false; i++ )
+		{
+			for ( int j = i+1; j < (int)dirty.size(); j++ )
+			{
+				if ( isEmpty( intersect( dirty[i], dirty[j] ) ) )
+				{
+					continue;
+				}
+
+				ScreenRect & a = dirty[i];
+				const ScreenRect & b = dirty[j];
+
+				a.left = a.left < b.left ? a.left : b.left;
+				a.top = a.top < b.top ? a.top : b.top;
+				a.right = a.right > b.right ? a.right : b.right;
+				a.bottom = a.bottom > b.bottom ? a.bottom : b.bottom;
+
+				dirty.erase( dirty.begin() + j );
+				merged = true;
+				break;
+			}
+		}
+	}
+}
+
+/**
+*  Function: sync()
+*
+*  Purpose: This function finishes the frame, as dbSync() does.  The frame's
+*           pastes and text are drawn into the background if they changed, and
+*           then the dirty rectangles are drawn again: the background, and over
+*           it every visible sprite in them, in order of sprite ID.
+*/
+
+void SoftwareRenderer::sync()
+{
+	if ( commands != lastCommands )
+	{
+		for ( int i = 0; i < (int)commands.size(); i++ )
+		{
+			drawBackground( commands[i] );
+		}
+
+		allDirty = true;
+	}
+
+	lastCommands.swap( commands );
+	commands.clear();
+
+	if ( drawn.size() < sprites.size() )
+	{
+		drawn.resize( sprites.size() );  // Sprites that weren't there didn't exist.
+	}
+
+	// Sprites are never taken away, only hidden or deleted in place, so each
+	// one still has its entry in drawn.  Only the ones that changed are copied.
+	for ( int i = 0; i < (int)sprites.size(); i++ )
+	{
+		if ( sameSprite( sprites[i], drawn[i] ) == false )
+		{
+			if ( allDirty == false )
+			{
+				addDirty( spriteBounds( drawn[i] ) );
+				addDirty( spriteBounds( sprites[i] ) );
+			}
+
+			drawn[i] = sprites[i];
+		}
+	}
+
+	if ( allDirty )
+	{
+		ScreenRect screen = { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+
+		dirty.assign( 1, screen );
+	}
+	else
+	{
+		mergeDirty();
+	}
+
+	shown.clear();
+	shownBounds.clear();
+
+	for ( int i = 0; i < (int)sprites.size() && dirty.empty() == false; i++ )
+	{
+		ScreenRect bounds = spriteBounds( sprites[i] );
+
+		if ( isEmpty( bounds ) == false )
+		{
+			shown.push_back( i );
+			shownBounds.push_back( bounds );
+		}
+	}
+
+	lastDirtyPixels = 0;
+
+	for ( int r = 0; r < (int)dirty.size(); r++ )
+	{
+		const ScreenRect & rect = dirty[r];
+		int width = rect.right - rect.left;
+
+		for ( int y = rect.top; y < rect.bottom; y++ )
+		{
+			memcpy( & framebuffer[y*SCREEN_WIDTH + rect.left], & background[y*SCREEN_WIDTH + rect.left], width * 4 );
+		}
+
+		for ( int k = 0; k < (int)shown.size(); k++ )
+		{
+			if ( isEmpty( intersect( shownBounds[k], rect ) ) == false )
+			{
+				drawSprite( sprites[shown[k]], rect );
+			}
+		}
+
+		lastDirtyPixels += width * ( rect.bottom - rect.top );
+	}
+
+	dirtyPixels += lastDirtyPixels;
+	dirty.clear();
+	allDirty = false;
+
+	NullRenderer::sync();
+}
+
+/**
+*  Function: getPixels()
+*
+*  Returns: The framebuffer, SCREEN_WIDTH by SCREEN_HEIGHT pixels, 0xAARRGGBB,
+*           top row first.  It holds the last frame drawn.
+*/
+
+const uint32 * SoftwareRenderer::getPixels() const
+{
+	return & framebuffer[0];
+}
+
+/**
+*  Function: writeLittle(uint8 * bytes, uint32 value, int count)
+*
+*  Purpose: This function stores value as a little-endian integer of count
+*           bytes at bytes.
+*/
+
+static void writeLittle(uint8 * bytes, uint32 value, int count)
+{
+	for ( int i = 0; i < count; i++ )
+	{
+		bytes[i] = (uint8)( value >> ( i*8 ) );
+	}
+}
+
+/**
+*  Function: saveBitmap(const char * path)
+*
+*  Purpose: This function writes the framebuffer to a 24-bit BMP file, so
+*           that a frame can be looked at.
+*
+*  Returns: True if the file was written.
+*/
+
+bool SoftwareRenderer::saveBitmap(const char * path) const
+{
+	const uint32 headerSize = 54;
+	const uint32 rowSize = SCREEN_WIDTH * 3;  // Already a multiple of 4.
+	vector <uint8> bytes( headerSize + rowSize * SCREEN_HEIGHT, 0 );
+
+	bytes[0] = 'B';
+	bytes[1] = 'M';
+	writeLittle( & bytes[2], (uint32)bytes.size(), 4 );
+	writeLittle( & bytes[10], headerSize, 4 );
+	writeLittle( & bytes[14], 40, 4 );              // The size of the info header.
+	writeLittle( & bytes[18], SCREEN_WIDTH, 4 );
+	writeLittle( & bytes[22], SCREEN_HEIGHT, 4 );   // Bottom row first.
+	writeLittle( & bytes[26], 1, 2 );               // Planes.
+	writeLittle( & bytes[28], 24, 2 );              // Bits per pixel.
+
+	for ( int y = 0; y < SCREEN_HEIGHT; y++ )
+	{
+		uint8 * row = & bytes[headerSize + rowSize * ( SCREEN_HEIGHT-1-y )];
+
+		for ( int x = 0; x < SCREEN_WIDTH; x++ )
+		{
+			writeLittle( row + x*3, framebuffer[y*SCREEN_WIDTH + x], 3 );
+		}
+	}
+
+	FILE * file = fopen( path, "wb" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	bool written = fwrite( & bytes[0], 1, bytes.size(), file ) == bytes.size();
+
+	return fclose( file ) == 0 && written;
+}
@@ -0,0 +1,132 @@
+/**
+*  File:  SoftwareRenderer.h
+*
+*  Description:  This header file contains SoftwareRenderer, a renderer (see
+*                Platform.h) that draws each frame into a framebuffer in memory,
+*                SCREEN_WIDTH by SCREEN_HEIGHT 32-bit pixels, as DarkGDK would
+*                draw it on the screen: pasted images when they are pasted, and
+*                at sync(), every visible sprite, sized, rotated about its offset
+*                point, tinted and blended by its alpha.
+*
+*                It extends NullRenderer, which keeps track of the sprites, and
+*                adds the pixels of each image.  Images from the media pack, BMP
+*                files and PNG files (see PngDecoder.h) are decoded.  Text is
+*                drawn in the ink color with a font of its own (SoftwareFont.h),
+*                scaled to the text size.
+*
+*                Pixels are blended four at a time with the SIMD operations in
+*                Simd.h, and a sprite's pixels are found a row at a time: only
+*                the part of each row the sprite covers is visited, stepping
+*                through the image in fixed point.
+*
+*                Only what changed is drawn again.  What is pasted and written
+*                goes into a background of its own, under the sprites, and is
+*                only drawn again when a frame's pastes and text aren't the
+*                same as the last frame's.  At sync(), each sprite is compared
+*                with how it was drawn last frame, and if it moved or changed,
+*                where it was and where it is now are dirty.  Only the dirty
+*                rectangles are put back together, from the background and the
+*                sprites over them.  The whole screen is dirty when the
+*                background changes, when an image is made or deleted, or when
+*                a sprite that covers it does, like the white overlay fading.
+*
+*                A circle image (see BubbleCircles.h) is drawn as a circle the
+*                size of the sprite, shaded pixel by pixel, instead of from its
+*                pixels, so it is smooth at any size.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SOFTWARE_RENDERER_H_
+#define SOFTWARE_RENDERER_H_
+
+#include "PlatformNull.h"
+#include "SoftwareFont.h"
+#include <string>
+
+/**
+*  A ScreenRect is a rectangle of pixels, right and bottom not included.
+*/
+
+struct ScreenRect
+{
+	int left;
+	int top;
+	int right;
+	int bottom;
+};
+
+/**
+*  A BackgroundCommand is an image pasted, or text written, in a frame.
+*/
+
+struct BackgroundCommand
+{
+	int imageID;   // The image pasted, or -1 for text.
+	int x;         // Its top left corner.
+	int y;
+	uint32 color;  // The text's ink color and size.
+	int size;
+	string text;
+
+	bool operator==(const BackgroundCommand & other) const;
+};
+
+class SoftwareRenderer : public NullRenderer
+{
+private:
+	vector < vector <uint32> > pixels;  // Each image's, 0xAARRGGBB, top row first.
+	vector <bool> opaque;               // Whether each image has no transparent pixels.
+	vector <CircleStyle> circles;       // Each image's circle, if it is one (alpha -1 if not).
+	vector <uint32> framebuffer;
+	vector <uint32> background;         // What has been pasted and written.
+	vector <uint8> glyphCoverage;       // FONT_COVERAGE, 0 to 255.
+	uint32 inkColor;
+	int textSize;
+
+	vector <BackgroundCommand> commands;      // This frame's pastes and text.
+	vector <BackgroundCommand> lastCommands;  // And the last frame's.
+	vector <NullSprite> drawn;                // The sprites as they were last drawn.
+	vector <ScreenRect> dirty;                // What has to be drawn again this frame.
+	vector <int> shown;                       // The sprites that draw anything this frame,
+	vector <ScreenRect> shownBounds;          // and where.
+	bool allDirty;
+	int lastDirtyPixels;                      // Drawn again in the last frame.
+	uint64 dirtyPixels;                       // And in every frame.
+
+	void setPixels(int imageID);
+	void addDirty(const ScreenRect & rect);
+	void mergeDirty();
+	void drawBackground(const BackgroundCommand & command);
+	void drawSprite(const NullSprite & s, const ScreenRect & clip);
+	void drawCircleSprite(const NullSprite & s, const CircleStyle & circle, const ScreenRect & clip);
+	double measureText(const char * text) const;
+	void drawGlyph(const FontGlyph & glyph, double glyphLeft, double glyphTop, double scale, uint32 color);
+	void drawText(double x, int y, const char * text, uint32 color, int size);
+	void addText(int x, int y, const char * text);
+
+public:
+	SoftwareRenderer();
+	bool loadImage(MediaAsset asset, int imageID);
+	void deleteImage(int imageID);
+	bool readImage(int imageID, vector <uint32> & imagePixels, int & width, int & height);
+	bool makeImage(int imageID, const uint32 * imagePixels, int width, int height);
+	bool makeCircleImage(int imageID, const CircleStyle & style, int size);
+	void pasteImage(int imageID, int x, int y);
+	bool grabScreen(int imageID);
+	void ink(uint32 inkForeground, uint32 inkBackground);
+	void setTextSize(int size);
+	void text(int x, int y, const char * text);
+	void centerText(int x, int y, const char * text);
+	void sync();
+	const uint32 * getPixels() const;
+	bool saveBitmap(const char * path) const;
+	int getLastDirtyPixels() const { return lastDirtyPixels; }
+	uint64 getDirtyPixels() const { return dirtyPixels; }
+};
+
+typedef Backend <SoftwareRenderer, NullAudio, ScriptedInput> SoftwareBackend;
+
+#endif
@@ -23,12 +23,17 @@
 *                                 NormalBubble      UserBubble
 *
 *
-*                ButtonSprite, NormalBubble and UserBubble are #included in Prisms.cpp.
+*                ButtonSprite, NormalBubble and UserBubble are #included in FrontEnd.h.
+*
+*                Each class is a template on a Backend (see Platform.h), and calls
+*                its renderer and audio instead of DarkGDK, so the same sprites
+*                run on DarkGDK, on the null backend and on the software one.
+*                As templates, the methods are all defined here in the headers.
 *                         
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/20/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef SPRITE_H_
@@ -37,20 +42,31 @@
 /**
 *  Sprite.h #includes the following header files, and because
 *  this class forms the top of the inheritance hierarchy, the 
-*  contents of these files will also get imported into Prisms.cpp.
+*  contents of these files will also get imported into FrontEnd.h.
 */
 
-#include "DarkGDK.h"    // Import the game programming library functions (these functions begin with the letters 'db').
+#include "Platform.h"   // For Backend, which each sprite draws with.
 #include "Constants.h"  // Ensure access to application-wide constants.
+#include "MediaManifest.h"  // For MediaAsset, the handles of the images.
 #include <fstream>      // Used to create an ofstream object called logFile (Prisms.log).
 #include <time.h>       // Needed to record the game start and end times in logFile.
+#include <stdio.h>      // For sprintf().
 
 using namespace std;
 
+extern ofstream logFile;  // Created as Prisms.log in Prisms.cpp's setup()
+
+// Given as a sprite's image when it shows one that was already made, like the
+// image the tinted bubbles share.  The sprite doesn't load it or delete it.
+const MediaAsset SHARED_IMAGE = MEDIA_ASSET_COUNT;
+
+template <class Platform>
 class Sprite
 {
 private:
+	Platform & platform;
 	int imageID;
+	bool ownsImage;  // False for a SHARED_IMAGE.
 	int spriteID;
 	char lineBuffer[MAX_ERROR_BUFFER];  // For writing potential errors to logFile.
 	int degrees;
@@ -58,9 +74,11 @@ private:
 	int height;
 
 public:
-	Sprite(int imgID, int sprtID, char fileName[]);
+	Sprite(Platform & p, int imgID, int sprtID, MediaAsset image);
 	~Sprite();
+	Platform & getPlatform() const;
 	void display(int cX, int cY) const;
+	void display(int cX, int cY, int imgID) const;
 	void hide() const;
 	void show() const;
 	void resize(int width, int height);
@@ -75,6 +93,386 @@ public:
 	void setHeight(int h); 
 	int getHeight() const;  
 	void setAlpha(int a);
+	void setTint(uint32 color) const;
 };
 
-#endif
\ No newline at end of file
+/**
+*  Function: Sprite(Platform & p, int imgID, int sprtID, MediaAsset image)
+*
+*  Purpose: This is the constructor for the Sprite class. The actual
+*           sprite is created in the constructors of its child classes,
+*           ButtonSprite and BubbleSprite.
+*
+*  Inputs: p - The backend the sprite is drawn with.  It has to outlive
+*              the sprite.
+*          imgID - the imageID that is used to create the
+*                  initial image.
+*          sprtID - the spriteID that is used to create the
+*                   actual sprite.
+*          image - the image that is also used when creating the
+*                  initial sprite.  It is made from the media pack if
+*                  it is in it (see MediaManifest.h).  If it is missing,
+*                  an error is written to the log file.  SHARED_IMAGE
+*                  if imgID was already made.
+*/
+
+template <class Platform>
+Sprite<Platform>::Sprite(Platform & p, int imgID, int sprtID, MediaAsset image)
+               : platform(p)
+{
+	imageID = imgID;
+	spriteID = sprtID;
+	degrees = 0;  // Sprites start out unrotated.
+	width = 0;
+	height = 0;
+	ownsImage = image != SHARED_IMAGE;
+
+	if ( ownsImage && platform.renderer.loadImage( image, imageID ) == false )
+	{
+		sprintf( lineBuffer, "Sprite(): Image file %s does not exist.", getMediaPath( image ) );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: ~Sprite()
+*
+*  Purpose: This is the destructor for the Sprite class.  It first
+*           attempts to delete the sprite from memory and writes an
+*           error to the log file if unable to do so.  It then attempts
+*           to delete the image from memory, unless it is shared, and writes
+*           an error to the log file if unsuccessful.
+*/
+
+template <class Platform>
+Sprite<Platform>::~Sprite()
+{
+	if ( platform.renderer.spriteExists( spriteID ) )
+	{
+		platform.renderer.deleteSprite( spriteID );
+	}
+	else
+	{
+		sprintf( lineBuffer, "~Sprite(): spriteID %d does not exist.", spriteID );
+		logFile << lineBuffer << endl << endl;
+	}
+
+	if ( ownsImage == false )
+	{
+		return;
+	}
+
+	if ( platform.renderer.imageExists( imageID ) )
+	{
+		platform.renderer.deleteImage( imageID );
+	}
+	else
+	{
+		sprintf( lineBuffer, "~Sprite(): imageID %d does not exist.", imageID );
+		logFile << lineBuffer << endl << endl;
+	}
+}
+
+/**
+*  Function: getPlatform()
+*
+*  Purpose: This function returns the backend the sprite is drawn with.  The
+*           child classes use it for their sounds and for asking the renderer
+*           about their sprite.
+*
+*  Returns: The backend.
+*/
+
+template <class Platform>
+Platform & Sprite<Platform>::getPlatform() const
+{
+	return platform;
+}
+
+/**
+*  Function: display(int cX, int cY)
+*
+*  Purpose: The first time this function is called, the actual sprite
+*           will be created and drawn to the screen.  Subsequent calls
+*           will simply draw the sprite to the screen.
+*
+*  Inputs: cX - The x-coordinate of the center point where the sprite is displayed.
+*		   cY - The y-coordinate of the center point where the sprite is displayed.
+*/
+
+template <class Platform>
+void Sprite<Platform>::display(int cX, int cY) const
+{
+	platform.renderer.sprite( spriteID, cX, cY, imageID );
+}
+
+/**
+*  Function: display(int cX, int cY, int imgID)
+*
+*  Purpose: This function draws the sprite with another image than its own.
+*           BubbleSprite uses it to show the radius frame (see BubbleFrames.h)
+*           for the bubble's size.
+*
+*  Inputs: cX, cY - Where the sprite's center point goes.
+*          imgID - The image to show.
+*/
+
+template <class Platform>
+void Sprite<Platform>::display(int cX, int cY, int imgID) const
+{
+	platform.renderer.sprite( spriteID, cX, cY, imgID );
+}
+
+/**
+*  Function: hide()
+*
+*  Purpose: This function is used to hide the sprite when not in use.  For
+*           example, it is used to hide buttons when they are no longer needed.
+*/
+
+template <class Platform>
+void Sprite<Platform>::hide() const
+{
+	platform.renderer.hideSprite( spriteID );
+}
+
+/**
+*  Function: show()
+*
+*  Purpose: This function is used to show the sprite when it is needed.  For example,
+*           it is used to show the buttons when they are needed during the cut-screens.
+*/
+
+template <class Platform>
+void Sprite<Platform>::show() const
+{
+	platform.renderer.showSprite( spriteID );
+}
+
+/**
+*  Function: resize(int w, int h)
+*
+*  Purpose: This function is used to resize the sprite.  For example,
+*           it is used to resize the size of the bubble sprites in the
+*           BubbleSprite constructor.
+*
+*  Inputs: w - The new width of the sprite in pixels
+*          h - The new height of the sprite in pixels
+*/
+
+template <class Platform>
+void Sprite<Platform>::resize(int w, int h)
+{
+	platform.renderer.sizeSprite( spriteID, w, h );
+
+	width = platform.renderer.spriteWidth( spriteID );
+	height = platform.renderer.spriteHeight( spriteID );
+}
+
+/**
+*  Function: rotate(int d)
+*
+*  Purpose: This function is used to rotate the sprite a number of degrees
+*           around its insertion point, which in our case is its center.
+*
+*  Inputs: d - The number of degrees to rotate the sprite.  Acceptable values
+*              are in the range of 0-359.
+*/
+
+template <class Platform>
+void Sprite<Platform>::rotate(int d)
+{
+	degrees = d;
+	platform.renderer.rotateSprite( spriteID, degrees );
+}
+
+/**
+*  Function: scale(int s)	
+*
+*  Purpose: This function is used to expand or contract the entire sprite.
+*           It is used to shrink the handPointer image down to size.  I use
+*           resize() to shrink the bubble sprites because I can pass the radius
+*           to that function, which is more natural when shrinking circles.
+*
+*  Inputs: s - the percentage of the original image to scale it to.  For example,
+*              passing in 50 will shrink the sprite to 50% of its current size.
+*              Passing in 150 will grow it to 150% of its current size.
+*/
+
+template <class Platform>
+void Sprite<Platform>::scale(int s) const
+{
+	platform.renderer.scaleSprite( spriteID, s );
+}
+
+/**
+*  Function: setOffsetToCenter()
+*
+*  Purpose: This function is used to set the positioning point from the default 
+*           upper left point to the center point of the sprite.
+*/
+
+template <class Platform>
+void Sprite<Platform>::setOffsetToCenter()
+{
+	int offsetX = platform.renderer.spriteWidth( spriteID ) / 2;
+	int offsetY = platform.renderer.spriteHeight( spriteID ) / 2;
+
+	platform.renderer.offsetSprite( spriteID, offsetX, offsetY );	
+}
+
+/**
+*  Function: setOffset(int x, int y)
+*
+*  Purpose: This function is used to set the positioning point of the sprite
+*           to the new location that is passed in.
+*
+*  Inputs: int x - the x-coordinate of the new positioning point
+*          int y - the y-coordinate of the new positioning point
+*/
+
+template <class Platform>
+void Sprite<Platform>::setOffset(int x, int y) const
+{
+	platform.renderer.offsetSprite( spriteID, x, y );
+}
+
+/**
+*  Function: getSpriteID()
+*
+*  Purpose: This function returns the private member spriteID.  It is used
+*           in the ButtonSprite and BubbleSprite constructors.
+*/
+
+template <class Platform>
+int Sprite<Platform>::getSpriteID() const
+{
+	return spriteID;
+}
+
+/**
+*  Function: getDegrees()
+*
+*  Purpose: This function returns the current angle of the sprite in degrees.
+*           It is used in Prisms.cpp in boundaryCollisionCheck() to set the 
+*           new direction of the sprite movement after it hits a wall.
+*
+*  Returns: The current angle of the sprite in degrees.
+*/
+
+template <class Platform>
+int Sprite<Platform>::getDegrees() const
+{
+	return degrees;
+}
+
+/**
+*  Function: setWidth(int w)
+*
+*  Purpose: This function sets the width of the sprite to the
+*           value passed to it.  It is used in ButtonSprite's
+*           constructor.
+*
+*  Inputs: int w - The width of the sprite.
+*/
+
+template <class Platform>
+void Sprite<Platform>::setWidth(int w) 
+{
+	width = w;
+}
+
+/**
+*  Function: getWidth()
+*
+*  Purpose: This function returns the current width of the sprite.
+*           It is used in ButtonSprite's mouseOver() function.
+*
+*  Returns: The current width of the sprite.
+*/
+
+template <class Platform>
+int Sprite<Platform>::getWidth() const 
+{
+	return width;
+}
+
+/**
+*  Function: setHeight(int h)
+*
+*  Purpose: This function sets the height of the sprite to the
+*           value passed to it.  It is used in ButtonSprite's
+*           constructor.
+*
+*  Inputs: int h - The height of the sprite.
+*/
+
+template <class Platform>
+void Sprite<Platform>::setHeight(int h)  
+{
+	height = h;
+}
+
+/**
+*  Function: getHeight()
+*
+*  Purpose: This function returns the current height of the sprite.
+*           It is used in ButtonSprite's mouseOver() function.
+*
+*  Returns: The current height of the sprite.
+*/
+
+template <class Platform>
+int Sprite<Platform>::getHeight() const  
+{
+	return height;
+}
+
+/**
+*  Function: setAlpha(int a)
+*
+*  Purpose: This function sets the alpha (transparency) channel of the sprite.
+*           It is used in BubbleSprite::pop() to make the bubble transparent 
+*           during its expand/contract sequence.  It is also used in Prisms.cpp
+*           with the whiteOverlay image to gradually fade in once the user has
+*           popped enough bubbles to win the level.
+*
+*  Inputs: a - The alpha value that determines the level of transparency of the 
+*              sprite.  Acceptible values are in the range of 0-255.  The default
+*              value is 255, which is completely opaque.  A value of 0 makes the 
+*              sprite completely invisible, and any values in between make the 
+*              sprite semitransparent.  The function ensures that the value is
+*              within range (0-255), and sets the alpha channel to 0 otherwise.
+*/
+
+template <class Platform>
+void Sprite<Platform>::setAlpha(int a)
+{
+	if ( a >= 0 && a <= 255 )  // Make sure value is within range.
+	{
+		platform.renderer.setSpriteAlpha( spriteID, a );
+	}
+	else
+	{
+		platform.renderer.setSpriteAlpha( spriteID, 0 );  // Set to 0 (completely invisible) otherwise.
+	}
+}
+
+/**
+*  Function: setTint(uint32 color)
+*
+*  Purpose: This function sets the color the sprite's image is multiplied by,
+*           channel by channel.  The tinted bubbles (see FrontEnd.h) all share
+*           one white image and get their colors this way.
+*
+*  Inputs: color - The tint, 0xAARRGGBB with the alpha ignored.  WHITE leaves
+*                  the image as it is.
+*/
+
+template <class Platform>
+void Sprite<Platform>::setTint(uint32 color) const
+{
+	platform.renderer.tintSprite( spriteID, color );
+}
+
+#endif
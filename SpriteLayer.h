@@ -0,0 +1,790 @@
+/**
+*  File:  SpriteLayer.h
+*
+*  Description:  This header file contains SpriteLayer, a renderer (see
+*                Platform.h) that goes in front of another one and keeps its
+*                own copy of every sprite: where it is, its image, size, offset
+*                point, angle, alpha, tint and whether it is shown.  The sprite calls
+*                only change that copy.  Once a frame, in sync(), each sprite
+*                that changed is sent to the renderer behind it, one call for
+*                each field that is different from what was sent last time,
+*                and nothing for the rest.  Questions like spriteWidth() are
+*                answered from the copy, so nothing is ever read back from the
+*                engine.  Image sizes come from the media (getMediaImageSize()).
+*
+*                Everything else (images, pasting, text, sync) goes straight
+*                through, in order.
+*
+*                The layer counts the calls made to it and the calls it sent
+*                on, so the calls it saved each frame can be reported.  The game
+*                writes them to Prisms.log when it exits, and PrismsTools loop
+*                prints them.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef SPRITE_LAYER_H_
+#define SPRITE_LAYER_H_
+
+#include "Platform.h"
+#include <vector>
+
+using namespace std;
+
+/**
+*  SpriteState is everything about a sprite that the layer keeps, as the game
+*  wants it and as the engine has it.
+*/
+
+struct SpriteState
+{
+	bool exists;
+	bool visible;
+	int x;        // Where the offset point is.
+	int y;
+	int imageID;
+	int width;    // As drawn.
+	int height;
+	int offsetX;
+	int offsetY;
+	int degrees;
+	int alpha;
+	uint32 tint;
+};
+
+template <class Engine>
+class SpriteLayer
+{
+private:
+	struct ImageSize
+	{
+		bool exists;
+		int width;
+		int height;
+	};
+
+	Engine engine;
+	vector <ImageSize> images;
+	vector <SpriteState> wanted;  // As the game has set them.
+	vector <SpriteState> sent;    // As the engine has them.
+	vector <bool> dirty;          // Whether each sprite is in changed.
+	vector <int> changed;         // The sprites to send at the next sync().
+	int asked;                    // Calls made to the layer.
+	int passed;                   // Calls sent on to the engine.
+	int frames;
+
+	SpriteState * find(int spriteID);
+	void touch(int spriteID);
+	void send(int spriteID);
+	void keepImageSize(int imageID, int width, int height);
+
+public:
+	SpriteLayer();
+	bool loadImage(MediaAsset asset, int imageID);
+	bool imageExists(int imageID);
+	void deleteImage(int imageID);
+	bool readImage(int imageID, vector <uint32> & pixels, int & width, int & height);
+	bool makeImage(int imageID, const uint32 * pixels, int width, int height);
+	bool makeCircleImage(int imageID, const CircleStyle & style, int size);
+	void pasteImage(int imageID, int x, int y) { asked++; passed++; engine.pasteImage( imageID, x, y ); }
+	bool grabScreen(int imageID);
+	void sprite(int spriteID, int x, int y, int imageID);
+	bool spriteExists(int spriteID) { asked++; return find( spriteID ) != NULL; }
+	void deleteSprite(int spriteID);
+	void hideSprite(int spriteID);
+	void showSprite(int spriteID);
+	void hideAllSprites();
+	void sizeSprite(int spriteID, int width, int height);
+	void scaleSprite(int spriteID, int percent);
+	void rotateSprite(int spriteID, int degrees);
+	void offsetSprite(int spriteID, int x, int y);
+	int spriteX(int spriteID);
+	int spriteY(int spriteID);
+	int spriteWidth(int spriteID);
+	int spriteHeight(int spriteID);
+	void setSpriteAlpha(int spriteID, int alpha);
+	void tintSprite(int spriteID, uint32 color);
+	void ink(uint32 foreground, uint32 background) { asked++; passed++; engine.ink( foreground, background ); }
+	void setTextSize(int size) { asked++; passed++; engine.setTextSize( size ); }
+	void text(int x, int y, const char * text) { asked++; passed++; engine.text( x, y, text ); }
+	void centerText(int x, int y, const char * text) { asked++; passed++; engine.centerText( x, y, text ); }
+	void syncOn(int rate) { asked++; passed++; engine.syncOn( rate ); }
+	void sync();
+	Engine & getEngine() { return engine; }
+	int getAskedCount() const { return asked; }
+	int getSentCount() const { return passed; }
+	int getFrameCount() const { return frames; }
+};
+
+/**
+*  Function: SpriteLayer()
+*
+*  Purpose: This is the constructor for the SpriteLayer class.  It starts with
+*           no images or sprites.
+*/
+
+template <class Engine>
+SpriteLayer<Engine>::SpriteLayer()
+{
+	asked = 0;
+	passed = 0;
+	frames = 0;
+}
+
+/**
+*  Function: find(int spriteID)
+*
+*  Returns: The sprite as the game wants it, or NULL if it doesn't exist.
+*/
+
+template <class Engine>
+SpriteState * SpriteLayer<Engine>::find(int spriteID)
+{
+	if ( spriteID < 0 || spriteID >= (int)wanted.size() || wanted[spriteID].exists == false )
+	{
+		return NULL;
+	}
+
+	return & wanted[spriteID];
+}
+
+/**
+*  Function: touch(int spriteID)
+*
+*  Purpose: This function makes sure a sprite is sent at the next sync().
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::touch(int spriteID)
+{
+	if ( dirty[spriteID] == false )
+	{
+		dirty[spriteID] = true;
+		changed.push_back( spriteID );
+	}
+}
+
+/**
+*  Function: loadImage(MediaAsset asset, int imageID)
+*
+*  Purpose: This function loads an image into the engine, and keeps its size
+*           for the sprites made from it.
+*
+*  Returns: True if the image was loaded.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::loadImage(MediaAsset asset, int imageID)
+{
+	asked++;
+	passed++;
+
+	if ( engine.loadImage( asset, imageID ) == false || imageID < 0 )
+	{
+		return false;
+	}
+
+	if ( imageID >= (int)images.size() )
+	{
+		ImageSize none = { false, 0, 0 };
+		images.resize( imageID+1, none );
+	}
+
+	images[imageID].exists = true;
+	getMediaImageSize( asset, images[imageID].width, images[imageID].height );
+
+	return true;
+}
+
+/**
+*  Function: imageExists(int imageID)
+*
+*  Returns: True if the image has been loaded through the layer.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::imageExists(int imageID)
+{
+	asked++;
+
+	return imageID >= 0 && imageID < (int)images.size() && images[imageID].exists;
+}
+
+/**
+*  Function: deleteImage(int imageID)
+*
+*  Purpose: This function deletes an image from the engine.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::deleteImage(int imageID)
+{
+	asked++;
+
+	if ( imageID >= 0 && imageID < (int)images.size() && images[imageID].exists )
+	{
+		passed++;
+		engine.deleteImage( imageID );
+
+		images[imageID].exists = false;
+	}
+}
+
+/**
+*  Function: readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+*
+*  Purpose: This function copies an image's pixels out of the engine.
+*
+*  Returns: True if it was copied.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::readImage(int imageID, vector <uint32> & pixels, int & width, int & height)
+{
+	asked++;
+	passed++;
+
+	return engine.readImage( imageID, pixels, width, height );
+}
+
+/**
+*  Function: makeImage(int imageID, const uint32 * pixels, int width, int height)
+*
+*  Purpose: This function makes an image in the engine from pixels, and keeps
+*           its size for the sprites made from it.
+*
+*  Returns: True if the image was made.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::makeImage(int imageID, const uint32 * pixels, int width, int height)
+{
+	asked++;
+	passed++;
+
+	if ( engine.makeImage( imageID, pixels, width, height ) == false || imageID < 0 )
+	{
+		return false;
+	}
+
+	keepImageSize( imageID, width, height );
+
+	return true;
+}
+
+/**
+*  Function: makeCircleImage(int imageID, const CircleStyle & style, int size)
+*
+*  Purpose: This function makes an image of a circle in the engine, and keeps
+*           its size for the sprites made from it.
+*
+*  Returns: True if the image was made.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::makeCircleImage(int imageID, const CircleStyle & style, int size)
+{
+	asked++;
+	passed++;
+
+	if ( engine.makeCircleImage( imageID, style, size ) == false || imageID < 0 )
+	{
+		return false;
+	}
+
+	keepImageSize( imageID, size, size );
+
+	return true;
+}
+
+/**
+*  Function: grabScreen(int imageID)
+*
+*  Purpose: This function makes an image of the screen in the engine, and
+*           keeps its size for the sprites made from it.
+*
+*  Returns: True if the image was made.
+*/
+
+template <class Engine>
+bool SpriteLayer<Engine>::grabScreen(int imageID)
+{
+	asked++;
+	passed++;
+
+	if ( engine.grabScreen( imageID ) == false || imageID < 0 )
+	{
+		return false;
+	}
+
+	keepImageSize( imageID, SCREEN_WIDTH, SCREEN_HEIGHT );
+
+	return true;
+}
+
+/**
+*  Function: keepImageSize(int imageID, int width, int height)
+*
+*  Purpose: This function records the size of an image made in the engine.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::keepImageSize(int imageID, int width, int height)
+{
+	if ( imageID >= (int)images.size() )
+	{
+		ImageSize none = { false, 0, 0 };
+		images.resize( imageID+1, none );
+	}
+
+	images[imageID].exists = true;
+	images[imageID].width = width;
+	images[imageID].height = height;
+}
+
+/**
+*  Function: sprite(int spriteID, int x, int y, int imageID)
+*
+*  Purpose: This function does what dbSprite() does, to the layer's copy.  The
+*           first time, it makes the sprite, shown and the size of its image.
+*           After that, it moves the sprite and changes its image.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::sprite(int spriteID, int x, int y, int imageID)
+{
+	asked++;
+
+	if ( spriteID < 0 )
+	{
+		return;
+	}
+
+	if ( spriteID >= (int)wanted.size() )
+	{
+		SpriteState none = { false, false, 0, 0, 0, 0, 0, 0, 0, 0, 255, WHITE };
+		wanted.resize( spriteID+1, none );
+		sent.resize( spriteID+1, none );
+		dirty.resize( spriteID+1, false );
+	}
+
+	SpriteState & s = wanted[spriteID];
+
+	if ( s.exists == false )
+	{
+		bool known = imageID >= 0 && imageID < (int)images.size();
+
+		s.exists = true;
+		s.visible = true;
+		s.width = known ? images[imageID].width : 0;
+		s.height = known ? images[imageID].height : 0;
+		s.offsetX = 0;
+		s.offsetY = 0;
+		s.degrees = 0;
+		s.alpha = 255;
+		s.tint = WHITE;
+	}
+
+	s.x = x;
+	s.y = y;
+	s.imageID = imageID;
+
+	touch( spriteID );
+}
+
+/**
+*  Function: deleteSprite(int spriteID)
+*
+*  Purpose: This function deletes a sprite, from the engine too if it had been
+*           sent there.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::deleteSprite(int spriteID)
+{
+	asked++;
+
+	if ( find( spriteID ) == NULL )
+	{
+		return;
+	}
+
+	if ( sent[spriteID].exists )
+	{
+		passed++;
+		engine.deleteSprite( spriteID );
+	}
+
+	wanted[spriteID].exists = false;
+	sent[spriteID].exists = false;
+}
+
+/**
+*  Function: hideSprite(int spriteID)
+*
+*  Purpose: This function hides a sprite.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::hideSprite(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->visible )
+	{
+		s->visible = false;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: showSprite(int spriteID)
+*
+*  Purpose: This function shows a sprite.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::showSprite(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->visible == false )
+	{
+		s->visible = true;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: hideAllSprites()
+*
+*  Purpose: This function hides every sprite.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::hideAllSprites()
+{
+	asked++;
+
+	for ( int i = 0; i < (int)wanted.size(); i++ )
+	{
+		if ( wanted[i].exists && wanted[i].visible )
+		{
+			wanted[i].visible = false;
+			touch( i );
+		}
+	}
+}
+
+/**
+*  Function: sizeSprite(int spriteID, int width, int height)
+*
+*  Purpose: This function sets the size a sprite is drawn at.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::sizeSprite(int spriteID, int width, int height)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && ( s->width != width || s->height != height ) )
+	{
+		s->width = width;
+		s->height = height;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: scaleSprite(int spriteID, int percent)
+*
+*  Purpose: This function sets the size a sprite is drawn at to a percentage of
+*           its image's size.  It is sent to the engine as that size.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::scaleSprite(int spriteID, int percent)
+{
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->imageID >= 0 && s->imageID < (int)images.size() )
+	{
+		sizeSprite( spriteID, images[s->imageID].width * percent / 100, images[s->imageID].height * percent / 100 );
+	}
+	else
+	{
+		asked++;
+	}
+}
+
+/**
+*  Function: rotateSprite(int spriteID, int degrees)
+*
+*  Purpose: This function sets a sprite's angle.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::rotateSprite(int spriteID, int degrees)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->degrees != degrees )
+	{
+		s->degrees = degrees;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: offsetSprite(int spriteID, int x, int y)
+*
+*  Purpose: This function sets a sprite's offset point.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::offsetSprite(int spriteID, int x, int y)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && ( s->offsetX != x || s->offsetY != y ) )
+	{
+		s->offsetX = x;
+		s->offsetY = y;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: spriteX(int spriteID)
+*
+*  Returns: The x-coordinate of the sprite's offset point, or 0 if there is no
+*           such sprite.
+*/
+
+template <class Engine>
+int SpriteLayer<Engine>::spriteX(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	return s != NULL ? s->x : 0;
+}
+
+/**
+*  Function: spriteY(int spriteID)
+*
+*  Returns: The y-coordinate of the sprite's offset point, or 0 if there is no
+*           such sprite.
+*/
+
+template <class Engine>
+int SpriteLayer<Engine>::spriteY(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	return s != NULL ? s->y : 0;
+}
+
+/**
+*  Function: spriteWidth(int spriteID)
+*
+*  Returns: The width the sprite is drawn at, or 0 if there is no such sprite.
+*/
+
+template <class Engine>
+int SpriteLayer<Engine>::spriteWidth(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	return s != NULL ? s->width : 0;
+}
+
+/**
+*  Function: spriteHeight(int spriteID)
+*
+*  Returns: The height the sprite is drawn at, or 0 if there is no such sprite.
+*/
+
+template <class Engine>
+int SpriteLayer<Engine>::spriteHeight(int spriteID)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	return s != NULL ? s->height : 0;
+}
+
+/**
+*  Function: setSpriteAlpha(int spriteID, int alpha)
+*
+*  Purpose: This function sets how opaque a sprite is, from 0 to 255.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::setSpriteAlpha(int spriteID, int alpha)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->alpha != alpha )
+	{
+		s->alpha = alpha;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: tintSprite(int spriteID, uint32 color)
+*
+*  Purpose: This function sets the color a sprite's image is multiplied by.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::tintSprite(int spriteID, uint32 color)
+{
+	asked++;
+
+	SpriteState * s = find( spriteID );
+
+	if ( s != NULL && s->tint != color )
+	{
+		s->tint = color;
+		touch( spriteID );
+	}
+}
+
+/**
+*  Function: send(int spriteID)
+*
+*  Purpose: This function sends the engine the fields of a sprite that are
+*           different from what it has.  A sprite the engine doesn't have yet
+*           is made first, which gives it the engine's own defaults.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::send(int spriteID)
+{
+	const SpriteState & want = wanted[spriteID];
+	SpriteState & have = sent[spriteID];
+
+	if ( want.exists == false )
+	{
+		return;
+	}
+
+	if ( have.exists == false )
+	{
+		bool known = want.imageID >= 0 && want.imageID < (int)images.size();
+
+		passed++;
+		engine.sprite( spriteID, want.x, want.y, want.imageID );
+
+		have = want;
+		have.visible = true;
+		have.width = known ? images[want.imageID].width : 0;
+		have.height = known ? images[want.imageID].height : 0;
+		have.offsetX = 0;
+		have.offsetY = 0;
+		have.degrees = 0;
+		have.alpha = 255;
+		have.tint = WHITE;
+	}
+	else if ( have.x != want.x || have.y != want.y || have.imageID != want.imageID )
+	{
+		passed++;
+		engine.sprite( spriteID, want.x, want.y, want.imageID );
+	}
+
+	if ( have.width != want.width || have.height != want.height )
+	{
+		passed++;
+		engine.sizeSprite( spriteID, want.width, want.height );
+	}
+
+	if ( have.offsetX != want.offsetX || have.offsetY != want.offsetY )
+	{
+		passed++;
+		engine.offsetSprite( spriteID, want.offsetX, want.offsetY );
+	}
+
+	if ( have.degrees != want.degrees )
+	{
+		passed++;
+		engine.rotateSprite( spriteID, want.degrees );
+	}
+
+	if ( have.alpha != want.alpha )
+	{
+		passed++;
+		engine.setSpriteAlpha( spriteID, want.alpha );
+	}
+
+	if ( have.tint != want.tint )
+	{
+		passed++;
+		engine.tintSprite( spriteID, want.tint );
+	}
+
+	if ( have.visible != want.visible )
+	{
+		passed++;
+
+		if ( want.visible )
+		{
+			engine.showSprite( spriteID );
+		}
+		else
+		{
+			engine.hideSprite( spriteID );
+		}
+	}
+
+	have = want;
+}
+
+/**
+*  Function: sync()
+*
+*  Purpose: This function sends every sprite that changed this frame to the
+*           engine, and then finishes the frame.
+*/
+
+template <class Engine>
+void SpriteLayer<Engine>::sync()
+{
+	asked++;
+
+	for ( int i = 0; i < (int)changed.size(); i++ )
+	{
+		send( changed[i] );
+		dirty[changed[i]] = false;
+	}
+
+	changed.clear();
+
+	passed++;
+	engine.sync();
+
+	frames++;
+}
+
+#endif
@@ -0,0 +1,581 @@
+/**
+*  File:  Threading.cpp
+*
+*  Description:  This file contains the method implementations for WorkerPool and
+*                TaskThread, and the operating system specific atomic operations,
+*                semaphores and threads that they are built on.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "Threading.h"
+#include "Profiler.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>   // For sched_yield().
+#include <unistd.h>  // For sysconf().
+#endif
+
+/**
+*  Function: atomicAdd(volatile int32 * p, int32 value)
+*
+*  Purpose: This function adds to a value shared between threads.
+*
+*  Inputs: p - The shared value.
+*          value - The amount to add.
+*
+*  Returns: The new value.
+*/
+
+int32 atomicAdd(volatile int32 * p, int32 value)
+{
+#ifdef _WIN32
+	return (int32)InterlockedExchangeAdd( (volatile LONG *)p, (LONG)value ) + value;
+#else
+	return __sync_add_and_fetch( p, value );
+#endif
+}
+
+/**
+*  Function: atomicCompareExchange(volatile int32 * p, int32 exchange, int32 comparand)
+*
+*  Purpose: This function sets a value shared between threads to exchange, but only
+*           if it still equals comparand.
+*
+*  Inputs: p - The shared value.
+*          exchange - The new value.
+*          comparand - The value p must hold for it to be changed.
+*
+*  Returns: The value p held before the call.  The exchange happened if this
+*           equals comparand.
+*/
+
+int32 atomicCompareExchange(volatile int32 * p, int32 exchange, int32 comparand)
+{
+#ifdef _WIN32
+	return (int32)InterlockedCompareExchange( (volatile LONG *)p, (LONG)exchange, (LONG)comparand );
+#else
+	return __sync_val_compare_and_swap( p, comparand, exchange );
+#endif
+}
+
+/**
+*  Function: atomicMin(volatile int32 * p, int32 value)
+*
+*  Purpose: This function lowers a value shared between threads to value, if value
+*           is smaller.  However many threads call it at once, the result is the
+*           smallest of all of their values.
+*
+*  Inputs: p - The shared value.
+*          value - The value to compare with.
+*
+*  Returns: The value p held before the call.
+*/
+
+int32 atomicMin(volatile int32 * p, int32 value)
+{
+	int32 old = *p;
+
+	while ( value < old )
+	{
+		int32 seen = atomicCompareExchange( p, value, old );
+
+		if ( seen == old )
+		{
+			break;
+		}
+
+		old = seen;
+	}
+
+	return old;
+}
+
+/**
+*  Function: getProcessorCount()
+*
+*  Returns: The number of processors available to the program (at least 1).
+*/
+
+int getProcessorCount()
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo( & info );
+	int count = (int)info.dwNumberOfProcessors;
+#else
+	int count = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+
+	return count > 0 ? count : 1;
+}
+
+/**
+*  WorkerQueue is one worker's share of the chunks, [head, tail).  The owner takes
+*  chunks from the head and other workers steal them from the tail.  The padding
+*  keeps each queue on its own cache line.
+*/
+
+struct WorkerQueue
+{
+	volatile int32 lock;
+	int head;
+	int tail;
+	char padding[64 - 3*sizeof(int32)];
+};
+
+/**
+*  WorkerSemaphore is a counting semaphore.  Windows has one built in.  POSIX
+*  semaphores are missing or deprecated on some systems, so a mutex and a
+*  condition variable are used there instead.
+*/
+
+class WorkerSemaphore
+{
+private:
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_mutex_t mutex;
+	pthread_cond_t condition;
+	int count;
+#endif
+
+public:
+	WorkerSemaphore()
+	{
+#ifdef _WIN32
+		handle = CreateSemaphore( NULL, 0, 0x7fffffff, NULL );
+#else
+		pthread_mutex_init( & mutex, NULL );
+		pthread_cond_init( & condition, NULL );
+		count = 0;
+#endif
+	}
+
+	~WorkerSemaphore()
+	{
+#ifdef _WIN32
+		CloseHandle( handle );
+#else
+		pthread_cond_destroy( & condition );
+		pthread_mutex_destroy( & mutex );
+#endif
+	}
+
+	void post(int times)
+	{
+#ifdef _WIN32
+		ReleaseSemaphore( handle, times, NULL );
+#else
+		pthread_mutex_lock( & mutex );
+		count += times;
+		pthread_cond_broadcast( & condition );
+		pthread_mutex_unlock( & mutex );
+#endif
+	}
+
+	void wait()
+	{
+#ifdef _WIN32
+		WaitForSingleObject( handle, INFINITE );
+#else
+		pthread_mutex_lock( & mutex );
+
+		while ( count == 0 )
+		{
+			pthread_cond_wait( & condition, & mutex );
+		}
+
+		count--;
+		pthread_mutex_unlock( & mutex );
+#endif
+	}
+};
+
+/**
+*  WorkerThread is one of the pool's extra threads.  Worker 0 is the thread that
+*  calls parallelFor(), so it has no WorkerThread of its own.
+*/
+
+struct WorkerThread
+{
+	WorkerPool * pool;
+	int worker;
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI workerThreadMain(LPVOID parameter)
+#else
+static void * workerThreadMain(void * parameter)
+#endif
+{
+	WorkerThread * thread = (WorkerThread *)parameter;
+	thread->pool->workerMain( thread->worker );
+
+	return 0;
+}
+
+/**
+*  Function: WorkerPool(int workers)
+*
+*  Purpose: This is the constructor for the WorkerPool class.  It starts the
+*           worker threads, which sleep until parallelFor() is called.
+*
+*  Inputs: workers - The number of threads to use, counting the calling thread.
+*                    0 means one per processor.
+*/
+
+WorkerPool::WorkerPool(int workers)
+{
+	if ( workers <= 0 )
+	{
+		workers = getProcessorCount();
+	}
+
+	threadCount = workers;
+	quitting = false;
+	task = NULL;
+	itemCount = 0;
+	grain = 1;
+	queues = new WorkerQueue[threadCount];
+	threads = new WorkerThread[threadCount];
+	startSignal = new WorkerSemaphore();
+	doneSignal = new WorkerSemaphore();
+
+	for ( int i = 0; i < threadCount; i++ )
+	{
+		queues[i].lock = 0;
+		queues[i].head = 0;
+		queues[i].tail = 0;
+	}
+
+	for ( int i = 1; i < threadCount; i++ )
+	{
+		WorkerThread & thread = threads[i];
+		thread.pool = this;
+		thread.worker = i;
+
+#ifdef _WIN32
+		thread.handle = CreateThread( NULL, 0, workerThreadMain, & thread, 0, NULL );
+#else
+		pthread_create( & thread.handle, NULL, workerThreadMain, & thread );
+#endif
+	}
+}
+
+/**
+*  Function: ~WorkerPool()
+*
+*  Purpose: This is the destructor for the WorkerPool class.  It wakes the worker
+*           threads up to tell them to quit and waits for them to finish.
+*/
+
+WorkerPool::~WorkerPool()
+{
+	quitting = true;
+	startSignal->post( threadCount-1 );
+
+	for ( int i = 1; i < threadCount; i++ )
+	{
+#ifdef _WIN32
+		WaitForSingleObject( threads[i].handle, INFINITE );
+		CloseHandle( threads[i].handle );
+#else
+		pthread_join( threads[i].handle, NULL );
+#endif
+	}
+
+	delete startSignal;
+	delete doneSignal;
+	delete [] threads;
+	delete [] queues;
+}
+
+/**
+*  Function: getThreadCount()
+*
+*  Returns: The number of workers, counting the thread that calls parallelFor().
+*/
+
+int WorkerPool::getThreadCount() const
+{
+	return threadCount;
+}
+
+/**
+*  Function: parallelFor(int count, int chunkSize, ParallelTask & parallelTask)
+*
+*  Purpose: This function runs parallelTask on the items 0 to count-1, chunkSize
+*           items at a time, using every worker.  It returns when all of the items
+*           are done.
+*
+*  Inputs: count - The number of items.
+*          chunkSize - The number of items in each chunk (the last may be smaller).
+*          parallelTask - The work to do.
+*/
+
+void WorkerPool::parallelFor(int count, int chunkSize, ParallelTask & parallelTask)
+{
+	if ( count <= 0 )
+	{
+		return;
+	}
+
+	if ( chunkSize < 1 )
+	{
+		chunkSize = 1;
+	}
+
+	int chunks = ( count + chunkSize - 1 ) / chunkSize;
+
+	if ( threadCount == 1 || chunks == 1 )  // Not worth waking anybody up.
+	{
+		for ( int begin = 0; begin < count; begin += chunkSize )
+		{
+			parallelTask.run( begin, begin + chunkSize < count ? begin + chunkSize : count, 0 );
+		}
+
+		return;
+	}
+
+	task = & parallelTask;
+	itemCount = count;
+	grain = chunkSize;
+
+	for ( int i = 0; i < threadCount; i++ )
+	{
+		queues[i].head = (int)( (int64)chunks * i / threadCount );
+		queues[i].tail = (int)( (int64)chunks * (i+1) / threadCount );
+	}
+
+	startSignal->post( threadCount-1 );
+
+	work( 0 );
+
+	for ( int i = 1; i < threadCount; i++ )
+	{
+		doneSignal->wait();
+	}
+
+	task = NULL;
+}
+
+/**
+*  Function: workerMain(int worker)
+*
+*  Purpose: This is the loop run by each extra thread.  It waits for parallelFor()
+*           to hand out work, helps with it, and reports back when the chunks have
+*           all been taken.
+*
+*  Inputs: worker - The worker's number (1 to getThreadCount()-1).
+*/
+
+void WorkerPool::workerMain(int worker)
+{
+	for ( ;; )
+	{
+		startSignal->wait();
+
+		if ( quitting )
+		{
+			break;
+		}
+
+		work( worker );
+		doneSignal->post( 1 );
+	}
+}
+
+/**
+*  Function: takeChunk(int worker, int & chunk)
+*
+*  Purpose: This function finds the next chunk for a worker: the front of its own
+*           queue if there is anything left in it, otherwise the back of the first
+*           other queue that still has chunks in it.
+*
+*  Inputs: worker - The worker looking for work.
+*          chunk - Set to the chunk to run.
+*
+*  Returns: True if a chunk was found, or false if every queue is empty.
+*/
+
+bool WorkerPool::takeChunk(int worker, int & chunk)
+{
+	for ( int i = 0; i < threadCount; i++ )
+	{
+		WorkerQueue & queue = queues[( worker + i ) % threadCount];
+
+		while ( atomicCompareExchange( & queue.lock, 1, 0 ) != 0 )
+		{
+#ifdef _WIN32
+			SwitchToThread();
+#else
+			sched_yield();
+#endif
+		}
+
+		bool found = queue.head < queue.tail;
+
+		if ( found )
+		{
+			chunk = i == 0 ? queue.head++ : --queue.tail;
+		}
+
+		atomicCompareExchange( & queue.lock, 0, 1 );
+
+		if ( found )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+*  Function: work(int worker)
+*
+*  Purpose: This function runs chunks until there are none left.
+*
+*  Inputs: worker - The worker doing the work.
+*/
+
+void WorkerPool::work(int worker)
+{
+	int chunk;
+
+	while ( takeChunk( worker, chunk ) )
+	{
+		PROFILE_SCOPE( "chunk" );
+
+		int begin = chunk * grain;
+		int end = begin + grain < itemCount ? begin + grain : itemCount;
+
+		task->run( begin, end, worker );
+	}
+}
+
+/**
+*  TaskThreadHandle is the operating system's handle for a TaskThread's thread,
+*  and the task it runs.
+*/
+
+struct TaskThreadHandle
+{
+	ThreadTask * task;
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI taskThreadMain(LPVOID parameter)
+#else
+static void * taskThreadMain(void * parameter)
+#endif
+{
+	TaskThreadHandle * thread = (TaskThreadHandle *)parameter;
+	thread->task->run();
+
+	return 0;
+}
+
+/**
+*  Function: TaskThread()
+*
+*  Purpose: This is the constructor for the TaskThread class.  No thread is
+*           started until start() is called.
+*/
+
+TaskThread::TaskThread()
+{
+	handle = NULL;
+}
+
+/**
+*  Function: ~TaskThread()
+*
+*  Purpose: This is the destructor for the TaskThread class.  It waits for the
+*           thread to finish, if it is still running.
+*/
+
+TaskThread::~TaskThread()
+{
+	join();
+}
+
+/**
+*  Function: start(ThreadTask & threadTask)
+*
+*  Purpose: This function starts a thread that runs threadTask.  threadTask must
+*           last until join() returns.
+*
+*  Inputs: threadTask - The work to do.
+*
+*  Returns: True if the thread was started, or false if one is already running
+*           or the operating system couldn't start it.
+*/
+
+bool TaskThread::start(ThreadTask & threadTask)
+{
+	if ( handle != NULL )
+	{
+		return false;
+	}
+
+	handle = new TaskThreadHandle();
+	handle->task = & threadTask;
+
+#ifdef _WIN32
+	handle->handle = CreateThread( NULL, 0, taskThreadMain, handle, 0, NULL );
+	bool started = handle->handle != NULL;
+#else
+	bool started = pthread_create( & handle->handle, NULL, taskThreadMain, handle ) == 0;
+#endif
+
+	if ( started == false )
+	{
+		delete handle;
+		handle = NULL;
+	}
+
+	return started;
+}
+
+/**
+*  Function: join()
+*
+*  Purpose: This function waits for the thread to finish running its task.  It
+*           does nothing if no thread was started.
+*/
+
+void TaskThread::join()
+{
+	if ( handle == NULL )
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	WaitForSingleObject( handle->handle, INFINITE );
+	CloseHandle( handle->handle );
+#else
+	pthread_join( handle->handle, NULL );
+#endif
+
+	delete handle;
+	handle = NULL;
+}
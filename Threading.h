@@ -0,0 +1,111 @@
+/**
+*  File:  Threading.h
+*
+*  Description:  This header file contains a small thread pool, WorkerPool, and the
+*                atomic operations used with it.  It uses Win32 threads on Windows
+*                and pthreads elsewhere (Visual C++ 2008 has no <thread>).
+*
+*                parallelFor() splits a range of items into chunks.  Each worker
+*                starts with an equal share of the chunks in its own queue, takes
+*                chunks from the front of that queue, and when it runs out it steals
+*                chunks from the back of the other workers' queues.  The thread that
+*                calls parallelFor() works as worker 0, and the call returns when
+*                every chunk has been run.
+*
+*                Which worker runs which chunk changes from run to run, so a task
+*                must give the same result no matter how its chunks are shared out.
+*
+*                TaskThread runs a single ThreadTask on a thread of its own, for
+*                work that goes on alongside the calling thread for a long time
+*                instead of being split up and waited for.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#ifndef THREADING_H_
+#define THREADING_H_
+
+#include "Portable.h"
+
+int32 atomicAdd(volatile int32 * p, int32 value);
+int32 atomicCompareExchange(volatile int32 * p, int32 exchange, int32 comparand);
+int32 atomicMin(volatile int32 * p, int32 value);
+int getProcessorCount();
+
+/**
+*  ParallelTask is the work handed to WorkerPool::parallelFor().  run() is called
+*  once for each chunk, with the items [begin, end) and the number of the worker
+*  running it (0 to getThreadCount()-1), which can be used to index per-worker
+*  totals without locking.
+*/
+
+class ParallelTask
+{
+public:
+	virtual ~ParallelTask() {}
+	virtual void run(int begin, int end, int worker) = 0;
+};
+
+struct WorkerQueue;
+struct WorkerThread;
+class WorkerSemaphore;
+
+class WorkerPool
+{
+private:
+	int threadCount;
+	bool quitting;
+	ParallelTask * task;
+	int itemCount;
+	int grain;
+	WorkerQueue * queues;
+	WorkerThread * threads;
+	WorkerSemaphore * startSignal;
+	WorkerSemaphore * doneSignal;
+
+	WorkerPool(const WorkerPool &);
+	WorkerPool & operator=(const WorkerPool &);
+
+	bool takeChunk(int worker, int & chunk);
+	void work(int worker);
+
+public:
+	WorkerPool(int workers);
+	~WorkerPool();
+	int getThreadCount() const;
+	void parallelFor(int count, int chunkSize, ParallelTask & parallelTask);
+	void workerMain(int worker);
+};
+
+/**
+*  ThreadTask is the work handed to TaskThread::start().  run() is called once,
+*  on the new thread.
+*/
+
+class ThreadTask
+{
+public:
+	virtual ~ThreadTask() {}
+	virtual void run() = 0;
+};
+
+struct TaskThreadHandle;
+
+class TaskThread
+{
+private:
+	TaskThreadHandle * handle;
+
+	TaskThread(const TaskThread &);
+	TaskThread & operator=(const TaskThread &);
+
+public:
+	TaskThread();
+	~TaskThread();
+	bool start(ThreadTask & threadTask);
+	void join();
+};
+
+#endif
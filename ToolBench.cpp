@@ -0,0 +1,598 @@
+/**
+*  File:  ToolBench.cpp
+*
+*  Description:  This file contains the bench command of PrismsTools.  It times the
+*                simulation kernels one at a time, so that two versions of a kernel
+*                can be compared on the same machine:
+*
+*                bubbleCollisionCheck    simBubbleCollisionCheck(), each bubble against the next.
+*                boundaryCollisionCheck  simBoundaryCollisionCheck() on every bubble.
+*                move                    simMove() on every bubble.
+*                pop                     simPop() on every bubble, through a whole pop.
+*                detectBubbleCollisions  One full collision pass, part way into the chain reaction.
+*                level                   A whole level, from the click to the end of the chain reaction.
+*
+*                The last two are run on the "scalar" engine (one thread, every
+*                popper against every bubble) and on the "grid" engine (a WorkerPool
+*                and the collision grid of SimulationParallel.cpp).  The scalar
+*                engine takes time in the square of the number of bubbles, so it is
+*                left out above SCALAR_BUBBLE_LIMIT bubbles.
+*
+*                Each kernel is run with 5, 60, 1000 and 100000 bubbles, laid out
+*                three ways:
+*
+*                sparse       A square lattice, too far apart for a popped bubble to reach its neighbours.
+*                dense        A square lattice of touching bubbles, so the chain reaction reaches them all.
+*                overlapping  Every bubble on the same spot, the worst case for the collision test.
+*
+*                The arena is made big enough for each layout.  A kernel is run
+*                over and over until it has taken at least the minimum time, and
+*                the average is reported as nanoseconds per operation (one bubble,
+*                one pass or one level) and bubbles per second.
+*
+*                Usage:  PrismsTools bench [bubbles] [ms] [threads] [json]
+*
+*                bubbles is the most bubbles to try (default 100000).  ms is the
+*                minimum time for each kernel (default 200).  threads is the size of
+*                the grid engine's WorkerPool (default 1, so results don't depend on
+*                the number of processors).  If json is given, the results are also
+*                written to that file.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "Simulation.h"
+#include <stdio.h>
+
+const int SCALAR_BUBBLE_LIMIT = 10000;    // Most bubbles for the scalar collision pass and level.
+const int BATCH_ITEMS = 1 << 20;          // Bubbles a per-bubble kernel works through between timer reads.
+const int PASS_WARMUP_TICKS = 20;         // Frames played after the click before the collision pass is timed.
+const int MAX_LEVEL_TICKS = 100000;       // Safety limit.  A real chain reaction ends long before this.
+
+const int BENCH_SIZES[] = { 5, 60, 1000, 100000 };
+const int BENCH_SIZE_COUNT = sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]);
+
+enum BenchLayout { LAYOUT_SPARSE, LAYOUT_DENSE, LAYOUT_OVERLAPPING, LAYOUT_COUNT };
+const char * LAYOUT_NAMES[LAYOUT_COUNT] = { "sparse", "dense", "overlapping" };
+
+/**
+*  BenchLevel is one layout: the bubbles, the arena they fit in and where the
+*  user clicks to start the chain reaction.
+*/
+
+struct BenchLevel
+{
+	SimConfig config;
+	vector <SimBubble> bubbles;
+	int clickX;
+	int clickY;
+};
+
+/**
+*  BenchResult is one line of the results.
+*/
+
+struct BenchResult
+{
+	const char * kernel;
+	const char * engine;
+	const char * layout;
+	int bubbles;
+	double runs;
+	double nsPerOp;
+	double itemsPerSecond;
+};
+
+/**
+*  BenchCase is one kernel, ready to run.  setup() gets it ready (and isn't
+*  timed), and returns how many times run() may then be called before it
+*  needs setting up again.
+*/
+
+class BenchCase
+{
+public:
+	const char * kernel;
+	const char * engine;
+	int opsPerRun;      // Operations in each run(), for nanoseconds per operation.
+	int itemsPerRun;    // Bubbles in each run(), for bubbles per second.
+
+	virtual ~BenchCase() {}
+	virtual int setup() = 0;
+	virtual void run() = 0;
+};
+
+/**
+*  Function: makeLevel(BenchLayout layout, int count, BenchLevel & level)
+*
+*  Purpose: This function lays out count bubbles of the game's size in one of the
+*           canonical layouts, in the middle of an arena that fits them with room
+*           to move.  The headings and notes are random, but the same layout and
+*           count always give the same level.
+*
+*  Inputs: layout - Which layout.
+*          count - The number of bubbles.
+*          level - Filled in with the layout.
+*/
+
+static void makeLevel(BenchLayout layout, int count, BenchLevel & level)
+{
+	SimConfig & config = level.config;
+	config = SimConfig();
+
+	int radius = config.bubbleRadius;
+	int spacing = 0;
+	int columns = 1;
+
+	if ( layout == LAYOUT_SPARSE )
+	{
+		spacing = 2*radius + config.popExpansion + 16;  // Out of reach even fully expanded.
+	}
+	else if ( layout == LAYOUT_DENSE )
+	{
+		spacing = 2*radius;
+	}
+
+	if ( spacing > 0 )
+	{
+		while ( columns * columns < count )
+		{
+			columns++;
+		}
+	}
+
+	int extent = ( columns - 1 ) * spacing;
+	int margin = 2 * ( radius + config.popExpansion );
+
+	config.arenaWidth = extent + 2*margin > SCREEN_WIDTH ? extent + 2*margin : SCREEN_WIDTH;
+	config.arenaHeight = extent + 2*margin > SCREEN_HEIGHT ? extent + 2*margin : SCREEN_HEIGHT;
+
+	int left = ( config.arenaWidth - extent ) / 2;
+	int top = ( config.arenaHeight - extent ) / 2;
+
+	SimRandom random( (uint32)count * 3u + (uint32)layout );
+
+	level.bubbles.resize( count );
+
+	for ( int i = 0; i < count; i++ )
+	{
+		SimBubble & b = level.bubbles[i];
+
+		simInitBubble( b, left + ( i % columns ) * spacing, top + ( i / columns ) * spacing,
+			           radius, config.popExpansion, random.next( 310 ) + 30, false );
+
+		b.imageIndex = i % BUBBLE_IMAGE_COUNT;
+		b.noteIndex = random.next( NOTE_COUNT-1 );
+	}
+
+	if ( layout == LAYOUT_SPARSE && count > 0 )  // On the first bubble.
+	{
+		level.clickX = level.bubbles[0].centerX;
+		level.clickY = level.bubbles[0].centerY;
+	}
+	else  // In the middle of the cluster.
+	{
+		level.clickX = config.arenaWidth / 2;
+		level.clickY = config.arenaHeight / 2;
+	}
+}
+
+/**
+*  CollisionCheckCase times simBubbleCollisionCheck(), testing each bubble
+*  against the next one in the layout.
+*/
+
+class CollisionCheckCase : public BenchCase
+{
+private:
+	const BenchLevel & level;
+	int hitCount;
+
+public:
+	CollisionCheckCase(const BenchLevel & benchLevel) : level( benchLevel )
+	{
+		kernel = "bubbleCollisionCheck";
+		engine = "scalar";
+		opsPerRun = (int)level.bubbles.size();
+		itemsPerRun = opsPerRun;
+		hitCount = 0;
+	}
+
+	int setup()
+	{
+		return BATCH_ITEMS / itemsPerRun + 1;
+	}
+
+	void run()
+	{
+		const vector <SimBubble> & b = level.bubbles;
+		int count = (int)b.size();
+
+		for ( int i = 0; i < count; i++ )
+		{
+			if ( simBubbleCollisionCheck( b[i], b[i+1 < count ? i+1 : 0] ) )
+			{
+				hitCount++;
+			}
+		}
+	}
+};
+
+/**
+*  BoundaryCase times simBoundaryCollisionCheck() on every bubble.
+*/
+
+class BoundaryCase : public BenchCase
+{
+private:
+	const BenchLevel & level;
+	vector <SimBubble> bubbles;
+
+public:
+	BoundaryCase(const BenchLevel & benchLevel) : level( benchLevel )
+	{
+		kernel = "boundaryCollisionCheck";
+		engine = "scalar";
+		opsPerRun = (int)level.bubbles.size();
+		itemsPerRun = opsPerRun;
+	}
+
+	int setup()
+	{
+		bubbles = level.bubbles;
+		return BATCH_ITEMS / itemsPerRun + 1;
+	}
+
+	void run()
+	{
+		for ( int i = 0; i < (int)bubbles.size(); i++ )
+		{
+			simBoundaryCollisionCheck( bubbles[i], level.config.arenaWidth, level.config.arenaHeight );
+		}
+	}
+};
+
+/**
+*  MoveCase times simMove() on every bubble.
+*/
+
+class MoveCase : public BenchCase
+{
+private:
+	const BenchLevel & level;
+	vector <SimBubble> bubbles;
+
+public:
+	MoveCase(const BenchLevel & benchLevel) : level( benchLevel )
+	{
+		kernel = "move";
+		engine = "scalar";
+		opsPerRun = (int)level.bubbles.size();
+		itemsPerRun = opsPerRun;
+	}
+
+	int setup()
+	{
+		bubbles = level.bubbles;
+		return BATCH_ITEMS / itemsPerRun + 1;
+	}
+
+	void run()
+	{
+		for ( int i = 0; i < (int)bubbles.size(); i++ )
+		{
+			simMove( bubbles[i] );
+		}
+	}
+};
+
+/**
+*  PopCase times simPop() on every bubble.  setup() starts them all popping,
+*  and they can then be run through one whole pop: expanding, holding and
+*  contracting to nothing.
+*/
+
+class PopCase : public BenchCase
+{
+private:
+	const BenchLevel & level;
+	vector <SimBubble> bubbles;
+	int currentPopping;
+
+public:
+	PopCase(const BenchLevel & benchLevel) : level( benchLevel )
+	{
+		kernel = "pop";
+		engine = "scalar";
+		opsPerRun = (int)level.bubbles.size();
+		itemsPerRun = opsPerRun;
+		currentPopping = 0;
+	}
+
+	int setup()
+	{
+		bubbles = level.bubbles;
+
+		for ( int i = 0; i < (int)bubbles.size(); i++ )
+		{
+			bubbles[i].paused = true;
+			bubbles[i].popping = true;
+		}
+
+		currentPopping = (int)bubbles.size();
+
+		const SimConfig & config = level.config;
+
+		return config.popExpansion + POP_HOLD_TICKS + 1 + config.bubbleRadius + config.popExpansion;
+	}
+
+	void run()
+	{
+		for ( int i = 0; i < (int)bubbles.size(); i++ )
+		{
+			simPop( bubbles[i], currentPopping );
+		}
+	}
+};
+
+/**
+*  PassCase times one call of detectBubbleCollisions(), in the frame that
+*  comes PASS_WARMUP_TICKS frames after the click, when the chain reaction
+*  is under way.
+*/
+
+class PassCase : public BenchCase
+{
+private:
+	LevelSimulation start;
+	LevelSimulation sim;
+
+public:
+	PassCase(const BenchLevel & level, WorkerPool * pool)
+	{
+		kernel = "detectBubbleCollisions";
+		engine = pool == NULL ? "scalar" : "grid";
+		opsPerRun = 1;
+		itemsPerRun = (int)level.bubbles.size();
+
+		start.setConfig( level.config );
+		start.setWorkerPool( pool );
+		start.setBubbles( level.bubbles );
+		start.click( level.clickX, level.clickY );
+
+		for ( int i = 0; i < PASS_WARMUP_TICKS; i++ )
+		{
+			start.tick();
+		}
+
+		start.detectUserClick();  // The rest of the frame, up to the collision pass.
+		start.detectBoundaryCollisions();
+		start.popUserBubble();
+		start.popBubbles();
+		start.moveBubbles();
+	}
+
+	int setup()
+	{
+		sim = start;
+		return 1;
+	}
+
+	void run()
+	{
+		sim.detectBubbleCollisions();
+	}
+};
+
+/**
+*  LevelCase times a whole level, from the click to the end of the chain reaction.
+*/
+
+class LevelCase : public BenchCase
+{
+private:
+	const BenchLevel & level;
+	LevelSimulation sim;
+
+public:
+	LevelCase(const BenchLevel & benchLevel, WorkerPool * pool) : level( benchLevel )
+	{
+		kernel = "level";
+		engine = pool == NULL ? "scalar" : "grid";
+		opsPerRun = 1;
+		itemsPerRun = (int)level.bubbles.size();
+
+		sim.setConfig( level.config );
+		sim.setWorkerPool( pool );
+	}
+
+	int setup()
+	{
+		sim.setBubbles( level.bubbles );
+		sim.click( level.clickX, level.clickY );
+		return 1;
+	}
+
+	void run()
+	{
+		sim.resolve( MAX_LEVEL_TICKS );
+	}
+};
+
+/**
+*  Function: runCase(BenchCase & benchCase, const char * layout, int bubbles, double minSeconds, vector <BenchResult> & results)
+*
+*  Purpose: This function runs a kernel until it has taken at least minSeconds,
+*           then prints the result and adds it to results.  Only the calls to
+*           run() are timed.
+*
+*  Inputs: benchCase - The kernel.
+*          layout - The name of the layout, for the results.
+*          bubbles - The number of bubbles, for the results.
+*          minSeconds - The least time to spend running the kernel.
+*          results - The result is added to the end.
+*/
+
+static void runCase(BenchCase & benchCase, const char * layout, int bubbles, double minSeconds, vector <BenchResult> & results)
+{
+	double seconds = 0.0;
+	double runs = 0.0;
+
+	while ( seconds < minSeconds )
+	{
+		int batch = benchCase.setup();
+
+		double start = getSeconds();
+
+		for ( int i = 0; i < batch; i++ )
+		{
+			benchCase.run();
+		}
+
+		seconds += getSeconds() - start;
+		runs += batch;
+	}
+
+	BenchResult result;
+	result.kernel = benchCase.kernel;
+	result.engine = benchCase.engine;
+	result.layout = layout;
+	result.bubbles = bubbles;
+	result.runs = runs;
+	result.nsPerOp = seconds * 1e9 / ( runs * benchCase.opsPerRun );
+	result.itemsPerSecond = runs * benchCase.itemsPerRun / seconds;
+
+	results.push_back( result );
+
+	printf( "%-22s  %-6s  %-11s  %7d  %10.0f  %14.1f  %14.0f\n", result.kernel, result.engine, result.layout,
+		    result.bubbles, result.runs, result.nsPerOp, result.itemsPerSecond );
+}
+
+/**
+*  Function: writeJson(const char * fileName, const vector <BenchResult> & results, int threads, int ms)
+*
+*  Purpose: This function writes the results to a JSON file, one object per line.
+*
+*  Inputs: fileName - The file to write.
+*          results - The results.
+*          threads, ms - The settings the benchmarks were run with.
+*
+*  Returns: True if the file was written.
+*/
+
+static bool writeJson(const char * fileName, const vector <BenchResult> & results, int threads, int ms)
+{
+	FILE * file = fopen( fileName, "w" );
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+
+	fprintf( file, "{\"threads\":%d,\"processors\":%d,\"minimumMs\":%d,\"results\":[\n", threads, getProcessorCount(), ms );
+
+	for ( int i = 0; i < (int)results.size(); i++ )
+	{
+		const BenchResult & r = results[i];
+
+		fprintf( file, "{\"kernel\":\"%s\",\"engine\":\"%s\",\"layout\":\"%s\",\"bubbles\":%d,"
+			           "\"runs\":%.0f,\"nsPerOp\":%.3f,\"itemsPerSecond\":%.1f}%s\n",
+			     r.kernel, r.engine, r.layout, r.bubbles, r.runs, r.nsPerOp, r.itemsPerSecond,
+			     i+1 < (int)results.size() ? "," : "" );
+	}
+
+	fprintf( file, "]}\n" );
+	fclose( file );
+
+	return true;
+}
+
+/**
+*  Function: benchCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the bench command.
+*
+*  Inputs: argc, argv - [bubbles] [ms] [threads] [json]
+*
+*  Returns: 0, or 1 if the arguments are no good or the JSON file couldn't be written.
+*/
+
+int benchCommand(int argc, char * argv[])
+{
+	int maxBubbles = intArgument( argc, argv, 0, 100000 );
+	int ms = intArgument( argc, argv, 1, 200 );
+	int threads = intArgument( argc, argv, 2, 1 );
+	const char * jsonName = argc > 3 ? argv[3] : NULL;
+
+	if ( maxBubbles < 1 || ms < 1 || threads < 0 )
+	{
+		printf( "bench: bubbles and ms must be at least 1.\n" );
+		return 1;
+	}
+
+	WorkerPool pool( threads );
+	vector <BenchResult> results;
+
+	printf( "Grid engine on %d threads, at least %d ms per kernel\n\n", pool.getThreadCount(), ms );
+	printf( "Kernel                  Engine  Layout       Bubbles        Runs           ns/op        bubbles/s\n" );
+
+	for ( int s = 0; s < BENCH_SIZE_COUNT && BENCH_SIZES[s] <= maxBubbles; s++ )
+	{
+		int bubbles = BENCH_SIZES[s];
+
+		for ( int l = 0; l < LAYOUT_COUNT; l++ )
+		{
+			BenchLevel level;
+			makeLevel( (BenchLayout)l, bubbles, level );
+
+			double minSeconds = ms / 1000.0;
+			const char * layout = LAYOUT_NAMES[l];
+
+			CollisionCheckCase collisionCheck( level );
+			runCase( collisionCheck, layout, bubbles, minSeconds, results );
+
+			BoundaryCase boundary( level );
+			runCase( boundary, layout, bubbles, minSeconds, results );
+
+			MoveCase move( level );
+			runCase( move, layout, bubbles, minSeconds, results );
+
+			PopCase pop( level );
+			runCase( pop, layout, bubbles, minSeconds, results );
+
+			if ( bubbles <= SCALAR_BUBBLE_LIMIT )
+			{
+				PassCase scalarPass( level, NULL );
+				runCase( scalarPass, layout, bubbles, minSeconds, results );
+			}
+
+			PassCase gridPass( level, & pool );
+			runCase( gridPass, layout, bubbles, minSeconds, results );
+
+			if ( bubbles <= SCALAR_BUBBLE_LIMIT )
+			{
+				LevelCase scalarLevel( level, NULL );
+				runCase( scalarLevel, layout, bubbles, minSeconds, results );
+			}
+
+			LevelCase gridLevel( level, & pool );
+			runCase( gridLevel, layout, bubbles, minSeconds, results );
+		}
+	}
+
+	if ( jsonName != NULL )
+	{
+		if ( writeJson( jsonName, results, pool.getThreadCount(), ms ) == false )
+		{
+			printf( "\nCouldn't write %s\n", jsonName );
+			return 1;
+		}
+
+		printf( "\nResults written to %s\n", jsonName );
+	}
+
+	return 0;
+}
@@ -0,0 +1,247 @@
+/**
+*  File:  ToolCalibrate.cpp
+*
+*  Description:  This file contains the calibrate command of PrismsTools.  For each
+*                level it plays out many random games (a random seed, and a click
+*                at a random place and time) and reports how many bubbles were
+*                popped and how often the goal was reached.
+*
+*                Every game is played twice, once with LevelSimulation and once
+*                with BatchSimulation, so the command also reports the throughput
+*                of both engines in level resolutions per second, and counts any
+*                games where the two engines disagree (there should be none).
+*
+*                Usage:  PrismsTools calibrate [instances] [level]
+*
+*                instances defaults to 4096.  If level is left out, all 12 levels
+*                are calibrated.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "BatchSimulation.h"
+#include <stdio.h>
+
+const int MAX_RESOLVE_TICKS = 100000;  // Safety limit.  A real chain reaction ends long before this.
+
+struct CalibrationGame
+{
+	uint32 seed;
+	int clickTick;
+	int clickX;
+	int clickY;
+	int points;
+	int doneTick;
+};
+
+/**
+*  Function: makeGame(int level, int index, CalibrationGame & game)
+*
+*  Purpose: This function picks the seed and click for one calibration game.
+*           The same level and index always give the same game.
+*
+*  Inputs: level - The level (1-12).
+*          index - Which game of the level this is.
+*          game - Filled in with the seed and click.
+*/
+
+static void makeGame(int level, int index, CalibrationGame & game)
+{
+	game.seed = (uint32)level * 1000003u + (uint32)index * 2654435761u;
+
+	SimRandom random( game.seed ^ 0x5bd1e995u );
+
+	game.clickTick = random.next( REFRESH_RATE );
+	game.clickX = random.next( SCREEN_WIDTH-1 );
+	game.clickY = random.next( SCREEN_HEIGHT-1 );
+	game.points = -1;
+	game.doneTick = -1;
+}
+
+/**
+*  Function: resolveScalar(int bubbles, CalibrationGame & game)
+*
+*  Purpose: This function plays out one game with LevelSimulation.
+*
+*  Inputs: bubbles - The number of bubbles in the level.
+*          game - The game to play.  Its points and doneTick are filled in.
+*/
+
+static void resolveScalar(int bubbles, CalibrationGame & game)
+{
+	LevelSimulation sim;
+	sim.generate( game.seed, bubbles );
+
+	while ( sim.getChainReactionDone() == false && sim.getTickCount() < MAX_RESOLVE_TICKS )
+	{
+		if ( sim.getTickCount() == game.clickTick )
+		{
+			sim.click( game.clickX, game.clickY );
+		}
+
+		sim.tick();
+	}
+
+	game.points = sim.getLevelPoints();
+	game.doneTick = sim.getTickCount() - 1;
+}
+
+/**
+*  Function: resolveBatch(int bubbles, CalibrationGame games[], int count)
+*
+*  Purpose: This function plays out a list of games with BatchSimulation.  As soon
+*           as a lane's game is over, the next game from the list is loaded into
+*           that lane, so every lane stays busy until the list runs out.
+*
+*  Inputs: bubbles - The number of bubbles in the level.
+*          games - The games to play.  Their points and doneTick are filled in.
+*          count - The number of games.
+*/
+
+static void resolveBatch(int bubbles, CalibrationGame games[], int count)
+{
+	BatchSimulation batch( bubbles );
+
+	int laneGame[BATCH_LANES];
+	int nextGame = 0;
+	int running = 0;
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		laneGame[lane] = -1;
+
+		if ( nextGame < count )
+		{
+			batch.generate( lane, games[nextGame].seed );
+			batch.setClick( lane, games[nextGame].clickTick, games[nextGame].clickX, games[nextGame].clickY );
+			laneGame[lane] = nextGame++;
+			running++;
+		}
+	}
+
+	while ( running > 0 )
+	{
+		batch.tick();
+
+		for ( int lane = 0; lane < BATCH_LANES; lane++ )
+		{
+			int g = laneGame[lane];
+
+			if ( g < 0 || ( batch.getLaneDone( lane ) == false && batch.getLaneTick( lane ) < MAX_RESOLVE_TICKS ) )
+			{
+				continue;
+			}
+
+			games[g].points = batch.getLevelPoints( lane );
+			games[g].doneTick = batch.getDoneTick( lane );
+			laneGame[lane] = -1;
+			running--;
+
+			if ( nextGame < count )
+			{
+				batch.generate( lane, games[nextGame].seed );
+				batch.setClick( lane, games[nextGame].clickTick, games[nextGame].clickX, games[nextGame].clickY );
+				laneGame[lane] = nextGame++;
+				running++;
+			}
+			else
+			{
+				batch.retire( lane );
+			}
+		}
+	}
+}
+
+/**
+*  Function: calibrateCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the calibrate command.
+*
+*  Inputs: argc, argv - [instances] [level]
+*
+*  Returns: 0 if the two engines agreed on every game, and 1 otherwise.
+*/
+
+int calibrateCommand(int argc, char * argv[])
+{
+	int instances = intArgument( argc, argv, 0, 4096 );
+	int onlyLevel = intArgument( argc, argv, 1, 0 );
+
+	if ( instances < 1 || onlyLevel < 0 || onlyLevel > LEVELS )
+	{
+		printf( "calibrate: instances must be at least 1 and level must be 1-%d.\n", LEVELS );
+		return 1;
+	}
+
+	int totalMismatches = 0;
+
+	printf( "Level  Bubbles  Goal  Avg points  Won    Scalar res/s  SIMD res/s  Speedup  Mismatches\n" );
+
+	for ( int level = 1; level <= LEVELS; level++ )
+	{
+		if ( onlyLevel != 0 && level != onlyLevel )
+		{
+			continue;
+		}
+
+		int bubbles = LEVEL_BUBBLES[level-1];
+
+		vector <CalibrationGame> scalarGames( instances );
+		vector <CalibrationGame> batchGames( instances );
+
+		for ( int i = 0; i < instances; i++ )
+		{
+			makeGame( level, i, scalarGames[i] );
+			batchGames[i] = scalarGames[i];
+		}
+
+		double start = getSeconds();
+
+		for ( int i = 0; i < instances; i++ )
+		{
+			resolveScalar( bubbles, scalarGames[i] );
+		}
+
+		double scalarSeconds = getSeconds() - start;
+
+		start = getSeconds();
+
+		resolveBatch( bubbles, & batchGames[0], instances );
+
+		double batchSeconds = getSeconds() - start;
+
+		int mismatches = 0;
+		int won = 0;
+		double totalPoints = 0.0;
+
+		for ( int i = 0; i < instances; i++ )
+		{
+			if ( scalarGames[i].points != batchGames[i].points ||
+				 scalarGames[i].doneTick != batchGames[i].doneTick )
+			{
+				mismatches++;
+			}
+
+			if ( scalarGames[i].points >= GOAL_POINTS[level-1] )
+			{
+				won++;
+			}
+
+			totalPoints += scalarGames[i].points;
+		}
+
+		totalMismatches += mismatches;
+
+		double scalarRate = instances / ( scalarSeconds > 0.0 ? scalarSeconds : 1e-9 );
+		double batchRate = instances / ( batchSeconds > 0.0 ? batchSeconds : 1e-9 );
+
+		printf( "%5d  %7d  %4d  %10.2f  %5.1f%%  %12.0f  %10.0f  %6.2fx  %10d\n",
+			    level, bubbles, GOAL_POINTS[level-1], totalPoints / instances,
+			    100.0 * won / instances, scalarRate, batchRate, batchRate / scalarRate, mismatches );
+	}
+
+	return totalMismatches == 0 ? 0 : 1;
+}
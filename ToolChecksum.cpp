@@ -0,0 +1,442 @@
+/**
+*  File:  ToolChecksum.cpp
+*
+*  Description:  This file contains the checksum command of PrismsTools, which
+*                records and compares the per-frame state checksums of Checksum.h.
+*
+*                Usage:  PrismsTools checksum compare [level] [games] [threads]
+*                        PrismsTools checksum record <file> [level] [seed] [engine]
+*                        PrismsTools checksum diff <file> <file>
+*
+*                compare plays random games of a level (default 12, 64 games) on
+*                the scalar, threaded (default one thread per processor) and SIMD
+*                batch engines, and reports the first frame and bubble where
+*                either one leaves the scalar engine's path.  The games are
+*                played without bubble hashes, and only a game that differs is
+*                played again with them.  It also times the scalar engine with
+*                and without checksums, to show what they cost.
+*
+*                record writes the checksums of one game to a file.  engine is
+*                scalar (the default), threads or batch.  diff compares two such
+*                files, from different engines or different builds.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "BatchSimulation.h"
+#include <stdio.h>
+#include <string.h>  // For strcmp().
+
+const int CHECKSUM_MAX_TICKS = 100000;  // Safety limit.  A real chain reaction ends long before this.
+
+struct ChecksumGame
+{
+	uint32 seed;
+	int clickTick;
+	int clickX;
+	int clickY;
+};
+
+/**
+*  Function: makeChecksumGame(uint32 seed, ChecksumGame & game)
+*
+*  Purpose: This function picks a random click for a game.  The same seed
+*           always gives the same game.
+*
+*  Inputs: seed - The level's seed.
+*          game - Filled in with the seed and click.
+*/
+
+static void makeChecksumGame(uint32 seed, ChecksumGame & game)
+{
+	SimRandom random( seed ^ 0x2545f491u );
+
+	game.seed = seed;
+	game.clickTick = random.next( REFRESH_RATE );
+	game.clickX = random.next( SCREEN_WIDTH-1 );
+	game.clickY = random.next( SCREEN_HEIGHT-1 );
+}
+
+/**
+*  Function: playLevel(int bubbles, const ChecksumGame & game, WorkerPool * pool, ChecksumStream * stream)
+*
+*  Purpose: This function plays a game on LevelSimulation until its chain
+*           reaction is over.
+*
+*  Inputs: bubbles - The number of bubbles.
+*          game - The game.
+*          pool - The threads to play on, or NULL for the scalar engine.
+*          stream - Where to record the checksums, or NULL.
+*
+*  Returns: The number of frames played.
+*/
+
+static int playLevel(int bubbles, const ChecksumGame & game, WorkerPool * pool, ChecksumStream * stream)
+{
+	LevelSimulation sim;
+	sim.setWorkerPool( pool );
+	sim.setChecksumStream( stream );
+	sim.generate( game.seed, bubbles );
+
+	while ( sim.getChainReactionDone() == false && sim.getTickCount() < CHECKSUM_MAX_TICKS )
+	{
+		if ( sim.getTickCount() == game.clickTick )
+		{
+			sim.click( game.clickX, game.clickY );
+		}
+
+		sim.tick();
+	}
+
+	return sim.getTickCount();
+}
+
+/**
+*  Function: playBatch(int bubbles, const ChecksumGame games[], int count, ChecksumStream * streams[])
+*
+*  Purpose: This function plays up to BATCH_LANES games at once on BatchSimulation,
+*           one in each lane, recording each lane's checksums.
+*
+*  Inputs: bubbles - The number of bubbles.
+*          games - The games.
+*          count - The number of games (at most BATCH_LANES).
+*          streams - Where to record each game's checksums.
+*/
+
+static void playBatch(int bubbles, const ChecksumGame games[], int count, ChecksumStream * streams[])
+{
+	BatchSimulation batch( bubbles );
+
+	for ( int lane = 0; lane < BATCH_LANES; lane++ )
+	{
+		if ( lane < count )
+		{
+			batch.generate( lane, games[lane].seed );
+			batch.setClick( lane, games[lane].clickTick, games[lane].clickX, games[lane].clickY );
+			batch.setChecksumStream( lane, streams[lane] );
+		}
+		else
+		{
+			batch.retire( lane );
+		}
+	}
+
+	batch.resolve( CHECKSUM_MAX_TICKS );
+}
+
+/**
+*  Function: reportDifference(const char * name, const ChecksumStream & a, const ChecksumStream & b, int bubbles, const ChecksumGame & game, WorkerPool * pool, int & shown)
+*
+*  Purpose: This function compares an engine's checksums against the scalar
+*           engine's, and prints where they first differ for the first few games.
+*           The games are played without bubble hashes, so a game that differs
+*           is played again on both engines with them, to find the bubble.
+*
+*  Inputs: name - The engine, for the message.
+*          a - The scalar engine's checksums.
+*          b - The other engine's checksums.
+*          bubbles, game - The game that was played.
+*          pool - The threads the other engine played on, or NULL for the batch engine.
+*          shown - The number of differences printed so far.
+*
+*  Returns: True if they differ.
+*/
+
+static bool reportDifference(const char * name, const ChecksumStream & a, const ChecksumStream & b, int bubbles,
+							 const ChecksumGame & game, WorkerPool * pool, int & shown)
+{
+	int bubble;
+	int tick = checksumFirstDifference( a, b, bubble );
+
+	if ( tick < 0 )
+	{
+		return false;
+	}
+
+	if ( shown < 10 )
+	{
+		ChecksumStream scalar( true );
+		ChecksumStream other( true );
+
+		playLevel( bubbles, game, NULL, & scalar );
+
+		if ( pool == NULL )
+		{
+			ChecksumStream * streams[1] = { & other };
+			playBatch( bubbles, & game, 1, streams );
+		}
+		else
+		{
+			playLevel( bubbles, game, pool, & other );
+		}
+
+		tick = checksumFirstDifference( scalar, other, bubble );
+
+		printf( "  %s engine differs at tick %d, bubble %d\n", name, tick, bubble );
+		shown++;
+	}
+
+	return true;
+}
+
+/**
+*  Function: compareEngines(int argc, char * argv[])
+*
+*  Purpose: This function runs checksum compare.
+*
+*  Inputs: argc, argv - [level] [games] [threads]
+*
+*  Returns: 0 if every engine matched the scalar engine in every frame, and 1 otherwise.
+*/
+
+static int compareEngines(int argc, char * argv[])
+{
+	int level = intArgument( argc, argv, 0, LEVELS );
+	int games = intArgument( argc, argv, 1, 64 );
+	int threads = intArgument( argc, argv, 2, 0 );
+
+	if ( level < 1 || level > LEVELS || games < 1 || threads < 0 )
+	{
+		printf( "checksum: level must be 1-%d and games at least 1.\n", LEVELS );
+		return 1;
+	}
+
+	int bubbles = LEVEL_BUBBLES[level-1];
+	WorkerPool pool( threads );
+
+	int threadFailures = 0;
+	int batchFailures = 0;
+	int shown = 0;
+
+	printf( "Level %d, %d bubbles, %d games, %d threads\n", level, bubbles, games, pool.getThreadCount() );
+
+	for ( int first = 0; first < games; first += BATCH_LANES )
+	{
+		int count = games - first < BATCH_LANES ? games - first : BATCH_LANES;
+
+		ChecksumGame batchGames[BATCH_LANES];
+		ChecksumStream * batchStreams[BATCH_LANES];
+
+		for ( int lane = 0; lane < count; lane++ )
+		{
+			makeChecksumGame( (uint32)( level * 1000003 + first + lane ), batchGames[lane] );
+			batchStreams[lane] = new ChecksumStream;
+		}
+
+		playBatch( bubbles, batchGames, count, batchStreams );
+
+		for ( int lane = 0; lane < count; lane++ )
+		{
+			ChecksumStream scalar;
+			ChecksumStream threaded;
+
+			playLevel( bubbles, batchGames[lane], NULL, & scalar );
+			playLevel( bubbles, batchGames[lane], & pool, & threaded );
+
+			if ( reportDifference( "threaded", scalar, threaded, bubbles, batchGames[lane], & pool, shown ) )
+			{
+				threadFailures++;
+			}
+
+			if ( reportDifference( "batch", scalar, * batchStreams[lane], bubbles, batchGames[lane], NULL, shown ) )
+			{
+				batchFailures++;
+			}
+
+			delete batchStreams[lane];
+		}
+	}
+
+	printf( "Games that differ from the scalar engine: threaded %d, batch %d\n", threadFailures, batchFailures );
+
+	// Time the scalar engine on the same games with and without checksums.
+	int rounds = games < 1000 ? 1000 / games + 1 : 1;
+	double seconds[2];
+	int ticks = 0;
+
+	for ( int withChecksums = 0; withChecksums < 2; withChecksums++ )
+	{
+		ChecksumStream stream;
+		double start = getSeconds();
+
+		for ( int r = 0; r < rounds; r++ )
+		{
+			for ( int i = 0; i < games; i++ )
+			{
+				ChecksumGame game;
+				makeChecksumGame( (uint32)( level * 1000003 + i ), game );
+
+				ticks += playLevel( bubbles, game, NULL, withChecksums ? & stream : NULL );
+			}
+
+			stream.clear();
+		}
+
+		seconds[withChecksums] = getSeconds() - start;
+	}
+
+	ticks /= 2;
+
+	printf( "Scalar engine: %.1f ns per tick, %.1f ns with checksums (%.1f%% more)\n",
+		    seconds[0] * 1e9 / ticks, seconds[1] * 1e9 / ticks, 100.0 * ( seconds[1] - seconds[0] ) / seconds[0] );
+
+	return threadFailures == 0 && batchFailures == 0 ? 0 : 1;
+}
+
+/**
+*  Function: recordGame(int argc, char * argv[])
+*
+*  Purpose: This function runs checksum record.
+*
+*  Inputs: argc, argv - <file> [level] [seed] [engine]
+*
+*  Returns: 0, or 1 if the arguments are no good or the file couldn't be written.
+*/
+
+static int recordGame(int argc, char * argv[])
+{
+	int level = intArgument( argc, argv, 1, LEVELS );
+	uint32 seed = (uint32)intArgument( argc, argv, 2, 1 );
+	const char * engine = argc > 3 ? argv[3] : "scalar";
+
+	if ( argc < 1 || level < 1 || level > LEVELS )
+	{
+		printf( "checksum: usage is checksum record <file> [level 1-%d] [seed] [scalar|threads|batch]\n", LEVELS );
+		return 1;
+	}
+
+	ChecksumGame game;
+	makeChecksumGame( seed, game );
+
+	ChecksumStream stream( true );
+
+	if ( stream.open( argv[0] ) == false )
+	{
+		printf( "checksum: couldn't write %s\n", argv[0] );
+		return 1;
+	}
+
+	int bubbles = LEVEL_BUBBLES[level-1];
+
+	if ( strcmp( engine, "batch" ) == 0 )
+	{
+		ChecksumStream * streams[1] = { & stream };
+		playBatch( bubbles, & game, 1, streams );
+	}
+	else if ( strcmp( engine, "threads" ) == 0 )
+	{
+		WorkerPool pool( 0 );
+		playLevel( bubbles, game, & pool, & stream );
+	}
+	else if ( strcmp( engine, "scalar" ) == 0 )
+	{
+		playLevel( bubbles, game, NULL, & stream );
+	}
+	else
+	{
+		printf( "checksum: unknown engine %s\n", engine );
+		return 1;
+	}
+
+	if ( stream.close() == false )
+	{
+		printf( "checksum: couldn't write %s\n", argv[0] );
+		return 1;
+	}
+
+	printf( "Recorded level %d, seed %u on the %s engine to %s\n", level, seed, engine, argv[0] );
+
+	return 0;
+}
+
+/**
+*  Function: diffFiles(int argc, char * argv[])
+*
+*  Purpose: This function runs checksum diff.
+*
+*  Inputs: argc, argv - <file> <file>
+*
+*  Returns: 0 if the two runs are the same, and 1 otherwise.
+*/
+
+static int diffFiles(int argc, char * argv[])
+{
+	if ( argc < 2 )
+	{
+		printf( "checksum: usage is checksum diff <file> <file>\n" );
+		return 1;
+	}
+
+	ChecksumStream a;
+	ChecksumStream b;
+
+	for ( int i = 0; i < 2; i++ )
+	{
+		if ( ( i == 0 ? a : b ).load( argv[i] ) == false )
+		{
+			printf( "checksum: couldn't read %s\n", argv[i] );
+			return 1;
+		}
+	}
+
+	int bubble;
+	int tick = checksumFirstDifference( a, b, bubble );
+
+	if ( tick < 0 )
+	{
+		printf( "Same for all %d ticks.\n", a.getTickCount() );
+		return 0;
+	}
+
+	if ( tick >= a.getTickCount() || tick >= b.getTickCount() )
+	{
+		printf( "Same until tick %d, where %s ends.\n", tick, tick >= a.getTickCount() ? argv[0] : argv[1] );
+	}
+	else if ( bubble >= 0 )
+	{
+		printf( "First difference at tick %d, bubble %d.\n", tick, bubble );
+	}
+	else
+	{
+		printf( "First difference at tick %d.\n", tick );
+	}
+
+	return 1;
+}
+
+/**
+*  Function: checksumCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the checksum command.
+*
+*  Inputs: argc, argv - compare, record or diff, then its arguments.
+*
+*  Returns: 0 if everything matched, and 1 otherwise.
+*/
+
+int checksumCommand(int argc, char * argv[])
+{
+	if ( argc >= 1 && strcmp( argv[0], "compare" ) == 0 )
+	{
+		return compareEngines( argc-1, argv+1 );
+	}
+
+	if ( argc >= 1 && strcmp( argv[0], "record" ) == 0 )
+	{
+		return recordGame( argc-1, argv+1 );
+	}
+
+	if ( argc >= 1 && strcmp( argv[0], "diff" ) == 0 )
+	{
+		return diffFiles( argc-1, argv+1 );
+	}
+
+	printf( "checksum: usage is checksum compare [level] [games] [threads]\n"
+		    "                   checksum record <file> [level] [seed] [engine]\n"
+		    "                   checksum diff <file> <file>\n" );
+
+	return 1;
+}
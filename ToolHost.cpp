@@ -0,0 +1,151 @@
+/**
+*  File:  ToolHost.cpp
+*
+*  Description:  This file contains the host command of PrismsTools, which puts
+*                a SessionHost under load and reports how late its ticks are.
+*
+*                Usage:  PrismsTools host [sessions] [seconds] [threads]
+*
+*                It plays sessions games (default 2000) for the given time
+*                (default 10 seconds) on a SessionHost with the given number of
+*                threads (default one per processor).  Each game has a bot for
+*                a player: it waits a moment on each cut-screen before pressing
+*                its button, and waits a moment after each level starts before
+*                clicking somewhere at random, so at any time some of the games
+*                are idle on a cut-screen.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "SessionHost.h"
+#include <stdio.h>
+#include <queue>
+#include <functional>  // For greater.
+
+const int BOT_THINK_MS = 2000;   // Longest a bot waits on a cut-screen.
+const int BOT_CLICK_MS = 1000;   // Longest a bot waits to click once a level starts.
+
+/**
+*  A bot's next move: the time it is due, and the session number times two, plus
+*  one if the move is a click rather than a button press.
+*/
+
+typedef pair <double, int> BotMove;
+typedef priority_queue < BotMove, vector <BotMove>, greater <BotMove> > BotQueue;
+
+/**
+*  Function: hostCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the host command.
+*
+*  Inputs: argc, argv - [sessions] [seconds] [threads]
+*
+*  Returns: 0, or 1 if the arguments are bad.
+*/
+
+int hostCommand(int argc, char * argv[])
+{
+	int sessionCount = intArgument( argc, argv, 0, 2000 );
+	int seconds = intArgument( argc, argv, 1, 10 );
+	int threads = intArgument( argc, argv, 2, 0 );
+
+	if ( sessionCount < 1 || seconds < 1 || threads < 0 )
+	{
+		printf( "host: sessions and seconds must be at least 1.\n" );
+		return 1;
+	}
+
+	SessionHost host( threads );
+	SimRandom random( 1 );
+	BotQueue moves;
+
+	double start = getSeconds();
+	double end = start + seconds;
+
+	for ( int i = 0; i < sessionCount; i++ )
+	{
+		int id = host.addSession( (uint32)random.next( 0x7fffffff ) );
+		moves.push( BotMove( start + random.next( BOT_THINK_MS ) * 0.001, id * 2 ) );
+	}
+
+	double busySeconds = 0.0;
+	int64 levelsPlayed = 0;
+
+	for ( ;; )
+	{
+		double now = getSeconds();
+
+		if ( now >= end )
+		{
+			break;
+		}
+
+		while ( moves.empty() == false && moves.top().first <= now )
+		{
+			int id = moves.top().second / 2;
+			bool isClick = ( moves.top().second & 1 ) != 0;
+
+			moves.pop();
+
+			if ( isClick )
+			{
+				host.click( id, random.next( SCREEN_WIDTH-1 ), random.next( SCREEN_HEIGHT-1 ) );
+			}
+			else if ( host.press( id ) && host.getSession( id ).getScreen() == SCREEN_PLAYING )
+			{
+				moves.push( BotMove( now + random.next( BOT_CLICK_MS ) * 0.001, id * 2 + 1 ) );
+			}
+			else  // Retry and Play Again go to the level start screen, which needs Play too.
+			{
+				moves.push( BotMove( now + random.next( BOT_THINK_MS ) * 0.001, id * 2 ) );
+			}
+		}
+
+		double next = host.run();
+		double ran = getSeconds();
+
+		busySeconds += ran - now;
+
+		const vector <int> & idled = host.getIdled();
+
+		for ( int i = 0; i < (int)idled.size(); i++ )
+		{
+			moves.push( BotMove( ran + random.next( BOT_THINK_MS ) * 0.001, idled[i] * 2 ) );
+		}
+
+		levelsPlayed += (int64)idled.size();
+
+		if ( moves.empty() == false && moves.top().first < next )
+		{
+			next = moves.top().first;
+		}
+
+		if ( next > end )
+		{
+			next = end;
+		}
+
+		sleepSeconds( next - getSeconds() );
+	}
+
+	double elapsed = getSeconds() - start;
+	double ticks = (double)host.getTickCount();
+
+	printf( "%d sessions on %d threads for %.1f seconds\n\n", sessionCount, host.getThreadCount(), elapsed );
+	printf( "Ticks:              %.0f (%.0f per second)\n", ticks, ticks / elapsed );
+	printf( "Playing on average: %.0f sessions (the rest were idle on a cut-screen)\n", ticks / elapsed / REFRESH_RATE );
+	printf( "Levels played:      %.0f\n", (double)levelsPlayed );
+	printf( "Wakeups:            %.0f, %.1f sessions per batch\n", (double)host.getWakeups(),
+		    host.getBatches() > 0 ? ticks / (double)host.getBatches() : 0.0 );
+	printf( "Host busy:          %.1f%%\n", 100.0 * busySeconds / elapsed );
+	printf( "Missed ticks:       %.0f\n\n", (double)host.getMissedTicks() );
+
+	printf( "Tick lateness (ms):  p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+		    host.getLateness( 50.0 ) * 1e3, host.getLateness( 90.0 ) * 1e3, host.getLateness( 99.0 ) * 1e3,
+		    host.getLateness( 99.9 ) * 1e3, host.getLateness( 100.0 ) * 1e3 );
+
+	return 0;
+}
@@ -0,0 +1,160 @@
+/**
+*  File:  ToolLevels.cpp
+*
+*  Description:  This file contains the levels command of PrismsTools, which makes
+*                and checks level packs (see LevelPack.h).
+*
+*                Usage:  PrismsTools levels make <file> [campaigns] [seed]
+*                        PrismsTools levels check <file>
+*
+*                levels make lays out campaigns (default 1000) and writes them
+*                to a pack.  The game plays them with -levels <file>.
+*
+*                levels check maps a pack, starts every level in it from the
+*                pack and again from its seed with generate(), and checks that
+*                the two are exactly the same.  It prints how long each way of
+*                starting a level takes.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "LevelPack.h"
+#include <stdio.h>
+#include <string.h>  // For strcmp().
+
+/**
+*  Function: checkPack(const char * fileName)
+*
+*  Purpose: This function checks every level of a pack against generate(), and
+*           times both ways of starting the levels.
+*
+*  Inputs: fileName - The pack.
+*
+*  Returns: 0 if every level matched, and 1 otherwise.
+*/
+
+static int checkPack(const char * fileName)
+{
+	LevelPack pack;
+
+	double start = getSeconds();
+	bool opened = pack.open( fileName );
+	double openSeconds = getSeconds() - start;
+
+	if ( opened == false )
+	{
+		printf( "levels: %s isn't a level pack.\n", fileName );
+		return 1;
+	}
+
+	SimConfig config;
+
+	if ( pack.fits( config ) == false )
+	{
+		printf( "levels: %s wasn't laid out with the game's own sizes.\n", fileName );
+		return 1;
+	}
+
+	int campaigns = pack.getCampaignCount();
+	int failures = 0;
+	double bubbles = 0.0;
+
+	LevelSimulation packed;
+	LevelSimulation generated;
+	packed.setConfig( config );
+	generated.setConfig( config );
+
+	vector <uint8> packedState;
+	vector <uint8> generatedState;
+
+	double packSeconds = 0.0;
+	double generateSeconds = 0.0;
+
+	for ( int c = 0; c < campaigns; c++ )
+	{
+		for ( int level = 1; level <= LEVELS; level++ )
+		{
+			const PackLevel * packLevel = pack.getLevel( c, level );
+			const SimLayoutBubble * layout = pack.getBubbles( *packLevel );
+
+			if ( layout == NULL )
+			{
+				failures++;
+				continue;
+			}
+
+			start = getSeconds();
+			packed.setLayout( layout, packLevel->bubbleCount );
+			double laidOut = getSeconds();
+			generated.generate( packLevel->seed, packLevel->bubbleCount );
+			double done = getSeconds();
+
+			packSeconds += laidOut - start;
+			generateSeconds += done - laidOut;
+			bubbles += packLevel->bubbleCount;
+
+			packedState.clear();
+			generatedState.clear();
+
+			ByteWriter packedWriter( packedState );
+			ByteWriter generatedWriter( generatedState );
+
+			packed.saveState( packedWriter );
+			generated.saveState( generatedWriter );
+
+			if ( packedState != generatedState || packLevel->goalPoints != GOAL_POINTS[level-1] )
+			{
+				failures++;
+			}
+		}
+	}
+
+	double levels = (double)campaigns * LEVELS;
+
+	printf( "%d campaigns, %.0f levels, %.0f bubbles, mapped in %.3f ms\n\n", campaigns, levels, bubbles, openSeconds * 1000.0 );
+	printf( "Start from the pack:  %8.1f ns per level\n", packSeconds * 1e9 / levels );
+	printf( "Generate from seed:   %8.1f ns per level\n", generateSeconds * 1e9 / levels );
+	printf( "\nLevels that didn't match: %d\n", failures );
+
+	return failures == 0 ? 0 : 1;
+}
+
+/**
+*  Function: levelsCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the levels command.
+*
+*  Inputs: argc, argv - make <file> [campaigns] [seed], or check <file>
+*
+*  Returns: 0 on success, and 1 otherwise.
+*/
+
+int levelsCommand(int argc, char * argv[])
+{
+	if ( argc >= 2 && strcmp( argv[0], "make" ) == 0 )
+	{
+		int campaigns = intArgument( argc, argv, 2, 1000 );
+
+		if ( writeLevelPack( argv[1], campaigns, (uint32)intArgument( argc, argv, 3, 1 ), SimConfig() ) == false )
+		{
+			printf( "levels: couldn't write %s (campaigns must be 1-%d).\n", argv[1], LEVEL_PACK_MAX_CAMPAIGNS );
+			return 1;
+		}
+
+		printf( "Wrote %d campaigns to %s\n", campaigns, argv[1] );
+
+		return 0;
+	}
+
+	if ( argc >= 2 && strcmp( argv[0], "check" ) == 0 )
+	{
+		return checkPack( argv[1] );
+	}
+
+	printf( "levels: usage is levels make <file> [campaigns] [seed] or levels check <file>\n" );
+
+	return 1;
+}
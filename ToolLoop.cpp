@@ -0,0 +1,279 @@
+/**
+*  File:  ToolLoop.cpp
+*
+*  Description:  This file contains the loop command of PrismsTools, which runs
+*                the game's own front end (see FrontEnd.h) without DarkGDK.
+*
+*                Usage:  PrismsTools loop [frames] [seed] [software|circles|tinted|pipelined [bitmap]]
+*
+*                It plays the whole game, cut-screens and all, on the null
+*                backend (see PlatformNull.h) for a number of frames (default
+*                100000), as fast as it will go, with a script that clicks
+*                through the screens and into each level.  It prints the frames
+*                per second, the levels played, how many renderer calls the
+*                front end makes each frame, and the frames that a cut-screen
+*                slept through because nothing on it changed (which the
+*                script doesn't wait for).  As in the game, the renderer is
+*                behind a SpriteLayer (SpriteLayer.h), and the calls it saved
+*                each frame are printed too.  With "software" the frames are
+*                also drawn, by SoftwareRenderer, and the pixels it drew again
+*                each frame (see its dirty rectangles) and a checksum of the
+*                last one are printed.  The last frame is written to a BMP
+*                file too if one is named.  "circles" is "software" with the
+*                bubbles drawn as circles (see BubbleCircles.h), and "tinted"
+*                with them drawn from one image, tinted (see BUBBLE_TINTS in
+*                FrontEnd.h).  "pipelined" is "software" with the game on one
+*                thread and the drawing on another (see RenderPipeline.h); it
+*                also prints how long the frames took to be presented, and how
+*                long each thread waited for the other.  The game sees its input
+*                two frames later, so it plays differently from "software".
+*
+*                It is run from the directory the media directory is in, like
+*                the game.  Missing media is written to PrismsTools.log.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "FrontEnd.h"
+#include "PlatformNull.h"
+#include "RenderPipeline.h"
+#include "SoftwareRenderer.h"
+#include "SpriteLayer.h"
+#include <stdio.h>
+#include <string.h>  // For strcmp().
+
+ofstream logFile;  // The sprites and the front end write their errors here.
+
+/**
+*  The script clicks each place a screen's button is, in turn: the Intro
+*  screen's Play button, the Play (or Play Again) button and the Retry button.
+*  A click at the Retry button's place on the Intro screen opens the
+*  Instructions screen, whose OK button is there too.  In between, it clicks
+*  somewhere in the left or right part of the screen, where there are no
+*  buttons, and the first of those clicks in a level makes the user bubble.
+*  Nothing is ever clicked where an Exit button is.
+*/
+
+const ScriptStep LOOP_SCRIPT[] =
+{
+	{ 320, 140, true, 20, 0 },     // Intro: Play.
+	{ 320, 240, true, 20, 0 },     // Level start: Play.  Won game: Play Again.
+	{ 135, 130, true, 20, 115 },
+	{ 505, 350, true, 20, 115 },
+	{ 135, 350, true, 20, 115 },
+	{ 505, 130, true, 20, 115 },
+	{ 320, 200, true, 20, 0 }      // Lost: Retry.  Instructions: OK.
+};
+
+const int LOOP_SCRIPT_STEPS = sizeof(LOOP_SCRIPT) / sizeof(LOOP_SCRIPT[0]);
+
+typedef Backend <SpriteLayer <NullRenderer>, NullAudio, ScriptedInput> LayeredNullBackend;
+typedef Backend <SpriteLayer <SoftwareRenderer>, NullAudio, ScriptedInput> LayeredSoftwareBackend;
+
+/**
+*  Function: runLoop(Platform & platform, int frames, uint32 seed, bool circles, bool tinted)
+*
+*  Purpose: This function runs the front end on a backend until the script has
+*           played for the given number of frames, and prints how it went.
+*
+*  Inputs: platform - The backend, whose input is a ScriptedInput.
+*          frames - How many frames to run.
+*          seed - The game's seed.
+*          circles - Whether the bubbles are drawn as circles.
+*          tinted - Whether they are tinted.
+*/
+
+template <class Platform>
+void runLoop(Platform & platform, int frames, uint32 seed, bool circles, bool tinted)
+{
+	platform.input.setScript( LOOP_SCRIPT, LOOP_SCRIPT_STEPS, frames, seed );
+
+	GameFrontEnd<Platform> * game = new GameFrontEnd<Platform>( platform );
+	game->setReplayFileName( NULL );
+	game->setCircleBubbles( circles );
+	game->setTintedBubbles( tinted );
+
+	double start = getSeconds();
+	game->run( seed );
+	double seconds = getSeconds() - start;
+
+	int drawn = platform.renderer.getFrameCount();
+	double asked = drawn > 0 ? (double)platform.renderer.getAskedCount() / drawn : 0.0;
+	double sent = drawn > 0 ? (double)platform.renderer.getEngine().getCallCount() / drawn : 0.0;
+
+	printf( "loop: %d frames in %.2f s, %.0f frames per second.\n", drawn, seconds, seconds > 0.0 ? drawn / seconds : 0.0 );
+	printf( "loop: %d levels played, %d in the campaign now, %d points.\n", game->getLevelsPlayed(),
+		    game->getSession().getLevel(), game->getSession().getTotalPoints() );
+	printf( "loop: %.1f renderer calls per frame, %.1f sent on by the sprite layer (%.1f saved).\n",
+		    asked, sent, asked - sent );
+	printf( "loop: %d sounds played.\n", platform.audio.getPlayedCount() );
+	printf( "loop: %d cut-screen frames slept instead of being drawn.\n", platform.input.getIdleCount() );
+
+	delete game;
+}
+
+/**
+*  Function: runPipelinedLoop(SoftwareBackend & target, int frames, uint32 seed)
+*
+*  Purpose: This function runs the front end on the pipeline, drawing on
+*           target, until the script has played for the given number of
+*           frames, and prints how it went.
+*
+*  Inputs: target - The backend drawn on, whose input is a ScriptedInput.
+*          frames - How many frames to run.
+*          seed - The game's seed.
+*
+*  Returns: True if the game ran.
+*/
+
+bool runPipelinedLoop(SoftwareBackend & target, int frames, uint32 seed)
+{
+	target.input.setScript( LOOP_SCRIPT, LOOP_SCRIPT_STEPS, frames, seed );
+
+	PipelinedBackend * backend = new PipelinedBackend;
+	GameFrontEnd<PipelinedBackend> * game = new GameFrontEnd<PipelinedBackend>( *backend );
+	game->setReplayFileName( NULL );
+
+	double start = getSeconds();
+	bool ran = runPipelined( *game, *backend, target, seed );
+	double seconds = getSeconds() - start;
+
+	if ( ran == false )
+	{
+		printf( "loop: the game's thread couldn't be started.\n" );
+	}
+	else
+	{
+		int drawn = target.renderer.getFrameCount();
+		double asked = drawn > 0 ? (double)backend->renderer.getAskedCount() / drawn : 0.0;
+		double sent = drawn > 0 ? (double)backend->renderer.getEngine().getCallCount() / drawn : 0.0;
+		const RenderPipelineStats & stats = backend->pipeline.getStats();
+
+		printf( "loop: %d frames in %.2f s, %.0f frames per second.\n", drawn, seconds, seconds > 0.0 ? drawn / seconds : 0.0 );
+		printf( "loop: %d levels played, %d in the campaign now, %d points.\n", game->getLevelsPlayed(),
+			    game->getSession().getLevel(), game->getSession().getTotalPoints() );
+		printf( "loop: %.1f renderer calls per frame, %.1f sent on by the sprite layer (%.1f saved).\n",
+			    asked, sent, asked - sent );
+		printf( "loop: %d sounds played.\n", target.audio.getPlayedCount() );
+		printf( "loop: %d cut-screen frames slept instead of being drawn.\n", target.input.getIdleCount() );
+		printf( "loop: %.2f ms from a frame being handed over to it being presented, %.2f ms at most.\n",
+			    stats.frames > 0 ? stats.totalLatency * 1000.0 / stats.frames : 0.0, stats.maxLatency * 1000.0 );
+		printf( "loop: the game waited %.2f s for the drawing, and the drawing %.2f s for the game.\n",
+			    stats.gameWaiting, stats.renderWaiting );
+	}
+
+	delete game;
+	delete backend;
+
+	return ran;
+}
+
+/**
+*  Function: printSoftwareFrame(SoftwareRenderer & software, int argc, char * argv[])
+*
+*  Purpose: This function prints how many pixels the software renderer drew
+*           again each frame and a checksum of its last frame, and writes that
+*           frame to a BMP file if one was named.
+*
+*  Inputs: software - The renderer.
+*          argc, argv - The loop command's arguments.
+*/
+
+void printSoftwareFrame(SoftwareRenderer & software, int argc, char * argv[])
+{
+	const uint32 * pixels = software.getPixels();
+	uint32 hash = 2166136261u;  // FNV-1a.
+
+	for ( int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++ )
+	{
+		hash = ( hash ^ pixels[i] ) * 16777619u;
+	}
+
+	int drawn = software.getFrameCount();
+	double dirty = drawn > 0 ? (double)software.getDirtyPixels() / drawn : 0.0;
+
+	printf( "loop: %.0f pixels drawn again per frame, %.1f%% of the screen.\n", dirty,
+		    dirty * 100.0 / ( SCREEN_WIDTH * SCREEN_HEIGHT ) );
+	printf( "loop: last frame's checksum %08x.\n", hash );
+
+	if ( argc > 3 )
+	{
+		if ( software.saveBitmap( argv[3] ) )
+		{
+			printf( "loop: last frame written to %s.\n", argv[3] );
+		}
+		else
+		{
+			printf( "loop: %s couldn't be written.\n", argv[3] );
+		}
+	}
+}
+
+/**
+*  Function: loopCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the loop command.
+*
+*  Inputs: argc, argv - [frames] [seed] [software|circles|tinted|pipelined [bitmap]]
+*
+*  Returns: 0 if the game ran, and 1 otherwise.
+*/
+
+int loopCommand(int argc, char * argv[])
+{
+	int frames = intArgument( argc, argv, 0, 100000 );
+	uint32 seed = (uint32)intArgument( argc, argv, 1, 1 );
+	bool circles = argc > 2 && strcmp( argv[2], "circles" ) == 0;
+	bool tinted = argc > 2 && strcmp( argv[2], "tinted" ) == 0;
+	bool pipelined = argc > 2 && strcmp( argv[2], "pipelined" ) == 0;
+	bool software = circles || tinted || ( argc > 2 && strcmp( argv[2], "software" ) == 0 );
+
+	if ( frames < 1 )
+	{
+		printf( "loop: frames must be at least 1.\n" );
+		return 1;
+	}
+
+	logFile.open( "PrismsTools.log" );
+
+	openMediaPack( MEDIA_PACK_FILE_NAME );
+	int missing = checkMediaManifest();
+
+	if ( missing > 0 )
+	{
+		printf( "loop: %d of %d media files are missing (see PrismsTools.log).\n", missing, (int)MEDIA_ASSET_COUNT );
+	}
+
+	if ( pipelined )
+	{
+		SoftwareBackend * target = new SoftwareBackend;
+
+		if ( runPipelinedLoop( *target, frames, seed ) )
+		{
+			printSoftwareFrame( target->renderer, argc, argv );
+		}
+
+		delete target;
+	}
+	else if ( software )
+	{
+		LayeredSoftwareBackend * backend = new LayeredSoftwareBackend;
+		runLoop( *backend, frames, seed, circles, tinted );
+		printSoftwareFrame( backend->renderer.getEngine(), argc, argv );
+		delete backend;
+	}
+	else
+	{
+		LayeredNullBackend * backend = new LayeredNullBackend;
+		runLoop( *backend, frames, seed, false, false );
+		delete backend;
+	}
+
+	closeMediaPack();
+	logFile.close();
+
+	return 0;
+}
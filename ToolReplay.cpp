@@ -0,0 +1,238 @@
+/**
+*  File:  ToolReplay.cpp
+*
+*  Description:  This file contains the replay command of PrismsTools.  It plays
+*                back a replay recorded by the game (Prisms.replay), headless and
+*                as fast as the CPU allows, and prints each level with the points
+*                the game reported and the points the playback scored.
+*
+*                Usage:  PrismsTools replay <file> [level] [tick]
+*                        PrismsTools replay make <file> [seed]
+*
+*                Given a level (the index in the replay, counting from 1) and a
+*                tick, the level is also seeked to that frame using its keyframes,
+*                and the result is checked against playing it from the start.
+*
+*                replay make records a whole campaign of random games, one for
+*                each of the 12 levels, the same way the game does, so the replay
+*                code can be tried out without the game.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "Replay.h"
+#include <stdio.h>
+#include <string.h>  // For strcmp().
+
+/**
+*  Function: makeReplay(const char * fileName, uint32 seed)
+*
+*  Purpose: This function records a campaign of 12 random games to a replay file.
+*           Each level is played to the end on a LevelSimulation, with the click
+*           recorded in the frame it is handled in, just as in the game.  The
+*           level seeds are picked from the campaign seed the way GameSession
+*           picks them, and the clicks separately.
+*
+*  Inputs: fileName - The file to write.
+*          seed - Picks the games.
+*
+*  Returns: 0, or 1 if the file couldn't be written.
+*/
+
+static int makeReplay(const char * fileName, uint32 seed)
+{
+	SimRandom seeds( seed );
+	SimRandom random( seed ^ 0x2545f491u );
+	Replay replay;
+
+	replay.setCampaignSeed( seed );
+
+	for ( int level = 1; level <= LEVELS; level++ )
+	{
+		uint32 levelSeed = (uint32)seeds.next( 0x7fffffff );
+		int clickTick = random.next( REFRESH_RATE );
+		int clickX = random.next( SCREEN_WIDTH-1 );
+		int clickY = random.next( SCREEN_HEIGHT-1 );
+
+		LevelSimulation sim;
+		sim.generate( levelSeed, LEVEL_BUBBLES[level-1] );
+
+		replay.beginLevel( level, levelSeed, LEVEL_BUBBLES[level-1], GOAL_POINTS[level-1] );
+
+		while ( sim.getChainReactionDone() == false && sim.getTickCount() < clickTick + REPLAY_MAX_RESOLVE_TICKS )
+		{
+			if ( sim.getTickCount() == clickTick )
+			{
+				sim.click( clickX, clickY );
+				replay.recordClick( clickTick, clickX, clickY );
+			}
+
+			sim.tick();
+			replay.recordTick( sim );
+		}
+
+		replay.endLevel( sim.getLevelPoints() );
+	}
+
+	if ( replay.save( fileName ) == false )
+	{
+		printf( "replay: couldn't write %s\n", fileName );
+		return 1;
+	}
+
+	printf( "Recorded %d levels to %s\n", replay.getLevelCount(), fileName );
+
+	return 0;
+}
+
+/**
+*  Function: seekLevel(const Replay & replay, int index, int tick)
+*
+*  Purpose: This function seeks a level to a frame with its keyframes, and
+*           checks the result against playing the level from the start.
+*
+*  Inputs: replay - The replay.
+*          index - The level's index in the replay.
+*          tick - The frame to seek to.
+*
+*  Returns: True if the seeked state matches.
+*/
+
+static bool seekLevel(const Replay & replay, int index, int tick)
+{
+	const ReplayLevel & r = replay.getLevel( index );
+
+	ReplayPlayer seeker;
+	seeker.start( replay.getConfig(), r );
+
+	double start = getSeconds();
+	bool loaded = seeker.seek( tick );
+	double seekSeconds = getSeconds() - start;
+
+	ReplayPlayer player;
+	player.start( replay.getConfig(), r );
+
+	start = getSeconds();
+
+	while ( player.getSimulation().getTickCount() < tick )
+	{
+		player.step();
+	}
+
+	double playSeconds = getSeconds() - start;
+
+	vector <uint8> seeked;
+	vector <uint8> played;
+	ByteWriter seekedWriter( seeked );
+	ByteWriter playedWriter( played );
+
+	seeker.getSimulation().saveState( seekedWriter );
+	player.getSimulation().saveState( playedWriter );
+
+	bool same = loaded && seeked == played;
+
+	const LevelSimulation & sim = seeker.getSimulation();
+
+	printf( "\nLevel %d at tick %d: %d popping, %d points, chain reaction %s\n", index+1, tick,
+		    sim.getCurrentPopping(), sim.getLevelPoints(), sim.getChainReactionDone() ? "done" : "not done" );
+	printf( "Seek %.3f ms, play from the start %.3f ms, same state: %s\n",
+		    seekSeconds * 1000.0, playSeconds * 1000.0, same ? "yes" : "NO" );
+
+	return same;
+}
+
+/**
+*  Function: replayCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the replay command.
+*
+*  Inputs: argc, argv - <file> [level] [tick], or make <file> [seed]
+*
+*  Returns: 0 if every level played back as recorded, and 1 otherwise.
+*/
+
+int replayCommand(int argc, char * argv[])
+{
+	if ( argc >= 2 && strcmp( argv[0], "make" ) == 0 )
+	{
+		return makeReplay( argv[1], (uint32)intArgument( argc, argv, 2, 1 ) );
+	}
+
+	if ( argc < 1 )
+	{
+		printf( "replay: usage is replay <file> [level] [tick] or replay make <file> [seed]\n" );
+		return 1;
+	}
+
+	Replay replay;
+
+	if ( replay.load( argv[0] ) == false )
+	{
+		printf( "replay: couldn't read %s\n", argv[0] );
+		return 1;
+	}
+
+	const SimConfig & config = replay.getConfig();
+
+	printf( "Arena %dx%d, radius %d, expansion %d, %d levels\n\n",
+		    config.arenaWidth, config.arenaHeight, config.bubbleRadius, config.popExpansion, replay.getLevelCount() );
+	printf( "  #  Level        Seed  Bubbles  Goal  Click tick     x     y  Keyframes  Recorded  Played  End tick\n" );
+
+	int failures = 0;
+	int ticks = 0;
+	double start = getSeconds();
+
+	for ( int i = 0; i < replay.getLevelCount(); i++ )
+	{
+		const ReplayLevel & r = replay.getLevel( i );
+
+		ReplayPlayer player;
+		player.start( config, r );
+
+		if ( r.clickTick >= 0 )
+		{
+			player.play( r.clickTick + REPLAY_MAX_RESOLVE_TICKS );
+		}
+
+		const LevelSimulation & sim = player.getSimulation();
+		int endTick = sim.getChainReactionDone() ? sim.getTickCount() : -1;
+
+		ticks += sim.getTickCount();
+
+		if ( sim.getLevelPoints() != r.points || endTick != r.endTick )
+		{
+			failures++;
+		}
+
+		printf( "%3d  %5d  %10u  %7d  %4d  %10d  %4d  %4d  %9d  %8d  %6d  %8d%s\n", i+1, r.level, r.seed, r.levelBubbles,
+			    r.goalPoints, r.clickTick, r.clickX, r.clickY, (int)r.keyframes.size(), r.points,
+			    sim.getLevelPoints(), endTick, sim.getLevelPoints() != r.points ? "  MISMATCH" : "" );
+	}
+
+	double seconds = getSeconds() - start;
+
+	printf( "\n%d ticks played back in %.3f s (%.0f ticks/s), %d mismatches\n",
+		    ticks, seconds, ticks / ( seconds > 0.0 ? seconds : 1e-9 ), failures );
+
+	if ( argc >= 3 )
+	{
+		int index = intArgument( argc, argv, 1, 1 ) - 1;
+		int tick = intArgument( argc, argv, 2, 0 );
+
+		if ( index < 0 || index >= replay.getLevelCount() || tick < 0 )
+		{
+			printf( "replay: there is no level %d, or the tick is negative.\n", index+1 );
+			return 1;
+		}
+
+		if ( seekLevel( replay, index, tick ) == false )
+		{
+			failures++;
+		}
+	}
+
+	return failures == 0 ? 0 : 1;
+}
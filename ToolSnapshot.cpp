@@ -0,0 +1,352 @@
+/**
+*  File:  ToolSnapshot.cpp
+*
+*  Description:  This file contains the snapshot command of PrismsTools, which
+*                measures the snapshots of Snapshot.h.
+*
+*                Usage:  PrismsTools snapshot [level] [games]
+*
+*                It plays random games of a level (default 12, 20 games) on
+*                GameSession, and keeps every frame two ways: as a GameSnapshot,
+*                just as the game keeps them for rewinding, and as a LevelSimulation
+*                state alone, as a long headless run would checkpoint itself.  It prints how much
+*                room each SnapshotHistory takes against keeping every frame
+*                whole, and how long it takes to get a frame back, then checks
+*                that every frame comes back exactly as it was.
+*
+*                It then plays a few campaigns recorded to a Replay, as the game
+*                records them, rewinding each level past its click the way
+*                holding Backspace does and clicking somewhere else.  Each replay
+*                must then be accepted by ReplayValidator, and each of its
+*                keyframes must match the level played back to that frame, so
+*                nothing from the abandoned timeline is left in it.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "GameSession.h"
+#include "ReplayValidator.h"
+#include <stdio.h>
+
+const int SNAPSHOT_MAX_TICKS = 100000;     // Safety limit.  A real chain reaction ends long before this.
+const int SNAPSHOT_REWIND_CAMPAIGNS = 4;   // Campaigns played with rewinding.
+const int SNAPSHOT_REWIND_TICKS = 30;      // How long after the click the level is rewound.
+const int SNAPSHOT_MAX_LEVELS = 1000;      // A campaign is given up after this many levels, retries included.
+
+/**
+*  Function: checkKeyframes(const Replay & replay)
+*
+*  Purpose: This function plays back every level of a replay and checks that
+*           each keyframe is the state the level plays back to at that frame.
+*
+*  Inputs: replay - The replay.
+*
+*  Returns: The number of keyframes that don't match.
+*/
+
+static int checkKeyframes(const Replay & replay)
+{
+	int failures = 0;
+	vector <uint8> state;
+	ReplayPlayer player;
+
+	for ( int i = 0; i < replay.getLevelCount(); i++ )
+	{
+		const ReplayLevel & r = replay.getLevel( i );
+
+		player.start( replay.getConfig(), r );
+
+		for ( int k = 0; k < (int)r.keyframes.size(); k++ )
+		{
+			while ( player.getSimulation().getTickCount() < r.keyframes[k].tick )
+			{
+				player.step();
+			}
+
+			state.clear();
+
+			ByteWriter writer( state );
+			player.getSimulation().saveState( writer );
+
+			if ( state != r.keyframes[k].state )
+			{
+				failures++;
+			}
+		}
+	}
+
+	return failures;
+}
+
+/**
+*  Function: checkRewind(uint32 seed, int & rewinds)
+*
+*  Purpose: This function plays campaigns on a GameSession recording to a Replay,
+*           with a bot that presses each button straight away and clicks at
+*           random in the first second of each level.  Half a second after the
+*           click, the level is stepped back a frame at a time with rewind(),
+*           as the game does while Backspace is held, to a frame at or before
+*           the click, and the bot clicks again somewhere else.  Each campaign
+*           won is validated with the campaign seed it was started on.
+*
+*  Inputs: seed - Picks the campaigns.
+*          rewinds - Set to the number of levels rewound past their click.
+*
+*  Returns: The number of campaigns turned down, or whose keyframes don't match.
+*/
+
+static int checkRewind(uint32 seed, int & rewinds)
+{
+	SimRandom random( seed );
+	GameSession session;
+	Replay replay;
+	Replay loaded;
+	ReplayValidator validator;
+	ReplayVerdict verdict;
+	SnapshotHistory history;
+	GameSnapshot snapshot;
+	vector <uint8> bytes;
+	int failures = 0;
+
+	session.setReplay( & replay );
+	rewinds = 0;
+
+	for ( int c = 0; c < SNAPSHOT_REWIND_CAMPAIGNS; c++ )
+	{
+		uint32 campaignSeed = (uint32)random.next( 0x7fffffff );
+
+		replay.clear();
+		session.start( campaignSeed );
+
+		for ( int played = 0; played < SNAPSHOT_MAX_LEVELS && session.getScreen() != SCREEN_WON_GAME; played++ )
+		{
+			session.retry();
+			session.play();
+			history.clear();
+
+			int clickTick = random.next( REFRESH_RATE );
+			int clickX = random.next( SCREEN_WIDTH-1 );
+			int clickY = random.next( SCREEN_HEIGHT-1 );
+			int rewindTick = random.next( clickTick );
+			bool rewound = false;
+
+			while ( session.getScreen() == SCREEN_PLAYING )
+			{
+				int tick = session.getSimulation().getTickCount();
+
+				if ( rewound == false && tick == clickTick + SNAPSHOT_REWIND_TICKS )
+				{
+					while ( history.getCount() > rewindTick )
+					{
+						int frame = history.getCount() - 1;
+
+						if ( history.get( frame, bytes ) == false ||
+							 readGameSnapshot( & bytes[0], (int)bytes.size(), snapshot ) == false ||
+							 session.rewind( snapshot ) == false )
+						{
+							failures++;
+							break;
+						}
+
+						history.truncate( frame );
+					}
+
+					rewound = true;
+					rewinds++;
+
+					clickTick = rewindTick + random.next( REFRESH_RATE );
+					clickX = random.next( SCREEN_WIDTH-1 );
+					clickY = random.next( SCREEN_HEIGHT-1 );
+					continue;
+				}
+
+				session.capture( snapshot );
+				writeGameSnapshot( snapshot, bytes );
+				history.push( bytes );
+
+				if ( tick == clickTick )
+				{
+					session.click( clickX, clickY );
+				}
+
+				session.tick();
+			}
+		}
+
+		if ( session.getScreen() != SCREEN_WON_GAME )
+		{
+			continue;  // The bot gave up, so there is no whole campaign to validate.
+		}
+
+		bytes.clear();
+		replay.write( bytes );
+		validator.validate( & bytes[0], (int)bytes.size(), campaignSeed, verdict );
+
+		if ( verdict.reason != VERDICT_ACCEPTED ||
+			 loaded.read( & bytes[0], (int)bytes.size() ) == false || checkKeyframes( loaded ) != 0 )
+		{
+			printf( "Campaign %u turned down after rewinding: %s at entry %d (level %d)\n",
+				    campaignSeed, getVerdictName( verdict.reason ), verdict.entry, verdict.level );
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+/**
+*  Function: snapshotCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the snapshot command.
+*
+*  Inputs: argc, argv - [level] [games]
+*
+*  Returns: 0 if every frame came back exactly, and 1 otherwise.
+*/
+
+int snapshotCommand(int argc, char * argv[])
+{
+	int level = intArgument( argc, argv, 0, LEVELS );
+	int games = intArgument( argc, argv, 1, 20 );
+
+	if ( level < 1 || level > LEVELS || games < 1 )
+	{
+		printf( "snapshot: level must be 1-%d and games at least 1.\n", LEVELS );
+		return 1;
+	}
+
+	SimRandom random( (uint32)level );
+
+	double wholeBytes[2] = { 0.0, 0.0 };  // [0] game snapshots, [1] simulation states.
+	double historyBytes[2] = { 0.0, 0.0 };
+	double restoreSeconds[2] = { 0.0, 0.0 };
+	int frames = 0;
+	int failures = 0;
+
+	for ( int g = 0; g < games; g++ )
+	{
+		GameSession session;
+		session.setConfig( SimConfig(), LEVEL_BUBBLES[level-1] );  // Every level of the session has this level's bubbles.
+		session.start( (uint32)random.next( 0x7fffffff ) );
+		session.play();
+
+		int clickTick = random.next( REFRESH_RATE );
+		int clickX = random.next( SCREEN_WIDTH-1 );
+		int clickY = random.next( SCREEN_HEIGHT-1 );
+
+		SnapshotHistory history[2];
+		vector < vector <uint8> > whole[2];
+		GameSnapshot snapshot;
+
+		while ( session.getScreen() == SCREEN_PLAYING && session.getSimulation().getTickCount() < SNAPSHOT_MAX_TICKS )
+		{
+			whole[0].resize( whole[0].size() + 1 );
+			whole[1].resize( whole[1].size() + 1 );
+
+			session.capture( snapshot );
+			writeGameSnapshot( snapshot, whole[0].back() );
+
+			ByteWriter writer( whole[1].back() );
+			session.getSimulation().saveState( writer );
+
+			for ( int k = 0; k < 2; k++ )
+			{
+				history[k].push( whole[k].back() );
+				wholeBytes[k] += (double)whole[k].back().size();
+			}
+
+			if ( session.getSimulation().getTickCount() == clickTick )
+			{
+				session.click( clickX, clickY );
+			}
+
+			session.tick();
+		}
+
+		frames += (int)whole[0].size();
+
+		for ( int k = 0; k < 2; k++ )
+		{
+			historyBytes[k] += (double)history[k].getByteCount();
+
+			vector <uint8> state;
+			vector <uint8> again;
+			GameSession restored;
+			double start = getSeconds();
+
+			for ( int i = 0; i < history[k].getCount(); i++ )
+			{
+				if ( history[k].get( i, state ) == false )
+				{
+					failures++;
+					continue;
+				}
+
+				if ( k == 0 )
+				{
+					if ( readGameSnapshot( & state[0], (int)state.size(), snapshot ) == false ||
+						 restored.restore( snapshot ) == false )
+					{
+						failures++;
+					}
+				}
+				else
+				{
+					LevelSimulation restoredLevel;
+					ByteReader reader( & state[0], (int)state.size() );
+
+					if ( restoredLevel.loadState( reader ) == false )
+					{
+						failures++;
+					}
+				}
+			}
+
+			restoreSeconds[k] += getSeconds() - start;
+
+			for ( int i = 0; i < history[k].getCount(); i++ )
+			{
+				if ( history[k].get( i, state ) == false || state != whole[k][i] )
+				{
+					failures++;
+				}
+				else if ( k == 0 )  // A restored session must capture the same snapshot again.
+				{
+					readGameSnapshot( & state[0], (int)state.size(), snapshot );
+					restored.restore( snapshot );
+					restored.capture( snapshot );
+					writeGameSnapshot( snapshot, again );
+
+					if ( again != state )
+					{
+						failures++;
+					}
+				}
+			}
+		}
+	}
+
+	printf( "Level %d, %d bubbles, %d games, %d frames\n\n", level, LEVEL_BUBBLES[level-1], games, frames );
+	printf( "                    Whole (bytes/frame)  History (bytes/frame)  Saved  Restore (us)\n" );
+
+	const char * names[2] = { "Game snapshot", "Simulation state" };
+
+	for ( int k = 0; k < 2; k++ )
+	{
+		printf( "%-18s  %19.0f  %21.0f  %4.0f%%  %12.2f\n", names[k], wholeBytes[k] / frames, historyBytes[k] / frames,
+			    100.0 * ( 1.0 - historyBytes[k] / wholeBytes[k] ), restoreSeconds[k] * 1e6 / frames );
+	}
+
+	printf( "\nFrames that didn't come back exactly: %d\n", failures );
+
+	int rewinds = 0;
+	int rejected = checkRewind( (uint32)level, rewinds );
+
+	printf( "Replays turned down after rewinding past the click (%d campaigns, %d levels rewound): %d\n",
+		    SNAPSHOT_REWIND_CAMPAIGNS, rewinds, rejected );
+
+	return failures == 0 && rejected == 0 ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/**
+*  File:  ToolStress.cpp
+*
+*  Description:  This file contains the stress command of PrismsTools.  It plays
+*                levels much bigger than the game's, with 1000, 10000, 100000, ...
+*                bubbles in an arena of any size, and prints how long each step
+*                of a frame takes as the number of bubbles grows.  The levels run
+*                on a WorkerPool, which also sorts the bubbles into a grid for the
+*                collision test.
+*
+*                Usage:  PrismsTools stress [bubbles] [arena] [ticks] [threads] [radius] [expansion]
+*
+*                bubbles is the most bubbles to try (default 1000000).  arena is the
+*                width and height of the arena (default 10000).  Each level is
+*                clicked in the middle and played for ticks frames (default 60).
+*                threads defaults to one per processor.  radius and expansion
+*                default to the game's 12 and 40.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "Simulation.h"
+#include <stdio.h>
+
+/**
+*  Function: stressLevel(WorkerPool & pool, const SimConfig & config, int bubbles, int ticks)
+*
+*  Purpose: This function plays one stress level and prints a line with the
+*           average time per frame spent in each step.
+*
+*  Inputs: pool - The threads to play on.
+*          config - The arena and bubble sizes.
+*          bubbles - The number of bubbles.
+*          ticks - The number of frames to play.
+*/
+
+static void stressLevel(WorkerPool & pool, const SimConfig & config, int bubbles, int ticks)
+{
+	LevelSimulation sim;
+	sim.setConfig( config );
+	sim.setWorkerPool( & pool );
+
+	double start = getSeconds();
+
+	sim.generate( (uint32)bubbles, bubbles );
+	sim.click( config.arenaWidth/2, config.arenaHeight/2 );
+
+	double generateSeconds = getSeconds() - start;
+
+	double phaseSeconds[SIM_PHASE_COUNT];
+
+	for ( int i = 0; i < SIM_PHASE_COUNT; i++ )
+	{
+		phaseSeconds[i] = 0.0;
+	}
+
+	for ( int i = 0; i < ticks; i++ )
+	{
+		sim.tick( phaseSeconds );
+	}
+
+	double total = 0.0;
+
+	printf( "%9d  %9d  %9.1f", bubbles, sim.getLevelPoints(), generateSeconds * 1000.0 );
+
+	for ( int i = 0; i < SIM_PHASE_COUNT; i++ )
+	{
+		printf( "  %9.3f", phaseSeconds[i] * 1000.0 / ticks );
+		total += phaseSeconds[i];
+	}
+
+	printf( "  %9.3f\n", total * 1000.0 / ticks );
+}
+
+/**
+*  Function: stressCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the stress command.
+*
+*  Inputs: argc, argv - [bubbles] [arena] [ticks] [threads] [radius] [expansion]
+*
+*  Returns: 0, or 1 if the arguments are no good.
+*/
+
+int stressCommand(int argc, char * argv[])
+{
+	int maxBubbles = intArgument( argc, argv, 0, 1000000 );
+	int arena = intArgument( argc, argv, 1, 10000 );
+	int ticks = intArgument( argc, argv, 2, 60 );
+	int threads = intArgument( argc, argv, 3, 0 );
+
+	SimConfig config;
+	config.arenaWidth = arena;
+	config.arenaHeight = arena;
+	config.bubbleRadius = intArgument( argc, argv, 4, BUBBLE_RADIUS );
+	config.popExpansion = intArgument( argc, argv, 5, POP_EXPANSION );
+
+	if ( maxBubbles < 1 || ticks < 1 || threads < 0 || config.valid() == false )
+	{
+		printf( "stress: bubbles and ticks must be at least 1, and the arena must be\n"
+			    "at least 41 units wider than a bubble and no more than 30000.\n" );
+		return 1;
+	}
+
+	WorkerPool pool( threads );
+
+	printf( "Arena %dx%d, radius %d, expansion %d, %d ticks, %d threads\n",
+		    config.arenaWidth, config.arenaHeight, config.bubbleRadius, config.popExpansion, ticks, pool.getThreadCount() );
+	printf( "Times are milliseconds per tick, except for the layout.\n\n" );
+	printf( "  Bubbles     Popped  Layout ms" );
+
+	for ( int i = 0; i < SIM_PHASE_COUNT; i++ )
+	{
+		printf( "  %9s", SIM_PHASE_NAMES[i] );
+	}
+
+	printf( "      Total\n" );
+
+	int bubbles = maxBubbles < 1000 ? maxBubbles : 1000;
+
+	for ( ;; )
+	{
+		stressLevel( pool, config, bubbles, ticks );
+
+		if ( bubbles == maxBubbles )
+		{
+			break;
+		}
+
+		bubbles = bubbles <= maxBubbles / 10 ? bubbles * 10 : maxBubbles;
+	}
+
+	return 0;
+}
@@ -0,0 +1,153 @@
+/**
+*  File:  ToolThreads.cpp
+*
+*  Description:  This file contains the threads command of PrismsTools.  It plays
+*                one big level on a single thread, then again with WorkerPools of
+*                1, 2, 4, ... threads, and reports how long each run took and
+*                whether it finished in exactly the same state as the single
+*                threaded run.
+*
+*                Usage:  PrismsTools threads [bubbles] [ticks] [threads]
+*
+*                bubbles defaults to 10000 and ticks to 200.  threads is the most
+*                threads to try, and defaults to the number of processors.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "Simulation.h"
+#include <stdio.h>
+#include <string.h>  // For memcmp().
+
+/**
+*  Function: playLevel(LevelSimulation & sim, int bubbles, int ticks)
+*
+*  Purpose: This function lays out the test level, clicks in the middle of the
+*           screen and plays the given number of frames.
+*
+*  Inputs: sim - The level to play, with its worker pool already set.
+*          bubbles - The number of bubbles.
+*          ticks - The number of frames to play.
+*
+*  Returns: The time taken in seconds, not counting the layout.
+*/
+
+static double playLevel(LevelSimulation & sim, int bubbles, int ticks)
+{
+	sim.generate( 1, bubbles );
+	sim.click( SCREEN_WIDTH/2, SCREEN_HEIGHT/2 );
+
+	double start = getSeconds();
+
+	for ( int i = 0; i < ticks && sim.getChainReactionDone() == false; i++ )
+	{
+		sim.tick();
+	}
+
+	return getSeconds() - start;
+}
+
+/**
+*  Function: sameState(const LevelSimulation & a, const LevelSimulation & b)
+*
+*  Returns: True if the two levels are in exactly the same state, down to the
+*           last bit of every bubble's position.
+*/
+
+static bool sameState(const LevelSimulation & a, const LevelSimulation & b)
+{
+	if ( a.getBubbleCount() != b.getBubbleCount() ||
+		 a.getTickCount() != b.getTickCount() ||
+		 a.getCurrentPopping() != b.getCurrentPopping() ||
+		 a.getLevelPoints() != b.getLevelPoints() ||
+		 a.getChainReactionDone() != b.getChainReactionDone() )
+	{
+		return false;
+	}
+
+	for ( int i = 0; i < a.getBubbleCount(); i++ )
+	{
+		const SimBubble & p = a.getBubble( i );
+		const SimBubble & q = b.getBubble( i );
+
+		if ( memcmp( & p.x, & q.x, sizeof(float) ) != 0 ||
+			 memcmp( & p.y, & q.y, sizeof(float) ) != 0 ||
+			 memcmp( & p.stepX, & q.stepX, sizeof(float) ) != 0 ||
+			 memcmp( & p.stepY, & q.stepY, sizeof(float) ) != 0 ||
+			 p.centerX != q.centerX || p.centerY != q.centerY ||
+			 p.radius != q.radius || p.degrees != q.degrees ||
+			 p.holdCounter != q.holdCounter ||
+			 p.paused != q.paused || p.popping != q.popping ||
+			 p.expanding != q.expanding || p.holding != q.holding ||
+			 p.contracting != q.contracting )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+*  Function: threadsCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the threads command.
+*
+*  Inputs: argc, argv - [bubbles] [ticks] [threads]
+*
+*  Returns: 0 if every threaded run matched the single threaded one, and 1 otherwise.
+*/
+
+int threadsCommand(int argc, char * argv[])
+{
+	int bubbles = intArgument( argc, argv, 0, 10000 );
+	int ticks = intArgument( argc, argv, 1, 200 );
+	int maxThreads = intArgument( argc, argv, 2, getProcessorCount() );
+
+	if ( bubbles < 1 || ticks < 1 || maxThreads < 1 )
+	{
+		printf( "threads: bubbles, ticks and threads must all be at least 1.\n" );
+		return 1;
+	}
+
+	LevelSimulation reference;
+	double referenceSeconds = playLevel( reference, bubbles, ticks );
+
+	printf( "Bubbles %d, %d ticks played, %d points\n\n", bubbles, reference.getTickCount(), reference.getLevelPoints() );
+	printf( "Threads  Seconds  Speedup  Same state\n" );
+	printf( "   none  %7.3f  %6.2fx  -\n", referenceSeconds, 1.0 );
+
+	int failures = 0;
+	int threads = 1;
+
+	for ( ;; )
+	{
+		WorkerPool pool( threads );
+
+		LevelSimulation sim;
+		sim.setWorkerPool( & pool );
+
+		double seconds = playLevel( sim, bubbles, ticks );
+		bool same = sameState( reference, sim );
+
+		if ( same == false )
+		{
+			failures++;
+		}
+
+		printf( "%7d  %7.3f  %6.2fx  %s\n", threads, seconds,
+			    referenceSeconds / ( seconds > 0.0 ? seconds : 1e-9 ), same ? "yes" : "NO" );
+
+		if ( threads == maxThreads )
+		{
+			break;
+		}
+
+		threads = threads * 2 < maxThreads ? threads * 2 : maxThreads;  // Always finish with maxThreads itself.
+	}
+
+	return failures == 0 ? 0 : 1;
+}
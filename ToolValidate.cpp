@@ -0,0 +1,351 @@
+/**
+*  File:  ToolValidate.cpp
+*
+*  Description:  This file contains the validate command of PrismsTools, which
+*                checks a batch of replays submitted with scores (see
+*                ReplayValidator.h).
+*
+*                Usage:  PrismsTools validate <list> [verdicts] [threads]
+*                        PrismsTools validate make <list> [count] [seed]
+*
+*                list is a text file naming one replay file per line.  A name
+*                may be followed by a tab and the campaign seed the server
+*                issued for it, and the replay must then have that seed.  The
+*                replays are shared out between the threads (default one per
+*                processor), each mapped into memory rather than read, and
+*                validated.  One line is written to the verdicts file (default
+*                verdicts.txt) for each replay, in the order of the list:
+*
+*                    file <tab> verdict <tab> points <tab> level
+*
+*                where verdict is accepted or the reason it was turned down,
+*                points is the score played back, and level is the first level
+*                that failed (0 if none did).
+*
+*                validate make plays count (default 100) campaigns on GameSession
+*                with a bot clicking at random and retrying each lost level,
+*                records them the way the game does, and writes them out with a
+*                list, each with the campaign seed it was started on as if the
+*                server had issued it, to have something to validate.
+*
+*  Author:  jjobes
+*
+*  Last Update:  10/19/2026
+*/
+
+#include "PrismsTools.h"
+#include "GameSession.h"
+#include "ReplayValidator.h"
+#include <stdio.h>
+#include <stdlib.h>  // For strtoul().
+#include <string.h>  // For strcmp(), strchr() and strlen().
+#include <string>
+
+const int VALIDATE_CHUNK = 4;             // Replays per chunk handed to a worker.
+const int MAKE_MAX_LEVELS = 1000;         // The bot gives up on a campaign after this many levels, retries included.
+
+/**
+*  ValidateTask validates a range of the replays on a worker.
+*/
+
+class ValidateTask : public ParallelTask
+{
+private:
+	const vector <string> * files;
+	const vector <int64> * issuedSeeds;
+	vector <ReplayVerdict> * verdicts;
+	vector <ReplayValidator *> * validators;
+	vector <double> * mappedBytes;
+
+public:
+	ValidateTask(const vector <string> * fileNames, const vector <int64> * seeds, vector <ReplayVerdict> * results,
+		         vector <ReplayValidator *> * workerValidators, vector <double> * workerBytes)
+	{
+		files = fileNames;
+		issuedSeeds = seeds;
+		verdicts = results;
+		validators = workerValidators;
+		mappedBytes = workerBytes;
+	}
+
+	void run(int begin, int end, int worker)
+	{
+		MappedFile file;
+
+		for ( int i = begin; i < end; i++ )
+		{
+			ReplayVerdict & verdict = ( *verdicts )[i];
+
+			if ( file.open( ( *files )[i].c_str() ) == false || file.getSize() > 0x7fffffff )
+			{
+				( *validators )[worker]->validate( NULL, 0, verdict );
+				continue;
+			}
+
+			if ( ( *issuedSeeds )[i] >= 0 )
+			{
+				( *validators )[worker]->validate( file.getData(), (int)file.getSize(), (uint32)( *issuedSeeds )[i], verdict );
+			}
+			else
+			{
+				( *validators )[worker]->validate( file.getData(), (int)file.getSize(), verdict );
+			}
+
+			( *mappedBytes )[worker] += (double)file.getSize();
+		}
+	}
+};
+
+/**
+*  Function: readList(const char * fileName, vector <string> & files, vector <int64> & issuedSeeds)
+*
+*  Purpose: This function reads the list of replay files, one to a line, each
+*           with the campaign seed issued for it if there is one.  Blank lines
+*           are skipped.
+*
+*  Inputs: fileName - The list.
+*          files - Filled in with the names.
+*          issuedSeeds - Filled in with the seed for each name, or -1.
+*
+*  Returns: True if the list could be read.
+*/
+
+static bool readList(const char * fileName, vector <string> & files, vector <int64> & issuedSeeds)
+{
+	FILE * list = fopen( fileName, "r" );
+
+	if ( list == NULL )
+	{
+		return false;
+	}
+
+	char line[1024];
+
+	while ( fgets( line, sizeof(line), list ) != NULL )
+	{
+		int length = (int)strlen( line );
+
+		while ( length > 0 && ( line[length-1] == '\n' || line[length-1] == '\r' ) )
+		{
+			line[--length] = '\0';
+		}
+
+		if ( length == 0 )
+		{
+			continue;
+		}
+
+		char * tab = strchr( line, '\t' );
+		int64 seed = -1;
+
+		if ( tab != NULL )
+		{
+			*tab = '\0';
+			seed = (int64)strtoul( tab + 1, NULL, 10 );
+		}
+
+		files.push_back( line );
+		issuedSeeds.push_back( seed );
+	}
+
+	fclose( list );
+
+	return true;
+}
+
+/**
+*  Function: makeCampaigns(const char * listName, int count, uint32 seed)
+*
+*  Purpose: This function records campaigns for validating.  Each is played on a
+*           GameSession by a bot that presses each button straight away and
+*           clicks somewhere at random in the first second of each level, with
+*           the session recording to a Replay just as in the game.
+*
+*  Inputs: listName - The list to write.  The replays are written next to it.
+*          count - The number of campaigns.
+*          seed - Picks the campaigns.
+*
+*  Returns: 0, or 1 if a file couldn't be written.
+*/
+
+static int makeCampaigns(const char * listName, int count, uint32 seed)
+{
+	FILE * list = fopen( listName, "w" );
+
+	if ( list == NULL )
+	{
+		printf( "validate: couldn't write %s\n", listName );
+		return 1;
+	}
+
+	SimRandom random( seed );
+	GameSession session;
+	Replay replay;
+	int finished = 0;
+
+	session.setReplay( & replay );
+
+	for ( int c = 0; c < count; c++ )
+	{
+		uint32 campaignSeed = (uint32)random.next( 0x7fffffff );
+
+		replay.clear();
+		session.start( campaignSeed );
+
+		for ( int played = 0; played < MAKE_MAX_LEVELS && session.getScreen() != SCREEN_WON_GAME; played++ )
+		{
+			session.retry();
+			session.play();
+
+			int clickTick = random.next( REFRESH_RATE );
+			int clickX = random.next( SCREEN_WIDTH-1 );
+			int clickY = random.next( SCREEN_HEIGHT-1 );
+
+			while ( session.getScreen() == SCREEN_PLAYING )
+			{
+				if ( session.getSimulation().getTickCount() == clickTick )
+				{
+					session.click( clickX, clickY );
+				}
+
+				session.tick();
+			}
+		}
+
+		if ( session.getScreen() == SCREEN_WON_GAME )
+		{
+			finished++;
+		}
+
+		char fileName[1024];
+		sprintf( fileName, "%.1000s.%05d.replay", listName, c );
+
+		if ( replay.save( fileName ) == false )
+		{
+			printf( "validate: couldn't write %s\n", fileName );
+			fclose( list );
+			return 1;
+		}
+
+		fprintf( list, "%s\t%u\n", fileName, campaignSeed );
+	}
+
+	fclose( list );
+
+	printf( "Recorded %d campaigns (%d won) to %s\n", count, finished, listName );
+
+	return 0;
+}
+
+/**
+*  Function: validateCommand(int argc, char * argv[])
+*
+*  Purpose: This function runs the validate command.
+*
+*  Inputs: argc, argv - <list> [verdicts] [threads], or make <list> [count] [seed]
+*
+*  Returns: 0 if every replay was validated (whatever the verdicts), and 1 if
+*           the list or the verdicts couldn't be read or written.
+*/
+
+int validateCommand(int argc, char * argv[])
+{
+	if ( argc >= 2 && strcmp( argv[0], "make" ) == 0 )
+	{
+		return makeCampaigns( argv[1], intArgument( argc, argv, 2, 100 ), (uint32)intArgument( argc, argv, 3, 1 ) );
+	}
+
+	if ( argc < 1 )
+	{
+		printf( "validate: usage is validate <list> [verdicts] [threads] or validate make <list> [count] [seed]\n" );
+		return 1;
+	}
+
+	const char * verdictsName = argc >= 2 ? argv[1] : "verdicts.txt";
+	vector <string> files;
+	vector <int64> issuedSeeds;
+
+	if ( readList( argv[0], files, issuedSeeds ) == false )
+	{
+		printf( "validate: couldn't read %s\n", argv[0] );
+		return 1;
+	}
+
+	WorkerPool pool( intArgument( argc, argv, 2, 0 ) );
+	vector <ReplayValidator *> validators( pool.getThreadCount() );
+	vector <double> mappedBytes( pool.getThreadCount(), 0.0 );
+	vector <ReplayVerdict> verdicts( files.size() );
+
+	for ( int w = 0; w < pool.getThreadCount(); w++ )
+	{
+		validators[w] = new ReplayValidator;
+	}
+
+	ValidateTask task( & files, & issuedSeeds, & verdicts, & validators, & mappedBytes );
+
+	double start = getSeconds();
+	pool.parallelFor( (int)files.size(), VALIDATE_CHUNK, task );
+	double seconds = getSeconds() - start;
+
+	for ( int w = 0; w < pool.getThreadCount(); w++ )
+	{
+		delete validators[w];
+	}
+
+	FILE * output = fopen( verdictsName, "w" );
+
+	if ( output == NULL )
+	{
+		printf( "validate: couldn't write %s\n", verdictsName );
+		return 1;
+	}
+
+	int reasons[VERDICT_INCOMPLETE + 1] = { 0 };
+	double levels = 0.0;
+	double ticks = 0.0;
+	double bytes = 0.0;
+
+	for ( int i = 0; i < (int)files.size(); i++ )
+	{
+		const ReplayVerdict & verdict = verdicts[i];
+
+		fprintf( output, "%s\t%s\t%d\t%d\n", files[i].c_str(), getVerdictName( verdict.reason ), verdict.totalPoints,
+			     verdict.reason == VERDICT_ACCEPTED ? 0 : verdict.level );
+
+		reasons[verdict.reason]++;
+		levels += verdict.levelsPlayed;
+		ticks += (double)verdict.ticks;
+	}
+
+	for ( int w = 0; w < pool.getThreadCount(); w++ )
+	{
+		bytes += mappedBytes[w];
+	}
+
+	bool written = ferror( output ) == 0;
+
+	if ( fclose( output ) != 0 || written == false )
+	{
+		printf( "validate: couldn't write %s\n", verdictsName );
+		return 1;
+	}
+
+	if ( seconds <= 0.0 )
+	{
+		seconds = 1e-9;
+	}
+
+	printf( "%d replays (%.1f MB mapped) on %d threads in %.3f s\n\n", (int)files.size(), bytes / 1e6,
+		    pool.getThreadCount(), seconds );
+
+	for ( int r = VERDICT_ACCEPTED; r <= VERDICT_INCOMPLETE; r++ )
+	{
+		printf( "%-11s %d\n", getVerdictName( (VerdictReason)r ), reasons[r] );
+	}
+
+	printf( "\n%.0f replays per minute, %.0f levels and %.0f ticks played back per second\n",
+		    files.size() * 60.0 / seconds, levels / seconds, ticks / seconds );
+	printf( "Verdicts written to %s\n", verdictsName );
+
+	return 0;
+}
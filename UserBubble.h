@@ -3,12 +3,13 @@
 *                                                                                            
 *  Description:	 This header file is the class definition for the UserBubble class,         
 *                which extends the BubbleSprite class.  A single UserBubble object
-*                is created in Prisms.cpp when the user first clicks the mouse button
-*                on the screen.  This object is then loaded into the bubbles vector.
+*                is created in FrontEnd.h once the user's first click has created the
+*                user bubble in the level.  This object is then loaded into the bubbles
+*                vector.
 *                                                                                            
 *  Author:  jjobes                                                                   
 *																							  
-*  Last Update:  6/20/2013																	  
+*  Last Update:  10/19/2026																	  
 */
 
 #ifndef USER_BUBBLE_H
@@ -16,11 +17,60 @@
 
 #include "BubbleSprite.h"
 
-class UserBubble : public BubbleSprite
+template <class Platform>
+class UserBubble : public BubbleSprite<Platform>
 {
 public:
-	UserBubble(int cX, int cY, int r, char * bubbleFileName, int imgID, int sprtID, char * noteFileName, int sndID);
+	UserBubble(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID);
 	~UserBubble();
 };
 
-#endif
\ No newline at end of file
+/**
+*  Function: UserBubble(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID)
+*
+*  Purpose: This is the constructor for the UserBubble class.  It is called
+*           from createBubbleSprite() in FrontEnd.h once the level has created
+*           the user bubble.  The incoming values are all passed up to the
+*           BubbleSprite constructor.
+*
+*  Inputs: p - The backend the bubble is drawn with.
+*          cX - The x-coordinate of the mouse pointer's location when the user clicks the mouse.
+*          cY - The y-coordinate of the mouse pointer's location when the user clicks the mouse.
+*          r - The radius that is passed in (12).
+*          bubbleImage - The user bubble's image.
+*          imgID - The image ID to assign to this image resource.
+*          sprtID - The sprite ID to assign to the sprite that is created.
+*          noteSound - The sound that is played when the user clicks the mouse.
+*          sndID - The sound ID to assign to this sound resource.
+*/
+
+template <class Platform>
+UserBubble<Platform>::UserBubble(Platform & p, int cX, int cY, int r, MediaAsset bubbleImage, int imgID, int sprtID, MediaAsset noteSound, int sndID)
+          : BubbleSprite<Platform>(p, cX, cY, r, bubbleImage, imgID, sprtID)
+{
+	this->display( this->getCenterX(), this->getCenterY() );  // Create initial sprite.
+
+	this->setOffsetToCenter();
+
+	this->setPopSound( noteSound );
+
+	this->setPopSoundID( sndID );
+
+	this->loadPopSound( this->getPopSound(), this->getPopSoundID() );
+}
+
+/**
+*  Function: ~UserBubble()
+*
+*  Purpose: This is the destructor for the UserBubble class.  It
+*           automatically calls the destructor of its base class
+*           (BubbleSprite).
+*/
+
+template <class Platform>
+UserBubble<Platform>::~UserBubble()
+{
+	// Automatically calls the destructor of the base class (BubbleSprite).
+}
+
+#endif